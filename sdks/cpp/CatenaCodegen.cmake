@@ -29,6 +29,7 @@ cmake_minimum_required(VERSION 3.20)
 # . OUT_DIR (Optional) the directory that the generated files will be placed in, defaults to the current binary directory
 # . HDR_OUT_VAR (Optional) the variable to store the generated header file
 # . SRC_OUT_VAR (Optional) the variable to store the generated source file
+# . ATOMIC_PARAMS (Optional) oids of top level INT32, FLOAT32 or STRING params to back with lock-free AtomicValue cells
 #
 # Returns:
 #  ${HDR_OUT_VAR} the location of the generated header file
@@ -38,7 +39,7 @@ function(generate_catena_device)
     
     set(_options)
     set(_singleargs DEVICE_MODEL_JSON DEVICE_MODEL_YAML TARGET OUT_DIR HDR_OUT_VAR SRC_OUT_VAR)
-    set(_multiargs IMPORTED_PARAMS)
+    set(_multiargs IMPORTED_PARAMS ATOMIC_PARAMS)
 
     cmake_parse_arguments(generate_catena_device "${_options}" "${_singleargs}" "${_multiargs}" "${ARGN}")
 
@@ -49,6 +50,7 @@ function(generate_catena_device)
     set(_HDR_OUT_VAR ${generate_catena_device_HDR_OUT_VAR})
     set(_SRC_OUT_VAR ${generate_catena_device_SRC_OUT_VAR})
     set(_IMPORTED_PARAMS ${generate_catena_device_IMPORTED_PARAMS})
+    set(_ATOMIC_PARAMS ${generate_catena_device_ATOMIC_PARAMS})
 
     if(NOT DEFINED _TARGET AND (NOT DEFINED _HDR_OUT_VAR OR NOT DEFINED _SRC_OUT_VAR))
         message(SEND_ERROR "Error: generate_catena_device called without any targets or output variables")
@@ -79,6 +81,8 @@ function(generate_catena_device)
 
     get_filename_component(device_name ${_DEVICE_MODEL} NAME)
 
+    list(JOIN _ATOMIC_PARAMS "," _ATOMIC_PARAMS_ARG)
+
     set(HEADER ${device_name}.h)
     set(BODY ${device_name}.cpp)
 
@@ -91,7 +95,7 @@ function(generate_catena_device)
     add_custom_command(
         OUTPUT ${_OUT_DIR}/${HEADER}
             ${_OUT_DIR}/${BODY}
-        COMMAND ${NODE} ${CATENA_CODEGEN}/codegen.js --quiet cpp "${_DEVICE_MODEL}" --output ${_OUT_DIR}
+        COMMAND ${NODE} ${CATENA_CODEGEN}/codegen.js --quiet cpp "${_DEVICE_MODEL}" --output ${_OUT_DIR} --atomic-params "${_ATOMIC_PARAMS_ARG}"
         DEPENDS ${_DEVICE_MODEL} ${SCHEMA_FILES} ${CODEGEN_FILES} ${_IMPORTED_PARAMS}
         COMMENT "Generating ${HEADER} and ${BODY} from ${_DEVICE_MODEL}"
     )
@@ -0,0 +1,262 @@
+/*
+ * Copyright 2026 Ross Video Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file AtomicValue.h
+ * @brief Value cells that can be read without locking the device.
+ * @date 2026-10-16
+ * @copyright Copyright (c) 2026 Ross Video
+ *
+ * A top level INT32, FLOAT32 or STRING param can be backed by an
+ * AtomicValue instead of a plain value. Readers always see a whole value,
+ * either the one before or the one after a store, so serializing the param
+ * does not need IDevice::paramMutex(), and business logic can update it with
+ * a single store instead of locking the device.
+ *
+ * Only the value is atomic. Business logic that has to change several
+ * params together should still lock the device.
+ */
+
+#pragma once
+
+// common
+#include <Status.h>
+
+// std
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+
+namespace catena {
+namespace common {
+
+/**
+ * @brief A lock-free cell holding a scalar value.
+ *
+ * Backed by a std::atomic, so loads and stores are single instructions.
+ *
+ * @tparam T int32_t or float.
+ */
+template <typename T>
+class AtomicValue {
+    static_assert(std::is_arithmetic_v<T> && std::atomic<T>::is_always_lock_free,
+                  "AtomicValue only supports lock-free arithmetic types and std::string");
+  public:
+    using value_type = T;
+
+    /**
+     * @brief Constructs a cell holding T{}.
+     */
+    AtomicValue() : value_{T{}} {}
+    /**
+     * @brief Constructs a cell holding value.
+     */
+    AtomicValue(T value) : value_{value} {}
+
+    /**
+     * @brief AtomicValue is referenced by its ParamWithValue, so it can not
+     * be copied or moved.
+     */
+    AtomicValue(const AtomicValue&) = delete;
+    AtomicValue& operator=(const AtomicValue&) = delete;
+
+    /**
+     * @brief Returns a snapshot of the value.
+     */
+    T load() const { return value_.load(std::memory_order_acquire); }
+    /**
+     * @brief Replaces the value.
+     */
+    void store(T value) { value_.store(value, std::memory_order_release); }
+
+    /**
+     * @brief Replaces the value.
+     */
+    AtomicValue& operator=(T value) {
+        store(value);
+        return *this;
+    }
+    /**
+     * @brief Returns a snapshot of the value.
+     */
+    operator T() const { return load(); }
+
+  private:
+    std::atomic<T> value_;
+};
+
+/**
+ * @brief A lock-free cell holding a short string.
+ *
+ * The characters are kept in a fixed size buffer guarded by a sequence lock.
+ * A store makes the sequence odd, copies the characters in and makes it even
+ * again. A load copies the characters out and retries if the sequence was odd
+ * or changed while it was copying. Stores never wait on loads, and loads only
+ * spin while a store is in progress.
+ *
+ * Concurrent stores are serialized on the sequence, so they are safe but do
+ * spin on each other.
+ */
+template <>
+class AtomicValue<std::string> {
+  public:
+    using value_type = std::string;
+
+    /**
+     * @brief The longest string the cell can hold.
+     */
+    static constexpr std::size_t kCapacity = 64;
+
+    /**
+     * @brief Constructs a cell holding an empty string.
+     */
+    AtomicValue() = default;
+    /**
+     * @brief Constructs a cell holding value.
+     * @throws OUT_OF_RANGE if value is longer than kCapacity.
+     */
+    explicit AtomicValue(std::string_view value) { store(value); }
+    /**
+     * @brief Constructs a cell holding value.
+     * @throws OUT_OF_RANGE if value is longer than kCapacity.
+     */
+    explicit AtomicValue(const char* value) : AtomicValue(std::string_view{value}) {}
+
+    /**
+     * @brief AtomicValue is referenced by its ParamWithValue, so it can not
+     * be copied or moved.
+     */
+    AtomicValue(const AtomicValue&) = delete;
+    AtomicValue& operator=(const AtomicValue&) = delete;
+
+    /**
+     * @brief Returns a snapshot of the value.
+     */
+    std::string load() const {
+        std::array<std::uint64_t, kWords> words;
+        std::size_t length;
+        for (;;) {
+            std::uint64_t seq = seq_.load(std::memory_order_acquire);
+            if (seq & 1) {
+                std::this_thread::yield();
+                continue;
+            }
+            // Acquire loads keep the second read of the sequence after them
+            length = length_.load(std::memory_order_acquire);
+            for (std::size_t i = 0; i < kWords && i * sizeof(std::uint64_t) < length; ++i) {
+                words[i] = words_[i].load(std::memory_order_acquire);
+            }
+            if (seq_.load(std::memory_order_relaxed) == seq) {
+                break;
+            }
+        }
+        return std::string(reinterpret_cast<const char*>(words.data()), length);
+    }
+
+    /**
+     * @brief Replaces the value.
+     * @throws OUT_OF_RANGE if value is longer than kCapacity.
+     */
+    void store(std::string_view value) {
+        if (value.size() > kCapacity) {
+            throw catena::exception_with_status("String of length " + std::to_string(value.size()) +
+                " exceeds the capacity of its atomic value", catena::StatusCode::OUT_OF_RANGE);
+        }
+        std::array<std::uint64_t, kWords> words{};
+        std::memcpy(words.data(), value.data(), value.size());
+        // Make the sequence odd, waiting out any other store
+        std::uint64_t seq = seq_.load(std::memory_order_relaxed);
+        do {
+            while (seq & 1) {
+                std::this_thread::yield();
+                seq = seq_.load(std::memory_order_relaxed);
+            }
+        } while (!seq_.compare_exchange_weak(seq, seq + 1, std::memory_order_acquire, std::memory_order_relaxed));
+        // Release stores make a reader that sees them also see the odd sequence
+        length_.store(value.size(), std::memory_order_release);
+        for (std::size_t i = 0; i < kWords && i * sizeof(std::uint64_t) < value.size(); ++i) {
+            words_[i].store(words[i], std::memory_order_release);
+        }
+        seq_.store(seq + 2, std::memory_order_release);
+    }
+
+    /**
+     * @brief Replaces the value.
+     * @throws OUT_OF_RANGE if value is longer than kCapacity.
+     */
+    AtomicValue& operator=(std::string_view value) {
+        store(value);
+        return *this;
+    }
+    /**
+     * @brief Returns a snapshot of the value.
+     */
+    operator std::string() const { return load(); }
+
+    /**
+     * @brief Returns the length of the value.
+     */
+    std::size_t size() const { return length_.load(std::memory_order_acquire); }
+
+  private:
+    static constexpr std::size_t kWords = (kCapacity + sizeof(std::uint64_t) - 1) / sizeof(std::uint64_t);
+
+    /**
+     * @brief Odd while a store is in progress.
+     */
+    std::atomic<std::uint64_t> seq_{0};
+    /**
+     * @brief The length of the value.
+     */
+    std::atomic<std::size_t> length_{0};
+    /**
+     * @brief The value's characters, packed into words so that each can be
+     * copied atomically.
+     */
+    std::array<std::atomic<std::uint64_t>, kWords> words_{};
+};
+
+/**
+ * @brief Trait to check if a type is an AtomicValue.
+ */
+template <typename T>
+struct is_atomic_value : std::false_type {};
+template <typename T>
+struct is_atomic_value<AtomicValue<T>> : std::true_type {};
+template <typename T>
+inline constexpr bool is_atomic_value_v = is_atomic_value<T>::value;
+
+} // namespace common
+} // namespace catena
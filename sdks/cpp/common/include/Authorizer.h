@@ -46,6 +46,7 @@
 #include <IAuthorizer.h>
 
 #include <jwt-cpp/jwt.h>
+#include <cstdint>
 #include <functional>
 #include <set>
 
@@ -64,7 +65,7 @@ namespace common {
 /**
  * @brief Class for handling authorization information.
  * 
- * This class takes a valid JWS token and extracts the "scope" and "exp" claims
+ * This class takes a valid JWS token and extracts the "scope", "exp" and "sub" claims
  * to later check client access.
  * The actual authentication portion of the JWS token is handled externally and
  * the class just assumes that the token is good when it recieves it.
@@ -75,6 +76,10 @@ class Authorizer : public IAuthorizer {
      * @brief The scopes of the object
      */
     using ClientScopes = std::set<std::string>;
+    /**
+     * @brief Bitmask of Scopes_e values, one bit per value.
+     */
+    using ScopeMask = uint32_t;
     /**
      * @brief Special Authorizer object that disables authorization
      */
@@ -110,6 +115,13 @@ class Authorizer : public IAuthorizer {
      */
     virtual ~Authorizer() = default;
 
+    /**
+     * @brief Returns the bit of a scope in a ScopeMask.
+     * @param scope The scope, e.g. "st2138:mon".
+     * @return 0 if scope is not one of the Scopes_e values.
+     */
+    static ScopeMask scopeMask(const std::string& scope);
+
     /**
      * @brief Check if the client has read authorization for a param
      * @param param The param to check for authorization
@@ -170,18 +182,48 @@ class Authorizer : public IAuthorizer {
      * @brief Returns true if the JWS token is expired.
      */
     bool isExpired() const override;
+    /**
+     * @brief Returns a key shared by all authorizers which can read the same
+     * scopes.
+     *
+     * Params serialized for two authorizers with the same key are identical,
+     * which lets push updates be serialized once per key rather than once per
+     * client.
+     */
+    const std::string& readScopeKey() const { return readScopeKey_; }
+    /**
+     * @brief Returns the "sub" claim of the JWS token, which identifies the
+     * authenticated client. Empty if the token has none, and for
+     * kAuthzDisabled.
+     */
+    const std::string& subject() const { return subject_; }
 
   protected:
 	  /**
      * @brief Constructor for kAuthzDisabled authorizer. 
      */
-    Authorizer() : clientScopes_{{""}} {}
+    Authorizer() : clientScopes_{{""}}, readScopeKey_{"*"} {}
     /**
      * @brief Checks if the client has the specified authorization
      * @param scope The scope to check for authorization
      * @return true if the client has the specified authorization
      */
     bool hasAuthz_(const std::string& scope) const;
+    /**
+     * @brief Recomputes readScopes_ and writeScopes_ from clientScopes_.
+     */
+    void updateScopeMasks_();
+    /**
+     * @brief Finds the Scopes_e value of a scope.
+     * @param scope The scope to find.
+     * @param ans Set to the scope's value if found.
+     * @return false if scope is not one of the Scopes_e values.
+     */
+    static bool toScope_(const std::string& scope, Scopes_e& ans);
+    /**
+     * @brief Returns the bit of a Scopes_e value in a ScopeMask.
+     */
+    static ScopeMask scopeBit_(Scopes_e scope) { return ScopeMask{1} << static_cast<uint32_t>(scope); }
     /**
      * @brief The exp or expiry date field from the JWS token. 0 by default.
      */
@@ -190,6 +232,23 @@ class Authorizer : public IAuthorizer {
      * @brief Client scopes extracted from a valid JWS token.
      */
   	ClientScopes clientScopes_;
+    /**
+     * @brief The Scopes_e values the client can read, including those it
+     * can write.
+     */
+    ScopeMask readScopes_{0};
+    /**
+     * @brief The Scopes_e values the client can write.
+     */
+    ScopeMask writeScopes_{0};
+    /**
+     * @brief The sorted, space separated scopes the client can read.
+     */
+    std::string readScopeKey_;
+    /**
+     * @brief The sub or subject field from the JWS token.
+     */
+    std::string subject_;
 };
 
 } // namespace common
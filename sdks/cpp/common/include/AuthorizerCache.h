@@ -0,0 +1,135 @@
+/*
+ * Copyright 2026 Ross Video Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file AuthorizerCache.h
+ * @brief Cache of decoded Authorizers keyed by JWS token.
+ * @date 2026-10-16
+ * @copyright Copyright (c) 2026 Ross Video
+ */
+
+#pragma once
+
+// common
+#include <Authorizer.h>
+
+// std
+#include <cstddef>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+
+namespace catena {
+namespace common {
+
+/**
+ * @brief Least recently used cache of the Authorizers decoded from JWS
+ * tokens.
+ *
+ * Clients send the same token with every request until it expires, so the
+ * token is decoded once and its Authorizer shared by every request that
+ * sends it. Authorizers are immutable once constructed, so sharing them
+ * between threads is safe.
+ *
+ * Expired authorizers are never returned from the cache. A token that has
+ * expired is decoded again, and the caller sees isExpired() as before.
+ */
+class AuthorizerCache {
+  public:
+    /**
+     * @brief Returns the process wide cache, created on first use with room
+     * for config::authz_cache_size tokens.
+     */
+    static AuthorizerCache& instance();
+
+    /**
+     * @brief Constructor.
+     * @param capacity The number of tokens to cache. 0 disables caching.
+     */
+    explicit AuthorizerCache(std::size_t capacity) : capacity_{capacity} {}
+
+    /**
+     * @brief AuthorizerCache has no copy or move semantics.
+     */
+    AuthorizerCache(const AuthorizerCache&) = delete;
+    AuthorizerCache& operator=(const AuthorizerCache&) = delete;
+    AuthorizerCache(AuthorizerCache&&) = delete;
+    AuthorizerCache& operator=(AuthorizerCache&&) = delete;
+
+    /**
+     * @brief Returns the Authorizer for a JWS token, decoding it if it is
+     * not cached or its cached Authorizer has expired.
+     * @param jwsToken The client's JWS token.
+     * @return The token's Authorizer.
+     * @throw Throws an catena::exception_with_status UNAUTHENTICATED if the
+     * token can not be decoded. Tokens which fail to decode are not cached.
+     */
+    std::shared_ptr<Authorizer> get(const std::string& jwsToken);
+
+    /**
+     * @brief Returns the number of cached tokens.
+     */
+    std::size_t size() const;
+
+    /**
+     * @brief Removes every cached token.
+     */
+    void clear();
+
+  private:
+    /**
+     * @brief A token and its Authorizer, most recently used first.
+     */
+    using Entries = std::list<std::pair<std::string, std::shared_ptr<Authorizer>>>;
+
+    /**
+     * @brief The number of tokens to cache.
+     */
+    const std::size_t capacity_;
+    /**
+     * @brief Guards entries_ and index_.
+     */
+    mutable std::mutex mtx_;
+    /**
+     * @brief The cached tokens in order of use.
+     */
+    Entries entries_;
+    /**
+     * @brief Finds a token's entry. Keys view the tokens in entries_.
+     */
+    std::unordered_map<std::string_view, Entries::iterator> index_;
+};
+
+} // namespace common
+} // namespace catena
@@ -55,6 +55,7 @@
 #include <unordered_set>
 #include <initializer_list>
 #include <type_traits>
+#include <span>
 
 namespace catena {
 namespace common {
@@ -128,6 +129,41 @@ class ChoiceConstraint : public catena::common::IConstraint {
      */
     bool satisfied(const st2138::Value& src) const override;
 
+    /**
+     * @brief checks if an int satisfies the constraint
+     * @param src the int to check
+     * @return true if src is one of the choices
+     *
+     * Looks src up directly for INT_CHOICE, otherwise boxes it.
+     */
+    bool satisfied(int32_t src) const override {
+        if constexpr (std::is_same<T, int32_t>::value) {
+            return choices_.contains(src);
+        } else {
+            return IConstraint::satisfied(src);
+        }
+    }
+
+    /**
+     * @brief checks if every int in src satisfies the constraint
+     * @param src the ints to check
+     * @return true if all of src are among the choices
+     */
+    bool validate(std::span<const int32_t> src) const override {
+        if constexpr (std::is_same<T, int32_t>::value) {
+            for (int32_t i : src) {
+                if (!choices_.contains(i)) { return false; }
+            }
+            return true;
+        } else {
+            return IConstraint::validate(src);
+        }
+    }
+
+    // float overloads box the value, as IConstraint does
+    using IConstraint::satisfied;
+    using IConstraint::validate;
+
     /**
      * @brief Applies constraint to src and returns the constrained value.
      * @param src A catena::Value to apply the constraint to.
@@ -39,6 +39,8 @@
  * @copyright Copyright (c) 2026 Ross Video
  */
 
+#pragma once
+
  #include <string>
  #include <cstdint>
  #include <boost/program_options.hpp>
@@ -63,9 +65,20 @@ const std::string DASHBOARD_TLS_ENABLED_KEY = "dashboard_tls_enabled";
 const std::string DEFAULT_MAX_ARRAY_SIZE_KEY = "default_max_array_size";
 const std::string DEFAULT_TOTAL_ARRAY_SIZE_KEY = "default_total_array_size";
 const std::string MAX_CONNECTIONS_KEY = "max_connections";
+const std::string UPDATE_QUEUE_DEPTH_KEY = "update_queue_depth";
+const std::string UPDATE_QUEUE_OVERFLOW_KEY = "update_queue_overflow";
+const std::string PUSH_UPDATE_WORKERS_KEY = "push_update_workers";
+const std::string SERIALIZER_WORKERS_KEY = "serializer_workers";
+const std::string COMMAND_WORKERS_KEY = "command_workers";
+const std::string GRPC_THREADS_KEY = "grpc_threads";
+const std::string REST_THREADS_KEY = "rest_threads";
+const std::string REST_HANDLER_THREADS_KEY = "rest_handler_threads";
+const std::string REST_WRITE_TIMEOUT_KEY = "rest_write_timeout";
 const std::string PRIVATE_CA_KEY = "private_ca";
 const std::string MUTUAL_AUTHC_KEY = "mutual_authc";
 const std::string AUTHZ_KEY = "authz";
+const std::string AUTHZ_CACHE_SIZE_KEY = "authz_cache_size";
+const std::string ARENA_POOL_SIZE_KEY = "arena_pool_size";
 const std::string SILENT_KEY = "silent";
 const std::string HELP_KEY = "help";
 const std::string LOG_LEVEL_KEY = "log_level";
@@ -91,8 +104,19 @@ const std::string HOSTNAME_DEFAULT = "0.0.0.0";
 const uint16_t PORT_DEFAULT = 6254;
 const uint16_t DASHBOARD_PORT_DEFAULT = 8080;
 const bool DASHBOARD_TLS_ENABLED_DEFAULT = false;
+const uint32_t UPDATE_QUEUE_DEPTH_DEFAULT = 1024;
+const std::string UPDATE_QUEUE_OVERFLOW_DEFAULT = "drop_oldest";
+const uint32_t PUSH_UPDATE_WORKERS_DEFAULT = 0;
+const uint32_t SERIALIZER_WORKERS_DEFAULT = 0;
+const uint32_t COMMAND_WORKERS_DEFAULT = 4;
+const uint32_t GRPC_THREADS_DEFAULT = 0;
+const uint32_t REST_THREADS_DEFAULT = 0;
+const uint32_t REST_HANDLER_THREADS_DEFAULT = 0;
+const uint32_t REST_WRITE_TIMEOUT_DEFAULT = 30;
 const bool PRIVATE_CA_DEFAULT = false;
 const bool AUTHZ_DEFAULT = false;
+const uint32_t AUTHZ_CACHE_SIZE_DEFAULT = 1024;
+const uint32_t ARENA_POOL_SIZE_DEFAULT = 64;
 const bool MUTUAL_AUTHC_DEFAULT = false;
 const bool SILENT_DEFAULT = false;
 const bool LOG_CONSOLE_DEFAULT = true;
@@ -141,6 +165,24 @@ inline uint32_t default_total_array_size = 0;
 
 inline uint32_t max_connections = DEFAULT_MAX_CONNECTIONS;
 
+inline uint32_t update_queue_depth = UPDATE_QUEUE_DEPTH_DEFAULT;
+
+inline std::string update_queue_overflow = UPDATE_QUEUE_OVERFLOW_DEFAULT;
+
+inline uint32_t push_update_workers = PUSH_UPDATE_WORKERS_DEFAULT;
+
+inline uint32_t serializer_workers = SERIALIZER_WORKERS_DEFAULT;
+
+inline uint32_t command_workers = COMMAND_WORKERS_DEFAULT;
+
+inline uint32_t grpc_threads = GRPC_THREADS_DEFAULT;
+
+inline uint32_t rest_threads = REST_THREADS_DEFAULT;
+
+inline uint32_t rest_handler_threads = REST_HANDLER_THREADS_DEFAULT;
+
+inline uint32_t rest_write_timeout = REST_WRITE_TIMEOUT_DEFAULT;
+
 inline std::string hostname = HOSTNAME_DEFAULT;
 
 inline uint16_t port = PORT_DEFAULT;
@@ -153,6 +195,10 @@ inline bool private_ca = PRIVATE_CA_DEFAULT;
 
 inline bool authz = AUTHZ_DEFAULT;
 
+inline uint32_t authz_cache_size = AUTHZ_CACHE_SIZE_DEFAULT;
+
+inline uint32_t arena_pool_size = ARENA_POOL_SIZE_DEFAULT;
+
 inline bool mutual_authc = MUTUAL_AUTHC_DEFAULT;
 
 inline bool silent = SILENT_DEFAULT;
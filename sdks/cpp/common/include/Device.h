@@ -53,7 +53,10 @@
 #include <Status.h>
 #include <IMenu.h>
 #include <IMenuGroup.h>
+#include <ParamCache.h>
+#include <rpc/ArenaPool.h>
 #include <rpc/IHeartbeat.h>
+#include <rpc/SerializerPool.h>
 
 // Interface
 #include <IDevice.h>
@@ -64,6 +67,8 @@
 #include <unordered_map>
 #include <string>
 #include <mutex>
+#include <shared_mutex>
+#include <array>
 #include <vector>
 #include <cassert>
 #include <type_traits>
@@ -77,6 +82,17 @@ namespace common {
  */
 constexpr uint32_t kDefaultMaxArrayLength{1024};
 
+/**
+ * @brief The number of params each of a SerializerPool's threads serializes
+ * per DeviceRequest batch.
+ */
+constexpr std::size_t kSerializerBatchPerThread{16};
+
+/**
+ * @brief The number of mutexes a device's top level params are spread across.
+ */
+constexpr std::size_t kParamMutexes{64};
+
 /**
  * @brief Implements the Device interface defined in the protobuf.
  */
@@ -91,7 +107,7 @@ class Device : public IDevice {
     /**
      * @brief Constructs a new Device object.
      */
-    Device() = default;
+    Device() { connectParamCache_(); }
 
     /**
      * @brief Constructs a new Device object.
@@ -99,9 +115,10 @@ class Device : public IDevice {
     Device(uint32_t slot, st2138::Device_DetailLevel detail_level, std::vector<std::string> access_scopes,
       std::string default_scope, bool multi_set_enabled, bool subscriptions)
       : slot_{slot}, detail_level_{detail_level}, access_scopes_{access_scopes},
-      default_scope_{default_scope}, multi_set_enabled_{multi_set_enabled},
+      default_scope_{default_scope}, default_scope_mask_{Authorizer::scopeMask(default_scope_)},
+      multi_set_enabled_{multi_set_enabled},
 	    subscriptions_{subscriptions}, default_max_length_{kDefaultMaxArrayLength},
-      default_total_length_{kDefaultMaxArrayLength}  {}
+      default_total_length_{kDefaultMaxArrayLength}  { connectParamCache_(); }
 
     /**
      * @brief Destroys the Device object.
@@ -112,7 +129,10 @@ class Device : public IDevice {
      * @brief Set the slot number of the device.
      * @param slot The device's new slot number.
      */
-    inline void slot(const uint32_t slot) override { slot_ = slot; }
+    inline void slot(const uint32_t slot) override {
+      slot_ = slot;
+      invalidateStaticComponents_();
+    }
 
     /**
      * @brief Get the slot number of the device
@@ -124,13 +144,32 @@ class Device : public IDevice {
      * @brief Gets the device's mutex.
      * @return The device's mutex.
      */
-    inline std::mutex& mutex() override { return mutex_; };
+    inline std::shared_mutex& mutex() override { return mutex_; };
+
+    /**
+     * @brief Gets the mutex guarding the value of the top level param that
+     * oid belongs to.
+     * @param oid The oid of a param or sub-param, with or without a leading
+     * solidus.
+     * @return The param's mutex.
+     */
+    std::shared_mutex& paramMutex(const std::string& oid) const override;
+
+    /**
+     * @brief Sets the pool which serializes params for DeviceRequests.
+     * @param pool The pool to use, or nullptr for SerializerPool::instance().
+     * The pool must outlive the device's serializers.
+     */
+    inline void serializerPool(SerializerPool* pool) { serializerPool_ = pool; }
 
     /**
      * @brief Sets the default detail level of the device.
      * @param detail_level the new default detail level of the device.
      */
-    inline void detail_level(const DetailLevel_e detail_level) override { detail_level_ = detail_level; }
+    inline void detail_level(const DetailLevel_e detail_level) override {
+      detail_level_ = detail_level;
+      invalidateStaticComponents_();
+    }
 
     /**
      * @brief Get the default detail level of the device.
@@ -142,6 +181,10 @@ class Device : public IDevice {
      * @return The device's default scope.
      */
     inline const std::string& getDefaultScope() const override { return default_scope_; }
+    /**
+     * @brief Gets the bit of the device's default scope.
+     */
+    uint32_t getDefaultScopeMask() const override { return default_scope_mask_; }
 
     /**
      * @brief Check if subscriptions are enabled for this device.
@@ -299,20 +342,22 @@ class Device : public IDevice {
 
             /**
              * @brief Called when the coroutine reaches a co_yield statement.
-             * It stores the yielded DeviceComponent then suspends the
-             * coroutine.
+             * It points deviceMessage at the yielded DeviceComponent, which
+             * the coroutine keeps alive until it is next resumed, then
+             * suspends the coroutine.
              */
-            inline std::suspend_always yield_value(st2138::DeviceComponent& component) { 
-              deviceMessage = component;
+            inline std::suspend_always yield_value(const st2138::DeviceComponent& component) { 
+              deviceMessage = &component;
               return {}; 
             }
 
             /**
              * @brief Called when the coroutine reaches a co_return statement.
-             * It stores the returned DeviceComponent. The coroutine is then
-             * set as done.
+             * It points deviceMessage at the returned DeviceComponent, which
+             * lives as long as the coroutine. The coroutine is then set as
+             * done.
              */
-            inline void return_value(st2138::DeviceComponent component) { this->deviceMessage = component; }
+            inline void return_value(const st2138::DeviceComponent& component) { deviceMessage = &component; }
 
             /**
              * @brief Called if an exception is thrown in the coroutine. It
@@ -335,7 +380,7 @@ class Device : public IDevice {
             /**
              * @brief The current deviceComponent returned by the coroutine.
              */
-            st2138::DeviceComponent deviceMessage{};
+            const st2138::DeviceComponent* deviceMessage = nullptr;
             /**
              * @brief The caught exception if one was thrown in the coroutine.
              */
@@ -380,12 +425,12 @@ class Device : public IDevice {
 
         /**
          * @brief Gets the next DeviceComponent to be serialized.
-         * @return The next DeviceComponent.
+         * @return The next DeviceComponent, valid until the next call.
          * 
          * If the coroutine is done and there are no more components to
          * serialize then an empty DeviceComponent is returned.
          */
-        st2138::DeviceComponent getNext() override;
+        const st2138::DeviceComponent& getNext() override;
 
       private:
         /**
@@ -409,19 +454,22 @@ class Device : public IDevice {
      * the whole device will be returned in one message.
      * @return A DeviceSerializer object.
      */
-    std::unique_ptr<IDeviceSerializer> getComponentSerializer(const IAuthorizer& authz, const std::set<std::string>& subscribedOids, st2138::Device_DetailLevel dl, bool shallow = false) const override;
+    std::unique_ptr<IDeviceSerializer> getComponentSerializer(const IAuthorizer& authz, const SubscribedOids& subscribedOids, st2138::Device_DetailLevel dl, bool shallow = false) const override;
     /**
      * @brief This is a helper function for the shared IDevice function
      * getComponentSerializer to return a DeviceSerializer object. It can be
      * used on its own if calling from a Device object.
      * 
      * @param authz The authorizer object containing the scopes of the client
-     * @param subscribedOids The oids of the subscribed parameters
+     * @param subscribedOids The oids of the subscribed parameters, kept by the serializer
      * @param dl The detail level to retrieve information in.
      * @param shallow If true, the device will be returned in parts, otherwise
      * the whole device will be returned in one message
+     *
+     * getNext must be called with the device's mutex held shared. It takes
+     * each param's mutex itself while serializing the param.
      */
-    DeviceSerializer getDeviceSerializer(const IAuthorizer& authz, const std::set<std::string>& subscribedOids, st2138::Device_DetailLevel dl, bool shallow = false) const;
+    DeviceSerializer getDeviceSerializer(const IAuthorizer& authz, SubscribedOids subscribedOids, st2138::Device_DetailLevel dl, bool shallow = false) const;
     /**
      * @brief add an item to one of the collections owned by the device.
      * Overload for parameters and commands.
@@ -434,6 +482,7 @@ class Device : public IDevice {
             commands_[key] = item;
         } else {
             params_[key] = item;
+            paramCache_.invalidate("/" + key);
         }
     }
     /**
@@ -443,7 +492,10 @@ class Device : public IDevice {
      * @param key The item's unique key.
      * @param item The item to be added.
      */
-    void addItem(const std::string& key, IConstraint* item) override { constraints_[key] = item; }
+    void addItem(const std::string& key, IConstraint* item) override {
+        constraints_[key] = item;
+        invalidateStaticComponents_();
+    }
     /**
      * @brief add an item to one of the collections owned by the device.
      * Overload for menu groups.
@@ -451,7 +503,10 @@ class Device : public IDevice {
      * @param key The item's unique key
      * @param item The item to be added
      */
-    void addItem(const std::string& key, IMenuGroup* item) override { menu_groups_[key] = item; }
+    void addItem(const std::string& key, IMenuGroup* item) override {
+        menu_groups_[key] = item;
+        invalidateStaticComponents_();
+    }
     /**
      * @brief add an item to one of the collections owned by the device
      * Overload for language packs.
@@ -459,7 +514,10 @@ class Device : public IDevice {
      * @param key The item's unique key
      * @param item The item to be added
      */
-    void addItem(const std::string& key, ILanguagePack* item) override { language_packs_[key] = item; }
+    void addItem(const std::string& key, ILanguagePack* item) override {
+        language_packs_[key] = item;
+        invalidateStaticComponents_();
+    }
 
     /**
      * @brief Gets an item from one of the collections owned by the device
@@ -523,6 +581,8 @@ class Device : public IDevice {
      * @param ans The exception_with_status to return.
      * @param authz The IAuthorizer to test with.
      * @returns True if the call is valid.
+     *
+     * Must be called with a ParamWriteLock held on src.
      */
     bool tryMultiSetValue(st2138::MultiSetValuePayload src, catena::exception_with_status& ans, const IAuthorizer& authz = Authorizer::kAuthzDisabled) override;
     
@@ -534,9 +594,23 @@ class Device : public IDevice {
      * @param src The MultiSetValuePayload to update the device with.
      * @param authz The Authroizer with the client's scopes.
      * @returns An exception_with_status with status set OK if successful.
+     *
+     * Must be called with a ParamWriteLock held on src.
      */
     catena::exception_with_status commitMultiSetValue(st2138::MultiSetValuePayload src, const IAuthorizer& authz) override;
 
+    /**
+     * @brief Validates and commits a MultiSetValuePayload in one pass.
+     * Each oid is parsed and resolved once; the handles used to validate
+     * are the ones committed through.
+     * @param src The MultiSetValuePayload to update the device with.
+     * @param authz The Authroizer with the client's scopes.
+     * @returns An exception_with_status with status set OK if successful.
+     *
+     * Must be called with a ParamWriteLock held on src.
+     */
+    catena::exception_with_status multiSetValue(const st2138::MultiSetValuePayload& src, const IAuthorizer& authz) override;
+
     /**
      * @brief Deserialize a protobuf value object into the parameter value
      * pointed to by jptr.
@@ -559,9 +633,23 @@ class Device : public IDevice {
      * @param authz The IAuthorizer to test read permission with.
      * @return An exception_with_status with status set OK if successful,
      * otherwise an error.
+     *
+     * Must be called with a ParamReadLock held on jptr.
      */
     catena::exception_with_status getValue(const std::string& jptr, st2138::Value& value, const IAuthorizer& authz = Authorizer::kAuthzDisabled) const override;
 
+    /**
+     * @brief Serialize the parameter value straight to JSON.
+     * @param jptr Json pointer to the part of the device model to serialize.
+     * @param dst the string to append to.
+     * @param authz The IAuthorizer to test read permission with.
+     * @return An exception_with_status with status set OK if successful,
+     * otherwise an error.
+     *
+     * Must be called with a ParamReadLock held on jptr.
+     */
+    catena::exception_with_status getValueJson(const std::string& jptr, std::string& dst, const IAuthorizer& authz = Authorizer::kAuthzDisabled) const override;
+
     /**
      * @brief Check if a parameter should be sent based on detail level and
      * authorization.
@@ -611,6 +699,16 @@ class Device : public IDevice {
      */
      vdk::signal<void(const std::string&, const IAuthorizer*)>& getDeleteAssetRequest() override { return deleteAssetRequest_; }
 
+    /**
+     * @brief Gets the device's cache of resolved parameter handles.
+     *
+     * The cache is disabled until its capacity is set, e.g.
+     * dm.paramCache().capacity(4096). Its stats() report hit and miss
+     * counts for sizing.
+     * @return The device's ParamCache.
+     */
+    ParamCache& paramCache() { return paramCache_; }
+
   protected:
     /**
      * @brief The heartbeat object. starts as null, and is created when
@@ -707,6 +805,10 @@ class Device : public IDevice {
      * @brief The device's default scope for parameters.
      */
     std::string default_scope_;
+    /**
+     * @brief The bit of default_scope_, or 0 if it is not a Scopes_e value.
+     */
+    uint32_t default_scope_mask_{0};
     /**
      * @brief Flag to enable/disable setting the value of more than one
      * parameter at a time.
@@ -729,7 +831,182 @@ class Device : public IDevice {
     /**
      * @brief The device's mutex.
      */
-    mutable std::mutex mutex_;
+    mutable std::shared_mutex mutex_;
+    /**
+     * @brief The mutexes guarding param values, shared by top level params
+     * with the same hash.
+     */
+    mutable std::array<std::shared_mutex, kParamMutexes> paramMutexes_;
+    /**
+     * @brief Cache of resolved parameter handles keyed by fqoid.
+     * Mutable as lookups populate it from const accessors.
+     */
+    mutable ParamCache paramCache_;
+
+    /**
+     * @brief The components of a DeviceRequest that depend on neither the
+     * client nor any param value, built once and shared by every serializer.
+     */
+    struct StaticComponents {
+        /**
+         * @brief The device info sent first, including its menu groups.
+         */
+        st2138::DeviceComponent device;
+        /**
+         * @brief One component per menu.
+         */
+        std::vector<st2138::DeviceComponent> menus;
+        /**
+         * @brief One component per language pack.
+         */
+        std::vector<st2138::DeviceComponent> languagePacks;
+        /**
+         * @brief One component per shared constraint.
+         */
+        std::vector<st2138::DeviceComponent> constraints;
+    };
+    /**
+     * @brief The device's static components, or nullptr if they need to be
+     * rebuilt. Serializers keep their own reference, so dropping it never
+     * affects a DeviceRequest already in progress.
+     */
+    mutable std::shared_ptr<const StaticComponents> staticCache_;
+    /**
+     * @brief Guards staticCache_, which DeviceRequests sharing the device's
+     * mutex may build concurrently.
+     */
+    mutable std::mutex staticMtx_;
+
+    /**
+     * @brief Gets the device's static components, building them if a
+     * change to the device has invalidated them.
+     *
+     * Menus and shared constraints are assumed not to change once added to
+     * the device. Must be called with the device's mutex held, shared or
+     * exclusively.
+     */
+    std::shared_ptr<const StaticComponents> staticComponents_() const;
+    /**
+     * @brief The coroutine behind getDeviceSerializer.
+     *
+     * components and the arenas are parameters rather than locals so that
+     * they live as long as the coroutine, keeping the component returned by
+     * co_return alive after the body has finished.
+     *
+     * @param components Null, set to staticComponents_() on the first
+     * getNext so that they are read with the device's mutex held.
+     * @param even The arena for the 1st, 3rd, ... batches of params and
+     * commands.
+     * @param odd The arena for the 2nd, 4th, ... batches.
+     */
+    DeviceSerializer serializeComponents_(const IAuthorizer& authz, SubscribedOids subscribedOids, st2138::Device_DetailLevel dl,
+                                          std::shared_ptr<const StaticComponents> components, ArenaPool::Lease even, ArenaPool::Lease odd) const;
+    /**
+     * @brief Drops the device's static components so that the next
+     * DeviceRequest rebuilds them.
+     */
+    inline void invalidateStaticComponents_() {
+      std::lock_guard lock(staticMtx_);
+      staticCache_.reset();
+    }
+
+    /**
+     * @brief The pool serializing params for DeviceRequests, nullptr for
+     * SerializerPool::instance().
+     */
+    SerializerPool* serializerPool_ = nullptr;
+
+    /**
+     * @brief Walks the device's parameter tree to resolve path, caching the
+     * result if the param cache is enabled.
+     * @param path The path to the parameter, starting at a top level param.
+     * @param status Will contain an error message if the parameter does not
+     * exist.
+     * @param authz The authorizer object to test read permission with.
+     * @return a unique pointer to the parameter, or nullptr if it does not
+     * exist.
+     */
+    std::unique_ptr<IParam> resolveParam_(catena::common::Path& path, catena::exception_with_status& status, const IAuthorizer& authz) const;
+
+    /**
+     * @brief Resolves jptr for getValue and getValueJson and calls read with
+     * the param.
+     * @param jptr Json pointer to the param to read.
+     * @param authz The IAuthorizer to test read permission with.
+     * @param read Serializes the param, returning its status.
+     * @return The status of read, or why jptr could not be resolved.
+     */
+    template <typename F>
+    catena::exception_with_status readValue_(const std::string& jptr, const IAuthorizer& authz, F&& read) const;
+
+    /**
+     * @brief Drops cached handles below oid after its value was replaced.
+     * Scalars own no storage that a cached handle could refer to, so they are
+     * skipped.
+     * @param oid The fully qualified oid of the replaced value.
+     * @param param The param that was replaced, or nullptr if unknown.
+     */
+    void invalidateParamCache_(const std::string& oid, const IParam* param);
+
+    /**
+     * @brief One resolved target of a MultiSetValuePayload.
+     */
+    struct SetTarget_ {
+        const st2138::SetValuePayload* payload; /*< the request for this target */
+        Path path; /*< the walked path to param */
+        Path::Index index = Path::kNone; /*< trailing index of the oid, if any */
+        std::unique_ptr<IParam> param = nullptr; /*< the target, or its array if index is set */
+    };
+
+    /**
+     * @brief Parses payload's oid and resolves the param it targets, or the
+     * array holding it if the oid ends in an index.
+     * @param payload The request to resolve.
+     * @param ans Will contain an error message if the param does not exist.
+     * @param authz The authorizer object to test read permission with.
+     * @return The target. Its param is nullptr if it could not be resolved.
+     */
+    SetTarget_ resolveSetTarget_(const st2138::SetValuePayload& payload, catena::exception_with_status& ans, const IAuthorizer& authz) const;
+
+    /**
+     * @brief Checks the multi-set rules and validates every request in src.
+     * @param src The MultiSetValuePayload to validate.
+     * @param plan Receives a target for each request resolved, including the
+     * one that failed validation.
+     * @param ans Will contain an error message if the payload is invalid.
+     * @param authz The IAuthorizer to test with.
+     * @returns True if the payload is valid.
+     *
+     * The caller must call resetValidate on every target in plan.
+     */
+    bool planMultiSetValue_(const st2138::MultiSetValuePayload& src, std::vector<SetTarget_>& plan, catena::exception_with_status& ans, const IAuthorizer& authz) const;
+
+    /**
+     * @brief Sets a resolved target's value and emits valueSetByClient.
+     * @param target The target to commit.
+     * @param authz The Authroizer with the client's scopes.
+     * @returns An exception_with_status with status set OK if successful.
+     */
+    catena::exception_with_status commitSetTarget_(SetTarget_& target, const IAuthorizer& authz);
+
+    /**
+     * @brief Checks that no oid in src is a prefix of another, other than
+     * appends to the same array.
+     * @param src The MultiSetValuePayload to check.
+     * @param ans Will contain an error message naming an overlapping pair.
+     * @returns True if no requests overlap.
+     *
+     * The oids are sorted so that each one follows all of its prefixes, then
+     * walked with a stack of the prefixes of the current oid: O(n log n)
+     * rather than comparing every pair.
+     */
+    static bool checkNoOverlap_(const st2138::MultiSetValuePayload& src, catena::exception_with_status& ans);
+
+    /**
+     * @brief Keeps the param cache coherent with values replaced by the
+     * business logic. Called from the constructors.
+     */
+    void connectParamCache_();
 };
 
 }  // namespace common
@@ -43,6 +43,10 @@
 #include "interface/param.pb.h"
 #include "interface/constraint.pb.h" 
 
+// std
+#include <cstdint>
+#include <span>
+
 namespace catena {
 namespace common {
 
@@ -74,6 +78,84 @@ public:
      */
     virtual st2138::Value apply(const st2138::Value& src) const = 0;
 
+    /**
+     * @brief Checks if the constraint is satisfied by an int.
+     * @param src The int to check the constraint against.
+     * @return True if the constraint is satisfied, false otherwise.
+     *
+     * The default implementation boxes src into a catena::Value.
+     */
+    virtual bool satisfied(int32_t src) const {
+        st2138::Value item;
+        item.set_int32_value(src);
+        return satisfied(item);
+    }
+
+    /**
+     * @brief Checks if the constraint is satisfied by a float.
+     * @param src The float to check the constraint against.
+     * @return True if the constraint is satisfied, false otherwise.
+     *
+     * The default implementation boxes src into a catena::Value.
+     */
+    virtual bool satisfied(float src) const {
+        st2138::Value item;
+        item.set_float32_value(src);
+        return satisfied(item);
+    }
+
+    /**
+     * @brief Checks if the constraint is satisfied by every int in src.
+     * @param src The ints to check the constraint against.
+     * @return True if the constraint is satisfied by all of them.
+     */
+    virtual bool validate(std::span<const int32_t> src) const {
+        for (int32_t i : src) {
+            if (!satisfied(i)) { return false; }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Checks if the constraint is satisfied by every float in src.
+     * @param src The floats to check the constraint against.
+     * @return True if the constraint is satisfied by all of them.
+     */
+    virtual bool validate(std::span<const float> src) const {
+        for (float f : src) {
+            if (!satisfied(f)) { return false; }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Applies the constraint to each int in values, in place.
+     * @param values The ints to constrain.
+     *
+     * The default implementation calls apply on each boxed value.
+     */
+    virtual void clamp(std::span<int32_t> values) const {
+        st2138::Value item;
+        for (int32_t& i : values) {
+            item.set_int32_value(i);
+            i = apply(item).int32_value();
+        }
+    }
+
+    /**
+     * @brief Applies the constraint to each float in values, in place.
+     * @param values The floats to constrain.
+     *
+     * The default implementation calls apply on each boxed value.
+     */
+    virtual void clamp(std::span<float> values) const {
+        st2138::Value item;
+        for (float& f : values) {
+            item.set_float32_value(f);
+            f = apply(item).float32_value();
+        }
+    }
+
     /**
      * @brief Checks if the constraint is a range constraint.
      * @return True if the constraint is a range constraint, False otherwise.
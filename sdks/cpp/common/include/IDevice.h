@@ -43,6 +43,7 @@
 #include <IParam.h>
 #include <ILanguagePack.h>
 #include <Status.h>
+#include <SubscribedOids.h>
 #include <vdk/signals.h>
 
 // protobuf interface
@@ -52,6 +53,7 @@
 #include <vector>
 #include <coroutine>
 #include <mutex>
+#include <shared_mutex>
 
 namespace catena {
 namespace common {
@@ -90,9 +92,31 @@ class IDevice {
 
     /**
      * @brief Gets the device's mutex.
+     *
+     * Holding it shared lets the device's structure, its language packs and
+     * the set of params, be read. Param values are guarded by their
+     * paramMutex, which must also be held to read or write them. Holding it
+     * exclusively guards everything, and is what business logic updating
+     * params and language packs does.
+     *
+     * Locks are always taken in this order, see ParamLock.h:
+     *  1. the device's mutex,
+     *  2. param mutexes, in ascending address order,
+     *  3. the internal locks of ParamCache, SubscriptionManager, UpdateFanout
+     *     and Connect, which are never held while taking another.
+     *
      * @return The device's mutex.
      */
-    virtual inline std::mutex& mutex() = 0;
+    virtual inline std::shared_mutex& mutex() = 0;
+
+    /**
+     * @brief Gets the mutex guarding the value of the top level param that
+     * oid belongs to. Top level params share a fixed number of mutexes.
+     * @param oid The oid of a param or sub-param, with or without a leading
+     * solidus.
+     * @return The param's mutex.
+     */
+    virtual std::shared_mutex& paramMutex(const std::string& oid) const = 0;
 
     /**
      * @brief Sets the default detail level of the device.
@@ -110,6 +134,11 @@ class IDevice {
      * @return The device's default scope.
      */
     virtual inline const std::string& getDefaultScope() const = 0;
+    /**
+     * @brief Gets the bit of the device's default scope in an
+     * Authorizer::ScopeMask, or 0 if it must be checked by name.
+     */
+    virtual uint32_t getDefaultScopeMask() const { return Authorizer::scopeMask(getDefaultScope()); }
 
     /**
      * @brief Check if subscriptions are enabled for this device.
@@ -257,12 +286,14 @@ class IDevice {
 
         /**
          * @brief Gets the next DeviceComponent to be serialized.
-         * @return The next DeviceComponent.
+         * @return The next DeviceComponent, owned by the serializer and
+         * valid until the next call to getNext or the serializer's
+         * destruction.
          * 
          * If the coroutine is done and there are no more components to
          * serialize then an empty DeviceComponent is returned.
          */
-        virtual st2138::DeviceComponent getNext() = 0;
+        virtual const st2138::DeviceComponent& getNext() = 0;
     };
 
     /**
@@ -275,7 +306,7 @@ class IDevice {
      * the whole device will be returned in one message.
      * @return A DeviceSerializer object.
      */
-    virtual std::unique_ptr<IDeviceSerializer> getComponentSerializer(const IAuthorizer& authz, const std::set<std::string>& subscribedOids, st2138::Device_DetailLevel dl, bool shallow = false) const = 0;
+    virtual std::unique_ptr<IDeviceSerializer> getComponentSerializer(const IAuthorizer& authz, const SubscribedOids& subscribedOids, st2138::Device_DetailLevel dl, bool shallow = false) const = 0;
 
     /**
      * @brief add an item to one of the collections owned by the device.
@@ -371,6 +402,22 @@ class IDevice {
      */
     virtual catena::exception_with_status commitMultiSetValue (st2138::MultiSetValuePayload src, const IAuthorizer& authz) = 0;
 
+    /**
+     * @brief Validates and commits a MultiSetValuePayload in one call.
+     * The default implementation calls tryMultiSetValue followed by
+     * commitMultiSetValue.
+     * @param src The MultiSetValuePayload to update the device with.
+     * @param authz The Authroizer with the client's scopes.
+     * @returns An exception_with_status with status set OK if successful.
+     */
+    virtual catena::exception_with_status multiSetValue (const st2138::MultiSetValuePayload& src, const IAuthorizer& authz) {
+        catena::exception_with_status ans{"", catena::StatusCode::OK};
+        if (tryMultiSetValue(src, ans, authz)) {
+            ans = commitMultiSetValue(src, authz);
+        }
+        return ans;
+    }
+
     /**
      * @brief Deserialize a protobuf value object into the parameter value
      * pointed to by jptr.
@@ -392,6 +439,31 @@ class IDevice {
      */
     virtual catena::exception_with_status getValue (const std::string& jptr, st2138::Value& value, const IAuthorizer& authz = Authorizer::kAuthzDisabled) const = 0;
 
+    /**
+     * @brief Serialize the parameter value as JSON, in the proto3 JSON
+     * mapping of the value getValue produces.
+     * @param jptr Json pointer to the part of the device model to serialize.
+     * @param dst the string to append to. Left unchanged on error.
+     * @param authz The IAuthorizer to test read permission with.
+     * @return An exception_with_status with status set OK if successful,
+     * otherwise an error.
+     *
+     * The default goes through getValue.
+     */
+    virtual catena::exception_with_status getValueJson (const std::string& jptr, std::string& dst, const IAuthorizer& authz = Authorizer::kAuthzDisabled) const {
+        st2138::Value value;
+        catena::exception_with_status rc = getValue(jptr, value, authz);
+        if (rc.status == catena::StatusCode::OK) {
+            std::string json;
+            if (appendJson(json, value)) {
+                dst.append(json);
+            } else {
+                rc = catena::exception_with_status("Failed to convert value to JSON", catena::StatusCode::INTERNAL);
+            }
+        }
+        return rc;
+    }
+
     /**
      * @brief Check if a parameter should be sent based on detail level and
      * authorization.
@@ -42,6 +42,7 @@
 #include <Enums.h>
 #include <IConstraint.h>
 #include <IParamDescriptor.h>
+#include <JsonWriter.h>
 #include <Path.h>
 #include <Status.h>
 
@@ -98,6 +99,29 @@ class IParam {
      * @param authz The authorizer object to containing the client's scopes.
      */
     virtual catena::exception_with_status toProto(st2138::Value& dst, const IAuthorizer& authz) const = 0;
+
+    /**
+     * @brief Serializes the parameter value as JSON, in the proto3 JSON
+     * mapping of the value toProto produces.
+     *
+     * The default goes through toProto. ParamWithValue writes the JSON
+     * directly instead.
+     * @param dst The string to append to. Left unchanged on error.
+     * @param authz The authorizer object to containing the client's scopes.
+     */
+    virtual catena::exception_with_status toJson(std::string& dst, const IAuthorizer& authz) const {
+        st2138::Value value;
+        catena::exception_with_status rc = toProto(value, authz);
+        if (rc.status == catena::StatusCode::OK) {
+            std::string json;
+            if (appendJson(json, value)) {
+                dst.append(json);
+            } else {
+                rc = catena::exception_with_status("Failed to convert value to JSON", catena::StatusCode::INTERNAL);
+            }
+        }
+        return rc;
+    }
     
     /**
      * @brief Deserializes the parameter value from protobuf.
@@ -201,6 +225,12 @@ class IParam {
      */
     virtual const std::string& getScope() const = 0;
 
+    /**
+     * @brief Gets the bit of the parameter's access scope in an
+     * Authorizer::ScopeMask, or 0 if the scope must be checked by name.
+     */
+    virtual uint32_t getScopeMask() const { return 0; }
+
     /**
      * @brief Defines the parameter's command implementation.
      * @param commandImpl The new command implementation.
@@ -230,6 +260,12 @@ class IParam {
      * FLOAT32_ARRAY, STRING_ARRAY, STRUCT_ARRAY, or STRUCT_VARIANT_ARRAY).
      */
     virtual bool isArrayType() const = 0;
+    /**
+     * @brief Checks if the parameter's value can be read without holding
+     * IDevice::paramMutex().
+     * @return True if the parameter is backed by an AtomicValue.
+     */
+    virtual bool lockFreeReads() const = 0;
     /**
      * @brief Validates a setValue operation without changing the param's value.
      * @param value The value we want to set the param to.
@@ -46,6 +46,11 @@
 // protobuf interface
 #include <interface/param.pb.h>
 
+// std
+#include <span>
+#include <cstddef>
+#include <cstdint>
+
 namespace catena {
 namespace common {
 
@@ -137,6 +142,13 @@ class IParamDescriptor {
      */
     virtual const std::string& getScope() const = 0;
 
+    /**
+     * @brief get the bit of the parameter's access scope in an
+     * Authorizer::ScopeMask, or 0 if the scope is not one of the Scopes_e
+     * values and must be checked by name.
+     */
+    virtual uint32_t getScopeMask() const { return 0; }
+
     /**
      * @brief get the minimal set status of the parameter
      */
@@ -207,6 +219,22 @@ class IParamDescriptor {
      */
     virtual IParamDescriptor& getSubParam(const std::string& oid) const = 0;
 
+    /**
+     * @brief gets the paramDescriptors of several sub parameters at once
+     *
+     * Used by CatenaStruct serialization, which always asks for the same
+     * static list of field names, so implementations may cache the result
+     * against names.data(). The default implementation calls getSubParam
+     * for each name.
+     * @param names the oids of the sub parameters
+     * @param subParams receives the descriptors, in the same order as names
+     */
+    virtual void getSubParams(std::span<const char* const> names, std::span<IParamDescriptor*> subParams) const {
+        for (std::size_t i = 0; i < names.size() && i < subParams.size(); ++i) {
+            subParams[i] = &getSubParam(names[i]);
+        }
+    }
+
 
     /**
      * @brief return all sub parameters
@@ -38,9 +38,9 @@
  * @copyright Copyright © 2025 Ross Video Ltd
  */
 
-#include <set>
 #include <string>
 #include <IDevice.h>
+#include <SubscribedOids.h>
 #include <IParam.h>
 #include <Authorizer.h>
 
@@ -49,40 +49,79 @@ namespace common {
 
 /**
  * @brief Interface for managing parameter subscriptions in Catena
+ *
+ * Subscriptions are kept per scope. A scope is the set of subscriptions of
+ * one Connect, keyed by scopeKey() on the connection's id and the subject of
+ * the client's token (Authorizer::subject()). Requests made outside of a
+ * Connect, without a subject, share kSharedScope.
+ *
+ * A keyed scope only exists while its Connect has it open, so the
+ * subscriptions of a connection can only be changed while it is open.
  */
 class ISubscriptionManager {
   public:
     virtual ~ISubscriptionManager() = default;
 
+    /**
+     * @brief The key of the scope shared by all clients which do not
+     * identify themselves.
+     */
+    static inline const std::string kSharedScope = "";
+
+    /**
+     * @brief Returns the key of a connection's subscription scope.
+     *
+     * The connection id is namespaced under the subject, so a client can
+     * only reach the scopes of connections opened with its own token. The
+     * subject's length is prefixed to keep every pair of subject and id
+     * apart.
+     *
+     * @param subject The subject of the client's token, empty if it has none.
+     * @param connectionId The id of the client's Connect, empty for requests
+     * which do not name one.
+     * @return kSharedScope if both are empty.
+     */
+    static std::string scopeKey(const std::string& subject, const std::string& connectionId) {
+        if (subject.empty() && connectionId.empty()) {
+            return kSharedScope;
+        }
+        return std::to_string(subject.size()) + ":" + subject + connectionId;
+    }
+
     /**
      * @brief Add an OID subscription
      * @param oid The OID to subscribe to (can be either a unique OID like "/param" or a wildcard like "/param/*")
      * @param dm The device model to use 
      * @param rc The status code to return if the operation fails
      * @param authz The authorizer to use for checking permissions
-     * @return true if the subscription was added, false if it already existed
+     * @param scope The key of the client's subscription scope
+     * @return true if the subscription was added, false if it already
+     * existed, or with FAILED_PRECONDITION if no connection has the scope open
      */
-    virtual bool addSubscription(const std::string& oid, IDevice& dm, exception_with_status& rc, const IAuthorizer& authz = Authorizer::kAuthzDisabled) = 0;
+    virtual bool addSubscription(const std::string& oid, IDevice& dm, exception_with_status& rc, const IAuthorizer& authz = Authorizer::kAuthzDisabled, const std::string& scope = kSharedScope) = 0;
 
     /**
      * @brief Remove an OID subscription
      * @param oid The OID to unsubscribe from (can be either a unique OID or a wildcard like "/param/*")
      * @param dm The device model to use
      * @param rc The status code to return if the operation fails
-     * @return true if the subscription was removed, false if it didn't exist
+     * @param scope The key of the client's subscription scope
+     * @return true if the subscription was removed, false if it didn't exist,
+     * or with FAILED_PRECONDITION if no connection has the scope open
      */
-    virtual bool removeSubscription(const std::string& oid, const IDevice& dm, exception_with_status& rc) = 0;
+    virtual bool removeSubscription(const std::string& oid, const IDevice& dm, exception_with_status& rc, const std::string& scope = kSharedScope) = 0;
 
     /**
      * @brief Get all subscribed OIDs, including expanding wildcard subscriptions
      * @param dm The device model to use 
-     * @return A copy of the set of all subscribed OIDs
-     * 
-     * Since subManager does not expose its mutex, it is required to return a
-     * copy of the set in order to avoid race conditions in the async API
-     * calls.
+     * @param scope The key of the client's subscription scope
+     * @return A view of the current subscriptions which expands wildcards
+     * when it is iterated.
+     *
+     * The view holds on to the subscriptions as they were when it was
+     * created, so it is safe to use without locking in the async API calls.
      */
-    virtual std::set<std::string> getAllSubscribedOids(const IDevice& dm) = 0;
+    virtual SubscribedOids getAllSubscribedOids(const IDevice& dm, const std::string& scope = kSharedScope) = 0;
 
     /**
      * @brief Check if an OID is a wildcard subscription
@@ -95,9 +134,27 @@ class ISubscriptionManager {
      * @brief Check if an OID is subscribed to
      * @param dm The device model to use 
      * @param oid The OID to check
+     * @param scope The key of the client's subscription scope
      * @return true if the OID is already subscribed to
      */
-    virtual bool isSubscribed(const std::string& oid, const IDevice& dm) = 0;
+    virtual bool isSubscribed(const std::string& oid, const IDevice& dm, const std::string& scope = kSharedScope) = 0;
+
+    /**
+     * @brief Opens a connection's subscription scope, creating it if no other
+     * connection has it open.
+     * @param scope The key of the scope
+     *
+     * Each call must be matched by a call to closeScope().
+     */
+    virtual void openScope(const std::string& scope) = 0;
+
+    /**
+     * @brief Closes a connection's subscription scope. The scope and its
+     * subscriptions are dropped once its last connection closes it. The
+     * shared scope is never dropped.
+     * @param scope The key of the scope
+     */
+    virtual void closeScope(const std::string& scope) = 0;
 };
 
 } // namespace common
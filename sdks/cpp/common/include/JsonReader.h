@@ -0,0 +1,78 @@
+/*
+ * Copyright 2026 Ross Video Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file JsonReader.h
+ * @brief Parses values and set value requests from proto3 JSON without going
+ * through protobuf's reflection based parser.
+ * @date 2026-10-16
+ * @copyright Copyright (c) 2026 Ross Video
+ */
+
+#pragma once
+
+// protobuf interface
+#include <interface/param.pb.h>
+#include <interface/device.pb.h>
+
+// std
+#include <string_view>
+
+namespace catena {
+namespace common {
+
+/**
+ * @brief Parses src, in the proto3 JSON mapping, into dst.
+ *
+ * JSON in the form the REST API documents, and JsonWriter writes, is parsed
+ * in a single pass straight into dst. Anything else, such as proto field
+ * names, numbers in strings, null or malformed JSON, is handed to
+ * google::protobuf::util::JsonStringToMessage, so the result and whether
+ * src is accepted are always the same as JsonStringToMessage's. Documents
+ * nested deeper than protobuf allows are handed over too, and so rejected.
+ * @param src The JSON to parse.
+ * @param dst The value to parse into. Cleared first.
+ * @return false if src is not valid JSON for a st2138::Value.
+ */
+bool parseJson(std::string_view src, st2138::Value& dst);
+
+/**
+ * @brief Parses src, in the proto3 JSON mapping, into dst.
+ *
+ * The same as parseJson for a st2138::Value, for a whole multi set value
+ * request such as a preset recall.
+ * @param src The JSON to parse.
+ * @param dst The request to parse into. Cleared first.
+ * @return false if src is not valid JSON for a st2138::MultiSetValuePayload.
+ */
+bool parseJson(std::string_view src, st2138::MultiSetValuePayload& dst);
+
+} // namespace common
+} // namespace catena
@@ -0,0 +1,128 @@
+/*
+ * Copyright 2026 Ross Video Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file JsonWriter.h
+ * @brief Writes values and push updates as proto3 JSON without going through
+ * protobuf's reflection based printer.
+ * @date 2026-10-16
+ * @copyright Copyright (c) 2026 Ross Video
+ */
+
+#pragma once
+
+// protobuf interface
+#include <interface/param.pb.h>
+#include <interface/device.pb.h>
+
+// std
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace catena {
+namespace common {
+
+/**
+ * @brief Appends src to dst as a quoted JSON string.
+ *
+ * Escapes the same characters, in the same way, as the protobuf JSON
+ * printer.
+ * @param dst The string to append to.
+ * @param src The UTF-8 string to write.
+ * @return false if src is not valid UTF-8, which protobuf does not allow in
+ * string fields and the printer fails on. dst is then left partially
+ * written.
+ */
+bool appendJsonString(std::string& dst, std::string_view src);
+
+/**
+ * @brief Appends src to dst as a JSON number.
+ * @param dst The string to append to.
+ * @param src The integer to write.
+ */
+void appendJsonInt(std::string& dst, int64_t src);
+
+/**
+ * @brief Appends src to dst as the protobuf JSON printer writes a float.
+ *
+ * Uses the shortest of 6 or 9 significant digits that reads back as src.
+ * NaN and the infinities are written as the strings "NaN", "Infinity" and
+ * "-Infinity".
+ * @param dst The string to append to.
+ * @param src The float to write.
+ */
+void appendJsonFloat(std::string& dst, float src);
+
+/**
+ * @brief Appends src to dst in the proto3 JSON mapping, byte for byte the
+ * same as google::protobuf::util::MessageToJsonString with default options.
+ *
+ * The kinds of value params hold are written directly. Anything else, such
+ * as data payloads, is handed to the protobuf printer. Struct fields are
+ * written in the order of src's map, which is the order the printer uses
+ * for src.
+ * @param dst The string to append to.
+ * @param src The value to write.
+ * @return false if a string is not valid UTF-8 or the protobuf printer
+ * failed, in which case dst is left partially written.
+ */
+bool appendJson(std::string& dst, const st2138::Value& src);
+
+/**
+ * @brief Appends src to dst in the proto3 JSON mapping.
+ * @param dst The string to append to.
+ * @param src The struct value to write.
+ * @return false if appendJson failed for one of its fields.
+ */
+bool appendJson(std::string& dst, const st2138::StructValue& src);
+
+/**
+ * @brief Appends src to dst in the proto3 JSON mapping.
+ * @param dst The string to append to.
+ * @param src The struct variant value to write.
+ * @return false if appendJson failed for its type or value.
+ */
+bool appendJson(std::string& dst, const st2138::StructVariantValue& src);
+
+/**
+ * @brief Appends src to dst in the proto3 JSON mapping.
+ *
+ * Value updates are written directly. Other updates are handed to the
+ * protobuf printer.
+ * @param dst The string to append to.
+ * @param src The push update to write.
+ * @return false if appendJson failed for its oid or value, or the protobuf
+ * printer failed.
+ */
+bool appendJson(std::string& dst, const st2138::PushUpdates& src);
+
+} // namespace common
+} // namespace catena
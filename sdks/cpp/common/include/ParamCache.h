@@ -0,0 +1,206 @@
+#pragma once
+
+/*
+ * Copyright 2026 Ross Video Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file ParamCache.h
+ * @brief Per-device cache of resolved parameter handles keyed by fqoid.
+ * @date 2026-10-16
+ * @copyright Copyright © 2026 Ross Video Ltd
+ */
+
+// common
+#include <IParam.h>
+#include <IParamDescriptor.h>
+#include <IAuthorizer.h>
+
+// std
+#include <atomic>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace catena {
+namespace common {
+
+/**
+ * @brief Caches the result of walking a json pointer through a device's
+ * parameter tree.
+ *
+ * Each entry holds a shallow IParam handle that refers directly to the
+ * parameter's value and descriptor, plus the chain of descriptors that
+ * were crossed on the way down so that read authorization can be checked
+ * without re-walking the tree.
+ *
+ * Handles below an array element or a variant alternative refer to storage
+ * owned by their parent, so entries strictly below an oid must be
+ * invalidated whenever the value at that oid is replaced or resized. Device
+ * does this automatically for values set by clients and for values
+ * announced through getValueSetByServer(). Business logic that resizes
+ * arrays, or switches variant alternatives, without emitting that signal
+ * must call clear().
+ *
+ * The cache is disabled (capacity 0) until capacity() is set. Once full,
+ * inserting a new fqoid evicts the least recently used entry. find()
+ * returns a shallow copy of the cached handle, so it outlives the entry, but
+ * like any handle it refers to the param's storage and is only valid while
+ * the device's locks are held.
+ */
+class ParamCache {
+  public:
+    /**
+     * @brief Hit / miss counters, used to size the cache.
+     */
+    struct Stats {
+        uint64_t hits = 0;          /**< lookups served from the cache */
+        uint64_t misses = 0;        /**< lookups that had to walk the tree */
+        uint64_t invalidations = 0; /**< entries dropped by invalidate() */
+        uint64_t evictions = 0;     /**< entries dropped to make room for others */
+        std::size_t size = 0;       /**< number of entries currently cached */
+        std::size_t capacity = 0;   /**< maximum number of entries */
+    };
+
+    ParamCache() = default;
+    ParamCache(const ParamCache&) = delete;
+    ParamCache& operator=(const ParamCache&) = delete;
+
+    /**
+     * @brief Sets the maximum number of cached entries. A capacity of 0
+     * disables the cache and drops all entries, a smaller one evicts the
+     * least recently used entries until the rest fit.
+     * @param capacity The new capacity.
+     */
+    void capacity(std::size_t capacity);
+
+    /**
+     * @brief Gets the maximum number of cached entries.
+     */
+    std::size_t capacity() const { return capacity_.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Returns true if the cache is enabled.
+     */
+    bool enabled() const { return capacity() > 0; }
+
+    /**
+     * @brief Looks up the handle cached for fqoid.
+     *
+     * Counts a hit if the entry exists and the client may read every
+     * descriptor between the top level param and the cached one, otherwise
+     * counts a miss.
+     *
+     * @param fqoid The fully qualified oid, with leading solidus.
+     * @param authz The authorizer to test read permission with.
+     * @return A copy of the cached handle, or nullptr on a miss.
+     */
+    std::unique_ptr<IParam> find(const std::string& fqoid, const IAuthorizer& authz);
+
+    /**
+     * @brief Caches a handle for fqoid.
+     *
+     * The descriptor chain is derived from the top level param's descriptor
+     * by following the oid's segments. Nothing is cached if the chain can
+     * not be derived. If the cache is full, the least recently used entry is
+     * evicted to make room.
+     *
+     * @param fqoid The fully qualified oid, with leading solidus.
+     * @param topLevel The top level param the oid starts at.
+     * @param param The resolved param. A shallow copy is cached.
+     */
+    void insert(const std::string& fqoid, const IParam& topLevel, const IParam& param);
+
+    /**
+     * @brief Drops every entry strictly below oid.
+     *
+     * The entry for oid itself stays valid, its value was replaced in place.
+     *
+     * @param oid The fully qualified oid of the value that was replaced.
+     */
+    void invalidate(const std::string& oid);
+
+    /**
+     * @brief Drops every entry.
+     */
+    void clear();
+
+    /**
+     * @brief Gets a snapshot of the cache counters.
+     */
+    Stats stats() const;
+
+  private:
+    /**
+     * @brief A resolved parameter and the descriptors crossed to reach it.
+     */
+    struct Entry {
+        std::unique_ptr<IParam> handle;               /**< shallow copy of the resolved param */
+        std::vector<const IParamDescriptor*> chain;   /**< descriptors to test read authz on */
+        std::list<const std::string*>::iterator use;  /**< position in uses_ */
+    };
+
+    /**
+     * @brief Drops the least recently used entries until at most capacity
+     * are left. Must be called with mtx_ held.
+     * @param capacity The number of entries to keep.
+     */
+    void evict_(std::size_t capacity);
+
+    /**
+     * @brief Guards entries_ and uses_.
+     */
+    mutable std::mutex mtx_;
+    /**
+     * @brief Cached entries keyed by fqoid.
+     */
+    std::unordered_map<std::string, Entry> entries_;
+    /**
+     * @brief The keys of entries_, most recently used first.
+     */
+    std::list<const std::string*> uses_;
+    /**
+     * @brief Maximum number of entries, 0 disables the cache.
+     */
+    std::atomic<std::size_t> capacity_{0};
+    /**
+     * @brief Counters reported by stats().
+     */
+    std::atomic<uint64_t> hits_{0};
+    std::atomic<uint64_t> misses_{0};
+    std::atomic<uint64_t> invalidations_{0};
+    std::atomic<uint64_t> evictions_{0};
+};
+
+}  // namespace common
+}  // namespace catena
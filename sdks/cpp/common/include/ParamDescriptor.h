@@ -49,6 +49,10 @@
 #include <vector>
 #include <string>
 #include <unordered_map>
+#include <span>
+#include <mutex>
+#include <atomic>
+#include <memory>
 
 namespace catena {
 namespace common {
@@ -140,6 +144,10 @@ class ParamDescriptor : public IParamDescriptor {
         constraint_{constraint}, isCommand_{isCommand}, response_{response},dev_{dm},
         max_length_{max_length}, total_length_{total_length},
         precision_{precision}, minimal_set_{minimal_set}, parent_{parent} {
+      // Inherited scopes are resolved through the parent or device instead.
+      if (!scope_.empty()) {
+        scope_mask_ = Authorizer::scopeMask(scope_);
+      }
       setOid(oid);
       if (parent_ != nullptr) {
         parent_->addSubParam(oid, this);
@@ -198,6 +206,12 @@ class ParamDescriptor : public IParamDescriptor {
      */
     const std::string& getScope() const override;
 
+    /**
+     * @brief get the bit of the parameter's access scope, or 0 if it must be
+     * checked by name.
+     */
+    uint32_t getScopeMask() const override;
+
     /**
      * @brief get the minimal set status of the parameter
      */
@@ -270,6 +284,9 @@ class ParamDescriptor : public IParamDescriptor {
         throw std::runtime_error("Cannot add a null sub parameter to ParamDescriptor");
       } else {
         subParams_[oid] = item;
+        if (subParamCache_) {
+          subParamCache_->key.store(nullptr, std::memory_order_release);
+        }
       }
     }
 
@@ -284,6 +301,18 @@ class ParamDescriptor : public IParamDescriptor {
       return *subParams_.at(oid);
     }
 
+    /**
+     * @brief gets the paramDescriptors of several sub parameters at once
+     *
+     * The first call resolves the names and caches the result against
+     * names.data(), so later calls with the same static field list are
+     * a pointer compare and a copy. Other name lists fall back to
+     * getSubParam.
+     * @param names the oids of the sub parameters
+     * @param subParams receives the descriptors, in the same order as names
+     */
+    void getSubParams(std::span<const char* const> names, std::span<IParamDescriptor*> subParams) const override;
+
 
     /**
      * @brief return all sub parameters
@@ -438,10 +467,27 @@ class ParamDescriptor : public IParamDescriptor {
     PolyglotText name_;
     std::string widget_;
     std::string scope_;
+    /**
+     * @brief the bit of scope_, computed once so authorization checks don't
+     * look the scope up by name. 0 if scope_ is empty or not a Scopes_e value.
+     */
+    uint32_t scope_mask_{0};
     bool read_only_;
     bool stateless_;
 
     std::unordered_map<std::string, IParamDescriptor*> subParams_;
+
+    /**
+     * @brief resolved sub parameter table for getSubParams, keyed by the
+     * address of the field name list it was built from. Held by pointer
+     * so ParamDescriptor stays movable.
+     */
+    struct SubParamCache {
+        std::mutex mtx;
+        std::atomic<const char* const*> key{nullptr};
+        std::vector<IParamDescriptor*> table;
+    };
+    mutable std::unique_ptr<SubParamCache> subParamCache_ = std::make_unique<SubParamCache>();
     std::unordered_map<std::string, catena::common::IParam*> commands_;
     common::IConstraint* constraint_;
     uint32_t max_length_;
@@ -0,0 +1,145 @@
+/*
+ * Copyright 2026 Ross Video Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file ParamLock.h
+ * @brief Locks a device's params for reading or writing.
+ * @date 2026-10-16
+ * @copyright Copyright (c) 2026 Ross Video
+ *
+ * A device has two levels of locks:
+ *  - IDevice::mutex(), held shared by every RPC and exclusively by anything
+ *    changing the device's structure or language packs, or by business
+ *    logic that wants the whole device to itself.
+ *  - IDevice::paramMutex(), one per top level param (or shard of them),
+ *    held shared to read a param's value and exclusively to write it.
+ *
+ * So reads never block each other, and a write only waits for the reads
+ * and writes of the top level params it touches.
+ *
+ * Business logic may store to params backed by an AtomicValue without
+ * taking either lock, and push updates read them without locking.
+ *
+ * Lock order:
+ *  1. IDevice::mutex()
+ *  2. IDevice::paramMutex(), in ascending address order when taking more
+ *     than one. Readers hold one at a time.
+ *  3. Leaf locks: ParamCache, SubscriptionManager, UpdateFanout, Connect and
+ *     UpdateQueue. No other lock is taken while holding one of these.
+ *
+ * Signals like valueSetByClient are emitted with the writer's locks held, so
+ * their handlers must not lock the device. UpdateFanout hands them to worker
+ * threads, which take a ParamReadLock of their own.
+ */
+
+#pragma once
+
+// common
+#include <IDevice.h>
+
+// protobuf interface
+#include <interface/device.pb.h>
+
+// std
+#include <algorithm>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <vector>
+
+namespace catena {
+namespace common {
+
+/**
+ * @brief Holds the device's mutex shared and the mutex of one param shared,
+ * so that the param can be read.
+ */
+class ParamReadLock {
+  public:
+    /**
+     * @brief Locks oid's param for reading.
+     * @param dm The device.
+     * @param oid The oid of the param or sub-param to read.
+     */
+    ParamReadLock(IDevice& dm, const std::string& oid)
+        : device_{dm.mutex()}, param_{dm.paramMutex(oid)} {}
+
+  private:
+    /**
+     * @brief The device's mutex, held shared.
+     */
+    std::shared_lock<std::shared_mutex> device_;
+    /**
+     * @brief The param's mutex, held shared.
+     */
+    std::shared_lock<std::shared_mutex> param_;
+};
+
+/**
+ * @brief Holds the device's mutex shared and the mutexes of the params a
+ * MultiSetValuePayload writes to exclusively, so that they can be validated
+ * and set.
+ */
+class ParamWriteLock {
+  public:
+    /**
+     * @brief Locks every param src sets for writing.
+     * @param dm The device.
+     * @param src The payload to lock the params of.
+     */
+    ParamWriteLock(IDevice& dm, const st2138::MultiSetValuePayload& src)
+        : device_{dm.mutex()} {
+        std::vector<std::shared_mutex*> mutexes;
+        mutexes.reserve(src.values_size());
+        for (const st2138::SetValuePayload& setValuePayload : src.values()) {
+            mutexes.push_back(&dm.paramMutex(setValuePayload.oid()));
+        }
+        // Address order, locking each shared mutex only once
+        std::sort(mutexes.begin(), mutexes.end(), std::less<>());
+        mutexes.erase(std::unique(mutexes.begin(), mutexes.end()), mutexes.end());
+        params_.reserve(mutexes.size());
+        for (std::shared_mutex* mutex : mutexes) {
+            params_.emplace_back(*mutex);
+        }
+    }
+
+  private:
+    /**
+     * @brief The device's mutex, held shared.
+     */
+    std::shared_lock<std::shared_mutex> device_;
+    /**
+     * @brief The params' mutexes, held exclusively.
+     */
+    std::vector<std::unique_lock<std::shared_mutex>> params_;
+};
+
+} // namespace common
+} // namespace catena
@@ -74,11 +74,36 @@ class ParamVisitor : public IParamVisitor {
          * @brief Helper function to traverse parameters using a visitor
          * @param param The parameter to visit
          * @param path The path of the parameter
-         * @param device The device to visit
+         * @param device Unused, children are resolved through their parent
          * @param visitor The visitor to use
          * @param authz The authorizer to use
          */
         static void traverseParams(IParam* param, const std::string& path, const IDevice& device, IParamVisitor& visitor, const IAuthorizer& authz);
+
+        /**
+         * @brief Traverses param and all of its descendants using a visitor
+         *
+         * Array elements and sub-params are resolved directly from their
+         * already resolved parent rather than re-parsed from the device root,
+         * and their paths are built incrementally in a single buffer.
+         *
+         * @param param The parameter to visit
+         * @param path The path of the parameter
+         * @param visitor The visitor to use
+         * @param authz The authorizer to use
+         */
+        static void traverseParams(IParam* param, const std::string& path, IParamVisitor& visitor, const IAuthorizer& authz);
+
+    private:
+        /**
+         * @brief Recursive step of traverseParams
+         * @param param The parameter to visit
+         * @param path In/out buffer holding the parameter's path. Restored to
+         * its original contents before returning.
+         * @param visitor The visitor to use
+         * @param authz The authorizer to use
+         */
+        static void traverse_(IParam* param, std::string& path, IParamVisitor& visitor, const IAuthorizer& authz);
 };
 
 } // namespace common
@@ -49,6 +49,7 @@
 #include <StructInfo.h>
 #include <PolyglotText.h>
 #include <IAuthorizer.h>
+#include <AtomicValue.h>
 
 // protobuf interface
 #include <interface/param.pb.h>
@@ -165,6 +166,21 @@ class ParamWithValue : public catena::common::IParam {
         return catena::common::toProto<T>(value, &value_.get(), descriptor_, authz);
     }
 
+    /**
+     * @brief Serialize the parameter value straight to JSON if authorized.
+     * @param dst the string to append to.
+     * @param authz the authorizer object containing the client's scopes.
+     */
+    catena::exception_with_status toJson(std::string& dst, const IAuthorizer& authz) const override {
+        std::size_t size = dst.size();
+        catena::exception_with_status rc = catena::common::toJson<T>(dst, &value_.get(), descriptor_, authz);
+        // Drop whatever was written before the error
+        if (rc.status != catena::StatusCode::OK) {
+            dst.resize(size);
+        }
+        return rc;
+    }
+
     /**
      * @brief Serializes the parameter descriptor to a protobuf param object.
      * Includes both the descriptor and the value.
@@ -332,6 +348,12 @@ class ParamWithValue : public catena::common::IParam {
                 paramType == st2138::ParamType::STRUCT_VARIANT_ARRAY);
     }
 
+    /**
+     * @brief Checks if the parameter's value can be read without locking.
+     * @return True if the parameter is backed by an AtomicValue.
+     */
+    bool lockFreeReads() const override { return is_atomic_value_v<T>; }
+
     /**
      * @brief Adds a child parameter.
      * @param oid The oid of the child parameter to add.
@@ -349,6 +371,11 @@ class ParamWithValue : public catena::common::IParam {
      */
     const std::string& getScope() const override { return descriptor_.getScope(); }
 
+    /**
+     * @brief Gets the bit of the parameter's access scope.
+     */
+    uint32_t getScopeMask() const override { return descriptor_.getScopeMask(); }
+
     /**
      * @brief Validates a setValue operation without changing the param's value.
      * @param value The value we want to set the param to.
@@ -358,12 +385,8 @@ class ParamWithValue : public catena::common::IParam {
      * @returns true if valid.
      */
     bool validateSetValue(const st2138::Value& value, Path::Index index, const IAuthorizer& authz, catena::exception_with_status& ans) override {
-        if (validateSetValueMap_.contains(value.kind_case())) {
-            // Updating trackers.
-            ans = validateSetValueMap_.at(value.kind_case())(value, index, authz);
-        } else {
-            ans = catena::exception_with_status("Type not supported with SetValue", catena::StatusCode::INVALID_ARGUMENT);
-        }
+        // Updating trackers.
+        ans = validateSetValueByKind_(value, index, authz);
         return ans.status == catena::StatusCode::OK;
     }
     /**
@@ -394,6 +417,14 @@ class ParamWithValue : public catena::common::IParam {
      * This specialization is used when the type is a std::string.
      */
     std::size_t size_(const std::string& value) const { return value.length(); }
+    /**
+     * @brief Gets the size of the string/array parameter.
+     * @param value The parameter's value.
+     * @return The size of the string parameter.
+     * 
+     * This specialization is used when the type is an AtomicValue<std::string>.
+     */
+    std::size_t size_(const AtomicValue<std::string>& value) const { return value.size(); }
     /**
      * @brief Gets the size of the string/array parameter.
      * @param value The parameter's value.
@@ -619,8 +650,7 @@ class ParamWithValue : public catena::common::IParam {
         } else {
             std::string oidStr = oid.front_as_string();
             oid.pop();
-            auto fields = StructInfo<U>::fields; // get tuple of FieldInfo for this struct type
-            returnParam = findParamByName_<U>(fields, oidStr);
+            returnParam = findParamByName_(value, oidStr);
             // Param does not exist, return nullptr
             if (!returnParam) {
                 status = catena::exception_with_status("Param " + oid.fqoid() + " does not exist", catena::StatusCode::NOT_FOUND);
@@ -684,62 +714,31 @@ class ParamWithValue : public catena::common::IParam {
     /**
      * @brief gets the child parameter by name
      * @tparam Struct the type of the struct that we are getting the child parameter from
-     * @param fields the tuple of FieldInfo structs that describe the fields of the struct
+     * @param value the struct that we are getting the child parameter from
      * @param name the name of the child parameter
      * @return a unique pointer to the child parameter, or nullptr if it does not exist
      * 
      * This function is a helper function for getParam(Path& oid, U& value) that finds the child parameter by name.
      * 
-     * This intermediate function in needed to create the index sequence for the given tuple. 
-     * findParamByNameImpl uses the index sequence to deduce its template parameters. 
-     */
-    template <typename Struct, typename Tuple>
-    std::unique_ptr<IParam>  findParamByName_(const Tuple& fields, const std::string& name) {
-        return findParamByNameImpl_<Struct>(fields, name, std::make_index_sequence<std::tuple_size_v<Tuple>>());
-    }
-
-    /**
-     * @brief gets the child parameter by name
-     * @tparam Struct the type of the struct that we are getting the child parameter from
-     * @tparam Tuple the tuple of FieldInfo structs that describe the fields of the struct
-     * @tparam Is the indices of the fields in the tuple
-     * @param fields the tuple of FieldInfo structs that describe the fields of the struct
-     * @param name the name of the child parameter
-     * @return a unique pointer to the child parameter, or nullptr if it does not exist
-     * 
-     * This function is a helper function for findParamByName that finds the child parameter by name.
-     */
-    template <typename Struct, typename Tuple, std::size_t... Is>
-    std::unique_ptr<IParam>  findParamByNameImpl_(const Tuple& fields, const std::string& name, std::index_sequence<Is...>) {
-        /**
-         * Creates an array of unique pointers to IParam objects. The pointer will be nullptr if the field name does not match 
-         * the name parameter. If the field name does match the name parameter, the pointer will be a unique pointer to an 
-         * IParam constructed with the field info.
-         */
-        std::unique_ptr<IParam> params[] = {std::get<Is>(fields).name == name ? getParamAtIndex_<Is>(fields) : nullptr ...};
-        for (auto& param : params) {
-            if (param) {
-                // returns first IParam unique_ptr element that isn't a nullptr
-                return std::move(param);
-            }
+     * The name is resolved to a field index with a binary search over the
+     * compile-time sorted field names, and the field's descriptor comes from
+     * the descriptor's cached sub param table, so only the matching field
+     * is constructed and no name is hashed.
+     */
+    template <CatenaStruct Struct>
+    std::unique_ptr<IParam> findParamByName_(Struct& value, const std::string& name) {
+        std::unique_ptr<IParam> param = nullptr;
+        std::size_t index = fieldIndex<Struct>(name);
+        if (index < fieldNames<Struct>.size()) {
+            auto subParams = fieldDescriptors<Struct>(descriptor_);
+            forEachField<Struct>([&](const auto& field, std::size_t i) {
+                if (i == index) {
+                    using FieldType = typename std::decay_t<decltype(field)>::Field;
+                    param = std::make_unique<ParamWithValue<FieldType>>(value.*(field.memberPtr), *subParams[i]);
+                }
+            });
         }
-        return nullptr;
-    }
-
-    /**
-     * @brief Create a new paramWithValue object for the field at index I
-     * @tparam I the index of the field in the tuple
-     * @param tuple the tuple of FieldInfo structs that describe the fields of the struct
-     * @return a unique pointer to the new IParam object
-     * 
-     * This function is a helper function for findParamByName that creates a new ParamWithValue object for the field at 
-     * index I of the tuple.
-     */
-    template <std::size_t I, typename Tuple>
-    std::unique_ptr<IParam> getParamAtIndex_(const Tuple& tuple) {
-        // Get the type of the field at index I so that we can create a ParamWithValue object of that type
-        using FieldType = typename std::tuple_element_t<I, Tuple>::Field;
-        return std::make_unique<ParamWithValue<FieldType>>(std::get<I>(tuple), value_.get(), descriptor_);
+        return param;
     }
 
     // Tracker updaters. One overload for each case.
@@ -838,10 +837,13 @@ class ParamWithValue : public catena::common::IParam {
     }
     using Kind = st2138::Value::KindCase;
     /**
-     * @brief A map to help routing to the validateSetValue_ functions above.
+     * @brief Routes to the validateSetValue_ functions above.
      * Protobuf is great in that you need to use a seperate function to get
      * each different type of value.
-     * @param key The value's kind_case().
+     *
+     * A switch rather than a per-object table of std::functions, so that
+     * constructing a ParamWithValue (done at every level of a getParam walk)
+     * does not allocate.
      * @param protoVal The protobuf value object we want passed into
      * validateSetValue_.
      * @param index The index to update (or Path::kNone if none).
@@ -849,48 +851,47 @@ class ParamWithValue : public catena::common::IParam {
      * @returns catena::exception_with_status.
      */
     // GCOVR_EXCL_START
-    const std::unordered_map<Kind, std::function<catena::exception_with_status(const st2138::Value&, Path::Index, const IAuthorizer&)>> validateSetValueMap_ {
-        {Kind::kInt32Value, [this](const st2138::Value& protoVal, Path::Index index, const IAuthorizer& authz) {
-            return this->validateSetValue_(this->get(), protoVal.int32_value(), protoVal, index, authz);
-        }},
-        {Kind::kFloat32Value, [this](const st2138::Value& protoVal, Path::Index index, const IAuthorizer& authz) {
-            return this->validateSetValue_(this->get(), protoVal.float32_value(), protoVal, index, authz);
-        }},
-        {Kind::kStringValue, [this](const st2138::Value& protoVal, Path::Index index, const IAuthorizer& authz) {
-            return this->validateSetValue_(this->get(), protoVal.string_value(), protoVal, index, authz);
-        }},
-        {Kind::kStructValue, [this](const st2138::Value& protoVal, Path::Index index, const IAuthorizer& authz) {
-            return this->validateSetValue_(this->get(), protoVal.struct_value(), protoVal, index, authz);
-        }},
-        {Kind::kStructVariantValue, [this](const st2138::Value& protoVal, Path::Index index, const IAuthorizer& authz) {
-            return this->validateSetValue_(this->get(), protoVal.struct_variant_value(), protoVal, index, authz);
-        }},
-        {Kind::kInt32ArrayValues, [this](const st2138::Value& protoVal, Path::Index index, const IAuthorizer& authz) {
-            auto ints = protoVal.int32_array_values().ints();
-            auto protoVector = std::vector<int>(ints.begin(), ints.end());
-            return this->validateSetValue_(this->get(), protoVector, protoVal, index, authz);
-        }},
-        {Kind::kFloat32ArrayValues, [this](const st2138::Value& protoVal, Path::Index index, const IAuthorizer& authz) {
-            auto floats = protoVal.float32_array_values().floats();
-            auto protoVector = std::vector<float>(floats.begin(), floats.end());
-            return this->validateSetValue_(this->get(), protoVector, protoVal, index, authz);
-        }},
-        {Kind::kStringArrayValues, [this](const st2138::Value& protoVal, Path::Index index, const IAuthorizer& authz) {
-            auto strings = protoVal.string_array_values().strings();
-            auto protoVector = std::vector<std::string>(strings.begin(), strings.end());
-            return this->validateSetValue_(this->get(), protoVector, protoVal, index, authz);
-        }},
-        {Kind::kStructArrayValues, [this](const st2138::Value& protoVal, Path::Index index, const IAuthorizer& authz) {
-            auto structs = protoVal.struct_array_values().struct_values();
-            auto protoVector = std::vector<st2138::StructValue>(structs.begin(), structs.end());
-            return this->validateSetValue_(this->get(), protoVector, protoVal, index, authz);
-        }},
-        {Kind::kStructVariantArrayValues, [this](const st2138::Value& protoVal, Path::Index index, const IAuthorizer& authz) {
-            auto structs = protoVal.struct_variant_array_values().struct_variants();
-            auto protoVector = std::vector<st2138::StructVariantValue>(structs.begin(), structs.end());
-            return this->validateSetValue_(this->get(), protoVector, protoVal, index, authz);
-        }}
-    };
+    catena::exception_with_status validateSetValueByKind_(const st2138::Value& protoVal, Path::Index index, const IAuthorizer& authz) {
+        switch (protoVal.kind_case()) {
+            case Kind::kInt32Value:
+                return validateSetValue_(get(), protoVal.int32_value(), protoVal, index, authz);
+            case Kind::kFloat32Value:
+                return validateSetValue_(get(), protoVal.float32_value(), protoVal, index, authz);
+            case Kind::kStringValue:
+                return validateSetValue_(get(), protoVal.string_value(), protoVal, index, authz);
+            case Kind::kStructValue:
+                return validateSetValue_(get(), protoVal.struct_value(), protoVal, index, authz);
+            case Kind::kStructVariantValue:
+                return validateSetValue_(get(), protoVal.struct_variant_value(), protoVal, index, authz);
+            case Kind::kInt32ArrayValues: {
+                auto ints = protoVal.int32_array_values().ints();
+                auto protoVector = std::vector<int>(ints.begin(), ints.end());
+                return validateSetValue_(get(), protoVector, protoVal, index, authz);
+            }
+            case Kind::kFloat32ArrayValues: {
+                auto floats = protoVal.float32_array_values().floats();
+                auto protoVector = std::vector<float>(floats.begin(), floats.end());
+                return validateSetValue_(get(), protoVector, protoVal, index, authz);
+            }
+            case Kind::kStringArrayValues: {
+                auto strings = protoVal.string_array_values().strings();
+                auto protoVector = std::vector<std::string>(strings.begin(), strings.end());
+                return validateSetValue_(get(), protoVector, protoVal, index, authz);
+            }
+            case Kind::kStructArrayValues: {
+                auto structs = protoVal.struct_array_values().struct_values();
+                auto protoVector = std::vector<st2138::StructValue>(structs.begin(), structs.end());
+                return validateSetValue_(get(), protoVector, protoVal, index, authz);
+            }
+            case Kind::kStructVariantArrayValues: {
+                auto structs = protoVal.struct_variant_array_values().struct_variants();
+                auto protoVector = std::vector<st2138::StructVariantValue>(structs.begin(), structs.end());
+                return validateSetValue_(get(), protoVector, protoVal, index, authz);
+            }
+            default:
+                return catena::exception_with_status("Type not supported with SetValue", catena::StatusCode::INVALID_ARGUMENT);
+        }
+    }
     // GCOVR_EXCL_STOP
 
     /**
@@ -48,6 +48,7 @@
 
 #include <iostream>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <variant>
 #include <memory>
@@ -304,12 +305,17 @@ class Path {
     void escape_(std::string& str);
 
     /**
-     * @brief replace ~0 and ~1 with ~ and /
+     * @brief split a json pointer into segments in a single pass
      *
-     * @param str
-     * @return unescaped version of str
+     * Accepts the same grammar as the documented constructors: a sequence of
+     * '/' separated oid, index or '-' segments. Oid segments are copied once
+     * into their final storage, no intermediate strings are built.
+     *
+     * @param jptr the json pointer to parse
+     * @throw catena::exception_with_status INVALID_ARGUMENT if jptr is not a
+     * valid json-pointer
      */
-    std::string unescape_(const std::string& str);
+    void parse_(std::string_view jptr);
 };
 
 }  // namespace common
@@ -43,9 +43,11 @@
 #include <IConstraint.h>
 #include <Tags.h>
 #include <IDevice.h>
+#include <RangeKernels.h>
 
 // std
 #include <cmath>
+#include <span>
 
 namespace catena {
 namespace common {
@@ -135,28 +137,66 @@ class RangeConstraint : public catena::common::IConstraint {
     bool satisfied(const st2138::Value& src) const override {
         bool ans = false;
         if constexpr(std::is_same<T, int32_t>::value) {
-            ans = src.has_int32_value() && src.int32_value() >= min_ 
-                  && src.int32_value() <= max_
-                  && (!step_ || (src.int32_value() - min_) % step_ == 0);
+            ans = src.has_int32_value() && satisfied_(src.int32_value());
         }
         else if constexpr(std::is_same<T, float>::value) {
-            if (src.has_float32_value()) {
-                const float val = src.float32_value();
-                if (val >= min_ && val <= max_) {
-                    if (!step_) {
-                        ans = true;
-                    } else {
-                        constexpr float kStepTolerance = 0.0001f;
-                        const st2138::Value constrainedVal = apply(src);
-                        // close enough if within 1/10000th of the step size
-                        ans = std::fabs(constrainedVal.float32_value() - val) < (step_ * kStepTolerance);
-                    }
-                }
-            }
+            ans = src.has_float32_value() && satisfied_(src.float32_value());
         }
         return ans;
     }
 
+    /**
+     * @brief checks if an int satisfies the constraint
+     * @param src the int to check
+     * @return true if this is an int range and src satisfies it
+     */
+    bool satisfied(int32_t src) const override {
+        if constexpr(std::is_same<T, int32_t>::value) {
+            return satisfied_(src);
+        } else {
+            return false;
+        }
+    }
+
+    /**
+     * @brief checks if a float satisfies the constraint
+     * @param src the float to check
+     * @return true if this is a float range and src satisfies it
+     */
+    bool satisfied(float src) const override {
+        if constexpr(std::is_same<T, float>::value) {
+            return satisfied_(src);
+        } else {
+            return false;
+        }
+    }
+
+    /**
+     * @brief checks if every int in src satisfies the constraint
+     * @param src the ints to check
+     * @return true if this is an int range and all of src satisfies it
+     */
+    bool validate(std::span<const int32_t> src) const override {
+        if constexpr(std::is_same<T, int32_t>::value) {
+            return validate_(src);
+        } else {
+            return src.empty();
+        }
+    }
+
+    /**
+     * @brief checks if every float in src satisfies the constraint
+     * @param src the floats to check
+     * @return true if this is a float range and all of src satisfies it
+     */
+    bool validate(std::span<const float> src) const override {
+        if constexpr(std::is_same<T, float>::value) {
+            return validate_(src);
+        } else {
+            return src.empty();
+        }
+    }
+
     /**
      * @brief applies range constraint to a st2138::Value
      * @param src a st2138::Value to apply the constraint to
@@ -171,48 +211,42 @@ class RangeConstraint : public catena::common::IConstraint {
         if constexpr(std::is_same<T, int32_t>::value) {
             // return empty value if src is not valid
             if (src.has_int32_value()) {
-                int32_t s = src.int32_value();
-                // constrain if not within allowed range
-                if (s < min_) {
-                    constrainedVal.set_int32_value(min_);
-                } else if (s > max_) {
-                    constrainedVal.set_int32_value(max_);
-                } else if (step_ && (s - min_) % step_ != 0) {
-                    constrainedVal.set_int32_value(s - ((s - min_) % step_));
-                } else {
-                    constrainedVal.set_int32_value(s);
-                }
+                constrainedVal.set_int32_value(clamp_(src.int32_value()));
             }
         }
         else if constexpr(std::is_same<T, float>::value) {
             // return empty value if src is not valid
             if (src.has_float32_value()) {
-                float val = src.float32_value();
-                // constrain if not within allowed range
-                if (val < min_) {
-                    constrainedVal.set_float32_value(min_);
-                } else if (val > max_) {
-                    constrainedVal.set_float32_value(max_);
-                } else if (step_) {
-                    // round to the nearest step, if step is not 0
-                    const float steps = std::round((val - min_) / step_);
-                    const float newVal = (steps * step_) + min_;
-                    // make sure we don't go under the min or over the max when rounding
-                    if (newVal < min_) {
-                        constrainedVal.set_float32_value(min_);
-                    } else if (newVal > max_) {
-                        constrainedVal.set_float32_value(max_);
-                    } else {
-                        constrainedVal.set_float32_value(newVal);
-                    }
-                } else {
-                    constrainedVal.set_float32_value(val);
-                }
+                constrainedVal.set_float32_value(clamp_(src.float32_value()));
             }
         }
         return constrainedVal;
     }
 
+    /**
+     * @brief applies range constraint to each int in values, in place
+     * @param values the ints to constrain
+     *
+     * Does nothing unless this is an int range.
+     */
+    void clamp(std::span<int32_t> values) const override {
+        if constexpr(std::is_same<T, int32_t>::value) {
+            clampAll_(values);
+        }
+    }
+
+    /**
+     * @brief applies range constraint to each float in values, in place
+     * @param values the floats to constrain
+     *
+     * Does nothing unless this is a float range.
+     */
+    void clamp(std::span<float> values) const override {
+        if constexpr(std::is_same<T, float>::value) {
+            clampAll_(values);
+        }
+    }
+
     /**
      * @brief serialize the constraint to a protobuf message
      * @param constraint the protobuf message to populate
@@ -257,6 +291,76 @@ class RangeConstraint : public catena::common::IConstraint {
     const std::string& getOid() const override { return oid_; }
 
 private:
+    /**
+     * @brief checks if val is within the range and, if step is not 0, on a step
+     */
+    bool satisfied_(T val) const {
+        bool ans = false;
+        if constexpr(std::is_same<T, int32_t>::value) {
+            ans = val >= min_ && val <= max_ && (!step_ || (val - min_) % step_ == 0);
+        }
+        else if constexpr(std::is_same<T, float>::value) {
+            if (val >= min_ && val <= max_) {
+                if (!step_) {
+                    ans = true;
+                } else {
+                    constexpr float kStepTolerance = 0.0001f;
+                    // close enough if within 1/10000th of the step size
+                    ans = std::fabs(clamp_(val) - val) < (step_ * kStepTolerance);
+                }
+            }
+        }
+        return ans;
+    }
+
+    /**
+     * @brief constrains val to the range and, if step is not 0, to a step
+     */
+    T clamp_(T val) const {
+        // constrain if not within allowed range
+        if (val < min_) {
+            val = min_;
+        } else if (val > max_) {
+            val = max_;
+        } else if (step_) {
+            if constexpr(std::is_same<T, int32_t>::value) {
+                val -= (val - min_) % step_;
+            } else if constexpr(std::is_same<T, float>::value) {
+                // round to the nearest step
+                const float steps = std::round((val - min_) / step_);
+                const float newVal = (steps * step_) + min_;
+                // make sure we don't go under the min or over the max when rounding
+                val = newVal < min_ ? min_ : (newVal > max_ ? max_ : newVal);
+            }
+        }
+        return val;
+    }
+
+    /**
+     * @brief satisfied_ over a span, without stopping early so the loop
+     * stays branch free
+     */
+    bool validate_(std::span<const T> src) const {
+        bool ans = true;
+        if (!step_) {
+            for (T val : src) {
+                ans &= (val >= min_) & (val <= max_);
+            }
+        } else {
+            for (T val : src) {
+                ans &= satisfied_(val);
+            }
+        }
+        return ans;
+    }
+
+    /**
+     * @brief clamp_ over a span, using the SIMD range kernels
+     */
+    void clampAll_(std::span<T> values) const {
+        clampToRange(values, min_, max_, step_);
+    }
+
     /** 
      * @brief The minimum value.
      */
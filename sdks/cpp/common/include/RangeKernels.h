@@ -0,0 +1,97 @@
+/*
+ * Copyright 2026 Ross Video Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file RangeKernels.h
+ * @brief Bulk clamp-and-quantize for int and float arrays with a range constraint.
+ * @date 2026-10-16
+ * @copyright Copyright (c) 2026 Ross Video
+ *
+ * RangeConstraint::clamp uses these to constrain a whole array in place.
+ * Each element gets the same result as RangeConstraint::apply: values
+ * outside [min, max] go to the nearest bound, and values inside are rounded
+ * to the nearest step (halfway cases away from zero) and kept in range.
+ *
+ * The x86 builds carry SSE4.1 and AVX2 versions chosen at runtime from what
+ * the CPU supports. Other builds use the scalar version.
+ */
+
+#pragma once
+
+// std
+#include <cstdint>
+#include <span>
+
+namespace catena {
+namespace common {
+
+/**
+ * @brief The instruction sets the range kernels can use.
+ */
+enum class SimdLevel {
+    kScalar,
+    kSse41,
+    kAvx2
+};
+
+/**
+ * @brief The best SimdLevel the CPU supports, detected once.
+ */
+SimdLevel simdLevel();
+
+/**
+ * @brief Clamps each value to [min, max] and, if step is not 0, rounds it
+ * to the nearest step from min.
+ * @param values The values to constrain, in place.
+ * @param min The minimum value.
+ * @param max The maximum value.
+ * @param step The step size, 0 for none.
+ * @param level The instruction set to use, lowered to simdLevel() if the CPU
+ * does not support it.
+ */
+void clampToRange(std::span<float> values, float min, float max, float step, SimdLevel level = simdLevel());
+
+/**
+ * @brief Clamps each value to [min, max] and, if step is not 0, rounds it
+ * down to a step from min.
+ * @param values The values to constrain, in place.
+ * @param min The minimum value.
+ * @param max The maximum value.
+ * @param step The step size, 0 for none.
+ * @param level The instruction set to use, lowered to simdLevel() if the CPU
+ * does not support it.
+ *
+ * Only the bounds are vectorized. With a step the scalar version is used,
+ * as there is no vector integer remainder.
+ */
+void clampToRange(std::span<int32_t> values, int32_t min, int32_t max, int32_t step, SimdLevel level = simdLevel());
+
+} // namespace common
+} // namespace catena
@@ -32,7 +32,8 @@
 
 /**
  * @file StructInfo.h
- * @brief Structured data serialization and deserialization to protobuf
+ * @brief Structured data serialization and deserialization to protobuf and
+ * JSON
  * @author John R. Naylor
  * @author John Danen
  * @date 2024-07-07
@@ -43,6 +44,7 @@
 #include <meta/IsVector.h>
 #include <meta/Variant.h>
 #include <IAuthorizer.h>
+#include <JsonWriter.h>
 
 // protobuf interface
 #include <interface/param.pb.h>
@@ -52,6 +54,10 @@
 #include <cstddef>
 #include <vector>
 #include <utility>
+#include <array>
+#include <tuple>
+#include <string_view>
+#include <algorithm>
 
 namespace catena {
 namespace common {
@@ -133,6 +139,78 @@ struct FieldInfo {
         : name(n), memberPtr(m) {}
 };
 
+/**
+ * @brief The names of a CatenaStruct's fields, in StructInfo<T>::fields order.
+ *
+ * Has one address per struct type, so it doubles as the cache key for
+ * IParamDescriptor::getSubParams.
+ */
+template <CatenaStruct T>
+inline constexpr auto fieldNames = std::apply([](const auto&... field) {
+    return std::array<const char*, sizeof...(field)>{field.name...};
+}, StructInfo<T>::fields);
+
+/**
+ * @brief (name, index) pairs of a CatenaStruct's fields, sorted by name at
+ * compile time for fieldIndex.
+ */
+template <CatenaStruct T>
+inline constexpr auto sortedFieldNames = [] {
+    std::array<std::pair<std::string_view, std::size_t>, fieldNames<T>.size()> sorted{};
+    for (std::size_t i = 0; i < sorted.size(); ++i) {
+        sorted[i] = {fieldNames<T>[i], i};
+    }
+    std::sort(sorted.begin(), sorted.end());
+    return sorted;
+}();
+
+/**
+ * @brief Finds the position of a field in StructInfo<T>::fields by name.
+ * @tparam T the type of the struct
+ * @param name the name of the field
+ * @return the field's index, or fieldNames<T>.size() if T has no such field.
+ */
+template <CatenaStruct T>
+constexpr std::size_t fieldIndex(std::string_view name) {
+    const auto& sorted = sortedFieldNames<T>;
+    auto it = std::lower_bound(sorted.begin(), sorted.end(), name, [](const auto& entry, std::string_view n) {
+        return entry.first < n;
+    });
+    return (it != sorted.end() && it->first == name) ? it->second : sorted.size();
+}
+
+/**
+ * @brief Calls f(field, index) for each FieldInfo in StructInfo<T>::fields.
+ * @tparam T the type of the struct
+ * @param f the function to call
+ */
+template <CatenaStruct T, typename F>
+constexpr void forEachField(F&& f) {
+    [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+        (f(std::get<Is>(StructInfo<T>::fields), Is), ...);
+    }(std::make_index_sequence<fieldNames<T>.size()>{});
+}
+
+/**
+ * @brief The descriptors of a struct's fields, indexed like
+ * StructInfo<T>::fields
+ */
+template <CatenaStruct T>
+using FieldDescriptors = std::array<IParamDescriptor*, fieldNames<T>.size()>;
+
+/**
+ * @brief Resolves the descriptors of all of a struct's fields in one call.
+ * @tparam T the type of the struct
+ * @param pd the descriptor of the struct param
+ * @return the field descriptors, indexed like StructInfo<T>::fields
+ */
+template <CatenaStruct T>
+FieldDescriptors<T> fieldDescriptors(const IParamDescriptor& pd) {
+    FieldDescriptors<T> subParams{};
+    pd.getSubParams(fieldNames<T>, subParams);
+    return subParams;
+}
+
 /**
  * @brief AltenativeNames is specialized in the generated code to provide the
  * names of the alternatives in a variant
@@ -188,6 +266,96 @@ bool validFromProto(const st2138::Value& src, const T* dst, const IParamDescript
 template <typename T>
 catena::exception_with_status fromProto(const st2138::Value& src, T* dst, const IParamDescriptor& pd, const IAuthorizer& authz);
 
+/**
+ * @brief Serializes the fields of a struct directly into dst. This is the
+ * shared body of the struct and struct array toProto, which have already
+ * checked read authorization.
+ * @tparam T the type of the struct
+ * @param dst The StructValue to serialize to, usually part of a larger message.
+ * @param src The struct to serialize.
+ * @param subParams The descriptors of the struct's fields.
+ * @param authz The authorizer object to containing the client's scopes.
+ */
+template <CatenaStruct T>
+catena::exception_with_status _structToProto(st2138::StructValue& dst, const T* src, const FieldDescriptors<T>& subParams, const IAuthorizer& authz) {
+    catena::exception_with_status rc{"", catena::StatusCode::OK};
+    auto* dstFields = dst.mutable_fields();
+
+    // lambda function to call toProto for the given field if it is authorized
+    auto readField = [&](const auto& field, std::size_t i) {
+        if (rc.status == catena::StatusCode::OK) {
+            IParamDescriptor& subParam = *subParams[i];
+            st2138::Value* newFieldValue = &(*dstFields)[field.name];
+
+            /**
+             * &(src->*(field.memberPtr)) will pass the address of the
+             * corresponding field in src to the toProto function.
+             * 
+             * the correct specializtion of toProto will be called based on the
+             * type of the field memberPtr. 
+             */
+            rc = toProto(*newFieldValue, &(src->*(field.memberPtr)), subParam, authz);
+        }
+    };
+
+    // call readField for each field in the struct
+    forEachField<T>(readField);
+    return rc;
+}
+
+/**
+ * @brief Validates the fields of a StructValue against a struct. This is the
+ * shared body of the struct and struct array validFromProto, which have
+ * already checked write authorization and the value's type.
+ */
+template <CatenaStruct T>
+bool _validStructFromProto(const st2138::StructValue& src, const T* dst, const FieldDescriptors<T>& subParams, const IParamDescriptor& pd, catena::exception_with_status& rc, const IAuthorizer& authz) {
+    auto& srcFields = src.fields();
+    // lambda function to call validFromProto for the given field
+    auto testWriteField = [&](const auto& field, std::size_t i) {
+        IParamDescriptor& subParam = *subParams[i];
+        if (rc.status == catena::StatusCode::OK) {
+            // Must contain all the field
+            auto it = srcFields.find(field.name);
+            if (it == srcFields.end()) {
+                rc = catena::exception_with_status("Missing field " + std::string(field.name) + " from " + pd.getOid(), catena::StatusCode::INVALID_ARGUMENT);
+            } else {
+                validFromProto(it->second, &(dst->*(field.memberPtr)), subParam, rc, authz);
+            }
+        }
+    };
+    // All sub params must also be valid.
+    forEachField<T>(testWriteField);
+    return rc.status == catena::StatusCode::OK;
+}
+
+/**
+ * @brief Deserializes the fields of a validated StructValue into dst. This
+ * is the shared body of the struct and struct array fromProto.
+ */
+template <CatenaStruct T>
+void _structFromProto(const st2138::StructValue& src, T* dst, const FieldDescriptors<T>& subParams, const IAuthorizer& authz) {
+    auto& srcFields = src.fields();
+
+    // lambda function to call fromProto for the given field if it is authorized
+    auto writeField = [&](const auto& field, std::size_t i) {
+        IParamDescriptor& subParam = *subParams[i];
+        /**
+         * &(dst->*(field.memberPtr)) will pass the address of the
+         * corresponding value field in dst to the fromProto function.
+         * 
+         * the correct specialization of fromProto will be called based on
+         * the type of the field memberPtr.
+         */
+        fromProto(srcFields.at(field.name), &(dst->*(field.memberPtr)), subParam, authz);
+    };
+
+    // call writeField for each field in the dst struct
+    // If the src value contains a field that is not in the dst struct, it
+    // will be ignored
+    forEachField<T>(writeField);
+}
+
 /**
  * toProto specialization to serialize a single struct value to protobuf.
  * 
@@ -205,30 +373,7 @@ catena::exception_with_status toProto(st2138::Value& dst, const T* src, const IP
         rc = catena::exception_with_status("Not authorized to read param " + pd.getOid(), catena::StatusCode::PERMISSION_DENIED);
     } else {
         dst.clear_struct_value();
-        auto fields = StructInfo<T>::fields; // get tuple of FieldInfo for this struct type
-        auto* dstFields = dst.mutable_struct_value()->mutable_fields();
-
-        // lambda function to call toProto for the given field if it is authorized
-        auto readField = [&](const auto& field) {
-            if (rc.status == catena::StatusCode::OK) {
-                IParamDescriptor& subParam = pd.getSubParam(field.name);
-                st2138::Value* newFieldValue = &(*dstFields)[field.name];
-
-                /**
-                 * &(src->*(field.memberPtr)) will pass the address of the
-                 * corresponding field in src to the toProto function.
-                 * 
-                 * the correct specializtion of toProto will be called based on the
-                 * type of the field memberPtr. 
-                 */
-                rc = toProto(*newFieldValue, &(src->*(field.memberPtr)), subParam, authz);
-            }
-        };
-
-        // call readField for each field in the struct
-        std::apply([&](auto... field) {
-            (readField(field), ...);
-        }, fields);
+        rc = _structToProto(*dst.mutable_struct_value(), src, fieldDescriptors<T>(pd), authz);
     }
     // Return an empty struct if the serialization failed
     if (rc.status != catena::StatusCode::OK) {
@@ -239,7 +384,6 @@ catena::exception_with_status toProto(st2138::Value& dst, const T* src, const IP
 
 template <CatenaStruct T>
 bool validFromProto(const st2138::Value& src, const T* dst, const IParamDescriptor& pd, catena::exception_with_status& rc, const IAuthorizer& authz) {
-    auto fields = StructInfo<T>::fields; // get tuple of FieldInfo for this struct type
     // Must have write authorization
     if (!authz.writeAuthz(pd)) {
         rc = catena::exception_with_status("Not authorized to write to param " + pd.getOid(), catena::StatusCode::PERMISSION_DENIED);
@@ -247,23 +391,7 @@ bool validFromProto(const st2138::Value& src, const T* dst, const IParamDescript
     } else if (!src.has_struct_value()) {
         rc = catena::exception_with_status("Type mismatch between value and struct " + pd.getOid(), catena::StatusCode::INVALID_ARGUMENT);
     } else {
-        auto& srcFields = src.struct_value().fields();
-        // lambda function to call validFromProto for the given field
-        auto testWriteField = [&](const auto& field) {
-            IParamDescriptor& subParam = pd.getSubParam(field.name);
-            if (rc.status == catena::StatusCode::OK) {
-                // Must contain all the field
-                if (!srcFields.contains(field.name)) {
-                    rc = catena::exception_with_status("Missing field " + std::string(field.name) + " from " + pd.getOid(), catena::StatusCode::INVALID_ARGUMENT);
-                } else {
-                    validFromProto(srcFields.at(field.name), &(dst->*(field.memberPtr)), subParam, rc, authz);
-                }
-            }
-        };
-        // All sub params must also be valid.
-        std::apply([&](auto... field) {
-            (testWriteField(field), ...);
-        }, fields);
+        _validStructFromProto(src.struct_value(), dst, fieldDescriptors<T>(pd), pd, rc, authz);
     }
     return rc.status == catena::StatusCode::OK;
 }
@@ -281,28 +409,7 @@ template <CatenaStruct T>
 catena::exception_with_status fromProto(const st2138::Value& src, T* dst, const IParamDescriptor& pd, const IAuthorizer& authz) {
     catena::exception_with_status rc{"", catena::StatusCode::OK};
     if (validFromProto(src, dst, pd, rc, authz)) {
-        auto fields = StructInfo<T>::fields; // get tuple of FieldInfo for this struct type
-        auto& srcFields = src.struct_value().fields();
-
-        // lambda function to call fromProto for the given field if it is authorized
-        auto writeField = [&](const auto& field) {
-            IParamDescriptor& subParam = pd.getSubParam(field.name);
-            /**
-             * &(dst->*(field.memberPtr)) will pass the address of the
-             * corresponding value field in dst to the fromProto function.
-             * 
-             * the correct specialization of fromProto will be called based on
-             * the type of the field memberPtr.
-             */
-            fromProto(srcFields.at(field.name), &(dst->*(field.memberPtr)), subParam, authz);
-        };
-
-        // call writeField for each field in the dst struct
-        // If the src value contains a field that is not in the dst struct, it
-        // will be ignored
-        std::apply([&](auto... field) {
-            (writeField(field), ...);
-        }, fields);
+        _structFromProto(src.struct_value(), dst, fieldDescriptors<T>(pd), authz);
     }
     return rc;
 }
@@ -323,13 +430,12 @@ catena::exception_with_status toProto(st2138::Value& dst, const T* src, const IP
         rc = catena::exception_with_status("Not authorized to read param " + pd.getOid(), catena::StatusCode::PERMISSION_DENIED);
     } else {
         dst.clear_struct_array_values();
-        using structType = T::value_type;
         auto* dstArray = dst.mutable_struct_array_values();
-        
+        auto subParams = fieldDescriptors<typename T::value_type>(pd);
+        // Elements are built in place, on dst's arena if it has one
+        dstArray->mutable_struct_values()->Reserve(src->size());
         for (const auto& item : *src) {
-            st2138::Value elemValue;
-            rc = toProto(elemValue, &item, pd, authz);
-            *dstArray->add_struct_values() = *elemValue.mutable_struct_value();
+            rc = _structToProto(*dstArray->add_struct_values(), &item, subParams, authz);
             if (rc.status != catena::StatusCode::OK) { break; }
         }
     }
@@ -354,12 +460,11 @@ bool validFromProto(const st2138::Value& src, const T* dst, const IParamDescript
         rc = catena::exception_with_status("Param " + pd.getOid() + " exceeds maximum capacity", catena::StatusCode::OUT_OF_RANGE);
     } else {
         auto& srcArray = src.struct_array_values().struct_values();
+        auto subParams = fieldDescriptors<structType>(pd);
         structType testStruct; // Empty struct for testing sub params.
         // All members must also be valid.
-        for (int i = 0; i < srcArray.size(); ++i) {
-            st2138::Value item;
-            *item.mutable_struct_value() = srcArray.Get(i);
-            if (!validFromProto(item, &testStruct, pd, rc, authz)) {
+        for (const st2138::StructValue& item : srcArray) {
+            if (!_validStructFromProto(item, &testStruct, subParams, pd, rc, authz)) {
                 break;
             }
         }
@@ -381,13 +486,13 @@ catena::exception_with_status fromProto(const st2138::Value& src, T* dst, const
     if (validFromProto(src, dst, pd, rc, authz)) {
         using structType = T::value_type;
         auto& srcArray = src.struct_array_values().struct_values();
+        auto subParams = fieldDescriptors<structType>(pd);
         dst->clear(); // empty the destination vector
-        // iterate over each element in the src array and call fromProto for each
-        for (int i = 0; i < srcArray.size(); ++i) {
-            st2138::Value item;
-            *item.mutable_struct_value() = srcArray.Get(i);
+        dst->reserve(srcArray.size());
+        // iterate over each element in the src array, already validated above
+        for (const st2138::StructValue& item : srcArray) {
             structType& elemValue = dst->emplace_back();
-            fromProto(item, &elemValue, pd, authz);
+            _structFromProto(item, &elemValue, subParams, authz);
         }
     }
     return rc;
@@ -433,6 +538,70 @@ void _changeType(V& variant, const std::size_t newTypeIndex) {
     } // else reached the end of the variant, type not found
 }
 
+/**
+ * @brief Serializes a variant directly into dst. This is the shared body of
+ * the variant and variant array toProto, which have already checked read
+ * authorization.
+ */
+template <meta::IsVariant T>
+catena::exception_with_status _variantToProto(st2138::StructVariantValue& dst, const T* src, const IParamDescriptor& pd, const IAuthorizer& authz) {
+    catena::exception_with_status rc{"", catena::StatusCode::OK};
+    const char* variantType = alternativeNames<T>[src->index()];
+    IParamDescriptor& subParam = pd.getSubParam(variantType);
+    std::visit([&](auto& arg) {
+        dst.set_struct_variant_type(variantType);
+        rc = toProto(*dst.mutable_value(), &arg, subParam, authz);
+    }, *src);
+    return rc;
+}
+
+/**
+ * @brief Validates a StructVariantValue against a variant. This is the
+ * shared body of the variant and variant array validFromProto, which have
+ * already checked write authorization and the value's type.
+ */
+template <meta::IsVariant T>
+bool _validVariantFromProto(const st2138::StructVariantValue& srcVariant, const IParamDescriptor& pd, catena::exception_with_status& rc, const IAuthorizer& authz) {
+    const std::string& variantType = srcVariant.struct_variant_type();
+    std::size_t typeIndex = _findTypeIndex(variantType, alternativeNames<T>);
+    // Must have valid variant type
+    if (typeIndex >= alternativeNames<T>.size()) {
+        rc = catena::exception_with_status(pd.getOid() + " does not contain variant " + variantType, catena::StatusCode::INVALID_ARGUMENT);
+    } else {
+        T testVariant;
+        _changeType<T, 0>(testVariant, typeIndex);
+        // All sub params must also be valid.
+        IParamDescriptor& subParam= pd.getSubParam(variantType);
+        std::visit([&](auto& arg) {
+            if (rc.status == catena::StatusCode::OK) {
+                validFromProto(srcVariant.value(), &arg, subParam, rc, authz);
+            }
+        }, testVariant); 
+    }
+    return rc.status == catena::StatusCode::OK;
+}
+
+/**
+ * @brief Deserializes a validated StructVariantValue into dst. This is the
+ * shared body of the variant and variant array fromProto.
+ */
+template <meta::IsVariant T>
+void _variantFromProto(const st2138::StructVariantValue& srcVariant, T* dst, const IParamDescriptor& pd, const IAuthorizer& authz) {
+    const std::string& variantType = srcVariant.struct_variant_type();
+    std::size_t typeIndex = _findTypeIndex(variantType, alternativeNames<T>);
+    if (typeIndex < alternativeNames<T>.size()) {
+        if (typeIndex != dst->index()) {
+            // The type of the variant needs to be changed
+            _changeType<T, 0>(*dst, typeIndex);
+        }
+
+        IParamDescriptor& subParam= pd.getSubParam(variantType);
+        std::visit([&](auto& arg) {
+            fromProto(srcVariant.value(), &arg, subParam, authz);
+        }, *dst); 
+    }
+}
+
 template <meta::IsVariant T>
 catena::exception_with_status toProto(st2138::Value& dst, const T* src, const IParamDescriptor& pd, const IAuthorizer& authz) {
     catena::exception_with_status rc{"", catena::StatusCode::OK};
@@ -441,17 +610,7 @@ catena::exception_with_status toProto(st2138::Value& dst, const T* src, const IP
         rc = catena::exception_with_status("Not authorized to read param " + pd.getOid(), catena::StatusCode::PERMISSION_DENIED);
     } else {
         dst.clear_struct_variant_value();
-        std::string variantType = alternativeNames<T>[src->index()];
-        IParamDescriptor& subParam = pd.getSubParam(variantType);
-        std::visit([&](auto& arg) {
-            if (rc.status == catena::StatusCode::OK) {
-                st2138::Value elemValue;
-                rc = toProto(elemValue, &arg, subParam, authz);
-                st2138::StructVariantValue* structVariant = dst.mutable_struct_variant_value();
-                structVariant->set_struct_variant_type(variantType);
-                *structVariant->mutable_value() = elemValue;
-            }
-        }, *src);
+        rc = _variantToProto(*dst.mutable_struct_variant_value(), src, pd, authz);
     }
     // Return an empty array if the serialization failed
     if (rc.status != catena::StatusCode::OK) {
@@ -469,23 +628,7 @@ bool validFromProto(const st2138::Value& src, const T* dst, const IParamDescript
     } else if (!src.has_struct_variant_value()) {
         rc = catena::exception_with_status("Type mismatch between value and variant struct " + pd.getOid(), catena::StatusCode::INVALID_ARGUMENT);
     } else {
-        const st2138::StructVariantValue& srcVariant = src.struct_variant_value();
-        std::string variantType = srcVariant.struct_variant_type();
-        std::size_t typeIndex = _findTypeIndex(variantType, alternativeNames<T>);
-        // Must have valid variant type
-        if (typeIndex >= alternativeNames<T>.size()) {
-            rc = catena::exception_with_status(pd.getOid() + " does not contain variant " + variantType, catena::StatusCode::INVALID_ARGUMENT);
-        } else {
-            T testVariant;
-            _changeType<T, 0>(testVariant, typeIndex);
-            // All sub params must also be valid.
-            IParamDescriptor& subParam= pd.getSubParam(variantType);
-            std::visit([&](auto& arg) {
-                if (rc.status == catena::StatusCode::OK) {
-                    validFromProto(srcVariant.value(), &arg, subParam, rc, authz);
-                }
-            }, testVariant); 
-        }
+        _validVariantFromProto<T>(src.struct_variant_value(), pd, rc, authz);
     }
     return rc.status == catena::StatusCode::OK;
 }
@@ -494,21 +637,7 @@ template <meta::IsVariant T>
 catena::exception_with_status fromProto(const st2138::Value& src, T* dst, const IParamDescriptor& pd, const IAuthorizer& authz) {
     catena::exception_with_status rc{"", catena::StatusCode::OK};
     if (validFromProto(src, dst, pd, rc, authz)) {
-        const st2138::StructVariantValue& srcVariant = src.struct_variant_value();
-        std::string variantType = srcVariant.struct_variant_type();
-        
-        std::size_t typeIndex = _findTypeIndex(variantType, alternativeNames<T>);
-        if (typeIndex < alternativeNames<T>.size()) {
-            if (typeIndex != dst->index()) {
-                // The type of the variant needs to be changed
-                _changeType<T, 0>(*dst, typeIndex);
-            }
-
-            IParamDescriptor& subParam= pd.getSubParam(variantType);
-            std::visit([&](auto& arg) {
-                fromProto(srcVariant.value(), &arg, subParam, authz);
-            }, *dst); 
-        }
+        _variantFromProto(src.struct_variant_value(), dst, pd, authz);
     }
     return rc;
 }
@@ -521,10 +650,11 @@ catena::exception_with_status toProto(st2138::Value& dst, const T* src, const IP
         rc = catena::exception_with_status("Not authorized to read param " + pd.getOid(), catena::StatusCode::PERMISSION_DENIED);
     } else {
         dst.clear_struct_variant_array_values();
+        auto* dstArray = dst.mutable_struct_variant_array_values();
+        // Elements are built in place, on dst's arena if it has one
+        dstArray->mutable_struct_variants()->Reserve(src->size());
         for (const auto& item : *src) {
-            st2138::Value elemValue;
-            rc = toProto(elemValue, &item, pd, authz);
-            *dst.mutable_struct_variant_array_values()->add_struct_variants() = *elemValue.mutable_struct_variant_value();
+            rc = _variantToProto(*dstArray->add_struct_variants(), &item, pd, authz);
             if (rc.status != catena::StatusCode::OK) { break; }
         }
     }
@@ -550,11 +680,8 @@ bool validFromProto(const st2138::Value& src, const T* dst, const IParamDescript
     } else {
         auto& srcArray = src.struct_variant_array_values().struct_variants();
         // All members must also be valid.
-        for (int i = 0; i < srcArray.size(); ++i) {
-            VariantType testStruct; // Empty struct for testing.
-            st2138::Value item;
-            *item.mutable_struct_variant_value() = srcArray.Get(i);
-            if (!validFromProto(item, &testStruct, pd, rc, authz)) {
+        for (const st2138::StructVariantValue& item : srcArray) {
+            if (!_validVariantFromProto<VariantType>(item, pd, rc, authz)) {
                 break;
             }
         }
@@ -570,16 +697,84 @@ catena::exception_with_status fromProto(const st2138::Value& src, T* dst, const
         auto& srcArray = src.struct_variant_array_values().struct_variants();
         dst->clear(); // empty the destination vector
 
-        // iterate over each element in the src array and call fromProto for each
-        for (int i = 0; i < srcArray.size(); ++i) {
-            st2138::Value item;
-            *item.mutable_struct_variant_value() = srcArray.Get(i);
+        dst->reserve(srcArray.size());
+        // iterate over each element in the src array, already validated above
+        for (const st2138::StructVariantValue& item : srcArray) {
             VariantType& elemValue = dst->emplace_back();
-            fromProto(item, &elemValue, pd, authz);
+            _variantFromProto(item, &elemValue, pd, authz);
         }
     }
     return rc;
 }
 
+/**
+ * Free standing method to serialize a value straight to JSON, skipping the
+ * protobuf message.
+ * 
+ * generic template declaration
+ * 
+ * Appends the value in the proto3 JSON mapping of the st2138::Value that
+ * toProto would produce, with the same authorization checks. Scalars and
+ * their arrays are written directly. Structs, variants and their arrays go
+ * through toProto, so their fields come out in the printer's map order.
+ * 
+ * @tparam T the type of the value
+ * @param dst The string to append to. Left partially written on error.
+ * @param src The value to serialize.
+ * @param pd The parameter descriptor of the parameter containing the value.
+ * @param authz The authorizer object to containing the client's scopes.
+ */
+template <typename T>
+catena::exception_with_status toJson(std::string& dst, const T* src, const IParamDescriptor& pd, const IAuthorizer& authz);
+
+template <CatenaStruct T>
+catena::exception_with_status toJson(std::string& dst, const T* src, const IParamDescriptor& pd, const IAuthorizer& authz);
+
+template <CatenaStructArray T>
+catena::exception_with_status toJson(std::string& dst, const T* src, const IParamDescriptor& pd, const IAuthorizer& authz);
+
+template <meta::IsVariant T>
+catena::exception_with_status toJson(std::string& dst, const T* src, const IParamDescriptor& pd, const IAuthorizer& authz);
+
+template <IsVariantArray T>
+catena::exception_with_status toJson(std::string& dst, const T* src, const IParamDescriptor& pd, const IAuthorizer& authz);
+
+/**
+ * @brief Writes a struct kind through the st2138::Value toProto produces.
+ *
+ * Struct fields are a map in the message, and the printer writes a map in
+ * its own iteration order, which protobuf does not fix. Writing the message
+ * keeps the output byte for byte what the printer writes for it.
+ */
+template <typename T>
+catena::exception_with_status _toJsonViaProto(std::string& dst, const T* src, const IParamDescriptor& pd, const IAuthorizer& authz) {
+    st2138::Value value;
+    catena::exception_with_status rc = toProto(value, src, pd, authz);
+    if (rc.status == catena::StatusCode::OK && !appendJson(dst, value)) {
+        rc = catena::exception_with_status("Param " + pd.getOid() + " is not valid UTF-8", catena::StatusCode::INTERNAL);
+    }
+    return rc;
+}
+
+template <CatenaStruct T>
+catena::exception_with_status toJson(std::string& dst, const T* src, const IParamDescriptor& pd, const IAuthorizer& authz) {
+    return _toJsonViaProto(dst, src, pd, authz);
+}
+
+template <CatenaStructArray T>
+catena::exception_with_status toJson(std::string& dst, const T* src, const IParamDescriptor& pd, const IAuthorizer& authz) {
+    return _toJsonViaProto(dst, src, pd, authz);
+}
+
+template <meta::IsVariant T>
+catena::exception_with_status toJson(std::string& dst, const T* src, const IParamDescriptor& pd, const IAuthorizer& authz) {
+    return _toJsonViaProto(dst, src, pd, authz);
+}
+
+template <IsVariantArray T>
+catena::exception_with_status toJson(std::string& dst, const T* src, const IParamDescriptor& pd, const IAuthorizer& authz) {
+    return _toJsonViaProto(dst, src, pd, authz);
+}
+
 }  // namespace common
 }  // namespace catena
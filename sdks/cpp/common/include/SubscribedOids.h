@@ -0,0 +1,177 @@
+/*
+ * Copyright 2026 Ross Video Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file SubscribedOids.h
+ * @brief Path trie of subscriptions and a lazily expanded view of it.
+ * @date 2026-10-16
+ * @copyright Copyright (c) 2026 Ross Video
+ */
+
+#pragma once
+
+// std
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <optional>
+#include <set>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace catena {
+namespace common {
+
+class IDevice;
+
+/**
+ * @brief Read-only view of the OIDs subscribed to on one device.
+ *
+ * Subscriptions are stored as a path trie with one node per OID segment. A
+ * wildcard subscription such as "/param/*" is a single flag on the "/param"
+ * node which covers that param and everything below it, so it costs the
+ * same no matter how many params it expands to.
+ *
+ * Trie nodes are immutable once published. The view keeps the root it was
+ * created from alive, so it stays consistent while the SubscriptionManager
+ * moves on to newer versions of the trie.
+ *
+ * contains() walks the trie in O(depth). Iterating the view expands the
+ * wildcards against the device the first time it is needed; views that are
+ * only queried with contains() never expand.
+ */
+class SubscribedOids {
+  public:
+    /**
+     * @brief A node in the subscription trie.
+     */
+    struct Node {
+        std::map<std::string, std::shared_ptr<const Node>, std::less<>> children; ///< Child segments.
+        bool exact = false;    ///< The OID ending at this node is subscribed.
+        bool wildcard = false; ///< This node and all of its descendants are subscribed.
+
+        /**
+         * @brief Returns true if the node holds no subscriptions.
+         */
+        bool empty() const { return !exact && !wildcard && children.empty(); }
+    };
+    using NodePtr = std::shared_ptr<const Node>;
+    using const_iterator = std::set<std::string>::const_iterator;
+
+    /**
+     * @brief Constructs an empty view.
+     */
+    SubscribedOids() = default;
+    /**
+     * @brief Constructs a view of a subscription trie.
+     * @param root The root of the trie.
+     * @param dm The device used to expand wildcard subscriptions.
+     */
+    SubscribedOids(NodePtr root, const IDevice& dm) : root_{std::move(root)}, dm_{&dm} {}
+    /**
+     * @brief Constructs an already expanded view from a set of OIDs.
+     * @param oids The subscribed OIDs.
+     */
+    SubscribedOids(std::set<std::string> oids) : expanded_{std::move(oids)} {}
+
+    /**
+     * @brief Returns true if the OID is subscribed to, either directly or
+     * through a wildcard subscription on one of its ancestors.
+     * @param oid The OID to check.
+     */
+    bool contains(std::string_view oid) const;
+    /**
+     * @brief Returns the number of subscribed OIDs after expansion.
+     */
+    std::size_t size() const { return expand_().size(); }
+    /**
+     * @brief Returns true if no OIDs are subscribed to after expansion.
+     */
+    bool empty() const { return expand_().empty(); }
+    /**
+     * @brief Returns an iterator to the first expanded OID.
+     */
+    const_iterator begin() const { return expand_().begin(); }
+    /**
+     * @brief Returns an iterator past the last expanded OID.
+     */
+    const_iterator end() const { return expand_().end(); }
+
+    /**
+     * @brief Returns true if the OID is covered by the trie rooted at root.
+     * @param root The root of the trie, may be nullptr.
+     * @param oid The OID to check.
+     */
+    static bool covers(const Node* root, std::string_view oid);
+    /**
+     * @brief Returns true if the OID and everything below it are covered by
+     * a wildcard in the trie rooted at root.
+     * @param root The root of the trie, may be nullptr.
+     * @param oid The OID to check.
+     */
+    static bool coversAll(const Node* root, std::string_view oid);
+    /**
+     * @brief Splits an OID into its path segments.
+     * @param oid The OID to split, e.g. "/param/0/child".
+     * @return The non-empty segments of the OID.
+     */
+    static std::vector<std::string_view> split(std::string_view oid);
+
+  private:
+    /**
+     * @brief Expands the trie into the set of subscribed OIDs on first use.
+     */
+    const std::set<std::string>& expand_() const;
+
+    /**
+     * @brief Adds the OIDs of the subtree rooted at node to expanded_.
+     * @param node The node to expand.
+     * @param path The OID of node.
+     */
+    void expandNode_(const Node& node, std::string& path) const;
+
+    /**
+     * @brief The root of the trie viewed.
+     */
+    NodePtr root_ = nullptr;
+    /**
+     * @brief The device used to expand wildcard subscriptions.
+     */
+    const IDevice* dm_ = nullptr;
+    /**
+     * @brief The expanded OIDs, filled in on first iteration.
+     */
+    mutable std::optional<std::set<std::string>> expanded_;
+};
+
+} // namespace common
+} // namespace catena
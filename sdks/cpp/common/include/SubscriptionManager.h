@@ -44,19 +44,33 @@
 // common
 #include <IDevice.h>
 #include <IParam.h>
-#include <ParamVisitor.h>
 #include <ISubscriptionManager.h>
+#include <SubscribedOids.h>
 #include <Authorizer.h>
 
 // std
-#include <set>
+#include <atomic>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
 
 namespace catena {
 namespace common {
 
 /**
  * @brief Class for managing parameter subscriptions in Catena
+ *
+ * Each scope keeps the subscriptions of each slot in a SubscribedOids trie.
+ * Published tries are never modified; writers copy the nodes along the
+ * changed path and swap in a new snapshot, so isSubscribed() and
+ * getAllSubscribedOids() never wait on a lock.
+ *
+ * A scope is created by the first connection to open it and lives until its
+ * last connection closes it. Subscriptions can only be changed in a scope
+ * that is open, or in the shared scope, which always exists.
  */
 class SubscriptionManager : public ISubscriptionManager {
   public:
@@ -71,29 +85,29 @@ class SubscriptionManager : public ISubscriptionManager {
      * @param dm The device model to use 
      * @param rc The status code to return if the operation fails
      * @param authz The authorizer to use for checking permissions
+     * @param scope The key of the client's subscription scope
      * @return true if the subscription was added, false if it already existed
      */
-    bool addSubscription(const std::string& oid, IDevice& dm, exception_with_status& rc, const IAuthorizer& authz = Authorizer::kAuthzDisabled) override;
+    bool addSubscription(const std::string& oid, IDevice& dm, exception_with_status& rc, const IAuthorizer& authz = Authorizer::kAuthzDisabled, const std::string& scope = kSharedScope) override;
 
     /**
      * @brief Remove an OID subscription
      * @param oid The OID to unsubscribe from (can be either a unique OID or a wildcard like "/param/*")
      * @param dm The device model to use
      * @param rc The status code to return if the operation fails
+     * @param scope The key of the client's subscription scope
      * @return true if the subscription was removed, false if it didn't exist
      */
-    bool removeSubscription(const std::string& oid, const IDevice& dm, exception_with_status& rc) override;
+    bool removeSubscription(const std::string& oid, const IDevice& dm, exception_with_status& rc, const std::string& scope = kSharedScope) override;
 
     /**
      * @brief Get all subscribed OIDs, including expanding wildcard subscriptions
      * @param dm The device model to use 
-     * @return A copy of the set of all subscribed OIDs
-     * 
-     * Since subManager does not expose its mutex, it is required to return a
-     * copy of the set in order to avoid race conditions in the async API
-     * calls.
+     * @param scope The key of the client's subscription scope
+     * @return A view of the current subscriptions which expands wildcards
+     * when it is iterated.
      */
-    std::set<std::string> getAllSubscribedOids(const IDevice& dm) override;
+    SubscribedOids getAllSubscribedOids(const IDevice& dm, const std::string& scope = kSharedScope) override;
 
     /**
      * @brief Check if an OID is a wildcard subscription
@@ -106,71 +120,104 @@ class SubscriptionManager : public ISubscriptionManager {
      * @brief Check if an OID is subscribed to
      * @param dm The device model to use 
      * @param oid The OID to check
+     * @param scope The key of the client's subscription scope
      * @return true if the OID is already subscribed to
      */
-    bool isSubscribed(const std::string& oid, const IDevice& dm) override;
+    bool isSubscribed(const std::string& oid, const IDevice& dm, const std::string& scope = kSharedScope) override;
+
+    /**
+     * @brief Opens a connection's subscription scope, creating it if no other
+     * connection has it open.
+     * @param scope The key of the scope
+     */
+    void openScope(const std::string& scope) override;
+
+    /**
+     * @brief Closes a connection's subscription scope. The scope and its
+     * subscriptions are dropped once its last connection closes it.
+     * @param scope The key of the scope
+     */
+    void closeScope(const std::string& scope) override;
 
   private:
+    using NodePtr = SubscribedOids::NodePtr;
+    using Segments = std::vector<std::string_view>;
     /**
-     * @brief Mutex for subscription data access
-     */
-    mutable std::mutex mtx_;
-
-    /**
-     * @brief Visitor class for collecting subscribed OIDs
-     */
-    class SubscriptionVisitor : public catena::common::IParamVisitor {
-        public:
-            /**
-             * @brief Constructor for the SubscriptionVisitor class
-             * @param oids The vector of subscribed OIDs
-             */
-            explicit SubscriptionVisitor(std::set<std::string>& oids) : oids_(oids) {}
-            
-            /**
-             * @brief Visit a parameter
-             * @param param The parameter to visit
-             * @param path The path of the parameter
-             */
-            void visit(catena::common::IParam* param, const std::string& path) override {
-                // Skip array elements (paths ending with indices) to prevent invalid paths
-                Path pathObj = Path(path);
-                if (!pathObj.back_is_index()) {
-                    oids_.insert(path);
-                }
-            }
-            
-            /**
-             * @brief Visit an array
-             * @param param The array to visit
-             * @param path The path of the array
-             * @param length The length of the array
-             */
-            void visitArray(catena::common::IParam* param, const std::string& path, uint32_t length) override {
-                // Add the array path itself (without indices) to the subscribed OIDs
-                Path pathObj = Path(path);
-                if (!pathObj.back_is_index()) {
-                    oids_.insert(path);
-                }
-            }
-            
-        private:
-            /**
-             * @brief The vector of subscribed OIDs within the visitor
-             */
-            std::set<std::string>& oids_;
+     * @brief The subscription tries of all slots at one point in time.
+     */
+    using Snapshot = std::unordered_map<uint32_t, NodePtr>;
+    /**
+     * @brief The subscriptions of one client.
+     */
+    struct Scope {
+        std::atomic<std::shared_ptr<const Snapshot>> subscriptions{std::make_shared<const Snapshot>()}; ///< The current subscriptions of every slot.
+        uint32_t connections = 0; ///< The number of open connections using the scope, guarded by writeMtx_.
     };
+    using Scopes = std::unordered_map<std::string, std::shared_ptr<Scope>>;
+
+    /**
+     * @brief Returns a copy of node with the subscription at segments added.
+     * @param node The node to copy, may be nullptr.
+     * @param segments The path of the subscription.
+     * @param i The index of the segment below node.
+     * @param wildcard True to subscribe to the whole subtree.
+     */
+    static NodePtr insert_(const NodePtr& node, const Segments& segments, std::size_t i, bool wildcard);
+
+    /**
+     * @brief Returns a copy of node with the subscription at segments removed.
+     * @param node The node to copy.
+     * @param segments The path of the subscription.
+     * @param i The index of the segment below node.
+     * @param wildcard True to remove the whole subtree.
+     * @param found Set to true if anything was removed.
+     * @return The new node, or nullptr if it no longer holds any subscriptions.
+     */
+    static NodePtr erase_(const NodePtr& node, const Segments& segments, std::size_t i, bool wildcard, bool& found);
+
+    /**
+     * @brief Returns the scope with the given key, or nullptr if it does not
+     * exist.
+     * @param key The key of the scope.
+     */
+    std::shared_ptr<Scope> scope_(const std::string& key) const;
+
+    /**
+     * @brief Returns the scope with the given key, creating it if needed.
+     *
+     * Must be called with writeMtx_ held.
+     *
+     * @param key The key of the scope.
+     */
+    std::shared_ptr<Scope> createScope_(const std::string& key);
+
+    /**
+     * @brief Returns the root of a slot's trie in a scope's current snapshot.
+     * @param scope The scope, may be nullptr.
+     * @param slot The slot of the device.
+     */
+    static NodePtr root_(const Scope* scope, uint32_t slot);
+
+    /**
+     * @brief Publishes a new root for a slot in a scope.
+     *
+     * Must be called with writeMtx_ held.
+     *
+     * @param scope The scope.
+     * @param slot The slot of the device.
+     * @param root The new root, or nullptr if the slot has no subscriptions.
+     */
+    static void publish_(Scope& scope, uint32_t slot, NodePtr root);
 
     /**
-     * @brief Set of all active subscriptions (unique and expanded wildcards)
+     * @brief Serializes writers. Readers never take it.
      */
-    std::unordered_map<uint32_t, std::set<std::string>> subscriptions_;
+    std::mutex writeMtx_;
 
     /**
-     * @brief Update the combined list of all subscribed OIDs
-     * @param dm The device model to use for expanding wildcard subscriptions
+     * @brief The current scopes by key. The shared scope always exists.
      */
-    void updateAllSubscribedOids_(IDevice& dm);
+    std::atomic<std::shared_ptr<const Scopes>> scopes_{std::make_shared<const Scopes>(Scopes{{kSharedScope, std::make_shared<Scope>()}})};
 };
 
 } // namespace common
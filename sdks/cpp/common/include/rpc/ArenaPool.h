@@ -0,0 +1,231 @@
+/*
+ * Copyright 2026 Ross Video Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file ArenaPool.h
+ * @brief Pool of reusable protobuf arenas for building responses.
+ * @date 2026-10-16
+ * @copyright Copyright (c) 2026 Ross Video
+ */
+
+#pragma once
+
+// protobuf
+#include <google/protobuf/arena.h>
+
+// std
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace catena {
+namespace common {
+
+/**
+ * @brief Lends out protobuf arenas so that a request's messages are built
+ * in a few large blocks instead of one heap allocation per message, string
+ * and repeated field.
+ *
+ * Each arena starts with a block of blockSize bytes which it keeps when it
+ * is returned to the pool, so a request whose messages fit in the block
+ * does not touch the heap at all. Anything beyond the block is freed when
+ * the arena is returned.
+ *
+ * A message created on an arena builds its sub messages on the same arena,
+ * so IParam::toProto and the StructInfo serializers construct nested values
+ * in place without any changes to their signatures.
+ *
+ * Messages created on a lease's arena must not outlive the lease, or its
+ * next reset(). gRPC serializes a message when it is passed to Write or
+ * Finish, so a stream can reset one lease between writes instead of leasing
+ * an arena per message.
+ */
+class ArenaPool {
+  public:
+    /**
+     * @brief The default size of the block each arena keeps, in bytes.
+     */
+    static constexpr std::size_t kBlockSize = 16 * 1024;
+
+    /**
+     * @brief Counters describing how the pool's arenas have been used.
+     */
+    struct Stats {
+        uint64_t leases = 0;       ///< The number of arenas lent out.
+        uint64_t arenas = 0;       ///< The number of arenas created.
+        uint64_t bytesUsed = 0;    ///< Bytes of messages built on the arenas.
+        uint64_t bytesSpilled = 0; ///< Bytes allocated beyond the arenas' blocks.
+    };
+
+    /**
+     * @brief An arena borrowed from the pool, returned when destroyed.
+     */
+    class Lease {
+      public:
+        /**
+         * @brief Destructor. Resets the arena and returns it to the pool.
+         */
+        ~Lease();
+        /**
+         * @brief Lease has move semantics but no copy semantics.
+         */
+        Lease(Lease&& other) noexcept : pool_{other.pool_}, entry_{std::move(other.entry_)} {}
+        Lease& operator=(Lease&&) = delete;
+        Lease(const Lease&) = delete;
+        Lease& operator=(const Lease&) = delete;
+
+        /**
+         * @brief Returns the leased arena.
+         */
+        google::protobuf::Arena* arena() const;
+        /**
+         * @brief Frees the messages built on the arena so far, keeping the
+         * lease and the arena's block for the next ones.
+         */
+        void reset();
+        /**
+         * @brief Creates a message on the leased arena.
+         * @tparam T The type of the message.
+         * @return The message, owned by the arena.
+         */
+        template <typename T>
+        T* create() const {
+#if GOOGLE_PROTOBUF_VERSION < 4022000
+            // Before 22.0 Create does not make the message's fields use the arena
+            return google::protobuf::Arena::CreateMessage<T>(arena());
+#else
+            return google::protobuf::Arena::Create<T>(arena());
+#endif
+        }
+
+      private:
+        friend class ArenaPool;
+        /**
+         * @brief An arena whose first block is owned alongside it, so that
+         * the block survives Reset() and is reused by the next lease.
+         */
+        struct Entry {
+            explicit Entry(std::size_t blockSize);
+            std::unique_ptr<char[]> block;
+            google::protobuf::Arena arena;
+        };
+        /**
+         * @brief Constructor. Only the pool lends out arenas.
+         */
+        Lease(ArenaPool& pool, std::unique_ptr<Entry> entry);
+
+        /**
+         * @brief The pool to return the arena to.
+         */
+        ArenaPool* pool_;
+        /**
+         * @brief The leased arena and its block, null once moved from.
+         */
+        std::unique_ptr<Entry> entry_;
+    };
+
+    /**
+     * @brief Returns the process wide pool, created on first use with room
+     * for config::arena_pool_size idle arenas.
+     */
+    static ArenaPool& instance();
+
+    /**
+     * @brief Constructor.
+     * @param capacity The number of idle arenas to keep. 0 creates a new
+     * arena for every lease.
+     * @param blockSize The size of the block each arena keeps, in bytes.
+     */
+    explicit ArenaPool(std::size_t capacity, std::size_t blockSize = kBlockSize);
+    /**
+     * @brief Destructor. Outstanding leases must be returned first.
+     */
+    ~ArenaPool();
+    /**
+     * @brief ArenaPool has no copy or move semantics.
+     */
+    ArenaPool(const ArenaPool&) = delete;
+    ArenaPool& operator=(const ArenaPool&) = delete;
+    ArenaPool(ArenaPool&&) = delete;
+    ArenaPool& operator=(ArenaPool&&) = delete;
+
+    /**
+     * @brief Borrows an arena, creating one if none are idle.
+     */
+    Lease acquire();
+    /**
+     * @brief Returns the number of idle arenas.
+     */
+    std::size_t idle() const;
+    /**
+     * @brief Returns the pool's counters.
+     */
+    Stats stats() const;
+
+  private:
+    /**
+     * @brief Adds an arena's usage to the counters and resets it.
+     */
+    void reset_(Lease::Entry& entry);
+    /**
+     * @brief Resets an arena and keeps it if there is room.
+     */
+    void release_(std::unique_ptr<Lease::Entry> entry);
+
+    /**
+     * @brief The number of idle arenas to keep.
+     */
+    const std::size_t capacity_;
+    /**
+     * @brief The size of the block each arena keeps.
+     */
+    const std::size_t blockSize_;
+    /**
+     * @brief Guards idle_.
+     */
+    mutable std::mutex mtx_;
+    /**
+     * @brief The arenas waiting to be lent out.
+     */
+    std::vector<std::unique_ptr<Lease::Entry>> idle_;
+    /**
+     * @brief Counters reported by stats().
+     */
+    std::atomic<uint64_t> leases_{0};
+    std::atomic<uint64_t> arenas_{0};
+    std::atomic<uint64_t> bytesUsed_{0};
+    std::atomic<uint64_t> bytesSpilled_{0};
+};
+
+} // namespace common
+} // namespace catena
@@ -0,0 +1,131 @@
+/*
+ * Copyright 2026 Ross Video Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file CommandExecutor.h
+ * @brief Worker pool which runs commands off the threads serving requests.
+ * @date 2026-10-16
+ * @copyright Copyright (c) 2026 Ross Video
+ */
+
+#pragma once
+
+// std
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace catena {
+namespace common {
+
+/**
+ * @brief Runs command responders on a pool of worker threads so that a
+ * command which blocks (e.g. sleeping between steps) does not hold up the
+ * threads serving other requests.
+ *
+ * Jobs are taken from a single queue in the order they were posted, so a
+ * job waits only while every worker is busy with another command. Callers
+ * are told a job finished by the job itself, e.g. by setting a gRPC alarm.
+ *
+ * With zero workers jobs run inline on the posting thread, as before.
+ */
+class CommandExecutor {
+  public:
+    /**
+     * @brief Returns the process wide executor, created on first use with
+     * config::command_workers workers.
+     */
+    static CommandExecutor& instance();
+
+    /**
+     * @brief Constructor. Starts the workers.
+     * @param workers The number of worker threads. 0 runs jobs inline.
+     */
+    explicit CommandExecutor(std::size_t workers);
+    /**
+     * @brief Destructor. Runs the remaining jobs and joins the workers.
+     */
+    ~CommandExecutor();
+    /**
+     * @brief CommandExecutor does not have copy or move semantics.
+     */
+    CommandExecutor(const CommandExecutor&) = delete;
+    CommandExecutor& operator=(const CommandExecutor&) = delete;
+    CommandExecutor(CommandExecutor&&) = delete;
+    CommandExecutor& operator=(CommandExecutor&&) = delete;
+
+    /**
+     * @brief Returns the number of worker threads.
+     */
+    std::size_t workers() const { return workers_.size(); }
+    /**
+     * @brief Queues a job. Never blocks on the job.
+     *
+     * If there are no workers the job is run inline. Jobs must handle their
+     * own errors, anything thrown is dropped.
+     *
+     * @param job The job to run.
+     */
+    void post(std::function<void()> job);
+
+  private:
+    /**
+     * @brief The body of a worker thread.
+     */
+    void run_();
+
+    /**
+     * @brief Guards jobs_ and stop_.
+     */
+    std::mutex mtx_;
+    /**
+     * @brief Wakes the workers when a job is queued or on shutdown.
+     */
+    std::condition_variable cv_;
+    /**
+     * @brief Jobs waiting for a worker.
+     */
+    std::deque<std::function<void()>> jobs_;
+    /**
+     * @brief Set to stop the workers once jobs_ is empty.
+     */
+    bool stop_ = false;
+    /**
+     * @brief The worker threads.
+     */
+    std::vector<std::thread> workers_;
+};
+
+} // namespace common
+} // namespace catena
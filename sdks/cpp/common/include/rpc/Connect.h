@@ -45,8 +45,12 @@
 #include <IParam.h>
 #include <IDevice.h>
 #include <Authorizer.h>
+#include <AuthorizerCache.h>
 #include <ISubscriptionManager.h>
 #include "IConnect.h"
+#include "UpdateQueue.h"
+#include "UpdateFanout.h"
+#include <Config.h>
 #include <Logger.h>
 #include <utils.h>
 
@@ -55,7 +59,9 @@
 
 // std
 #include <string>
+#include <vector>
 #include <condition_variable>
+#include <random>
 
 namespace catena {
 namespace common {
@@ -65,6 +71,8 @@ namespace common {
  * among other things.
  */
 class Connect : public IConnect {
+  // Delivers device updates through the protected updateResponse_ overloads.
+  friend class UpdateFanout;
   /*
    * Public functions are all used for connection management and priority
    * comparison in the connectionQueue class.
@@ -73,7 +81,12 @@ class Connect : public IConnect {
     /**
      * @brief Descructor
      */
-    virtual ~Connect() = default;
+    virtual ~Connect() {
+        unsubscribeUpdates_();
+        if (scopeOpen_) {
+            subscriptionManager_.closeScope(subscriptionScope_);
+        }
+    }
     /**
      * @brief Returns the connection's priority.
      */
@@ -97,10 +110,23 @@ class Connect : public IConnect {
      * @brief Forcefully shuts down the connection.
      */
     void shutdown() override {
+        std::lock_guard<std::mutex> lock(mtx_);
         shutdown_ = true;
         hasUpdate_ = true;
-        cv_.notify_one();
+        wakeWriter_();
     };
+    /**
+     * @brief Returns the id the client passes to name this connection's
+     * subscription scope in other requests.
+     */
+    const std::string& connectionId() const { return connectionId_; }
+    /**
+     * @brief Returns the lag metrics of the connection's update queue.
+     */
+    UpdateQueue::Metrics updateQueueMetrics() {
+        std::lock_guard<std::mutex> lock(mtx_);
+        return updates_.metrics();
+    }
 
   protected:
     Connect() = delete;
@@ -112,7 +138,11 @@ class Connect : public IConnect {
     Connect(SlotMap& dms, ISubscriptionManager& subscriptionManager) : 
         dms_{dms}, 
         subscriptionManager_{subscriptionManager},
-        detailLevel_{st2138::Device_DetailLevel_UNSET} {}
+        detailLevel_{st2138::Device_DetailLevel_UNSET},
+        updates_{config::update_queue_depth,
+                 config::update_queue_overflow == "disconnect" ? UpdateQueue::Overflow::kDisconnect
+                                                               : UpdateQueue::Overflow::kDropOldest},
+        connectionId_{newConnectionId_()} {}
     /**
      * @brief Connect does not have copy semantics
      */
@@ -133,52 +163,60 @@ class Connect : public IConnect {
      * @param slot The slot number of the device containing the parameter.
      */
     void updateResponse_(const std::string& oid, const IParam* p, uint32_t slot) override {
+        UpdateEncoder encoder(oid, p, slot);
+        updateResponse_(oid, p, slot, encoder);
+    }
+    /**
+     * @brief Updates the response message with parameter values if the client
+     * has read authorization and the correct detail level, sharing the
+     * serialized value with other connections through encoder.
+     * 
+     * @param oid The OID of the updated value
+     * @param p The updated parameter
+     * @param slot The slot number of the device containing the parameter.
+     * @param encoder The encoder shared by all connections receiving this
+     * update.
+     */
+    void updateResponse_(const std::string& oid, const IParam* p, uint32_t slot, UpdateEncoder& encoder) {
         try {
             // If Connect was cancelled, shutdown the call.
             if (isCancelled()) {
+                std::lock_guard<std::mutex> res_lock(mtx_);
                 hasUpdate_ = true;
-                cv_.notify_one();
+                wakeWriter_();
 
             // Send a push update if the client has read authorization.
             } else if (authz_->readAuthz(*p)) {
-                // Map of detail levels to their update logic
-                const std::unordered_map<st2138::Device_DetailLevel, std::function<bool()>> detailLevelMap {
-                    {st2138::Device_DetailLevel_FULL, [&]() {
+                bool send = false;
+                switch (detailLevel_) {
+                    case st2138::Device_DetailLevel_FULL:
                         // Always update for FULL detail level
-                        return true;
-                    }},
-                    {st2138::Device_DetailLevel_MINIMAL, [&]() {
+                        send = true;
+                        break;
+                    case st2138::Device_DetailLevel_MINIMAL:
                         // For MINIMAL, only update if it's in the minimal set
-                        return p->getDescriptor().minimalSet();
-                    }},
-                    {st2138::Device_DetailLevel_SUBSCRIPTIONS, [&]() {
+                        send = p->getDescriptor().minimalSet();
+                        break;
+                    case st2138::Device_DetailLevel_SUBSCRIPTIONS:
                         // Update if OID is subscribed or in minimal set
-                        return p->getDescriptor().minimalSet() || (dms_[slot] && subscriptionManager_.isSubscribed(oid, *dms_[slot]));
-                    }},
-                    {st2138::Device_DetailLevel_COMMANDS, [&]() {
+                        send = p->getDescriptor().minimalSet() || (dms_[slot] && subscriptionManager_.isSubscribed(oid, *dms_[slot], subscriptionScope_));
+                        break;
+                    case st2138::Device_DetailLevel_COMMANDS:
                         // For COMMANDS, only update command parameters
-                        return p->getDescriptor().isCommand();
-                    }},
-                    {st2138::Device_DetailLevel_NONE, [&]() {
-                        // Don't send any updates
-                        return false;
-                    }}
-                };
+                        send = p->getDescriptor().isCommand();
+                        break;
+                    default:
+                        // Don't send any updates for NONE or unknown levels
+                        break;
+                }
 
-                if (detailLevelMap.contains(detailLevel_) && detailLevelMap.at(detailLevel_)()) {
-                    std::lock_guard<std::mutex> res_lock(mtx_);
-                    res_.Clear();
-                    res_.set_slot(slot);
-                    res_.mutable_value()->set_oid(oid);    
-                    st2138::Value* value = res_.mutable_value()->mutable_value();
-            
-                    catena::exception_with_status rc{"", catena::StatusCode::OK};
-                    rc = p->toProto(*value, *authz_);
-                    //If the param conversion was successful, send the update
-                    if (rc.status == catena::StatusCode::OK) {
-                        LOG(DEBUG) << "Connect::updateResponse_: Param \"" << oid << "\" set to new value: " << catena::param_value_string(*value);
-                        hasUpdate_ = true;
-                        cv_.notify_one();
+                if (send) {
+                    // Serializing outside of the lock so the writer is not held up.
+                    SharedUpdatePtr update = encoder.encode(*authz_);
+                    //If the param conversion was successful, queue the update
+                    if (update) {
+                        std::lock_guard<std::mutex> res_lock(mtx_);
+                        queueUpdate_(updates_.push(slot, oid, std::move(update)));
                     }
                 }
                 //lock behind stateless
@@ -199,21 +237,33 @@ class Connect : public IConnect {
      * @param slot The slot number of the device containing the language pack.
      */
     void updateResponse_(const ILanguagePack* l, uint32_t slot) override {
+        UpdateEncoder encoder(l, slot);
+        updateResponse_(l, slot, encoder);
+    }
+    /**
+     * @brief Updates the response message with an ILanguagePack if the client
+     * has monitor scope, sharing the serialized pack with other connections
+     * through encoder.
+     * 
+     * @param l The added ILanguagePack emitted by device.
+     * @param slot The slot number of the device containing the language pack.
+     * @param encoder The encoder shared by all connections receiving this
+     * update.
+     */
+    void updateResponse_(const ILanguagePack* l, uint32_t slot, UpdateEncoder& encoder) {
         try {
             // If Connect was cancelled, shutdown the call.
             if (isCancelled()){
+                std::lock_guard<std::mutex> res_lock(mtx_);
                 hasUpdate_ = true;
-                cv_.notify_one();
+                wakeWriter_();
 
             // Send a push update if the client has monitor scope.
             } else if (authz_->readAuthz(Scopes_e::kMonitor)) {
-                // Updating res_'s device_component and pushing update.
-                res_.Clear();
-                res_.set_slot(slot);
-                auto pack = res_.mutable_device_component()->mutable_language_pack();
-                l->toProto(*pack->mutable_language_pack());
-                hasUpdate_ = true;
-                cv_.notify_one();
+                // Building the device_component and queueing the update.
+                SharedUpdatePtr update = encoder.encode(*authz_);
+                std::lock_guard<std::mutex> res_lock(mtx_);
+                queueUpdate_(updates_.push(std::move(update)));
             }
         } catch(catena::exception_with_status& why){
             // if an error is thrown, no update is pushed to the client
@@ -221,6 +271,105 @@ class Connect : public IConnect {
         }
     }
 
+    /**
+     * @brief Opens the client's subscription scope so that it is kept for as
+     * long as this connection is open. Must be called after initAuthz_().
+     *
+     * The scope is keyed on this connection's id under the subject of the
+     * client's token, so only requests which name this connection with the
+     * same token can change it. With the SUBSCRIPTIONS detail level, the
+     * connection only receives updates to the OIDs subscribed to in this
+     * scope.
+     */
+    void openSubscriptionScope_() {
+        subscriptionScope_ = ISubscriptionManager::scopeKey(authz_->subject(), connectionId_);
+        subscriptionManager_.openScope(subscriptionScope_);
+        scopeOpen_ = true;
+    }
+
+    /**
+     * @brief Starts receiving push updates from a device.
+     * @param slot The slot of the device.
+     * @param dm The device.
+     */
+    void subscribeUpdates_(uint32_t slot, IDevice& dm) {
+        fanouts_.push_back(UpdateFanout::get(dm, slot));
+        fanouts_.back()->add(this);
+    }
+    /**
+     * @brief Stops receiving push updates from all devices. Blocks until any
+     * update being sent to this connection has finished.
+     */
+    void unsubscribeUpdates_() {
+        for (auto& fanout : fanouts_) {
+            fanout->remove(this);
+        }
+        fanouts_.clear();
+    }
+
+    /**
+     * @brief Returns a new random connection id, 32 hex digits long, which
+     * can not be guessed from the ids of other connections.
+     */
+    static std::string newConnectionId_() {
+        static constexpr char kHex[] = "0123456789abcdef";
+        std::random_device rd;
+        std::string id;
+        id.reserve(32);
+        for (int i = 0; i < 4; ++i) {
+            uint32_t bits = rd();
+            for (int j = 0; j < 8; ++j, bits >>= 4) {
+                id += kHex[bits & 0xf];
+            }
+        }
+        return id;
+    }
+
+    /**
+     * @brief Wakes the writer after an update was pushed to updates_.
+     *
+     * Must be called with mtx_ held.
+     *
+     * @param queued The result of UpdateQueue::push. False means the client
+     * is not keeping up and the kDisconnect policy applies.
+     */
+    void queueUpdate_(bool queued) {
+        if (!queued && !shutdown_) {
+            LOG(WARNING) << "Connect[" << objectId_ << "] update queue overflowed, disconnecting slow client";
+            shutdown_ = true;
+        }
+        hasUpdate_ = true;
+        wakeWriter_();
+    }
+
+    /**
+     * @brief Wakes the writer to write queued updates or finish.
+     *
+     * Must be called with mtx_ held. Writers which block on cv_ use this
+     * default, others override it to schedule themselves.
+     */
+    virtual void wakeWriter_() {
+        cv_.notify_one();
+    }
+
+    /**
+     * @brief Moves the next batch of queued updates onto the end of batch.
+     *
+     * Must be called with mtx_ held.
+     *
+     * @param batch The vector to append the updates to.
+     * @return The number of updates moved.
+     */
+    size_t drainUpdates_(std::vector<SharedUpdatePtr>& batch) {
+        size_t first = batch.size();
+        size_t drained = updates_.drain(batch, kUpdateBatchSize);
+        UpdateDispatcher& dispatcher = UpdateDispatcher::instance();
+        for (size_t i = first; i < batch.size(); ++i) {
+            dispatcher.recordWrite(batch[i]->emittedAt());
+        }
+        return drained;
+    }
+
     /**
      * @brief Crates an authorizer using the jws token and calculates the
      * client's priority.
@@ -237,7 +386,7 @@ class Connect : public IConnect {
      */
     void initAuthz_(const std::string& jwsToken, bool authz = false) override {
         if (authz) {
-            sharedAuthz_ = std::make_shared<catena::common::Authorizer>(jwsToken);
+            sharedAuthz_ = catena::common::AuthorizerCache::instance().get(jwsToken);
             authz_ = sharedAuthz_.get();
             // Setting up their connection priority.
             for (uint32_t i = static_cast<uint32_t>(Scopes_e::kAdmin); i >= static_cast<uint32_t>(Scopes_e::kMonitor); i -= 1) {             
@@ -287,9 +436,19 @@ class Connect : public IConnect {
      */
     std::condition_variable cv_;
     /**
-     * @brief Server response (updates).
+     * @brief Updates waiting to be written to the client.
+     */
+    UpdateQueue updates_;
+    /**
+     * @brief The maximum number of updates the writer takes from updates_ at
+     * once.
      */
-    st2138::PushUpdates res_;
+    static constexpr size_t kUpdateBatchSize = 32;
+    /**
+     * @brief The fanouts of the devices this connection receives updates
+     * from.
+     */
+    std::vector<std::shared_ptr<UpdateFanout>> fanouts_;
     /**
      * @brief The language of the response.
      */
@@ -302,6 +461,19 @@ class Connect : public IConnect {
      * @brief The subscription manager.
      */
     ISubscriptionManager& subscriptionManager_;
+    /**
+     * @brief The key of the client's subscription scope.
+     */
+    std::string subscriptionScope_ = ISubscriptionManager::kSharedScope;
+    /**
+     * @brief True once the subscription scope has been opened.
+     */
+    bool scopeOpen_ = false;
+    /**
+     * @brief The id of this connection, sent to the client so it can name
+     * its subscription scope.
+     */
+    std::string connectionId_;
     /**
      * @brief The user agent of the client.
      * 
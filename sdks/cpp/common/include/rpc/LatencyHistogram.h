@@ -0,0 +1,105 @@
+/*
+ * Copyright 2026 Ross Video Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file LatencyHistogram.h
+ * @brief Lock-free histogram of latencies in power of two buckets.
+ * @date 2026-10-16
+ * @copyright Copyright (c) 2026 Ross Video
+ */
+
+#pragma once
+
+// std
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstdint>
+
+namespace catena {
+namespace common {
+
+/**
+ * @brief Histogram of latencies which any number of threads can record into.
+ *
+ * Bucket 0 counts latencies under 1us and bucket i counts latencies in
+ * [2^(i-1), 2^i) us. The last bucket also counts everything longer.
+ */
+class LatencyHistogram {
+  public:
+    /**
+     * @brief The number of buckets. The last one starts at ~4s.
+     */
+    static constexpr size_t kBuckets = 24;
+    /**
+     * @brief A snapshot of the bucket counts.
+     */
+    using Counts = std::array<uint64_t, kBuckets>;
+
+    /**
+     * @brief Records a latency.
+     * @param latency The latency to record.
+     */
+    void record(std::chrono::nanoseconds latency) {
+        auto us = std::chrono::duration_cast<std::chrono::microseconds>(latency).count();
+        size_t bucket = us <= 0 ? 0 : std::bit_width(static_cast<uint64_t>(us));
+        if (bucket >= kBuckets) {
+            bucket = kBuckets - 1;
+        }
+        buckets_[bucket].fetch_add(1, std::memory_order_relaxed);
+    }
+    /**
+     * @brief Returns a snapshot of the bucket counts.
+     */
+    Counts counts() const {
+        Counts ans{};
+        for (size_t i = 0; i < kBuckets; ++i) {
+            ans[i] = buckets_[i].load(std::memory_order_relaxed);
+        }
+        return ans;
+    }
+    /**
+     * @brief Returns the exclusive upper bound of a bucket.
+     * @param bucket The index of the bucket.
+     */
+    static constexpr std::chrono::microseconds upperBound(size_t bucket) {
+        return std::chrono::microseconds{uint64_t{1} << bucket};
+    }
+
+  private:
+    /**
+     * @brief The bucket counts.
+     */
+    std::array<std::atomic<uint64_t>, kBuckets> buckets_{};
+};
+
+} // namespace common
+} // namespace catena
@@ -0,0 +1,215 @@
+/*
+ * Copyright 2026 Ross Video Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file ParamInfoSerializer.h
+ * @brief Coroutine that streams the ParamInfoResponses of a param tree.
+ * @date 2026-10-16
+ * @copyright Copyright (c) 2026 Ross Video
+ */
+
+#pragma once
+
+// common
+#include <IDevice.h>
+#include <IParam.h>
+#include <IAuthorizer.h>
+#include <Path.h>
+#include <rpc/ArenaPool.h>
+
+// protobuf interface
+#include <interface/param.pb.h>
+
+// std
+#include <coroutine>
+#include <exception>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace catena {
+namespace common {
+
+/**
+ * @brief ParamInfoSerializer is a coroutine that yields a ParamInfoResponse
+ * for each param of one or more param trees, in the same pre-order that
+ * ParamVisitor visits them.
+ *
+ * Responses are produced one at a time as the trees are walked, so memory is
+ * proportional to the depth of the trees rather than their size, and the
+ * first response can be sent before the rest have been built. Array lengths
+ * are attached to each array's own response as it is visited.
+ *
+ * Each response is built on one of two pooled arenas, alternating, so the
+ * arena holding the response being written is never reset while the next
+ * response is built.
+ *
+ * The params are borrowed from the device, so getNext() must be called with
+ * the device's mutex held shared. Only the roots' oids are kept between
+ * calls. Each root, and the path from it to the current param, is resolved
+ * again after every suspension in case an array on the way was resized.
+ */
+class ParamInfoSerializer {
+  public:
+    /**
+     * @brief Defines the execution behaviour of the coroutine, see
+     * Device::DeviceSerializer.
+     */
+    struct promise_type {
+        /**
+         * @brief Creates the ParamInfoSerializer owning the coroutine.
+         */
+        inline ParamInfoSerializer get_return_object() {
+            return ParamInfoSerializer(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+        /**
+         * @brief Suspends immediately, nothing is built until getNext().
+         */
+        inline std::suspend_always initial_suspend() { return {}; }
+        /**
+         * @brief Suspends before the coroutine destroys itself, it is
+         * destroyed with the ParamInfoSerializer.
+         */
+        inline std::suspend_always final_suspend() noexcept { return {}; }
+        /**
+         * @brief Points at the yielded response then suspends the coroutine.
+         */
+        inline std::suspend_always yield_value(const st2138::ParamInfoResponse& response) {
+            this->response = &response;
+            return {};
+        }
+        /**
+         * @brief Points at the last response, which lives as long as the
+         * coroutine.
+         */
+        inline void return_value(const st2138::ParamInfoResponse& response) { this->response = &response; }
+        /**
+         * @brief Stores an exception thrown by the coroutine.
+         */
+        inline void unhandled_exception() { exception_ = std::current_exception(); }
+        /**
+         * @brief Rethrows the exception thrown by the coroutine, if any.
+         */
+        inline void rethrow_if_exception() {
+            if (exception_) std::rethrow_exception(exception_);
+        }
+        /**
+         * @brief The current response returned by the coroutine.
+         */
+        const st2138::ParamInfoResponse* response = nullptr;
+        /**
+         * @brief The caught exception if one was thrown in the coroutine.
+         */
+        std::exception_ptr exception_;
+    };
+
+    /**
+     * @brief Constructs a ParamInfoSerializer.
+     */
+    ParamInfoSerializer(std::coroutine_handle<promise_type> h) : handle_(h) {}
+    /**
+     * @brief ParamInfoSerializer does not have copy semantics.
+     */
+    ParamInfoSerializer(const ParamInfoSerializer&) = delete;
+    ParamInfoSerializer& operator=(const ParamInfoSerializer&) = delete;
+    /**
+     * @brief ParamInfoSerializer has move semantics.
+     */
+    ParamInfoSerializer(ParamInfoSerializer&& other) : handle_(other.handle_) { other.handle_ = nullptr; }
+    ParamInfoSerializer& operator=(ParamInfoSerializer&& other) {
+        if (this != &other) {
+            if (handle_) handle_.destroy();
+            handle_ = other.handle_;
+            other.handle_ = nullptr;
+        }
+        return *this;
+    }
+    /**
+     * @brief Destructor.
+     */
+    ~ParamInfoSerializer() {
+        if (handle_) handle_.destroy();
+    }
+
+    /**
+     * @brief returns true if there are more responses to be serialized.
+     */
+    inline bool hasMore() const { return handle_ && !handle_.done(); }
+
+    /**
+     * @brief Gets the next ParamInfoResponse.
+     * @return The next response, valid until the next call, or an empty
+     * one if there are none left.
+     * @throw Rethrows any exception thrown while building the response.
+     */
+    const st2138::ParamInfoResponse& getNext();
+
+    /**
+     * @brief Creates a serializer for the given param trees.
+     *
+     * Each root's IDevice::paramMutex is held shared whenever it is read.
+     * Roots which no longer exist, or are no longer readable, when they are
+     * reached are skipped.
+     *
+     * @param dm The device to resolve the roots from. Must outlive the
+     * serializer.
+     * @param oids The fqoids of the params to describe, in order. Must not
+     * be empty.
+     * @param recursive If true, each root is followed by all of its
+     * descendants that the client can read.
+     * @param authz The client's authorizer. Must outlive the serializer.
+     * @return A ParamInfoSerializer.
+     */
+    static ParamInfoSerializer serialize(const IDevice& dm, std::vector<std::string> oids, bool recursive, const IAuthorizer& authz);
+
+  private:
+    /**
+     * @brief The coroutine behind serialize.
+     *
+     * The arenas are parameters rather than locals so that they live as long
+     * as the coroutine, keeping the response returned by co_return alive
+     * after the body has finished.
+     *
+     * @param even The arena for the 1st, 3rd, ... responses.
+     * @param odd The arena for the 2nd, 4th, ... responses.
+     */
+    static ParamInfoSerializer serialize_(const IDevice& dm, std::vector<std::string> oids, bool recursive, const IAuthorizer& authz,
+                                          ArenaPool::Lease even, ArenaPool::Lease odd);
+
+    /**
+     * @brief The coroutine handle, see Device::DeviceSerializer.
+     */
+    std::coroutine_handle<promise_type> handle_;
+};
+
+} // namespace common
+} // namespace catena
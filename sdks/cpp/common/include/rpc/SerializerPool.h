@@ -0,0 +1,159 @@
+/*
+ * Copyright 2026 Ross Video Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file SerializerPool.h
+ * @brief Worker pool which serializes batches of params in parallel.
+ * @date 2026-10-16
+ * @copyright Copyright (c) 2026 Ross Video
+ */
+
+#pragma once
+
+// std
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace catena {
+namespace common {
+
+/**
+ * @brief Runs the tasks of a batch across a pool of worker threads and the
+ * calling thread, returning once all of them have finished.
+ *
+ * Device::getDeviceSerializer uses it to serialize params in parallel while
+ * the caller holds the device's mutex, so the tasks may read the device but
+ * must not modify it.
+ *
+ * The caller always works on its own batch, so a batch completes even when
+ * every worker is busy with another device's. With zero workers the tasks
+ * run inline, in order.
+ */
+class SerializerPool {
+  public:
+    /**
+     * @brief A batch's task, called once with each index in [0, count).
+     */
+    using Task = std::function<void(std::size_t)>;
+
+    /**
+     * @brief Returns the process wide pool, created on first use with
+     * config::serializer_workers workers.
+     */
+    static SerializerPool& instance();
+
+    /**
+     * @brief Constructor. Starts the workers.
+     * @param workers The number of worker threads. 0 disables the pool.
+     */
+    explicit SerializerPool(std::size_t workers);
+    /**
+     * @brief Destructor. Joins the workers.
+     */
+    ~SerializerPool();
+    /**
+     * @brief SerializerPool does not have copy or move semantics.
+     */
+    SerializerPool(const SerializerPool&) = delete;
+    SerializerPool& operator=(const SerializerPool&) = delete;
+    SerializerPool(SerializerPool&&) = delete;
+    SerializerPool& operator=(SerializerPool&&) = delete;
+
+    /**
+     * @brief Returns the number of worker threads.
+     */
+    std::size_t workers() const { return workers_.size(); }
+    /**
+     * @brief Calls task with each index in [0, count) and waits for all of
+     * them to finish.
+     * @param count The number of tasks in the batch.
+     * @param task The task to run.
+     * @throw Rethrows the first exception thrown by a task, once the whole
+     * batch has finished.
+     */
+    void run(std::size_t count, const Task& task);
+
+  private:
+    /**
+     * @brief A batch being run.
+     */
+    struct Batch {
+        const Task& task;
+        std::size_t count;
+        std::atomic<std::size_t> next{0};      ///< The next index to claim.
+        std::atomic<std::size_t> finished{0};  ///< Tasks that have returned.
+        std::size_t helpers = 0;               ///< Workers using the batch, guarded by mtx_.
+        std::exception_ptr error;              ///< First exception, guarded by mtx_.
+    };
+
+    /**
+     * @brief Runs tasks from batch until none are left to claim.
+     */
+    void work_(Batch& batch);
+    /**
+     * @brief The body of a worker thread.
+     */
+    void run_();
+
+    /**
+     * @brief Guards batches_, stop_ and the batches' shared fields.
+     */
+    std::mutex mtx_;
+    /**
+     * @brief Wakes the workers when a batch is queued or on shutdown.
+     */
+    std::condition_variable work_cv_;
+    /**
+     * @brief Wakes callers when a batch's tasks have finished.
+     */
+    std::condition_variable done_cv_;
+    /**
+     * @brief Batches with tasks left to claim, oldest first.
+     */
+    std::deque<Batch*> batches_;
+    /**
+     * @brief Set to stop the workers.
+     */
+    bool stop_ = false;
+    /**
+     * @brief The worker threads.
+     */
+    std::vector<std::thread> workers_;
+};
+
+} // namespace common
+} // namespace catena
@@ -0,0 +1,118 @@
+/*
+ * Copyright 2026 Ross Video Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file SharedUpdate.h
+ * @brief An encoded push update shared between connections.
+ * @date 2026-10-16
+ * @copyright Copyright (c) 2026 Ross Video
+ */
+
+#pragma once
+
+// protobuf interface
+#include <interface/device.pb.h>
+
+// std
+#include <string>
+#include <memory>
+#include <mutex>
+#include <chrono>
+
+namespace catena {
+namespace common {
+
+/**
+ * @brief A push update which is encoded once and then shared, read-only,
+ * between every connection it is sent to.
+ *
+ * The JSON form used by REST is only produced when first asked for.
+ */
+class SharedUpdate {
+  public:
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @brief Constructor.
+     * @param msg The encoded update.
+     * @param emittedAt When the device emitted the update.
+     */
+    explicit SharedUpdate(st2138::PushUpdates&& msg, Clock::time_point emittedAt = Clock::now())
+        : msg_{std::move(msg)}, emittedAt_{emittedAt} {}
+    /**
+     * @brief SharedUpdate does not have copy or move semantics.
+     */
+    SharedUpdate(const SharedUpdate&) = delete;
+    SharedUpdate& operator=(const SharedUpdate&) = delete;
+    SharedUpdate(SharedUpdate&&) = delete;
+    SharedUpdate& operator=(SharedUpdate&&) = delete;
+
+    /**
+     * @brief Returns the update message.
+     */
+    const st2138::PushUpdates& message() const { return msg_; }
+    /**
+     * @brief Returns when the device emitted the update.
+     */
+    Clock::time_point emittedAt() const { return emittedAt_; }
+    /**
+     * @brief Returns the update as JSON, converting it on the first call.
+     *
+     * Safe to call from multiple threads. Returns an empty string if the
+     * message could not be converted.
+     */
+    const std::string& json() const;
+
+  private:
+    /**
+     * @brief The update message.
+     */
+    st2138::PushUpdates msg_;
+    /**
+     * @brief When the device emitted the update.
+     */
+    Clock::time_point emittedAt_;
+    /**
+     * @brief Guards the one time conversion to JSON.
+     */
+    mutable std::once_flag jsonOnce_;
+    /**
+     * @brief The update as JSON.
+     */
+    mutable std::string json_;
+};
+
+/**
+ * @brief Shared ptr to an immutable SharedUpdate.
+ */
+using SharedUpdatePtr = std::shared_ptr<const SharedUpdate>;
+
+} // namespace common
+} // namespace catena
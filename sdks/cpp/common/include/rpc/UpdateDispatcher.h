@@ -0,0 +1,198 @@
+/*
+ * Copyright 2026 Ross Video Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file UpdateDispatcher.h
+ * @brief Worker pool which delivers push updates off the emitting thread.
+ * @date 2026-10-16
+ * @copyright Copyright (c) 2026 Ross Video
+ */
+
+#pragma once
+
+// common
+#include "LatencyHistogram.h"
+
+// std
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace catena {
+namespace common {
+
+/**
+ * @brief Runs push update delivery on a pool of worker threads so that
+ * emitting a device signal only costs an enqueue.
+ *
+ * Each worker owns a lock-free multi-producer single-consumer queue. Jobs
+ * are assigned to workers by key, so jobs posted with the same key (e.g. the
+ * same device) run in the order they were posted.
+ *
+ * With zero workers the dispatcher is disabled and callers deliver updates
+ * inline, as before.
+ */
+class UpdateDispatcher {
+  public:
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @brief Dispatcher metrics.
+     */
+    struct Metrics {
+        std::vector<size_t> depth;  ///< Jobs waiting in each worker's queue.
+        size_t maxDepth = 0;        ///< Largest depth seen by any worker.
+        uint64_t dispatched = 0;    ///< Jobs run.
+        LatencyHistogram::Counts dispatchLatency{}; ///< Post to start of job.
+        LatencyHistogram::Counts writeLatency{};    ///< Emit to handed to a writer.
+    };
+
+    /**
+     * @brief Returns the process wide dispatcher, created on first use with
+     * config::push_update_workers workers.
+     */
+    static UpdateDispatcher& instance();
+
+    /**
+     * @brief Constructor. Starts the workers.
+     * @param workers The number of worker threads. 0 disables dispatching.
+     */
+    explicit UpdateDispatcher(size_t workers);
+    /**
+     * @brief Destructor. Runs the remaining jobs and joins the workers.
+     */
+    ~UpdateDispatcher();
+    /**
+     * @brief UpdateDispatcher does not have copy or move semantics.
+     */
+    UpdateDispatcher(const UpdateDispatcher&) = delete;
+    UpdateDispatcher& operator=(const UpdateDispatcher&) = delete;
+    UpdateDispatcher(UpdateDispatcher&&) = delete;
+    UpdateDispatcher& operator=(UpdateDispatcher&&) = delete;
+
+    /**
+     * @brief Returns true if jobs are run on worker threads.
+     */
+    bool async() const { return !workers_.empty(); }
+    /**
+     * @brief Queues a job. Never blocks.
+     *
+     * If the dispatcher is disabled the job is run inline.
+     *
+     * @param key Jobs with the same key run in order on the same worker.
+     * @param job The job to run.
+     */
+    void post(size_t key, std::function<void()> job);
+    /**
+     * @brief Records the time from an update being emitted to it being
+     * handed to a connection's writer.
+     * @param emittedAt When the update was emitted.
+     */
+    void recordWrite(Clock::time_point emittedAt) {
+        writeLatency_.record(Clock::now() - emittedAt);
+    }
+    /**
+     * @brief Returns the dispatcher's metrics.
+     */
+    Metrics metrics() const;
+
+  private:
+    /**
+     * @brief A queued job.
+     */
+    struct Node {
+        std::function<void()> job;
+        Clock::time_point postedAt;
+        std::atomic<Node*> next{nullptr};
+    };
+
+    /**
+     * @brief A worker thread and its queue.
+     *
+     * The queue is an intrusive MPSC list: producers exchange tail_ and link
+     * the previous tail to their node, the worker follows next from head_.
+     */
+    struct Worker {
+        Worker();
+        ~Worker();
+        /**
+         * @brief Adds a node to the queue. Safe from any thread.
+         */
+        void push(Node* node);
+        /**
+         * @brief Removes the oldest node, or returns nullptr if the queue is
+         * empty or a push is mid-way. Worker thread only.
+         */
+        Node* pop();
+
+        Node stub_;
+        Node* head_;
+        std::atomic<Node*> tail_;
+        std::atomic<size_t> depth_{0};
+        std::atomic<uint32_t> wake_{0};
+        std::thread thread_;
+    };
+
+    /**
+     * @brief The body of a worker thread.
+     */
+    void run_(Worker& worker);
+
+    /**
+     * @brief The workers.
+     */
+    std::vector<std::unique_ptr<Worker>> workers_;
+    /**
+     * @brief Set to stop the workers once their queues are empty.
+     */
+    std::atomic<bool> stop_{false};
+    /**
+     * @brief Largest queue depth seen.
+     */
+    std::atomic<size_t> maxDepth_{0};
+    /**
+     * @brief Jobs run.
+     */
+    std::atomic<uint64_t> dispatched_{0};
+    /**
+     * @brief Time from post to the start of each job.
+     */
+    LatencyHistogram dispatchLatency_;
+    /**
+     * @brief Time from emit to handing each update to a writer.
+     */
+    LatencyHistogram writeLatency_;
+};
+
+} // namespace common
+} // namespace catena
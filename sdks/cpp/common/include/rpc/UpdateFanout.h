@@ -0,0 +1,262 @@
+/*
+ * Copyright 2026 Ross Video Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file UpdateFanout.h
+ * @brief Fans device push updates out to every connection, serializing each
+ * update once per scope class.
+ * @date 2026-10-16
+ * @copyright Copyright (c) 2026 Ross Video
+ */
+
+#pragma once
+
+// common
+#include <IDevice.h>
+#include <IParam.h>
+#include <ILanguagePack.h>
+#include <Authorizer.h>
+#include "SharedUpdate.h"
+#include "UpdateDispatcher.h"
+
+// std
+#include <string>
+#include <vector>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+
+namespace catena {
+namespace common {
+
+class Connect;
+
+/**
+ * @brief Serializes a single emitted update on behalf of many connections.
+ *
+ * Each connection asks for the update with its own authorizer and gets back
+ * the update encoded for its read scopes. Connections whose authorizers share
+ * a readScopeKey() share the same encoded update.
+ */
+class UpdateEncoder {
+  public:
+    /**
+     * @brief Constructs an encoder for a param update.
+     * @param oid The OID of the updated param.
+     * @param p The updated param.
+     * @param slot The slot of the device containing the param.
+     * @param emittedAt When the device emitted the update.
+     */
+    UpdateEncoder(const std::string& oid, const IParam* p, uint32_t slot,
+                  SharedUpdate::Clock::time_point emittedAt = SharedUpdate::Clock::now())
+        : oid_{&oid}, param_{p}, languagePack_{nullptr}, slot_{slot}, emittedAt_{emittedAt} {}
+    /**
+     * @brief Constructs an encoder for a language pack update.
+     * @param l The added language pack.
+     * @param slot The slot of the device containing the language pack.
+     * @param emittedAt When the device emitted the update.
+     */
+    UpdateEncoder(const ILanguagePack* l, uint32_t slot,
+                  SharedUpdate::Clock::time_point emittedAt = SharedUpdate::Clock::now())
+        : oid_{nullptr}, param_{nullptr}, languagePack_{l}, slot_{slot}, emittedAt_{emittedAt} {}
+    /**
+     * @brief UpdateEncoder does not have copy or move semantics.
+     */
+    UpdateEncoder(const UpdateEncoder&) = delete;
+    UpdateEncoder& operator=(const UpdateEncoder&) = delete;
+    UpdateEncoder(UpdateEncoder&&) = delete;
+    UpdateEncoder& operator=(UpdateEncoder&&) = delete;
+
+    /**
+     * @brief Returns the update encoded for the authorizer's read scopes,
+     * encoding it if no authorizer with the same scopes has asked yet.
+     *
+     * @param authz The authorizer of the connection.
+     * @return The encoded update, or nullptr if the param failed to
+     * serialize.
+     * @throw Throws a catena::exception_with_status if serialization throws.
+     */
+    SharedUpdatePtr encode(const Authorizer& authz);
+    /**
+     * @brief Returns the number of times the update has been serialized.
+     */
+    size_t encodings() const { return encoded_.size(); }
+
+  private:
+    /**
+     * @brief The OID of the updated param, or nullptr for language pack
+     * updates.
+     */
+    const std::string* oid_;
+    /**
+     * @brief The updated param, or nullptr for language pack updates.
+     */
+    const IParam* param_;
+    /**
+     * @brief The added language pack, or nullptr for param updates.
+     */
+    const ILanguagePack* languagePack_;
+    /**
+     * @brief The slot of the device the update came from.
+     */
+    uint32_t slot_;
+    /**
+     * @brief When the device emitted the update.
+     */
+    SharedUpdate::Clock::time_point emittedAt_;
+    /**
+     * @brief Encoded updates by readScopeKey().
+     *
+     * Clients typically fall into a handful of scope classes, so a vector
+     * beats a map here.
+     */
+    std::vector<std::pair<std::string, SharedUpdatePtr>> encoded_;
+};
+
+/**
+ * @brief Receives push updates from one device and hands them to every
+ * connection subscribed to it.
+ *
+ * There is one UpdateFanout per device and slot, shared by all connections
+ * of all services, which replaces each connection listening to the device's
+ * signals itself. Every emit is serialized at most once per scope class
+ * rather than once per connection.
+ *
+ * When UpdateDispatcher is enabled the emitting thread only copies the param
+ * handle and queues the fan-out; serialization and queueing to connections
+ * happen on a dispatcher worker, which takes the device's mutex while
+ * reading the param.
+ */
+class UpdateFanout : public std::enable_shared_from_this<UpdateFanout> {
+  public:
+    /**
+     * @brief Returns the fanout for the device and slot, creating it if no
+     * connection holds it.
+     * @param dm The device.
+     * @param slot The slot of the device.
+     */
+    static std::shared_ptr<UpdateFanout> get(IDevice& dm, uint32_t slot);
+    /**
+     * @brief Constructor. Connects to the device's signals. Use get() rather
+     * than constructing directly.
+     * @param dm The device.
+     * @param slot The slot of the device.
+     */
+    UpdateFanout(IDevice& dm, uint32_t slot);
+    /**
+     * @brief Destructor. Disconnects from the device's signals.
+     */
+    ~UpdateFanout();
+    /**
+     * @brief UpdateFanout does not have copy or move semantics.
+     */
+    UpdateFanout(const UpdateFanout&) = delete;
+    UpdateFanout& operator=(const UpdateFanout&) = delete;
+    UpdateFanout(UpdateFanout&&) = delete;
+    UpdateFanout& operator=(UpdateFanout&&) = delete;
+
+    /**
+     * @brief Starts sending updates to a connection.
+     * @param connection The connection.
+     */
+    void add(Connect* connection);
+    /**
+     * @brief Stops sending updates to a connection. Blocks until any update
+     * being sent to it has finished.
+     * @param connection The connection.
+     */
+    void remove(const Connect* connection);
+    /**
+     * @brief Returns the number of connections receiving updates.
+     */
+    size_t size() const;
+
+  private:
+    /**
+     * @brief Sends a param update to every connection.
+     */
+    void onValue_(const std::string& oid, const IParam* p);
+    /**
+     * @brief Sends a language pack update to every connection.
+     */
+    void onLanguage_(const ILanguagePack* l);
+    /**
+     * @brief Hands an encoded param update to every connection.
+     */
+    void deliver_(const std::string& oid, const IParam* p, UpdateEncoder& encoder);
+    /**
+     * @brief Hands an encoded language pack update to every connection.
+     */
+    void deliver_(const ILanguagePack* l, UpdateEncoder& encoder);
+    /**
+     * @brief Resolves the param an update was emitted for. The caller must
+     * hold a ParamReadLock for oid.
+     * @param oid The oid the update was emitted for. An append ("/-") is
+     * resolved to the array's last element.
+     * @return The param, or nullptr if oid no longer resolves.
+     */
+    std::unique_ptr<IParam> resolve_(const std::string& oid) const;
+
+    /**
+     * @brief The device.
+     */
+    IDevice& dm_;
+    /**
+     * @brief The slot of the device.
+     */
+    uint32_t slot_;
+    /**
+     * @brief Signal ids to disconnect on destruction.
+     */
+    uint32_t valueSetByServerId_;
+    uint32_t valueSetByClientId_;
+    uint32_t languageAddedId_;
+    /**
+     * @brief Guards connections_. Held shared while an update is sent.
+     */
+    mutable std::shared_mutex mtx_;
+    /**
+     * @brief The connections receiving updates.
+     */
+    std::vector<Connect*> connections_;
+
+    /**
+     * @brief Guards registry_.
+     */
+    static std::mutex registryMtx_;
+    /**
+     * @brief The live fanouts by device and slot.
+     */
+    static std::map<std::pair<const IDevice*, uint32_t>, std::weak_ptr<UpdateFanout>> registry_;
+};
+
+} // namespace common
+} // namespace catena
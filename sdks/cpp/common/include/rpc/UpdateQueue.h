@@ -0,0 +1,174 @@
+/*
+ * Copyright 2026 Ross Video Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file UpdateQueue.h
+ * @brief Bounded queue of push updates owned by a single Connect.
+ * @date 2026-10-16
+ * @copyright Copyright (c) 2026 Ross Video
+ */
+
+#pragma once
+
+// common
+#include "SharedUpdate.h"
+
+// std
+#include <string>
+#include <list>
+#include <vector>
+#include <unordered_map>
+#include <chrono>
+#include <cstdint>
+
+namespace catena {
+namespace common {
+
+/**
+ * @brief Bounded queue of push updates which coalesces value updates by
+ * (slot, oid).
+ *
+ * Only the latest value of each oid is kept, in the position of the first
+ * undelivered update to it, so a fast-changing param can not starve the
+ * others. Updates without an oid (language packs) are never coalesced.
+ *
+ * The queue does no locking of its own; the owning Connect guards it with
+ * its mutex.
+ */
+class UpdateQueue {
+  public:
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @brief What to do with a new update when the queue is full.
+     */
+    enum class Overflow {
+        kDropOldest, ///< Discard the oldest queued update.
+        kDisconnect  ///< Reject the update and flag the consumer as too slow.
+    };
+
+    /**
+     * @brief Lag metrics for a single connection.
+     */
+    struct Metrics {
+        size_t depth = 0;         ///< Updates currently queued.
+        size_t maxDepth = 0;      ///< Configured queue depth.
+        uint64_t enqueued = 0;    ///< Updates accepted into the queue.
+        uint64_t coalesced = 0;   ///< Updates merged into a queued one.
+        uint64_t dropped = 0;     ///< Updates discarded on overflow.
+        uint64_t delivered = 0;   ///< Updates handed to the writer.
+        std::chrono::microseconds lastLag{0}; ///< Queue time of the last update drained.
+        std::chrono::microseconds maxLag{0};  ///< Longest queue time seen.
+    };
+
+    /**
+     * @brief Constructor.
+     * @param maxDepth The maximum number of queued updates, at least 1.
+     * @param overflow The overflow policy.
+     */
+    UpdateQueue(size_t maxDepth, Overflow overflow);
+    /**
+     * @brief Queues a value update, replacing any queued update to the same
+     * oid in the same slot.
+     * @param slot The slot of the device the update came from.
+     * @param oid The oid of the updated param.
+     * @param update The update to send.
+     * @return False if the update was rejected by the kDisconnect policy.
+     */
+    bool push(uint32_t slot, const std::string& oid, SharedUpdatePtr update);
+    /**
+     * @brief Queues an update which is never coalesced.
+     * @param update The update to send.
+     * @return False if the update was rejected by the kDisconnect policy.
+     */
+    bool push(SharedUpdatePtr update);
+    /**
+     * @brief Moves up to maxBatch of the oldest updates onto the end of batch.
+     * @param batch The vector to append the updates to.
+     * @param maxBatch The maximum number of updates to move.
+     * @return The number of updates moved.
+     */
+    size_t drain(std::vector<SharedUpdatePtr>& batch, size_t maxBatch);
+    /**
+     * @brief Returns true if there are no queued updates.
+     */
+    bool empty() const { return queue_.empty(); }
+    /**
+     * @brief Returns the number of queued updates.
+     */
+    size_t size() const { return queue_.size(); }
+    /**
+     * @brief Returns true if an update has been rejected by the kDisconnect
+     * policy.
+     */
+    bool overflowed() const { return overflowed_; }
+    /**
+     * @brief Returns the queue's lag metrics.
+     */
+    Metrics metrics() const;
+
+  private:
+    /**
+     * @brief A queued update.
+     */
+    struct Entry {
+        std::string key;
+        SharedUpdatePtr update;
+        Clock::time_point queuedAt;
+    };
+    /**
+     * @brief Shared implementation of push. An empty key is never coalesced.
+     */
+    bool push_(std::string&& key, SharedUpdatePtr update);
+
+    /**
+     * @brief The updates in the order they will be sent.
+     */
+    std::list<Entry> queue_;
+    /**
+     * @brief Index of queued value updates by "slot:oid".
+     */
+    std::unordered_map<std::string, std::list<Entry>::iterator> index_;
+    /**
+     * @brief The overflow policy.
+     */
+    Overflow overflow_;
+    /**
+     * @brief True once an update has been rejected by kDisconnect.
+     */
+    bool overflowed_ = false;
+    /**
+     * @brief Running lag metrics.
+     */
+    Metrics metrics_;
+};
+
+} // namespace common
+} // namespace catena
@@ -0,0 +1,138 @@
+/*
+ * Copyright 2026 Ross Video Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file ArenaPool.cpp
+ * @brief Implements ArenaPool.
+ * @date 2026-10-16
+ * @copyright Copyright (c) 2026 Ross Video
+ */
+
+// common
+#include <rpc/ArenaPool.h>
+#include <Config.h>
+
+using catena::common::ArenaPool;
+
+namespace {
+
+/**
+ * @brief Options which start an arena with the given block.
+ */
+google::protobuf::ArenaOptions blockOptions(char* block, std::size_t blockSize) {
+    google::protobuf::ArenaOptions options;
+    options.initial_block = block;
+    options.initial_block_size = blockSize;
+    return options;
+}
+
+} // namespace
+
+ArenaPool::Lease::Entry::Entry(std::size_t blockSize)
+    : block{new char[blockSize]}, arena{blockOptions(block.get(), blockSize)} {}
+
+ArenaPool::Lease::Lease(ArenaPool& pool, std::unique_ptr<Entry> entry)
+    : pool_{&pool}, entry_{std::move(entry)} {}
+
+ArenaPool::Lease::~Lease() {
+    if (entry_) {
+        pool_->release_(std::move(entry_));
+    }
+}
+
+google::protobuf::Arena* ArenaPool::Lease::arena() const {
+    return &entry_->arena;
+}
+
+void ArenaPool::Lease::reset() {
+    pool_->reset_(*entry_);
+}
+
+ArenaPool& ArenaPool::instance() {
+    static ArenaPool pool(config::arena_pool_size);
+    return pool;
+}
+
+ArenaPool::ArenaPool(std::size_t capacity, std::size_t blockSize)
+    : capacity_{capacity}, blockSize_{blockSize} {
+    idle_.reserve(capacity_);
+}
+
+ArenaPool::~ArenaPool() = default;
+
+ArenaPool::Lease ArenaPool::acquire() {
+    leases_.fetch_add(1, std::memory_order_relaxed);
+    std::unique_ptr<Lease::Entry> entry;
+    {
+        std::lock_guard lock(mtx_);
+        if (!idle_.empty()) {
+            entry = std::move(idle_.back());
+            idle_.pop_back();
+        }
+    }
+    if (!entry) {
+        arenas_.fetch_add(1, std::memory_order_relaxed);
+        entry = std::make_unique<Lease::Entry>(blockSize_);
+    }
+    return Lease(*this, std::move(entry));
+}
+
+void ArenaPool::reset_(Lease::Entry& entry) {
+    // SpaceAllocated includes the arena's own block
+    uint64_t allocated = entry.arena.SpaceAllocated();
+    bytesUsed_.fetch_add(entry.arena.SpaceUsed(), std::memory_order_relaxed);
+    if (allocated > blockSize_) {
+        bytesSpilled_.fetch_add(allocated - blockSize_, std::memory_order_relaxed);
+    }
+    // Frees everything but the block, destroying the messages
+    entry.arena.Reset();
+}
+
+void ArenaPool::release_(std::unique_ptr<Lease::Entry> entry) {
+    reset_(*entry);
+    std::lock_guard lock(mtx_);
+    if (idle_.size() < capacity_) {
+        idle_.push_back(std::move(entry));
+    }
+}
+
+std::size_t ArenaPool::idle() const {
+    std::lock_guard lock(mtx_);
+    return idle_.size();
+}
+
+ArenaPool::Stats ArenaPool::stats() const {
+    return Stats{
+        leases_.load(std::memory_order_relaxed),
+        arenas_.load(std::memory_order_relaxed),
+        bytesUsed_.load(std::memory_order_relaxed),
+        bytesSpilled_.load(std::memory_order_relaxed)
+    };
+}
@@ -0,0 +1,143 @@
+/*
+ * Copyright 2026 Ross Video Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+//common
+#include <AtomicValue.h>
+#include <IParam.h>
+#include <StructInfo.h>
+
+// protobuf interface
+#include <interface/param.pb.h>
+
+using namespace catena::common;
+
+/*
+ * AtomicValues serialize a snapshot of their value with the plain value's
+ * specializations, and store the result of the plain value's fromProto.
+ */
+namespace {
+
+template <typename T>
+catena::exception_with_status atomicToProto(st2138::Value& dst, const AtomicValue<T>* src, const IParamDescriptor& pd, const IAuthorizer& authz) {
+    T value = src->load();
+    return toProto<T>(dst, &value, pd, authz);
+}
+
+template <typename T>
+catena::exception_with_status atomicToJson(std::string& dst, const AtomicValue<T>* src, const IParamDescriptor& pd, const IAuthorizer& authz) {
+    T value = src->load();
+    return toJson<T>(dst, &value, pd, authz);
+}
+
+template <typename T>
+bool atomicValidFromProto(const st2138::Value& src, const AtomicValue<T>* dst, const IParamDescriptor& pd, catena::exception_with_status& rc, const IAuthorizer& authz) {
+    T value = dst->load();
+    return validFromProto<T>(src, &value, pd, rc, authz);
+}
+
+template <typename T>
+catena::exception_with_status atomicFromProto(const st2138::Value& src, AtomicValue<T>* dst, const IParamDescriptor& pd, const IAuthorizer& authz) {
+    T value = dst->load();
+    catena::exception_with_status rc = fromProto<T>(src, &value, pd, authz);
+    if (rc.status == catena::StatusCode::OK) {
+        dst->store(value);
+    }
+    return rc;
+}
+
+} // namespace
+
+template<>
+catena::exception_with_status catena::common::toProto<AtomicValue<int32_t>>(st2138::Value& dst, const AtomicValue<int32_t>* src, const IParamDescriptor& pd, const IAuthorizer& authz) {
+    return atomicToProto(dst, src, pd, authz);
+}
+
+template<>
+catena::exception_with_status catena::common::toJson<AtomicValue<int32_t>>(std::string& dst, const AtomicValue<int32_t>* src, const IParamDescriptor& pd, const IAuthorizer& authz) {
+    return atomicToJson(dst, src, pd, authz);
+}
+
+template<>
+bool catena::common::validFromProto<AtomicValue<int32_t>>(const st2138::Value& src, const AtomicValue<int32_t>* dst, const IParamDescriptor& pd, catena::exception_with_status& rc, const IAuthorizer& authz) {
+    return atomicValidFromProto(src, dst, pd, rc, authz);
+}
+
+template<>
+catena::exception_with_status catena::common::fromProto<AtomicValue<int32_t>>(const st2138::Value& src, AtomicValue<int32_t>* dst, const IParamDescriptor& pd, const IAuthorizer& authz) {
+    return atomicFromProto(src, dst, pd, authz);
+}
+
+template<>
+catena::exception_with_status catena::common::toProto<AtomicValue<float>>(st2138::Value& dst, const AtomicValue<float>* src, const IParamDescriptor& pd, const IAuthorizer& authz) {
+    return atomicToProto(dst, src, pd, authz);
+}
+
+template<>
+catena::exception_with_status catena::common::toJson<AtomicValue<float>>(std::string& dst, const AtomicValue<float>* src, const IParamDescriptor& pd, const IAuthorizer& authz) {
+    return atomicToJson(dst, src, pd, authz);
+}
+
+template<>
+bool catena::common::validFromProto<AtomicValue<float>>(const st2138::Value& src, const AtomicValue<float>* dst, const IParamDescriptor& pd, catena::exception_with_status& rc, const IAuthorizer& authz) {
+    return atomicValidFromProto(src, dst, pd, rc, authz);
+}
+
+template<>
+catena::exception_with_status catena::common::fromProto<AtomicValue<float>>(const st2138::Value& src, AtomicValue<float>* dst, const IParamDescriptor& pd, const IAuthorizer& authz) {
+    return atomicFromProto(src, dst, pd, authz);
+}
+
+template<>
+catena::exception_with_status catena::common::toProto<AtomicValue<std::string>>(st2138::Value& dst, const AtomicValue<std::string>* src, const IParamDescriptor& pd, const IAuthorizer& authz) {
+    return atomicToProto(dst, src, pd, authz);
+}
+
+template<>
+catena::exception_with_status catena::common::toJson<AtomicValue<std::string>>(std::string& dst, const AtomicValue<std::string>* src, const IParamDescriptor& pd, const IAuthorizer& authz) {
+    return atomicToJson(dst, src, pd, authz);
+}
+
+template<>
+bool catena::common::validFromProto<AtomicValue<std::string>>(const st2138::Value& src, const AtomicValue<std::string>* dst, const IParamDescriptor& pd, catena::exception_with_status& rc, const IAuthorizer& authz) {
+    // Must fit in the cell as well as satisfy the param's own limits
+    if (atomicValidFromProto(src, dst, pd, rc, authz) && src.string_value().size() > AtomicValue<std::string>::kCapacity) {
+        rc = catena::exception_with_status("Param " + pd.getOid() + " exceeds maximum capacity", catena::StatusCode::OUT_OF_RANGE);
+    }
+    return rc.status == catena::StatusCode::OK;
+}
+
+template<>
+catena::exception_with_status catena::common::fromProto<AtomicValue<std::string>>(const st2138::Value& src, AtomicValue<std::string>* dst, const IParamDescriptor& pd, const IAuthorizer& authz) {
+    catena::exception_with_status rc{"", catena::StatusCode::OK};
+    if (validFromProto(src, dst, pd, rc, authz)) {
+        dst->store(src.string_value());
+    }
+    return rc;
+}
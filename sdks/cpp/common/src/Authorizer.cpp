@@ -30,7 +30,12 @@
 
 #include <Authorizer.h>
 
+#include <string_view>
+#include <unordered_map>
+
 using catena::common::Authorizer;
+using catena::common::Scopes_e;
+using catena::common::Scopes;
 
 // initialize the disabled authorization object with private constructor.
 Authorizer Authorizer::kAuthzDisabled;
@@ -51,12 +56,60 @@ Authorizer::Authorizer(const std::string& JWSToken) {
             // Extracting exp if present.
             } else if (it->first == "exp") {
                 exp_ = it->second.get<double>();
+            // Extracting sub if present.
+            } else if (it->first == "sub") {
+                subject_ = it->second.get<std::string>();
             }
         }
     // Catch error.
     } catch (...) {
         throw catena::exception_with_status("Invalid JWS Token", catena::StatusCode::UNAUTHENTICATED);
     }
+    // Write scopes also grant read, so "scope" and "scope:w" read the same.
+    std::set<std::string> readScopes;
+    for (const std::string& scope : clientScopes_) {
+        readScopes.insert(scope.ends_with(":w") ? scope.substr(0, scope.size() - 2) : scope);
+    }
+    for (const std::string& scope : readScopes) {
+        readScopeKey_.append(scope).append(1, ' ');
+    }
+    updateScopeMasks_();
+}
+
+void Authorizer::updateScopeMasks_() {
+    readScopes_ = 0;
+    writeScopes_ = 0;
+    for (const std::string& scope : clientScopes_) {
+        Scopes_e value;
+        if (scope.ends_with(":w") && toScope_(scope.substr(0, scope.size() - 2), value)) {
+            readScopes_ |= scopeBit_(value);
+            writeScopes_ |= scopeBit_(value);
+        } else if (toScope_(scope, value)) {
+            readScopes_ |= scopeBit_(value);
+        }
+    }
+}
+
+bool Authorizer::toScope_(const std::string& scope, Scopes_e& ans) {
+    // Built once, read concurrently by every authorizer.
+    static const std::unordered_map<std::string_view, Scopes_e> kScopes = []() {
+        std::unordered_map<std::string_view, Scopes_e> scopes;
+        for (const auto& [value, name] : Scopes().getForwardMap()) {
+            scopes.emplace(name, value);
+        }
+        return scopes;
+    }();
+    auto it = kScopes.find(scope);
+    if (it == kScopes.end()) {
+        return false;
+    }
+    ans = it->second;
+    return true;
+}
+
+Authorizer::ScopeMask Authorizer::scopeMask(const std::string& scope) {
+    Scopes_e value;
+    return toScope_(scope, value) ? scopeBit_(value) : 0;
 }
 
 bool Authorizer::isExpired() const {
@@ -73,36 +126,58 @@ bool Authorizer::hasAuthz_(const std::string& scope) const {
  * Check if the client has write authorization
  */
 bool Authorizer::writeAuthz(const std::string& scope) const {
+    Scopes_e value;
+    if (toScope_(scope, value)) {
+        return writeAuthz(value);
+    }
+    // Scopes outside of Scopes_e are looked up by name.
     return hasAuthz_(scope + ":w");
 }
 
 bool Authorizer::writeAuthz(const Scopes_e& scope) const {
-    return writeAuthz(Scopes().getForwardMap().at(scope));
+    return this == &kAuthzDisabled || (writeScopes_ & scopeBit_(scope));
 }
 
 bool Authorizer::writeAuthz(const IParam& param) const {
-    return !param.readOnly() && writeAuthz(param.getScope());
+    if (param.readOnly()) {
+        return false;
+    }
+    // Use the precomputed bit, falling back to the name if there isn't one.
+    ScopeMask bit = param.getScopeMask();
+    return bit ? (this == &kAuthzDisabled || (writeScopes_ & bit)) : writeAuthz(param.getScope());
 }
 
 bool Authorizer::writeAuthz(const IParamDescriptor& pd) const {
-    return !pd.readOnly() && writeAuthz(pd.getScope());
+    if (pd.readOnly()) {
+        return false;
+    }
+    ScopeMask bit = pd.getScopeMask();
+    return bit ? (this == &kAuthzDisabled || (writeScopes_ & bit)) : writeAuthz(pd.getScope());
 }
 
 /*
  * Check if the client has read authorization
  */
 bool Authorizer::readAuthz(const std::string& scope) const {
-    return hasAuthz_(scope) || writeAuthz(scope);
+    Scopes_e value;
+    if (toScope_(scope, value)) {
+        return readAuthz(value);
+    }
+    // Scopes outside of Scopes_e are looked up by name.
+    return hasAuthz_(scope) || hasAuthz_(scope + ":w");
 }
 
 bool Authorizer::readAuthz(const Scopes_e& scope) const {
-    return readAuthz(Scopes().getForwardMap().at(scope));
+    return this == &kAuthzDisabled || (readScopes_ & scopeBit_(scope));
 }
 
 bool Authorizer::readAuthz(const IParam& param) const {
-    return readAuthz(param.getScope());
+    // Use the precomputed bit, falling back to the name if there isn't one.
+    ScopeMask bit = param.getScopeMask();
+    return bit ? (this == &kAuthzDisabled || (readScopes_ & bit)) : readAuthz(param.getScope());
 }
 
 bool Authorizer::readAuthz(const IParamDescriptor& pd) const {
-    return readAuthz(pd.getScope());
+    ScopeMask bit = pd.getScopeMask();
+    return bit ? (this == &kAuthzDisabled || (readScopes_ & bit)) : readAuthz(pd.getScope());
 }
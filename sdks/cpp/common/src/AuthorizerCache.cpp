@@ -0,0 +1,98 @@
+/*
+ * Copyright 2026 Ross Video Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file AuthorizerCache.cpp
+ * @brief Implements AuthorizerCache.
+ * @date 2026-10-16
+ * @copyright Copyright (c) 2026 Ross Video
+ */
+
+// common
+#include <AuthorizerCache.h>
+#include <Config.h>
+
+using catena::common::Authorizer;
+using catena::common::AuthorizerCache;
+
+AuthorizerCache& AuthorizerCache::instance() {
+    static AuthorizerCache cache(config::authz_cache_size);
+    return cache;
+}
+
+std::shared_ptr<Authorizer> AuthorizerCache::get(const std::string& jwsToken) {
+    if (capacity_ == 0) {
+        return std::make_shared<Authorizer>(jwsToken);
+    }
+    {
+        std::lock_guard lock(mtx_);
+        auto it = index_.find(jwsToken);
+        if (it != index_.end()) {
+            Entries::iterator entry = it->second;
+            if (!entry->second->isExpired()) {
+                entries_.splice(entries_.begin(), entries_, entry);
+                return entry->second;
+            }
+            index_.erase(it);
+            entries_.erase(entry);
+        }
+    }
+    // Decoding is the slow part, so it happens without the lock. Throws if
+    // the token is invalid.
+    std::shared_ptr<Authorizer> authz = std::make_shared<Authorizer>(jwsToken);
+    if (authz->isExpired()) {
+        return authz;
+    }
+    std::lock_guard lock(mtx_);
+    // Another request may have decoded the same token in the meantime.
+    auto it = index_.find(jwsToken);
+    if (it != index_.end()) {
+        entries_.splice(entries_.begin(), entries_, it->second);
+        return it->second->second;
+    }
+    entries_.emplace_front(jwsToken, authz);
+    index_.emplace(entries_.front().first, entries_.begin());
+    while (entries_.size() > capacity_) {
+        index_.erase(entries_.back().first);
+        entries_.pop_back();
+    }
+    return authz;
+}
+
+std::size_t AuthorizerCache::size() const {
+    std::lock_guard lock(mtx_);
+    return entries_.size();
+}
+
+void AuthorizerCache::clear() {
+    std::lock_guard lock(mtx_);
+    index_.clear();
+    entries_.clear();
+}
@@ -0,0 +1,98 @@
+/*
+ * Copyright 2026 Ross Video Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file CommandExecutor.cpp
+ * @brief Implements CommandExecutor.
+ * @date 2026-10-16
+ * @copyright Copyright (c) 2026 Ross Video
+ */
+
+// common
+#include <rpc/CommandExecutor.h>
+#include <Config.h>
+
+using catena::common::CommandExecutor;
+
+CommandExecutor& CommandExecutor::instance() {
+    static CommandExecutor executor(config::command_workers);
+    return executor;
+}
+
+CommandExecutor::CommandExecutor(std::size_t workers) {
+    for (std::size_t i = 0; i < workers; ++i) {
+        workers_.emplace_back([this]() { run_(); });
+    }
+}
+
+CommandExecutor::~CommandExecutor() {
+    {
+        std::lock_guard lock(mtx_);
+        stop_ = true;
+    }
+    cv_.notify_all();
+    for (auto& worker : workers_) {
+        worker.join();
+    }
+}
+
+void CommandExecutor::post(std::function<void()> job) {
+    if (workers_.empty()) {
+        try {
+            job();
+        } catch (...) {} // GCOVR_EXCL_LINE
+        return;
+    }
+    {
+        std::lock_guard lock(mtx_);
+        jobs_.push_back(std::move(job));
+    }
+    cv_.notify_one();
+}
+
+void CommandExecutor::run_() {
+    while (true) {
+        std::function<void()> job;
+        {
+            std::unique_lock lock(mtx_);
+            cv_.wait(lock, [this]() { return stop_ || !jobs_.empty(); });
+            // Only stopping once every queued job has run.
+            if (jobs_.empty()) {
+                break;
+            }
+            job = std::move(jobs_.front());
+            jobs_.pop_front();
+        }
+        // Responders report their own errors, this is a last resort.
+        try {
+            job();
+        } catch (...) {} // GCOVR_EXCL_LINE
+    }
+}
@@ -43,9 +43,20 @@ std::pair<bool, int> config::initConfigVariables(int argc, char* argv[], std::st
             (DEFAULT_MAX_ARRAY_SIZE_KEY.c_str(), po::value<uint32_t>()->default_value(kDefaultMaxArrayLength), "Use this to define the default max length for array and string params.")
             (DEFAULT_TOTAL_ARRAY_SIZE_KEY.c_str(), po::value<uint32_t>()->default_value(kDefaultMaxArrayLength), "Use this to define the default total length for string array params.")
             (MAX_CONNECTIONS_KEY.c_str(), po::value<uint32_t>()->default_value(DEFAULT_MAX_CONNECTIONS), "Use this to define the total number of concurrent connections that can be made to a service.")
+            (UPDATE_QUEUE_DEPTH_KEY.c_str(), po::value<uint32_t>()->default_value(UPDATE_QUEUE_DEPTH_DEFAULT), "Maximum number of push updates queued for each connection.")
+            (UPDATE_QUEUE_OVERFLOW_KEY.c_str(), po::value<std::string>()->default_value(UPDATE_QUEUE_OVERFLOW_DEFAULT), "What to do when a connection's update queue is full, options are: \"drop_oldest\", \"disconnect\"")
+            (PUSH_UPDATE_WORKERS_KEY.c_str(), po::value<uint32_t>()->default_value(PUSH_UPDATE_WORKERS_DEFAULT), "Number of threads delivering push updates to clients. 0 delivers them on the thread that emits them.")
+            (SERIALIZER_WORKERS_KEY.c_str(), po::value<uint32_t>()->default_value(SERIALIZER_WORKERS_DEFAULT), "Number of extra threads serializing params for device requests. 0 serializes them on the request's thread.")
+            (COMMAND_WORKERS_KEY.c_str(), po::value<uint32_t>()->default_value(COMMAND_WORKERS_DEFAULT), "Number of threads running gRPC commands. 0 runs them on the threads processing gRPC events.")
+            (GRPC_THREADS_KEY.c_str(), po::value<uint32_t>()->default_value(GRPC_THREADS_DEFAULT), "Number of threads processing gRPC events. 0 uses one per hardware thread.")
+            (REST_THREADS_KEY.c_str(), po::value<uint32_t>()->default_value(REST_THREADS_DEFAULT), "Number of threads serving REST connections. 0 uses one per hardware thread.")
+            (REST_HANDLER_THREADS_KEY.c_str(), po::value<uint32_t>()->default_value(REST_HANDLER_THREADS_DEFAULT), "Number of threads running REST requests. 0 uses one per hardware thread.")
+            (REST_WRITE_TIMEOUT_KEY.c_str(), po::value<uint32_t>()->default_value(REST_WRITE_TIMEOUT_DEFAULT), "Seconds a REST write waits for a client to read before closing the connection.")
             (PRIVATE_CA_KEY.c_str(), po::value<bool>()->default_value(PRIVATE_CA_DEFAULT)->implicit_value(true), "Specify if using a private CA")
             (MUTUAL_AUTHC_KEY.c_str(), po::value<bool>()->default_value(MUTUAL_AUTHC_DEFAULT)->implicit_value(true), "Use this to require client to authenticate")
             (AUTHZ_KEY.c_str(), po::value<bool>()->default_value(AUTHZ_DEFAULT)->implicit_value(true), "Use OAuth token authorization")
+            (AUTHZ_CACHE_SIZE_KEY.c_str(), po::value<uint32_t>()->default_value(AUTHZ_CACHE_SIZE_DEFAULT), "Number of decoded OAuth tokens to cache. 0 decodes the token on every request.")
+            (ARENA_POOL_SIZE_KEY.c_str(), po::value<uint32_t>()->default_value(ARENA_POOL_SIZE_DEFAULT), "Number of protobuf arenas kept for reuse by gRPC requests. 0 creates a new arena for every request.")
             (SILENT_KEY.c_str(), po::value<bool>()->default_value(SILENT_DEFAULT)->implicit_value(true), "Use this to suppress all log output.")
             (LOG_LEVEL_KEY.c_str(), po::value<std::string>()->default_value(LOG_LEVEL_DEFAULT), "Minimum severity level of logs. Options are 'trace', 'debug', 'info', 'warning', 'error', and 'fatal'")
             (LOG_CONSOLE_KEY.c_str(), po::value<bool>()->default_value(LOG_CONSOLE_DEFAULT)->implicit_value(true), "Use console logging(stdout/stderr)")
@@ -104,6 +115,22 @@ std::pair<bool, int> config::initConfigVariables(int argc, char* argv[], std::st
         if (vars.count(DEFAULT_MAX_ARRAY_SIZE_KEY)) config::default_max_array_size = vars[DEFAULT_MAX_ARRAY_SIZE_KEY].as<uint32_t>();
         if (vars.count(DEFAULT_TOTAL_ARRAY_SIZE_KEY)) config::default_total_array_size = vars[DEFAULT_TOTAL_ARRAY_SIZE_KEY].as<uint32_t>();
         if (vars.count(MAX_CONNECTIONS_KEY)) config::max_connections = vars[MAX_CONNECTIONS_KEY].as<uint32_t>();
+        if (vars.count(UPDATE_QUEUE_DEPTH_KEY)) config::update_queue_depth = vars[UPDATE_QUEUE_DEPTH_KEY].as<uint32_t>();
+        if (vars.count(PUSH_UPDATE_WORKERS_KEY)) config::push_update_workers = vars[PUSH_UPDATE_WORKERS_KEY].as<uint32_t>();
+        if (vars.count(SERIALIZER_WORKERS_KEY)) config::serializer_workers = vars[SERIALIZER_WORKERS_KEY].as<uint32_t>();
+        if (vars.count(COMMAND_WORKERS_KEY)) config::command_workers = vars[COMMAND_WORKERS_KEY].as<uint32_t>();
+        if (vars.count(GRPC_THREADS_KEY)) config::grpc_threads = vars[GRPC_THREADS_KEY].as<uint32_t>();
+        if (vars.count(REST_THREADS_KEY)) config::rest_threads = vars[REST_THREADS_KEY].as<uint32_t>();
+        if (vars.count(REST_HANDLER_THREADS_KEY)) config::rest_handler_threads = vars[REST_HANDLER_THREADS_KEY].as<uint32_t>();
+        if (vars.count(REST_WRITE_TIMEOUT_KEY)) config::rest_write_timeout = vars[REST_WRITE_TIMEOUT_KEY].as<uint32_t>();
+        if (vars.count(UPDATE_QUEUE_OVERFLOW_KEY)) {
+            config::update_queue_overflow = vars[UPDATE_QUEUE_OVERFLOW_KEY].as<std::string>();
+            if (config::update_queue_overflow != "drop_oldest" && config::update_queue_overflow != "disconnect") {
+                std::cout << "WARNING: update_queue_overflow {" << config::update_queue_overflow << "} is invalid. ";
+                std::cout << "Defaulting to " << config::UPDATE_QUEUE_OVERFLOW_DEFAULT << " instead." << std::endl;
+                config::update_queue_overflow = config::UPDATE_QUEUE_OVERFLOW_DEFAULT;
+            }
+        }
         if (vars.count(HOSTNAME_KEY)) config::hostname = vars[HOSTNAME_KEY].as<std::string>();
         if (vars.count(PORT_KEY)) config::port = vars[PORT_KEY].as<uint16_t>();
         if (vars.count(DASHBOARD_PORT_KEY)) config::dashboard_port = vars[DASHBOARD_PORT_KEY].as<uint16_t>();
@@ -111,6 +138,8 @@ std::pair<bool, int> config::initConfigVariables(int argc, char* argv[], std::st
         if (vars.count(PRIVATE_CA_KEY)) config::private_ca = vars[PRIVATE_CA_KEY].as<bool>();
         if (vars.count(MUTUAL_AUTHC_KEY)) config::mutual_authc = vars[MUTUAL_AUTHC_KEY].as<bool>();
         if (vars.count(AUTHZ_KEY)) config::authz = vars[AUTHZ_KEY].as<bool>();
+        if (vars.count(AUTHZ_CACHE_SIZE_KEY)) config::authz_cache_size = vars[AUTHZ_CACHE_SIZE_KEY].as<uint32_t>();
+        if (vars.count(ARENA_POOL_SIZE_KEY)) config::arena_pool_size = vars[ARENA_POOL_SIZE_KEY].as<uint32_t>();
         if (vars.count(SILENT_KEY)) config::silent = vars[SILENT_KEY].as<bool>();
         if (vars.count(LOG_CONSOLE_KEY)) config::log_console = vars[LOG_CONSOLE_KEY].as<bool>();
         if (vars.count(LOG_FILE_KEY)) config::log_file = vars[LOG_FILE_KEY].as<bool>();
@@ -37,65 +37,137 @@
 #include <IMenuGroup.h> 
 #include <Menu.h>
 #include <rpc/Heartbeat.h>
+#include <rpc/ArenaPool.h>
 #include <Logger.h>
 #include <utils.h>
 
+#include <algorithm>
+#include <numeric>
 #include <cassert>
 #include <sstream>
 #include <stdexcept>
+#include <string_view>
 #include <utility>
 
 using namespace catena::common;
 
-bool Device::tryMultiSetValue (st2138::MultiSetValuePayload src, catena::exception_with_status& ans, const IAuthorizer& authz) {
+bool Device::checkNoOverlap_(const st2138::MultiSetValuePayload& src, catena::exception_with_status& ans) {
+    std::vector<int> order(src.values_size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&src](int a, int b) {
+        const std::string& oidA = src.values(a).oid();
+        const std::string& oidB = src.values(b).oid();
+        return oidA < oidB || (oidA == oidB && a < b);
+    });
+    // Walking the sorted oids with a stack of those that prefix the current one.
+    std::vector<int> prefixes;
+    for (int i : order) {
+        const std::string& oid = src.values(i).oid();
+        while (!prefixes.empty() && !oid.starts_with(src.values(prefixes.back()).oid())) {
+            prefixes.pop_back();
+        }
+        if (!prefixes.empty()) {
+            const std::string& prefix = src.values(prefixes.back()).oid();
+            // Appending to the same array several times is allowed.
+            if (!(prefix.ends_with("/-") && oid.ends_with("/-"))) {
+                // Reporting the pair in request order.
+                int first = std::min(prefixes.back(), i);
+                int second = std::max(prefixes.back(), i);
+                ans = catena::exception_with_status("Overlapping actions for " + src.values(first).oid() + " and " + src.values(second).oid(), catena::StatusCode::INVALID_ARGUMENT);
+                return false;
+            }
+        }
+        prefixes.push_back(i);
+    }
+    return true;
+}
+
+Device::SetTarget_ Device::resolveSetTarget_(const st2138::SetValuePayload& payload, catena::exception_with_status& ans, const IAuthorizer& authz) const {
+    SetTarget_ target{&payload, Path(payload.oid())};
+    // Getting param, or parent param if the final segment is an index.
+    if (target.path.back_is_index()) {
+        target.index = target.path.back_as_index();
+        target.path.popBack();
+    }
+    target.param = getParam(target.path, ans, authz);
+    return target;
+}
+
+bool Device::planMultiSetValue_(const st2138::MultiSetValuePayload& src, std::vector<SetTarget_>& plan, catena::exception_with_status& ans, const IAuthorizer& authz) const {
     // Making sure multi set is enabled.
     if (src.values_size() > 1 && !multi_set_enabled_) {
         ans = catena::exception_with_status("Multi-set is disabled for the device in slot " + std::to_string(slot_), catena::StatusCode::PERMISSION_DENIED);
-    } else {
-        std::vector<std::string> affectedOids;
-
+    // Then validate no overlapping actions.
+    } else if (checkNoOverlap_(src, ans)) {
+        plan.reserve(src.values_size());
         // Looping through and validating set value requests.
         for (const st2138::SetValuePayload& setValuePayload : src.values()) {
             try {
-                // First validate no overlapping actions.
-                for (const auto& oid : affectedOids) {
-                    if (!(oid.ends_with("/-") && (setValuePayload.oid().ends_with("/-"))) &&
-                       (oid.starts_with(setValuePayload.oid()) || setValuePayload.oid().starts_with(oid))) {
-                        ans = catena::exception_with_status("Overlapping actions for " + oid + " and " + setValuePayload.oid(), catena::StatusCode::INVALID_ARGUMENT);
-                        break;
-                    }
+                SetTarget_ target = resolveSetTarget_(setValuePayload, ans, authz);
+                if (!target.param) {
+                    break;
                 }
-                // Then ensure the request will go through if fromProto is called.
-                if (ans.status == catena::StatusCode::OK) {
-                    affectedOids.push_back(setValuePayload.oid());
-                    // Getting param, or parent param if the final segment is an index.
-                    Path path(setValuePayload.oid());
-                    Path::Index index = Path::kNone;
-                    if (path.back_is_index()) {
-                        index = path.back_as_index();
-                        path.popBack();
-                    }
-                    std::unique_ptr<IParam> param = getParam(path, ans, authz);
-                    // Validating setValue operation.
-                    if (!param || !param->validateSetValue(setValuePayload.value(), index, authz, ans)) {
-                        break;
-                    }
+                plan.push_back(std::move(target));
+                // Ensuring the request will go through if fromProto is called.
+                if (!plan.back().param->validateSetValue(setValuePayload.value(), plan.back().index, authz, ans)) {
+                    break;
                 }
             } catch (const catena::exception_with_status& why) {
                 ans = catena::exception_with_status(why.what(), why.status);
                 break;
             }
         }
-        // Resetting trackers regardless of whether something went wrong or not.
-        for (const std::string& oid : affectedOids) {
-            // Creating another exception_with_status as to not overwrite ans.
-            catena::exception_with_status status{"", catena::StatusCode::OK};
-            // Resetting param's trackers, or parent param's if back is index.
-            Path path(oid);
-            if (path.back_is_index()) { path.popBack(); }
-            std::unique_ptr<IParam> param = getParam(path, status, authz);
-            if (param) { param->resetValidate(); }
+    }
+    return ans.status == catena::StatusCode::OK;
+}
+
+catena::exception_with_status Device::commitSetTarget_(SetTarget_& target, const IAuthorizer& authz) {
+    catena::exception_with_status ans{"", catena::StatusCode::OK};
+    const st2138::SetValuePayload& setValuePayload = *target.payload;
+    IParam* parent = nullptr;
+    std::unique_ptr<IParam> element = nullptr;
+    IParam* param = target.param.get();
+    bool append = false;
+    // Getting the element for appends and indexed sets.
+    if (target.index != Path::kNone) {
+        parent = target.param.get();
+        if (target.index == Path::kEnd) {
+            append = true;
+            element = parent->addBack(authz, ans);
+        } else {
+            target.path.push_back(target.index);
+            element = parent->getParam(target.path, authz, ans);
         }
+        param = element.get();
+    }
+    if (!param) {
+        return ans;
+    }
+    // Setting value and emitting signal.
+    ans = param->fromProto(setValuePayload.value(), authz);
+    // Appends resize the parent, path is the parent's in that case.
+    invalidateParamCache_(target.path.fqoid(), append ? parent : param);
+    valueSetByClient_.emit(setValuePayload.oid(), param);
+
+    //log value change
+    if (!(param->getDescriptor().stateless())) {
+        LOG(INFO) << "Device::commitMultiSetValue: Param \"" << target.path.fqoid() << "\" set to new value: " << catena::param_value_string(setValuePayload.value());
+    }
+    else {
+        LOG(DEBUG) << "Device::commitMultiSetValue: Param \"" << target.path.fqoid() << "\" set to new value: " << catena::param_value_string(setValuePayload.value());
+    }
+
+    // Resetting trackers to match new value.
+    target.param->resetValidate();
+    return ans;
+}
+
+bool Device::tryMultiSetValue (st2138::MultiSetValuePayload src, catena::exception_with_status& ans, const IAuthorizer& authz) {
+    std::vector<SetTarget_> plan;
+    planMultiSetValue_(src, plan, ans, authz);
+    // Resetting trackers regardless of whether something went wrong or not.
+    for (SetTarget_& target : plan) {
+        target.param->resetValidate();
     }
     // Returning true if successful.
     return ans.status == catena::StatusCode::OK;
@@ -106,41 +178,11 @@ catena::exception_with_status Device::commitMultiSetValue (st2138::MultiSetValue
     // Looping through and commiting all setValue operations.
     for (const st2138::SetValuePayload& setValuePayload : src.values()) {
         try {
-            // Figuring out parent param for appends and resetValidate().
-            Path path(setValuePayload.oid());
-            std::unique_ptr<IParam> parent = nullptr;
-            std::unique_ptr<IParam> param = nullptr;
-            // Get parent.
-            if (path.back_is_index()) {
-                Path::Index index = path.back_as_index();
-                path.popBack();
-                parent = getParam(path, ans, authz);
-                if (index == Path::kEnd) {
-                    param = parent->addBack(authz, ans);
-                } else {
-                    path.push_back(index);
-                    param = parent->getParam(path, authz, ans);
-                }
-            // Get normal.
-            } else {
-                param = getParam(path, ans, authz);
-            }
-            // Setting value and emitting signal.
-            ans = param->fromProto(setValuePayload.value(), authz);
-            valueSetByClient_.emit(setValuePayload.oid(), param.get());
-
-            //log value change
-            if (!(param->getDescriptor().stateless())) {
-                LOG(INFO) << "Device::commitMultiSetValue: Param \"" << path.fqoid() << "\" set to new value: " << catena::param_value_string(setValuePayload.value());
-            }
-            else {
-                LOG(DEBUG) << "Device::commitMultiSetValue: Param \"" << path.fqoid() << "\" set to new value: " << catena::param_value_string(setValuePayload.value());
+            SetTarget_ target = resolveSetTarget_(setValuePayload, ans, authz);
+            if (!target.param) {
+                break;
             }
-
-            // Resetting trackers to match new value.
-            if (parent) { parent->resetValidate();
-            } else { param->resetValidate(); }
-
+            ans = commitSetTarget_(target, authz);
         } catch (const catena::exception_with_status& why) {
             ans = catena::exception_with_status(why.what(), why.status);
             break;
@@ -149,19 +191,51 @@ catena::exception_with_status Device::commitMultiSetValue (st2138::MultiSetValue
     return ans;
 } //GCOV_EXCL_LINE
 
-catena::exception_with_status Device::setValue (const std::string& jptr, st2138::Value& src, const IAuthorizer& authz) {
+catena::exception_with_status Device::multiSetValue (const st2138::MultiSetValuePayload& src, const IAuthorizer& authz) {
     catena::exception_with_status ans{"", catena::StatusCode::OK};
-    st2138::MultiSetValuePayload setValues;
+    std::vector<SetTarget_> plan;
+    if (planMultiSetValue_(src, plan, ans, authz)) {
+        bool appended = false;
+        for (SetTarget_& target : plan) {
+            try {
+                /**
+                 * An append may reallocate its array, leaving any later
+                 * handle into one of its elements dangling. Appends are rare,
+                 * so targets after one are simply resolved again.
+                 */
+                if (appended) {
+                    target = resolveSetTarget_(*target.payload, ans, authz);
+                    if (!target.param) {
+                        break;
+                    }
+                }
+                appended = appended || target.index == Path::kEnd;
+                ans = commitSetTarget_(target, authz);
+            } catch (const catena::exception_with_status& why) {
+                ans = catena::exception_with_status(why.what(), why.status);
+                break;
+            }
+        }
+    } else {
+        for (SetTarget_& target : plan) {
+            target.param->resetValidate();
+        }
+    }
+    return ans;
+} //GCOV_EXCL_LINE
+
+catena::exception_with_status Device::setValue (const std::string& jptr, st2138::Value& src, const IAuthorizer& authz) {
+    // The payload only lives for the call, so is built on a pooled arena
+    ArenaPool::Lease arena = ArenaPool::instance().acquire();
+    st2138::MultiSetValuePayload& setValues = *arena.create<st2138::MultiSetValuePayload>();
     st2138::SetValuePayload* setValuePayload = setValues.add_values();
     setValuePayload->set_oid(jptr);
     setValuePayload->mutable_value()->CopyFrom(src);
-    if (tryMultiSetValue(setValues, ans, authz)) {
-        ans = commitMultiSetValue(setValues, authz);
-    }
-    return ans;
+    return multiSetValue(setValues, authz);
 }
 
-catena::exception_with_status Device::getValue (const std::string& jptr, st2138::Value& dst, const IAuthorizer& authz) const {
+template <typename F>
+catena::exception_with_status Device::readValue_(const std::string& jptr, const IAuthorizer& authz, F&& read) const {
     catena::exception_with_status ans{"", catena::StatusCode::OK};
     /**
      * Converting to Path object to validate input (cant end with /-).
@@ -169,16 +243,21 @@ catena::exception_with_status Device::getValue (const std::string& jptr, st2138:
      * invalid, so we use a try catch block to catch it.
      */
     try {
-        catena::common::Path path(jptr);
-        if (path.back_is_index() && path.back_as_index() == catena::common::Path::kEnd) {
-            // Index is "-"
-            ans = catena::exception_with_status("Index out - of bounds in path " + jptr, catena::StatusCode::OUT_OF_RANGE);
+        // Appends are never cached, so a hit is always a valid read.
+        if (std::unique_ptr<IParam> cached = paramCache_.find(jptr, authz)) {
+            ans = read(*cached);
         } else {
-            std::unique_ptr<IParam> param = getParam(path, ans, authz);
-            // we expect this to be a parameter name
-            if (param != nullptr) {
-                // we have reached the end of the path, deserialize the value
-                ans = param->toProto(dst, authz);
+            catena::common::Path path(jptr);
+            if (path.back_is_index() && path.back_as_index() == catena::common::Path::kEnd) {
+                // Index is "-"
+                ans = catena::exception_with_status("Index out - of bounds in path " + jptr, catena::StatusCode::OUT_OF_RANGE);
+            } else {
+                std::unique_ptr<IParam> param = resolveParam_(path, ans, authz);
+                // we expect this to be a parameter name
+                if (param != nullptr) {
+                    // we have reached the end of the path, deserialize the value
+                    ans = read(*param);
+                }
             }
         }
     } catch (const catena::exception_with_status& why) {
@@ -191,6 +270,18 @@ catena::exception_with_status Device::getValue (const std::string& jptr, st2138:
     return ans;
 } //GCOV_EXCL_LINE
 
+catena::exception_with_status Device::getValue (const std::string& jptr, st2138::Value& dst, const IAuthorizer& authz) const {
+    return readValue_(jptr, authz, [&](const IParam& param) {
+        return param.toProto(dst, authz);
+    });
+}
+
+catena::exception_with_status Device::getValueJson (const std::string& jptr, std::string& dst, const IAuthorizer& authz) const {
+    return readValue_(jptr, authz, [&](const IParam& param) {
+        return param.toJson(dst, authz);
+    });
+}
+
 catena::exception_with_status Device::getLanguagePack(const std::string& languageId, ComponentLanguagePack& pack) const {
     catena::exception_with_status ans{"", catena::StatusCode::OK};
 
@@ -230,7 +321,8 @@ catena::exception_with_status Device::addLanguage (st2138::AddLanguagePayload& l
     } else {
         // added_packs_ here to maintain ownership in device scope.
         added_packs_[id] = std::make_shared<LanguagePack>(id, name, LanguagePack::ListInitializer{}, *this);
-        language_packs_[id]->fromProto(language.language_pack());      
+        language_packs_[id]->fromProto(language.language_pack());
+        invalidateStaticComponents_();
         // Pushing update to connect gRPC.
         languageAddedPushUpdate_.emit(language_packs_[id]);
     }
@@ -252,6 +344,7 @@ catena::exception_with_status Device::removeLanguage(const std::string& language
     } else {
         added_packs_.erase(languageId);
         language_packs_.erase(languageId);
+        invalidateStaticComponents_();
         // Push update???
     }
     return ans;
@@ -261,8 +354,12 @@ std::unique_ptr<IParam> Device::getParam(const std::string& fqoid, catena::excep
     // The Path constructor will throw an exception if the json pointer is invalid, so we use a try catch block to catch it.
     std::unique_ptr<IParam> result = nullptr;
     try {
-        catena::common::Path path(fqoid);
-        result = getParam(path, status, authz);
+        if (std::unique_ptr<IParam> cached = paramCache_.find(fqoid, authz)) {
+            result = std::move(cached);
+        } else {
+            catena::common::Path path(fqoid);
+            result = resolveParam_(path, status, authz);
+        }
     } catch (const catena::exception_with_status& why) {
         status = catena::exception_with_status(why.what(), why.status);
     } catch (const std::exception& e) {
@@ -274,6 +371,17 @@ std::unique_ptr<IParam> Device::getParam(const std::string& fqoid, catena::excep
 } //GCOV_EXCL_LINE
 
 std::unique_ptr<IParam> Device::getParam(catena::common::Path& path, catena::exception_with_status& status, const IAuthorizer& authz) const {
+    if (paramCache_.enabled() && !path.empty()) {
+        if (std::unique_ptr<IParam> cached = paramCache_.find(path.toString(true), authz)) {
+            // Leave the path walked, as the tree walk would have.
+            while (!path.empty()) { path.pop(); }
+            return cached;
+        }
+    }
+    return resolveParam_(path, status, authz);
+}
+
+std::unique_ptr<IParam> Device::resolveParam_(catena::common::Path& path, catena::exception_with_status& status, const IAuthorizer& authz) const {
     if (path.empty()) {
         status = catena::exception_with_status("Invalid json pointer " + path.fqoid(), catena::StatusCode::INVALID_ARGUMENT);
         return nullptr;
@@ -293,20 +401,26 @@ std::unique_ptr<IParam> Device::getParam(catena::common::Path& path, catena::exc
             status = catena::exception_with_status("Not authorized to read the param " + path.fqoid(), catena::StatusCode::PERMISSION_DENIED); 
             return nullptr;
         }
+        std::string fqoid = paramCache_.enabled() ? path.toString(true) : "";
         path.pop();
+        std::unique_ptr<IParam> result = nullptr;
         if (path.empty()) {
             /**
              * Top level params need to be copied into a unique pointer to be returned.
              * 
              * This is a shallow copy.
              */
-            return param->copy();
+            result = param->copy();
         } else {
             /**
              * Sub-param objects are created by the getParam function so the lifetime of the object is managed by the caller.
              */
-            return param->getParam(path, authz, status);
+            result = param->getParam(path, authz, status);
+        }
+        if (result && paramCache_.enabled()) {
+            paramCache_.insert(fqoid, *param, *result);
         }
+        return result;
     } else {
         status = catena::exception_with_status("Invalid json pointer " + path.fqoid(), catena::StatusCode::INVALID_ARGUMENT);
         return nullptr;
@@ -367,6 +481,25 @@ std::unique_ptr<IParam> Device::getCommand(const std::string& fqoid, catena::exc
     return command;
 }
 
+void Device::invalidateParamCache_(const std::string& oid, const IParam* param) {
+    if (!paramCache_.enabled()) {
+        return;
+    }
+    if (param) {
+        st2138::ParamType type = param->type().value();
+        if (type == st2138::ParamType::INT32 || type == st2138::ParamType::FLOAT32 || type == st2138::ParamType::STRING) {
+            return;
+        }
+    }
+    paramCache_.invalidate(oid);
+}
+
+void Device::connectParamCache_() {
+    valueSetByServer_.connect([this](const std::string& oid, const IParam* param) {
+        invalidateParamCache_(oid, param);
+    });
+}
+
 void Device::initHeartbeat() {
     // if heartbeat already initialized, do nothing
     if (heartbeat_) return;
@@ -485,15 +618,16 @@ void Device::toProto(::st2138::LanguageList& list) const {
     }
 }
 
-st2138::DeviceComponent Device::DeviceSerializer::getNext() {
-    if (hasMore()) {
-        handle_.resume();
-        handle_.promise().rethrow_if_exception();
+const st2138::DeviceComponent& Device::DeviceSerializer::getNext() {
+    if (!hasMore()) {
+        return st2138::DeviceComponent::default_instance();
     }
-    return std::move(handle_.promise().deviceMessage); 
+    handle_.resume();
+    handle_.promise().rethrow_if_exception();
+    return *handle_.promise().deviceMessage;
 }
 
-std::unique_ptr<Device::IDeviceSerializer> Device::getComponentSerializer(const IAuthorizer& authz, const std::set<std::string>& subscribedOids, st2138::Device_DetailLevel dl, bool shallow) const {
+std::unique_ptr<Device::IDeviceSerializer> Device::getComponentSerializer(const IAuthorizer& authz, const SubscribedOids& subscribedOids, st2138::Device_DetailLevel dl, bool shallow) const {
     // Sanitizing if trying to use SUBSCRIPTIONS mode with subscriptions disabled
     if (dl == st2138::Device_DetailLevel_SUBSCRIPTIONS && !subscriptions_) {
         throw catena::exception_with_status("Subscriptions are not enabled for this device", catena::StatusCode::INVALID_ARGUMENT);
@@ -501,11 +635,25 @@ std::unique_ptr<Device::IDeviceSerializer> Device::getComponentSerializer(const
     return std::make_unique<Device::DeviceSerializer>(getDeviceSerializer(authz, subscribedOids, dl, shallow));
 }
 
-Device::DeviceSerializer Device::getDeviceSerializer(const IAuthorizer& authz, const std::set<std::string>& subscribedOids, st2138::Device_DetailLevel dl, bool shallow) const {
-    st2138::DeviceComponent component{};
+std::shared_mutex& Device::paramMutex(const std::string& oid) const {
+    // Hashing the top level param's name, the oid's first segment
+    std::string_view name = oid;
+    if (name.starts_with('/')) {
+        name.remove_prefix(1);
+    }
+    name = name.substr(0, name.find('/'));
+    return paramMutexes_[std::hash<std::string_view>{}(name) % kParamMutexes];
+}
 
-    // Send basic device information first
-    st2138::Device* dst = component.mutable_device();
+std::shared_ptr<const Device::StaticComponents> Device::staticComponents_() const {
+    std::lock_guard lock(staticMtx_);
+    if (staticCache_) {
+        return staticCache_;
+    }
+    auto components = std::make_shared<StaticComponents>();
+
+    // Basic device information
+    st2138::Device* dst = components->device.mutable_device();
     dst->set_slot(slot_);
     dst->set_detail_level(detail_level_);
     *dst->mutable_default_scope() = default_scope_;
@@ -520,6 +668,44 @@ Device::DeviceSerializer Device::getDeviceSerializer(const IAuthorizer& authz, c
         dst->mutable_menu_groups()->insert({entry.first, dstMenuGroup});
     }
 
+    // Menus
+    for (const auto& [groupGame, menuGroup] : menu_groups_) {
+        for (const auto& [name, menu] : *menuGroup->menus()) {
+            auto& component = components->menus.emplace_back();
+            menu->toProto(*component.mutable_menu()->mutable_menu());
+            component.mutable_menu()->set_oid(groupGame + "/" + name);
+        }
+    }
+    // Language packs
+    for (const auto& [language, languagePack] : language_packs_) {
+        auto& component = components->languagePacks.emplace_back();
+        languagePack->toProto(*component.mutable_language_pack()->mutable_language_pack());
+        component.mutable_language_pack()->set_language(language);
+    }
+    // Constraints
+    for (const auto& [name, constraint] : constraints_) {
+        auto& component = components->constraints.emplace_back();
+        constraint->toProto(*component.mutable_shared_constraint()->mutable_constraint());
+        component.mutable_shared_constraint()->set_oid(name);
+    }
+
+    staticCache_ = components;
+    return staticCache_;
+}
+
+Device::DeviceSerializer Device::getDeviceSerializer(const IAuthorizer& authz, SubscribedOids subscribedOids, st2138::Device_DetailLevel dl, bool shallow) const {
+    ArenaPool& arenas = ArenaPool::instance();
+    return serializeComponents_(authz, std::move(subscribedOids), dl, nullptr, arenas.acquire(), arenas.acquire());
+}
+
+Device::DeviceSerializer Device::serializeComponents_(const IAuthorizer& authz, SubscribedOids subscribedOids, st2138::Device_DetailLevel dl,
+                                                      std::shared_ptr<const StaticComponents> components, ArenaPool::Lease even, ArenaPool::Lease odd) const {
+    // Held for the life of the serializer, in case the device changes
+    components = staticComponents_();
+
+    // Send basic device information first
+    const st2138::DeviceComponent* component = &components->device;
+
     if (dl != st2138::Device_DetailLevel_NONE) {
         // Helper function to check if an OID is subscribed
         auto isSubscribed = [&subscribedOids](const std::string& paramName) {
@@ -528,44 +714,27 @@ Device::DeviceSerializer Device::getDeviceSerializer(const IAuthorizer& authz, c
 
         // Only send non-minimal items in FULL mode
         if (dl == st2138::Device_DetailLevel_FULL) {
-            // Send menus
-            for (const auto& [groupGame, menuGroup] : menu_groups_) {
-                for (const auto& [name, menu] : *menuGroup->menus()) {
-                    std::string oid = groupGame + "/" + name;
-                    co_yield component;
-                    component.Clear();
-                    ::st2138::Menu* dstMenu = component.mutable_menu()->mutable_menu();
-                    menu->toProto(*dstMenu);
-                    component.mutable_menu()->set_oid(oid);
+            // Send menus, language packs and constraints
+            for (const auto* cached : {&components->menus, &components->languagePacks, &components->constraints}) {
+                for (const auto& staticComponent : *cached) {
+                    co_yield *component;
+                    component = &staticComponent;
                 }
             }
-            // Send language packs
-            for (const auto& [language, languagePack] : language_packs_) {
-                co_yield component;
-                component.Clear();
-                ::st2138::LanguagePack* dstPack = component.mutable_language_pack()->mutable_language_pack();
-                languagePack->toProto(*dstPack);
-                component.mutable_language_pack()->set_language(language);
-            }
-            // Send constraints
-            for (const auto& [name, constraint] : constraints_) {
-                co_yield component;
-                component.Clear();
-                ::st2138::Constraint* dstConstraint = component.mutable_shared_constraint()->mutable_constraint();
-                constraint->toProto(*dstConstraint);
-                component.mutable_shared_constraint()->set_oid(name);
-            }
         }
 
+        // Select the commands and params to send
+        struct Selected {
+            const std::string* oid;
+            const IParam* param;
+            bool isCommand;
+        };
+        std::vector<Selected> selected;
         // Send commands if authorized and in FULL or COMMANDS mode
         if (dl == st2138::Device_DetailLevel_FULL || dl == st2138::Device_DetailLevel_COMMANDS) {
             for (const auto& [name, param] : commands_) {
                 if (authz.readAuthz(*param)) {
-                    co_yield component;
-                    component.Clear();
-                    ::st2138::Param* dstParam = component.mutable_command()->mutable_command();
-                    param->toProto(*dstParam, authz);
-                    component.mutable_command()->set_oid(name);
+                    selected.push_back({&name, param, true});
                 }
             }
         }
@@ -576,17 +745,54 @@ Device::DeviceSerializer Device::getDeviceSerializer(const IAuthorizer& authz, c
                     ((dl == st2138::Device_DetailLevel_FULL) ||
                      (param->getDescriptor().minimalSet()) ||
                      (dl == st2138::Device_DetailLevel_SUBSCRIPTIONS && isSubscribed(name)))) {
-                    co_yield component;
-                    component.Clear();
-                    ::st2138::Param* dstParam = component.mutable_param()->mutable_param();
-                    param->toProto(*dstParam, authz);
-                    component.mutable_param()->set_oid(name);
+                    selected.push_back({&name, param, false});
+                }
+            }
+        }
+
+        /*
+         * Serialize them in batches spread across the pool. Each batch is
+         * built inside the call to getNext that needs its first component,
+         * so with the caller holding the device's mutex, and a batch is only
+         * as large as the pool can keep busy, bounding the memory held for
+         * slow consumers.
+         *
+         * Batches alternate between the two arenas, so the last component
+         * of the previous batch is still alive while the next is built.
+         */
+        SerializerPool& pool = serializerPool_ ? *serializerPool_ : SerializerPool::instance();
+        const std::size_t batchSize = pool.workers() == 0 ? 1 : kSerializerBatchPerThread * (pool.workers() + 1);
+        ArenaPool::Lease* arenas[] = {&even, &odd};
+        std::size_t batches = 0;
+        std::vector<st2138::DeviceComponent*> batch;
+        for (std::size_t first = 0; first < selected.size(); first += batchSize) {
+            // The arena last held the batch before the previous one, which
+            // has all been written
+            ArenaPool::Lease& arena = *arenas[batches++ % 2];
+            arena.reset();
+            batch.clear();
+            for (std::size_t i = first; i < std::min(first + batchSize, selected.size()); ++i) {
+                batch.push_back(arena.create<st2138::DeviceComponent>());
+            }
+            pool.run(batch.size(), [&](std::size_t i) {
+                const Selected& entry = selected[first + i];
+                std::shared_lock lock(paramMutex(*entry.oid));
+                if (entry.isCommand) {
+                    entry.param->toProto(*batch[i]->mutable_command()->mutable_command(), authz);
+                    batch[i]->mutable_command()->set_oid(*entry.oid);
+                } else {
+                    entry.param->toProto(*batch[i]->mutable_param()->mutable_param(), authz);
+                    batch[i]->mutable_param()->set_oid(*entry.oid);
                 }
+            });
+            for (st2138::DeviceComponent* serialized : batch) {
+                co_yield *component;
+                component = serialized;
             }
         }
     }
     // return the last component
-    co_return component;
+    co_return *component;
 }
 
 bool Device::shouldSendParam(const IParam& param, bool is_subscribed, const IAuthorizer& authz) const {
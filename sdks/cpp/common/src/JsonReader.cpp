@@ -0,0 +1,589 @@
+/*
+ * Copyright 2026 Ross Video Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file JsonReader.cpp
+ * @brief Implements the JSON reader.
+ * @date 2026-10-16
+ * @copyright Copyright (c) 2026 Ross Video
+ */
+
+// common
+#include <JsonReader.h>
+
+// protobuf
+#include <google/protobuf/util/json_util.h>
+
+// std
+#include <cfloat>
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <utility>
+
+namespace {
+
+/**
+ * @brief Returns the length of the valid UTF-8 sequence at src, or 0 if it
+ * is not valid.
+ */
+std::size_t utf8Length(const char* src, const char* end) {
+    auto lead = static_cast<uint8_t>(*src);
+    std::size_t len = 0;
+    uint32_t cp = 0;
+    uint32_t min = 0;
+    if (lead >= 0xc2 && lead <= 0xdf) {
+        len = 2; cp = lead & 0x1f; min = 0x80;
+    } else if (lead >= 0xe0 && lead <= 0xef) {
+        len = 3; cp = lead & 0x0f; min = 0x800;
+    } else if (lead >= 0xf0 && lead <= 0xf4) {
+        len = 4; cp = lead & 0x07; min = 0x10000;
+    } else {
+        return 0;
+    }
+    if (end - src < static_cast<std::ptrdiff_t>(len)) {
+        return 0;
+    }
+    for (std::size_t i = 1; i < len; ++i) {
+        auto c = static_cast<uint8_t>(src[i]);
+        if ((c & 0xc0) != 0x80) {
+            return 0;
+        }
+        cp = (cp << 6) | (c & 0x3f);
+    }
+    if (cp < min || cp > 0x10ffff || (cp >= 0xd800 && cp <= 0xdfff)) {
+        return 0;
+    }
+    return len;
+}
+
+/**
+ * @brief Appends a code point to dst as UTF-8.
+ */
+void appendUtf8(std::string& dst, uint32_t cp) {
+    if (cp < 0x80) {
+        dst += static_cast<char>(cp);
+    } else if (cp < 0x800) {
+        dst += static_cast<char>(0xc0 | (cp >> 6));
+        dst += static_cast<char>(0x80 | (cp & 0x3f));
+    } else if (cp < 0x10000) {
+        dst += static_cast<char>(0xe0 | (cp >> 12));
+        dst += static_cast<char>(0x80 | ((cp >> 6) & 0x3f));
+        dst += static_cast<char>(0x80 | (cp & 0x3f));
+    } else {
+        dst += static_cast<char>(0xf0 | (cp >> 18));
+        dst += static_cast<char>(0x80 | ((cp >> 12) & 0x3f));
+        dst += static_cast<char>(0x80 | ((cp >> 6) & 0x3f));
+        dst += static_cast<char>(0x80 | (cp & 0x3f));
+    }
+}
+
+/**
+ * @brief A pull parser which reads a JSON document front to back, one part
+ * at a time as the message being parsed into asks for it, in the style of
+ * simdjson's on demand API. Nothing is buffered beyond the current string.
+ *
+ * Every method returns false as soon as the input is not in the form the
+ * reader handles, leaving the caller to fall back to protobuf. This covers
+ * malformed JSON as well as valid JSON the reader does not handle itself.
+ */
+class Reader {
+  public:
+    explicit Reader(std::string_view src) : pos_{src.data()}, end_{src.data() + src.size()} {}
+
+    /**
+     * @brief Returns true if only whitespace is left.
+     */
+    bool atEnd() {
+        skipWhitespace_();
+        return pos_ == end_;
+    }
+
+    /**
+     * @brief Reads an object, calling member(key) to read each member's
+     * value. key is only valid until member reads the value.
+     */
+    template <typename F>
+    bool object(F&& member) {
+        if (depth_ == kMaxDepth || !consume_('{')) {
+            return false;
+        }
+        ++depth_;
+        if (consume_('}')) {
+            --depth_;
+            return true;
+        }
+        do {
+            if (!string(key_) || !consume_(':') || !member(std::string_view(key_))) {
+                return false;
+            }
+        } while (consume_(','));
+        --depth_;
+        return consume_('}');
+    }
+
+    /**
+     * @brief Reads an array, calling element() to read each element.
+     */
+    template <typename F>
+    bool array(F&& element) {
+        if (depth_ == kMaxDepth || !consume_('[')) {
+            return false;
+        }
+        ++depth_;
+        if (consume_(']')) {
+            --depth_;
+            return true;
+        }
+        do {
+            if (!element()) {
+                return false;
+            }
+        } while (consume_(','));
+        --depth_;
+        return consume_(']');
+    }
+
+    /**
+     * @brief Reads a string into dst, replacing its contents.
+     */
+    bool string(std::string& dst) {
+        if (!consume_('"')) {
+            return false;
+        }
+        dst.clear();
+        const char* run = pos_; // Start of the bytes not yet copied.
+        while (pos_ < end_) {
+            auto c = static_cast<uint8_t>(*pos_);
+            if (c == '"') {
+                dst.append(run, pos_);
+                ++pos_;
+                return true;
+            } else if (c == '\\') {
+                dst.append(run, pos_);
+                if (!escape_(dst)) {
+                    return false;
+                }
+                run = pos_;
+            } else if (c < 0x20) {
+                return false; // Control characters must be escaped.
+            } else if (c < 0x80) {
+                ++pos_;
+            } else {
+                std::size_t len = utf8Length(pos_, end_);
+                if (len == 0) {
+                    return false;
+                }
+                pos_ += len;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Reads an integer that fits in an int32.
+     */
+    bool int32(int32_t& dst) {
+        int64_t value = 0;
+        if (!integer_(value) || value < std::numeric_limits<int32_t>::min() || value > std::numeric_limits<int32_t>::max()) {
+            return false;
+        }
+        dst = static_cast<int32_t>(value);
+        return true;
+    }
+
+    /**
+     * @brief Reads an integer that fits in a uint32.
+     */
+    bool uint32(uint32_t& dst) {
+        int64_t value = 0;
+        if (!integer_(value) || value < 0 || value > std::numeric_limits<uint32_t>::max()) {
+            return false;
+        }
+        dst = static_cast<uint32_t>(value);
+        return true;
+    }
+
+    /**
+     * @brief Reads a number as a float, the way protobuf does.
+     *
+     * Integers are only read if the float holds them exactly, and other
+     * numbers are rounded to a double and then to a float.
+     */
+    bool float32(float& dst) {
+        std::string_view text;
+        bool isInteger = false;
+        if (!number_(text, isInteger)) {
+            return false;
+        }
+        if (isInteger) {
+            int64_t value = 0;
+            auto result = std::from_chars(text.data(), text.data() + text.size(), value);
+            if (result.ec != std::errc() || value < -(int64_t{1} << FLT_MANT_DIG) || value > (int64_t{1} << FLT_MANT_DIG)) {
+                return false;
+            }
+            dst = static_cast<float>(value);
+        } else {
+            double value = 0;
+            auto result = std::from_chars(text.data(), text.data() + text.size(), value);
+            if (result.ec != std::errc() || !(std::fabs(value) <= FLT_MAX)) {
+                return false;
+            }
+            dst = static_cast<float>(value);
+        }
+        return true;
+    }
+
+  private:
+    void skipWhitespace_() {
+        while (pos_ < end_ && (*pos_ == ' ' || *pos_ == '\n' || *pos_ == '\r' || *pos_ == '\t')) {
+            ++pos_;
+        }
+    }
+
+    /**
+     * @brief Skips whitespace and then c if it is next.
+     * @return true if c was next.
+     */
+    bool consume_(char c) {
+        skipWhitespace_();
+        if (pos_ < end_ && *pos_ == c) {
+            ++pos_;
+            return true;
+        }
+        return false;
+    }
+
+    /**
+     * @brief Reads four hex digits.
+     */
+    bool hex4_(uint32_t& dst) {
+        if (end_ - pos_ < 4) {
+            return false;
+        }
+        auto result = std::from_chars(pos_, pos_ + 4, dst, 16);
+        if (result.ptr != pos_ + 4) {
+            return false;
+        }
+        pos_ += 4;
+        return true;
+    }
+
+    /**
+     * @brief Reads the escape sequence at pos_ and appends what it stands
+     * for to dst. Surrogates must come in pairs.
+     */
+    bool escape_(std::string& dst) {
+        if (end_ - pos_ < 2) {
+            return false;
+        }
+        char c = pos_[1];
+        pos_ += 2;
+        switch (c) {
+            case '"':  dst += '"'; return true;
+            case '\\': dst += '\\'; return true;
+            case '/':  dst += '/'; return true;
+            case 'b':  dst += '\b'; return true;
+            case 'f':  dst += '\f'; return true;
+            case 'n':  dst += '\n'; return true;
+            case 'r':  dst += '\r'; return true;
+            case 't':  dst += '\t'; return true;
+            case 'u':  break;
+            default:   return false;
+        }
+        uint32_t cp = 0;
+        if (!hex4_(cp) || (cp >= 0xdc00 && cp <= 0xdfff)) {
+            return false;
+        }
+        if (cp >= 0xd800 && cp <= 0xdbff) {
+            uint32_t low = 0;
+            if (end_ - pos_ < 2 || pos_[0] != '\\' || pos_[1] != 'u') {
+                return false;
+            }
+            pos_ += 2;
+            if (!hex4_(low) || low < 0xdc00 || low > 0xdfff) {
+                return false;
+            }
+            cp = 0x10000 + ((cp - 0xd800) << 10) + (low - 0xdc00);
+        }
+        appendUtf8(dst, cp);
+        return true;
+    }
+
+    /**
+     * @brief Reads a number, as JSON's grammar defines it.
+     * @param text Set to the number's text.
+     * @param isInteger Set to true if it has no fraction or exponent.
+     */
+    bool number_(std::string_view& text, bool& isInteger) {
+        auto isDigit = [this]() { return pos_ < end_ && *pos_ >= '0' && *pos_ <= '9'; };
+        auto digits = [&]() {
+            if (!isDigit()) {
+                return false;
+            }
+            while (isDigit()) {
+                ++pos_;
+            }
+            return true;
+        };
+        skipWhitespace_();
+        const char* start = pos_;
+        if (pos_ < end_ && *pos_ == '-') {
+            ++pos_;
+        }
+        if (pos_ < end_ && *pos_ == '0') {
+            ++pos_;
+        } else if (!digits()) {
+            return false;
+        }
+        isInteger = true;
+        if (pos_ < end_ && *pos_ == '.') {
+            ++pos_;
+            isInteger = false;
+            if (!digits()) {
+                return false;
+            }
+        }
+        if (pos_ < end_ && (*pos_ == 'e' || *pos_ == 'E')) {
+            ++pos_;
+            isInteger = false;
+            if (pos_ < end_ && (*pos_ == '+' || *pos_ == '-')) {
+                ++pos_;
+            }
+            if (!digits()) {
+                return false;
+            }
+        }
+        text = std::string_view(start, pos_ - start);
+        return true;
+    }
+
+    /**
+     * @brief Reads a number with no fraction or exponent.
+     */
+    bool integer_(int64_t& dst) {
+        std::string_view text;
+        bool isInteger = false;
+        if (!number_(text, isInteger) || !isInteger) {
+            return false;
+        }
+        auto result = std::from_chars(text.data(), text.data() + text.size(), dst);
+        return result.ec == std::errc();
+    }
+
+    const char* pos_;
+    const char* end_;
+    /**
+     * @brief The key of the member being read, reused between members.
+     */
+    std::string key_;
+    /**
+     * @brief How many objects and arrays the reader is inside of.
+     */
+    std::size_t depth_ = 0;
+    /**
+     * @brief The deepest the reader nests before giving up, the same as
+     * protobuf's parser. Values nest by recursion, so without a limit a
+     * deeply nested document would overflow the stack.
+     */
+    static constexpr std::size_t kMaxDepth = 100;
+};
+
+bool readValue(Reader& in, st2138::Value& dst);
+
+/**
+ * @brief Reads an object holding a single repeated field, name, calling
+ * element() to read each of its elements.
+ */
+template <typename F>
+bool readList(Reader& in, std::string_view name, F&& element) {
+    bool seen = false;
+    return in.object([&](std::string_view key) {
+        return key == name && !std::exchange(seen, true) && in.array(element);
+    });
+}
+
+bool readStruct(Reader& in, st2138::StructValue& dst) {
+    bool seen = false;
+    return in.object([&](std::string_view key) {
+        if (key != "fields" || std::exchange(seen, true)) {
+            return false;
+        }
+        auto& fields = *dst.mutable_fields();
+        return in.object([&](std::string_view name) {
+            std::string field(name);
+            // Repeated names are left to protobuf
+            return fields.find(field) == fields.end() && readValue(in, fields[field]);
+        });
+    });
+}
+
+bool readVariant(Reader& in, st2138::StructVariantValue& dst) {
+    bool seenType = false;
+    bool seenValue = false;
+    return in.object([&](std::string_view key) {
+        if (key == "structVariantType" && !std::exchange(seenType, true)) {
+            return in.string(*dst.mutable_struct_variant_type());
+        } else if (key == "value" && !std::exchange(seenValue, true)) {
+            return readValue(in, *dst.mutable_value());
+        }
+        return false;
+    });
+}
+
+bool readValue(Reader& in, st2138::Value& dst) {
+    return in.object([&](std::string_view key) {
+        // Setting a second kind is left to protobuf, as is any kind not
+        // listed here.
+        if (dst.kind_case() != st2138::Value::KIND_NOT_SET) {
+            return false;
+        }
+        if (key == "int32Value") {
+            int32_t value = 0;
+            if (!in.int32(value)) {
+                return false;
+            }
+            dst.set_int32_value(value);
+            return true;
+        } else if (key == "float32Value") {
+            float value = 0;
+            if (!in.float32(value)) {
+                return false;
+            }
+            dst.set_float32_value(value);
+            return true;
+        } else if (key == "stringValue") {
+            return in.string(*dst.mutable_string_value());
+        } else if (key == "int32ArrayValues") {
+            auto& ints = *dst.mutable_int32_array_values()->mutable_ints();
+            return readList(in, "ints", [&]() {
+                int32_t value = 0;
+                if (!in.int32(value)) {
+                    return false;
+                }
+                ints.Add(value);
+                return true;
+            });
+        } else if (key == "float32ArrayValues") {
+            auto& floats = *dst.mutable_float32_array_values()->mutable_floats();
+            return readList(in, "floats", [&]() {
+                float value = 0;
+                if (!in.float32(value)) {
+                    return false;
+                }
+                floats.Add(value);
+                return true;
+            });
+        } else if (key == "stringArrayValues") {
+            auto& strings = *dst.mutable_string_array_values();
+            return readList(in, "strings", [&]() {
+                return in.string(*strings.add_strings());
+            });
+        } else if (key == "structValue") {
+            return readStruct(in, *dst.mutable_struct_value());
+        } else if (key == "structVariantValue") {
+            return readVariant(in, *dst.mutable_struct_variant_value());
+        } else if (key == "structArrayValues") {
+            auto& structs = *dst.mutable_struct_array_values();
+            return readList(in, "structValues", [&]() {
+                return readStruct(in, *structs.add_struct_values());
+            });
+        } else if (key == "structVariantArrayValues") {
+            auto& variants = *dst.mutable_struct_variant_array_values();
+            return readList(in, "structVariants", [&]() {
+                return readVariant(in, *variants.add_struct_variants());
+            });
+        }
+        return false;
+    });
+}
+
+bool readSetValue(Reader& in, st2138::SetValuePayload& dst) {
+    bool seenOid = false;
+    bool seenValue = false;
+    return in.object([&](std::string_view key) {
+        if (key == "oid" && !std::exchange(seenOid, true)) {
+            return in.string(*dst.mutable_oid());
+        } else if (key == "value" && !std::exchange(seenValue, true)) {
+            return readValue(in, *dst.mutable_value());
+        }
+        return false;
+    });
+}
+
+bool readMultiSetValue(Reader& in, st2138::MultiSetValuePayload& dst) {
+    bool seenSlot = false;
+    bool seenValues = false;
+    return in.object([&](std::string_view key) {
+        if (key == "slot" && !std::exchange(seenSlot, true)) {
+            uint32_t slot = 0;
+            if (!in.uint32(slot)) {
+                return false;
+            }
+            dst.set_slot(slot);
+            return true;
+        } else if (key == "values" && !std::exchange(seenValues, true)) {
+            return in.array([&]() {
+                return readSetValue(in, *dst.add_values());
+            });
+        }
+        return false;
+    });
+}
+
+/**
+ * @brief Parses src with protobuf, for anything the reader does not handle.
+ */
+bool parseWithProtobuf(std::string_view src, google::protobuf::Message& dst) {
+    dst.Clear();
+    return google::protobuf::util::JsonStringToMessage({src.data(), src.size()}, &dst).ok();
+}
+
+} // namespace
+
+bool catena::common::parseJson(std::string_view src, st2138::Value& dst) {
+    dst.Clear();
+    Reader in(src);
+    if (readValue(in, dst) && in.atEnd()) {
+        return true;
+    }
+    return parseWithProtobuf(src, dst);
+}
+
+bool catena::common::parseJson(std::string_view src, st2138::MultiSetValuePayload& dst) {
+    dst.Clear();
+    Reader in(src);
+    if (readMultiSetValue(in, dst) && in.atEnd()) {
+        return true;
+    }
+    return parseWithProtobuf(src, dst);
+}
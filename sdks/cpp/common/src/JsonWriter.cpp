@@ -0,0 +1,394 @@
+/*
+ * Copyright 2026 Ross Video Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file JsonWriter.cpp
+ * @brief Implements the JSON writer.
+ * @date 2026-10-16
+ * @copyright Copyright (c) 2026 Ross Video
+ */
+
+// common
+#include <JsonWriter.h>
+
+// protobuf
+#include <google/protobuf/util/json_util.h>
+
+// std
+#include <array>
+#include <charconv>
+#include <cmath>
+
+namespace {
+
+/**
+ * @brief Classifies each byte for appendJsonString. 0 is copied as is, 1 is
+ * an ASCII character which must be escaped, and 2 starts or continues a
+ * multi-byte UTF-8 sequence.
+ */
+constexpr auto kByteClass = [] {
+    std::array<uint8_t, 256> table{};
+    for (int c = 0; c < 0x20; ++c) {
+        table[c] = 1;
+    }
+    for (char c : {'"', '\\', '<', '>', '\x7f'}) {
+        table[static_cast<uint8_t>(c)] = 1;
+    }
+    for (int c = 0x80; c < 0x100; ++c) {
+        table[c] = 2;
+    }
+    return table;
+}();
+
+/**
+ * @brief Returns true if the protobuf JSON printer escapes the code point.
+ *
+ * These are the control, format and separator characters which some JSON
+ * and JavaScript parsers mishandle.
+ */
+constexpr bool escapedCodePoint(uint32_t cp) {
+    return (cp >= 0x7f && cp <= 0x9f) || cp == 0xad ||
+           (cp >= 0x600 && cp <= 0x603) || cp == 0x6dd || cp == 0x70f ||
+           cp == 0x17b4 || cp == 0x17b5 ||
+           (cp >= 0x200b && cp <= 0x200f) || (cp >= 0x2028 && cp <= 0x202e) ||
+           (cp >= 0x2060 && cp <= 0x2064) || (cp >= 0x206a && cp <= 0x206f) ||
+           cp == 0xfeff || (cp >= 0xfff9 && cp <= 0xfffb) ||
+           (cp >= 0x1d173 && cp <= 0x1d17a) || cp == 0xe0001 || (cp >= 0xe0020 && cp <= 0xe007f);
+}
+
+/**
+ * @brief Appends a \uXXXX escape for a UTF-16 code unit.
+ */
+void appendUnicodeEscape(std::string& dst, uint32_t unit) {
+    static constexpr char kHex[] = "0123456789abcdef";
+    char buf[6] = {'\\', 'u', kHex[(unit >> 12) & 0xf], kHex[(unit >> 8) & 0xf], kHex[(unit >> 4) & 0xf], kHex[unit & 0xf]};
+    dst.append(buf, sizeof(buf));
+}
+
+/**
+ * @brief Appends the escape sequence for an ASCII character.
+ */
+void appendAsciiEscape(std::string& dst, char c) {
+    switch (c) {
+        case '"':  dst += "\\\""; break;
+        case '\\': dst += "\\\\"; break;
+        case '\b': dst += "\\b"; break;
+        case '\f': dst += "\\f"; break;
+        case '\n': dst += "\\n"; break;
+        case '\r': dst += "\\r"; break;
+        case '\t': dst += "\\t"; break;
+        default:   appendUnicodeEscape(dst, static_cast<uint8_t>(c)); break;
+    }
+}
+
+/**
+ * @brief Decodes the UTF-8 sequence starting at src[i].
+ * @return The code point, or -1 if the sequence is invalid. len is set to
+ * the number of bytes consumed either way.
+ */
+int32_t decodeUtf8(std::string_view src, std::size_t i, std::size_t& len) {
+    auto lead = static_cast<uint8_t>(src[i]);
+    uint32_t cp = 0;
+    uint32_t min = 0;
+    if (lead >= 0xc2 && lead <= 0xdf) {
+        len = 2; cp = lead & 0x1f; min = 0x80;
+    } else if (lead >= 0xe0 && lead <= 0xef) {
+        len = 3; cp = lead & 0x0f; min = 0x800;
+    } else if (lead >= 0xf0 && lead <= 0xf4) {
+        len = 4; cp = lead & 0x07; min = 0x10000;
+    } else {
+        len = 1;
+        return -1;
+    }
+    for (std::size_t j = 1; j < len; ++j) {
+        if (i + j >= src.size() || (static_cast<uint8_t>(src[i + j]) & 0xc0) != 0x80) {
+            len = j;
+            return -1;
+        }
+        cp = (cp << 6) | (static_cast<uint8_t>(src[i + j]) & 0x3f);
+    }
+    if (cp < min || cp > 0x10ffff || (cp >= 0xd800 && cp <= 0xdfff)) {
+        return -1;
+    }
+    return static_cast<int32_t>(cp);
+}
+
+/**
+ * @brief Appends a message the direct writer does not handle using the
+ * protobuf printer.
+ */
+bool appendWithPrinter(std::string& dst, const google::protobuf::Message& src) {
+    std::string json;
+    google::protobuf::util::JsonPrintOptions options; // Default options
+    if (!google::protobuf::util::MessageToJsonString(src, &json, options).ok()) {
+        return false; // GCOVR_EXCL_LINE
+    }
+    dst.append(json);
+    return true;
+}
+
+} // namespace
+
+bool catena::common::appendJsonString(std::string& dst, std::string_view src) {
+    dst.reserve(dst.size() + src.size() + 2);
+    dst += '"';
+    std::size_t run = 0; // Start of the bytes not yet copied.
+    std::size_t i = 0;
+    while (i < src.size()) {
+        uint8_t byteClass = kByteClass[static_cast<uint8_t>(src[i])];
+        if (byteClass == 0) {
+            ++i;
+            continue;
+        }
+        if (byteClass == 1) {
+            dst.append(src.data() + run, i - run);
+            appendAsciiEscape(dst, src[i]);
+            run = ++i;
+            continue;
+        }
+        std::size_t len = 0;
+        int32_t cp = decodeUtf8(src, i, len);
+        if (cp < 0) {
+            return false; // The printer fails on invalid UTF-8 as well.
+        }
+        if (escapedCodePoint(cp)) {
+            dst.append(src.data() + run, i - run);
+            if (cp >= 0x10000) {
+                // Written as a UTF-16 surrogate pair.
+                appendUnicodeEscape(dst, 0xd800 + ((cp - 0x10000) >> 10));
+                appendUnicodeEscape(dst, 0xdc00 + ((cp - 0x10000) & 0x3ff));
+            } else {
+                appendUnicodeEscape(dst, cp);
+            }
+            run = i + len;
+        }
+        i += len;
+    }
+    dst.append(src.data() + run, src.size() - run);
+    dst += '"';
+    return true;
+}
+
+void catena::common::appendJsonInt(std::string& dst, int64_t src) {
+    char buf[24];
+    auto result = std::to_chars(buf, buf + sizeof(buf), src);
+    dst.append(buf, result.ptr);
+}
+
+void catena::common::appendJsonFloat(std::string& dst, float src) {
+    if (std::isnan(src)) {
+        dst += "\"NaN\"";
+    } else if (std::isinf(src)) {
+        dst += src > 0 ? "\"Infinity\"" : "\"-Infinity\"";
+    } else {
+        // Same as protobuf's SimpleFtoa, %.6g unless it does not round trip.
+        // Subnormals never count as round tripping.
+        char buf[32];
+        auto result = std::to_chars(buf, buf + sizeof(buf), src, std::chars_format::general, 6);
+        float parsed = 0;
+        std::from_chars(buf, result.ptr, parsed);
+        if (parsed != src || std::fpclassify(src) == FP_SUBNORMAL) {
+            result = std::to_chars(buf, buf + sizeof(buf), src, std::chars_format::general, 9);
+        }
+        dst.append(buf, result.ptr);
+    }
+}
+
+bool catena::common::appendJson(std::string& dst, const st2138::Value& src) {
+    bool ok = true;
+    // Fields equal to their default are omitted, so empty lists and structs
+    // are written as {}.
+    switch (src.kind_case()) {
+        case st2138::Value::kInt32Value:
+            dst += "{\"int32Value\":";
+            appendJsonInt(dst, src.int32_value());
+            dst += '}';
+            break;
+        case st2138::Value::kFloat32Value:
+            dst += "{\"float32Value\":";
+            appendJsonFloat(dst, src.float32_value());
+            dst += '}';
+            break;
+        case st2138::Value::kStringValue:
+            dst += "{\"stringValue\":";
+            ok = appendJsonString(dst, src.string_value());
+            dst += '}';
+            break;
+        case st2138::Value::kInt32ArrayValues: {
+            const auto& ints = src.int32_array_values().ints();
+            dst += "{\"int32ArrayValues\":{";
+            if (!ints.empty()) {
+                dst += "\"ints\":[";
+                for (int i = 0; i < ints.size(); ++i) {
+                    if (i > 0) { dst += ','; }
+                    appendJsonInt(dst, ints[i]);
+                }
+                dst += ']';
+            }
+            dst += "}}";
+            break;
+        }
+        case st2138::Value::kFloat32ArrayValues: {
+            const auto& floats = src.float32_array_values().floats();
+            dst += "{\"float32ArrayValues\":{";
+            if (!floats.empty()) {
+                dst += "\"floats\":[";
+                for (int i = 0; i < floats.size(); ++i) {
+                    if (i > 0) { dst += ','; }
+                    appendJsonFloat(dst, floats[i]);
+                }
+                dst += ']';
+            }
+            dst += "}}";
+            break;
+        }
+        case st2138::Value::kStringArrayValues: {
+            const auto& strings = src.string_array_values().strings();
+            dst += "{\"stringArrayValues\":{";
+            if (!strings.empty()) {
+                dst += "\"strings\":[";
+                for (int i = 0; i < strings.size() && ok; ++i) {
+                    if (i > 0) { dst += ','; }
+                    ok = appendJsonString(dst, strings[i]);
+                }
+                dst += ']';
+            }
+            dst += "}}";
+            break;
+        }
+        case st2138::Value::kStructValue:
+            dst += "{\"structValue\":";
+            ok = appendJson(dst, src.struct_value());
+            dst += '}';
+            break;
+        case st2138::Value::kStructVariantValue:
+            dst += "{\"structVariantValue\":";
+            ok = appendJson(dst, src.struct_variant_value());
+            dst += '}';
+            break;
+        case st2138::Value::kStructArrayValues: {
+            const auto& structs = src.struct_array_values().struct_values();
+            dst += "{\"structArrayValues\":{";
+            if (!structs.empty()) {
+                dst += "\"structValues\":[";
+                for (int i = 0; i < structs.size() && ok; ++i) {
+                    if (i > 0) { dst += ','; }
+                    ok = appendJson(dst, structs[i]);
+                }
+                dst += ']';
+            }
+            dst += "}}";
+            break;
+        }
+        case st2138::Value::kStructVariantArrayValues: {
+            const auto& variants = src.struct_variant_array_values().struct_variants();
+            dst += "{\"structVariantArrayValues\":{";
+            if (!variants.empty()) {
+                dst += "\"structVariants\":[";
+                for (int i = 0; i < variants.size() && ok; ++i) {
+                    if (i > 0) { dst += ','; }
+                    ok = appendJson(dst, variants[i]);
+                }
+                dst += ']';
+            }
+            dst += "}}";
+            break;
+        }
+        case st2138::Value::KIND_NOT_SET:
+            dst += "{}";
+            break;
+        default:
+            ok = appendWithPrinter(dst, src);
+            break;
+    }
+    return ok;
+}
+
+bool catena::common::appendJson(std::string& dst, const st2138::StructValue& src) {
+    bool ok = true;
+    dst += '{';
+    if (!src.fields().empty()) {
+        dst += "\"fields\":{";
+        bool first = true;
+        // Same order as the printer, which follows the map's iteration order.
+        for (auto it = src.fields().begin(); it != src.fields().end() && ok; ++it) {
+            if (!first) { dst += ','; }
+            first = false;
+            ok = appendJsonString(dst, it->first);
+            dst += ':';
+            ok = ok && appendJson(dst, it->second);
+        }
+        dst += '}';
+    }
+    dst += '}';
+    return ok;
+}
+
+bool catena::common::appendJson(std::string& dst, const st2138::StructVariantValue& src) {
+    bool ok = true;
+    dst += '{';
+    if (!src.struct_variant_type().empty()) {
+        dst += "\"structVariantType\":";
+        ok = appendJsonString(dst, src.struct_variant_type());
+    }
+    if (src.has_value() && ok) {
+        if (!src.struct_variant_type().empty()) { dst += ','; }
+        dst += "\"value\":";
+        ok = appendJson(dst, src.value());
+    }
+    dst += '}';
+    return ok;
+}
+
+bool catena::common::appendJson(std::string& dst, const st2138::PushUpdates& src) {
+    if (!src.has_value()) {
+        return appendWithPrinter(dst, src);
+    }
+    const auto& update = src.value();
+    bool ok = true;
+    dst += '{';
+    if (src.slot() != 0) {
+        dst += "\"slot\":";
+        appendJsonInt(dst, src.slot());
+        dst += ',';
+    }
+    dst += "\"value\":{";
+    if (!update.oid().empty()) {
+        dst += "\"oid\":";
+        ok = appendJsonString(dst, update.oid());
+    }
+    if (update.has_value() && ok) {
+        if (!update.oid().empty()) { dst += ','; }
+        dst += "\"value\":";
+        ok = appendJson(dst, update.value());
+    }
+    dst += "}}";
+    return ok;
+}
@@ -0,0 +1,197 @@
+/*
+ * Copyright 2026 Ross Video Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <ParamCache.h>
+#include <Path.h>
+#include <Status.h>
+
+using catena::common::ParamCache;
+
+void ParamCache::capacity(std::size_t capacity) {
+    std::lock_guard lg(mtx_);
+    capacity_.store(capacity, std::memory_order_relaxed);
+    if (capacity == 0) {
+        entries_.clear();
+        uses_.clear();
+    } else {
+        evict_(capacity);
+    }
+}
+
+std::unique_ptr<catena::common::IParam> ParamCache::find(const std::string& fqoid, const IAuthorizer& authz) {
+    if (!enabled()) {
+        return nullptr;
+    }
+    std::unique_ptr<IParam> ans;
+    {
+        std::lock_guard lg(mtx_);
+        auto it = entries_.find(fqoid);
+        if (it != entries_.end()) {
+            bool authorized = true;
+            for (const IParamDescriptor* pd : it->second.chain) {
+                if (!authz.readAuthz(*pd)) {
+                    authorized = false;
+                    break;
+                }
+            }
+            // Unauthorized lookups fall through to the tree walk so the caller
+            // gets the same error it always did.
+            // Copied while mtx_ is held, as insert() and invalidate() may
+            // free the entry as soon as it is released.
+            if (authorized) {
+                ans = it->second.handle->copy();
+                uses_.splice(uses_.begin(), uses_, it->second.use);
+            }
+        }
+    }
+    if (ans) {
+        hits_.fetch_add(1, std::memory_order_relaxed);
+    } else {
+        misses_.fetch_add(1, std::memory_order_relaxed);
+    }
+    return ans;
+}
+
+void ParamCache::insert(const std::string& fqoid, const IParam& topLevel, const IParam& param) {
+    if (!enabled()) {
+        return;
+    }
+    // Deriving the chain of descriptors between the top level param and the
+    // resolved one. Array indices stay on the array's descriptor.
+    Entry entry;
+    try {
+        Path path(fqoid);
+        if (path.empty() || !path.front_is_string()) {
+            return;
+        }
+        path.pop();
+        const IParamDescriptor* pd = &topLevel.getDescriptor();
+        entry.chain.push_back(pd);
+        while (!path.empty()) {
+            std::string oid;
+            if (path.front_is_string()) {
+                oid = path.front_as_string();
+            } else {
+                Path::Index idx = path.front_as_index();
+                // Appends are not resolvable handles.
+                if (idx == Path::kEnd) {
+                    return;
+                }
+                st2138::ParamType type = pd->type();
+                if (type == st2138::ParamType::INT32_ARRAY || type == st2138::ParamType::FLOAT32_ARRAY ||
+                    type == st2138::ParamType::STRING_ARRAY || type == st2138::ParamType::STRUCT_ARRAY ||
+                    type == st2138::ParamType::STRUCT_VARIANT_ARRAY) {
+                    path.pop();
+                    continue;
+                }
+                // Template params keep their elements as indexed sub-params.
+                oid = std::to_string(idx);
+            }
+            const auto& subParams = pd->getAllSubParams();
+            auto it = subParams.find(oid);
+            if (it == subParams.end()) {
+                return;
+            }
+            pd = it->second;
+            entry.chain.push_back(pd);
+            path.pop();
+        }
+        entry.handle = param.copy();
+    } catch (const catena::exception_with_status&) {
+        return;
+    }
+    if (!entry.handle) {
+        return;
+    }
+    // The cached handle must not carry validation state from the caller.
+    entry.handle->resetValidate();
+
+    std::lock_guard lg(mtx_);
+    std::size_t capacity = capacity_.load(std::memory_order_relaxed);
+    if (capacity == 0) {
+        return;
+    }
+    auto it = entries_.find(fqoid);
+    if (it != entries_.end()) {
+        entry.use = it->second.use;
+        it->second = std::move(entry);
+    } else {
+        evict_(capacity - 1);
+        it = entries_.emplace(fqoid, std::move(entry)).first;
+        uses_.push_front(nullptr);
+        it->second.use = uses_.begin();
+        // Keys stay put in the map's nodes until the entry is erased.
+        *it->second.use = &it->first;
+    }
+    uses_.splice(uses_.begin(), uses_, it->second.use);
+}
+
+void ParamCache::evict_(std::size_t capacity) {
+    while (entries_.size() > capacity) {
+        entries_.erase(*uses_.back());
+        uses_.pop_back();
+        evictions_.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void ParamCache::invalidate(const std::string& oid) {
+    if (!enabled()) {
+        return;
+    }
+    std::string prefix = oid + "/";
+    std::lock_guard lg(mtx_);
+    std::erase_if(entries_, [this, &prefix](const auto& item) {
+        bool below = item.first.starts_with(prefix);
+        if (below) {
+            uses_.erase(item.second.use);
+            invalidations_.fetch_add(1, std::memory_order_relaxed);
+        }
+        return below;
+    });
+}
+
+void ParamCache::clear() {
+    std::lock_guard lg(mtx_);
+    invalidations_.fetch_add(entries_.size(), std::memory_order_relaxed);
+    entries_.clear();
+    uses_.clear();
+}
+
+ParamCache::Stats ParamCache::stats() const {
+    std::lock_guard lg(mtx_);
+    return Stats{
+        hits_.load(std::memory_order_relaxed),
+        misses_.load(std::memory_order_relaxed),
+        invalidations_.load(std::memory_order_relaxed),
+        evictions_.load(std::memory_order_relaxed),
+        entries_.size(),
+        capacity_.load(std::memory_order_relaxed)
+    };
+}
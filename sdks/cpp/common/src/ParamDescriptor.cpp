@@ -31,6 +31,9 @@
 
 #include <ParamDescriptor.h>
 
+// std
+#include <algorithm>
+
 using catena::common::ParamDescriptor;
 
 uint32_t ParamDescriptor::max_length() const {
@@ -41,6 +44,33 @@ std::size_t ParamDescriptor::total_length() const {
     return (total_length_ > 0) ? total_length_ : dev_.get().default_total_length();
 }
 
+void ParamDescriptor::getSubParams(std::span<const char* const> names, std::span<IParamDescriptor*> subParams) const {
+    std::size_t n = std::min(names.size(), subParams.size());
+    if (!subParamCache_ || n != names.size()) {
+        IParamDescriptor::getSubParams(names, subParams);
+        return;
+    }
+    SubParamCache& cache = *subParamCache_;
+    const char* const* key = cache.key.load(std::memory_order_acquire);
+    if (key == nullptr) {
+        // Build once. The table is never modified while key is published.
+        std::lock_guard lock(cache.mtx);
+        key = cache.key.load(std::memory_order_acquire);
+        if (key == nullptr) {
+            std::vector<IParamDescriptor*> table(n);
+            IParamDescriptor::getSubParams(names, table);
+            cache.table = std::move(table);
+            key = names.data();
+            cache.key.store(key, std::memory_order_release);
+        }
+    }
+    if (key == names.data() && cache.table.size() == n) {
+        std::copy_n(cache.table.begin(), n, subParams.begin());
+    } else {
+        IParamDescriptor::getSubParams(names, subParams);
+    }
+}
+
 void ParamDescriptor::toProto(st2138::Param &param, const IAuthorizer& authz) const {
     
     param.set_type(type_);
@@ -107,4 +137,14 @@ const std::string& ParamDescriptor::getScope() const {
         }
     }
     return *foundScope;
-}
\ No newline at end of file
+}
+
+uint32_t ParamDescriptor::getScopeMask() const {
+    if (!scope_.empty()) {
+        return scope_mask_;
+    } else if (parent_) {
+        return parent_->getScopeMask();
+    } else {
+        return dev_.get().getDefaultScopeMask();
+    }
+}
@@ -0,0 +1,273 @@
+/*
+ * Copyright 2026 Ross Video Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file ParamInfoSerializer.cpp
+ * @brief Implements ParamInfoSerializer.
+ * @date 2026-10-16
+ * @copyright Copyright (c) 2026 Ross Video
+ */
+
+// common
+#include <rpc/ParamInfoSerializer.h>
+#include <Status.h>
+
+namespace catena {
+namespace common {
+
+namespace {
+
+/**
+ * @brief Depth-first cursor over a param tree. Only the params on the path
+ * from the root to the current param are kept.
+ */
+class ParamCursor {
+  public:
+    /**
+     * @brief Constructs a cursor positioned on root.
+     */
+    ParamCursor(IParam& root, bool recursive, const IAuthorizer& authz)
+        : root_{&root}, recursive_{recursive}, authz_{authz} {}
+
+    /**
+     * @brief The current param.
+     */
+    IParam& current() { return frames_.empty() ? *root_ : *frames_.back().param; }
+
+    /**
+     * @brief True if the current param gets a response. Empty arrays below
+     * the root are skipped.
+     */
+    bool described() {
+        return frames_.empty() || !current().isArrayType() || current().size() > 0;
+    }
+
+    /**
+     * @brief Moves to the next param in pre-order, array elements before
+     * sub-params.
+     * @return false once the whole tree has been walked, or straight away if
+     * the cursor is not recursive.
+     */
+    bool next() {
+        while (recursive_) {
+            Position& pos = frames_.empty() ? rootPos_ : frames_.back().pos;
+            IParam& parent = current();
+            if (parent.isArrayType() && pos.index < parent.size()) {
+                if (push_(parent, Path::Segment{std::in_place_type<Path::Index>, pos.index++})) {
+                    return true;
+                }
+                continue;
+            }
+            const auto& subParams = parent.getDescriptor().getAllSubParams();
+            if (!pos.started) {
+                pos.child = subParams.begin();
+                pos.started = true;
+            }
+            while (pos.child != subParams.end()) {
+                const std::string& name = (pos.child++)->first;
+                // Skip invalid child names (empty or absolute paths)
+                if (!name.empty() && name[0] != '/' && push_(parent, Path::Segment{std::in_place_type<std::string>, name})) {
+                    return true;
+                }
+            }
+            // All of this param's children are done, go back up
+            if (frames_.empty()) {
+                break;
+            }
+            frames_.pop_back();
+        }
+        return false;
+    }
+
+    /**
+     * @brief Moves the cursor onto root, resolved again from the device, and
+     * resolves every param on the path to the current param again from it.
+     * If the current param no longer exists the cursor moves to its closest
+     * surviving ancestor.
+     */
+    void refresh(IParam& root) {
+        root_ = &root;
+        for (std::size_t i = 0; i < frames_.size(); ++i) {
+            auto param = resolve_(i == 0 ? *root_ : *frames_[i - 1].param, frames_[i].segment);
+            if (!param) {
+                frames_.resize(i);
+                return;
+            }
+            frames_[i].param = std::move(param);
+        }
+    }
+
+  private:
+    /**
+     * @brief How far the traversal has got through a param's children.
+     */
+    struct Position {
+        Path::Index index = 0;
+        bool started = false;
+        std::unordered_map<std::string, IParamDescriptor*>::const_iterator child{};
+    };
+
+    /**
+     * @brief A param on the current path, and how it was reached from its
+     * parent.
+     */
+    struct Frame {
+        std::unique_ptr<IParam> param;
+        Path::Segment segment;
+        Position pos;
+    };
+
+    /**
+     * @brief Resolves the child of parent at segment.
+     * @return The child, or nullptr if it does not exist or is not readable.
+     */
+    std::unique_ptr<IParam> resolve_(IParam& parent, const Path::Segment& segment) {
+        Path path{segment};
+        catena::exception_with_status rc{"", catena::StatusCode::OK};
+        auto child = parent.getParam(path, authz_, rc);
+        if (rc.status != catena::StatusCode::OK || (child && !authz_.readAuthz(*child))) {
+            child = nullptr;
+        }
+        return child;
+    }
+
+    /**
+     * @brief Moves the cursor to the child of parent at segment.
+     * @return false if the child does not exist or is not readable.
+     */
+    bool push_(IParam& parent, Path::Segment segment) {
+        auto child = resolve_(parent, segment);
+        if (!child) {
+            return false;
+        }
+        frames_.push_back(Frame{std::move(child), std::move(segment), {}});
+        return true;
+    }
+
+    IParam* root_;
+    bool recursive_;
+    const IAuthorizer& authz_;
+    Position rootPos_;
+    std::vector<Frame> frames_;
+};
+
+/**
+ * @brief Writes param's info and, for non-empty arrays, its length.
+ */
+void describe(IParam& param, st2138::ParamInfoResponse& response, const IAuthorizer& authz) {
+    response.Clear();
+    response.mutable_info();
+    param.toProto(response, authz);
+    if (param.isArrayType()) {
+        uint32_t length = param.size();
+        if (length > 0) {
+            response.set_array_length(length);
+        }
+    }
+}
+
+/**
+ * @brief Resolves the root at oid from the device.
+ * @return The root, or nullptr if it does not exist or is not readable.
+ */
+std::unique_ptr<IParam> resolveRoot(const IDevice& dm, const std::string& oid, const IAuthorizer& authz) {
+    catena::exception_with_status rc{"", catena::StatusCode::OK};
+    auto root = dm.getParam(oid, rc, authz);
+    if (rc.status != catena::StatusCode::OK) {
+        root = nullptr;
+    }
+    return root;
+}
+
+} // namespace
+
+const st2138::ParamInfoResponse& ParamInfoSerializer::getNext() {
+    if (!hasMore()) {
+        return st2138::ParamInfoResponse::default_instance();
+    }
+    handle_.resume();
+    handle_.promise().rethrow_if_exception();
+    return *handle_.promise().response;
+}
+
+ParamInfoSerializer ParamInfoSerializer::serialize(const IDevice& dm, std::vector<std::string> oids, bool recursive, const IAuthorizer& authz) {
+    ArenaPool& pool = ArenaPool::instance();
+    return serialize_(dm, std::move(oids), recursive, authz, pool.acquire(), pool.acquire());
+}
+
+ParamInfoSerializer ParamInfoSerializer::serialize_(const IDevice& dm, std::vector<std::string> oids, bool recursive, const IAuthorizer& authz,
+                                                    ArenaPool::Lease even, ArenaPool::Lease odd) {
+    ArenaPool::Lease* arenas[] = {&even, &odd};
+    std::size_t built = 0;
+    const st2138::ParamInfoResponse* previous = &st2138::ParamInfoResponse::default_instance();
+    bool pending = false;
+    for (const std::string& oid : oids) {
+        // Held while reading the root, but never while suspended
+        std::shared_lock<std::shared_mutex> lock(dm.paramMutex(oid));
+        std::unique_ptr<IParam> root = resolveRoot(dm, oid, authz);
+        if (!root) {
+            continue;
+        }
+        ParamCursor cursor(*root, recursive, authz);
+        do {
+            if (!cursor.described()) {
+                continue;
+            }
+            // The arena last held the response before previous, which has
+            // been written
+            ArenaPool::Lease& arena = *arenas[built++ % 2];
+            arena.reset();
+            st2138::ParamInfoResponse* response = arena.create<st2138::ParamInfoResponse>();
+            describe(cursor.current(), *response, authz);
+            // Only send the previous response once there is another after it
+            if (pending) {
+                lock.unlock();
+                co_yield *previous;
+                lock.lock();
+                // Every param was borrowed from the device, which may have
+                // changed while suspended, so the whole path is resolved
+                // again from the root. If this param has since been removed
+                // its response still stands, the cursor just continues from
+                // its closest surviving ancestor, or the next root.
+                root = resolveRoot(dm, oid, authz);
+                if (root) {
+                    cursor.refresh(*root);
+                }
+            }
+            previous = response;
+            pending = true;
+        } while (root && cursor.next());
+    }
+    // return the last response
+    co_return *previous;
+}
+
+} // namespace common
+} // namespace catena
@@ -30,62 +30,88 @@
 
 #include <ParamVisitor.h>
 
+#include <string_view>
+
 namespace catena {
 namespace common {
 
+namespace {
+
+/**
+ * @brief Appends "/segment" to path, escaping it as a json-pointer segment.
+ */
+void appendSegment(std::string& path, std::string_view segment) {
+    path.push_back('/');
+    for (char c : segment) {
+        if (c == '~') {
+            path.append("~0");
+        } else if (c == '/') {
+            path.append("~1");
+        } else {
+            path.push_back(c);
+        }
+    }
+}
+
+} // namespace
+
 // Traverses the parameters of a device and visits each parameter using the visitor
 void ParamVisitor::traverseParams(IParam* param, const std::string& path, const IDevice& device, IParamVisitor& visitor, const IAuthorizer& authz) {
+    traverseParams(param, path, visitor, authz);
+}
+
+// Traverses param and its descendants, resolving each child from its parent
+void ParamVisitor::traverseParams(IParam* param, const std::string& path, IParamVisitor& visitor, const IAuthorizer& authz) {
     if (!param) return;
+    std::string buffer;
+    buffer.reserve(path.size() + 64);
+    buffer = path;
+    traverse_(param, buffer, visitor, authz);
+}
 
+// Visits param at path, then descends into its elements and sub-params
+void ParamVisitor::traverse_(IParam* param, std::string& path, IParamVisitor& visitor, const IAuthorizer& authz) {
     // First visit the current parameter itself
     visitor.visit(param, path);
-    
+    const std::size_t parentLength = path.size();
+
     // Special handling for array-type parameters
     if (param->isArrayType()) {
         uint32_t array_length = param->size();
         if (array_length > 0) {
             // Notify visitor about array properties (e.g., length)
             visitor.visitArray(param, path, array_length);
-            
-            // Only process array elements if we're not already inside an array element
+
             for (uint32_t i = 0; i < array_length; i++) {
-                // Create path for this array element (e.g., "/params/array/0")
-                Path indexed_path(path);
-                indexed_path.push_back(std::to_string(i));
+                // Resolve the element directly from the array (e.g., "/params/array/0")
+                Path segment{Path::Segment{std::in_place_type<Path::Index>, i}};
                 catena::exception_with_status rc{"", catena::StatusCode::OK};
-                
-                // Get the parameter for this array index
-                auto indexed_param = device.getParam(indexed_path.toString(true), rc, authz);
+                auto indexed_param = param->getParam(segment, authz, rc);
                 if (indexed_param && authz.readAuthz(*indexed_param)) {
                     // Recursively process this array element and all its children
-                    traverseParams(indexed_param.get(), indexed_path.toString(true), device, visitor, authz);
+                    appendSegment(path, std::to_string(i));
+                    traverse_(indexed_param.get(), path, visitor, authz);
+                    path.resize(parentLength);
                 }
             }
         }
     }
-    
+
     // Process all regular (non-array-element) children of this parameter
-    const auto& descriptor = param->getDescriptor();
-    if (descriptor.getAllSubParams().empty()) {
-        return;  // No children to traverse
-    }
-    
-    
-    for (const auto& [child_name, child_desc] : descriptor.getAllSubParams()) {
+    for (const auto& [child_name, child_desc] : param->getDescriptor().getAllSubParams()) {
         // Skip invalid child names (empty or absolute paths)
         if (child_name.empty() || child_name[0] == '/') continue;
-        
-        // Construct the full path for this child
-        Path child_path(path);
-        child_path.push_back(child_name);
+
+        // Resolve the child directly from this parameter
+        Path segment{Path::Segment{std::in_place_type<std::string>, child_name}};
         catena::exception_with_status rc{"", catena::StatusCode::OK};
-        
-        // Get the child parameter
-        auto sub_param = device.getParam(child_path.toString(true), rc, authz);
-        
+        auto sub_param = param->getParam(segment, authz, rc);
+
         // If child exists and we can access it, process it recursively
         if (rc.status == catena::StatusCode::OK && sub_param && authz.readAuthz(*sub_param)) {
-            traverseParams(sub_param.get(), child_path.toString(true), device, visitor, authz);
+            appendSegment(path, child_name);
+            traverse_(sub_param.get(), path, visitor, authz);
+            path.resize(parentLength);
         }
     }
 }
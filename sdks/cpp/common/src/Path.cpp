@@ -33,77 +33,73 @@
 #include <utils.h>
 #include <Status.h>
 
-#include <regex>
-#include <optional>
+#include <algorithm>
+#include <charconv>
+#include <sstream>
 using catena::common::Path;
 using Index = Path::Index;
 
 Path::Path(const std::string &jptr) : segments_{} {
-    // regex will split a well-formed json pointer into a sequence of Path Segments
-    // typed according to the regex that matches the string for the segment
+    parse_(jptr);
+}
+
+Path::Path(const char *literal) : segments_{} {
+    parse_(literal);
+}
+
+void Path::parse_(std::string_view jptr) {
+    // single pass over a well-formed json pointer, each segment is one of
     // /- -- can be used as an array index
-    // /any_string_that_uses_only_word_chars -- i.e. letters & underscores.
-    // /string_with_~0_~1_escaped_chars -- string_with_~_/_escaped_chars
+    // /any_string_that_uses_only_word_chars -- i.e. letters, digits & underscores
+    //                                         not starting with a digit
     // /291834719 -- just numbers
     //
-
-    constexpr char kMatchOid[] {"(\\/[a-zA-Z_]\\w*)"}; // solidus followed by letters, underscore & digits, not starting with a digit
-    constexpr char kMatchIdx[] {"(\\/\\d+)"}; // solidus followed by at least one digit and only digits
-    constexpr char kMatchEnd[] {"(\\/-)"}; // solidus followed by dash
-    const std::string kSegmentRegex = std::string(kMatchOid) + "|" + kMatchIdx + "|" + kMatchEnd;
-    const std::string kPathRegex = "(" + kSegmentRegex + ")*";
-
-    // validate the input as a correctly formatted json pointer
-    std::regex path_regex(kPathRegex);
-    if (!std::regex_match(jptr, path_regex))  {
+    auto invalid = [&jptr]() {
         std::stringstream why;
         why << __PRETTY_FUNCTION__ << "\n'" << jptr << "' is not a valid path";
-        throw catena::exception_with_status(why.str(), catena::StatusCode::INVALID_ARGUMENT);
-    }
-
-    std::regex segment_regex(kSegmentRegex);
-    auto r_begin = std::sregex_iterator(jptr.begin(), jptr.end(), segment_regex);
-    auto r_end = std::sregex_iterator();
-    for (std::sregex_iterator it = r_begin; it != r_end; ++it) {
-        std::smatch match = *it;
-        if (it == r_begin && match.position(0) != 0) {
-            std::stringstream why;
-            why << __PRETTY_FUNCTION__ << "\n'" << jptr << " is invalid json pointer";
-            throw catena::exception_with_status(why.str(), catena::StatusCode::INVALID_ARGUMENT);
+        return catena::exception_with_status(why.str(), catena::StatusCode::INVALID_ARGUMENT);
+    };
+    auto isDigit = [](char c) { return c >= '0' && c <= '9'; };
+    auto isOidStart = [](char c) { return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_'; };
+
+    segments_.reserve(std::count(jptr.begin(), jptr.end(), '/'));
+    std::size_t pos = 0;
+    while (pos < jptr.size()) {
+        if (jptr[pos] != '/') {
+            throw invalid();
         }
+        std::size_t start = ++pos;
+        while (pos < jptr.size() && jptr[pos] != '/') {
+            ++pos;
+        }
+        std::string_view txt = jptr.substr(start, pos - start);
 
-        // unescape and strip off leading solidus '/'
-        std::string txt = unescape_(match.str()).substr(1, std::string::npos);
-
-        if (match[1].matched) {
-            // segment is a string
-            Segment seg;
-            seg.emplace<std::string>(txt);
-            segments_.push_back(seg);
-        } else if (match[2].matched) {
-            // segment is an index
-            Segment seg;
-            seg.emplace<Index>(std::stoul(txt));
-            segments_.push_back(seg);
-        } else if (match[3].matched) {
+        if (txt == "-") {
             // segment is the one-past-the-end array index
-            Segment seg;
-            seg.emplace<Index>(kEnd);
-            segments_.push_back(seg);
-        // GCOVR_EXCL_START
+            segments_.emplace_back(std::in_place_type<Index>, kEnd);
+        } else if (!txt.empty() && isDigit(txt.front())) {
+            // segment is an index
+            Index idx = 0;
+            auto [end, ec] = std::from_chars(txt.data(), txt.data() + txt.size(), idx);
+            if (ec != std::errc() || end != txt.data() + txt.size()) {
+                throw invalid();
+            }
+            segments_.emplace_back(std::in_place_type<Index>, idx);
+        } else if (!txt.empty() && isOidStart(txt.front())) {
+            // segment is a string
+            for (char c : txt) {
+                if (!isOidStart(c) && !isDigit(c)) {
+                    throw invalid();
+                }
+            }
+            segments_.emplace_back(std::in_place_type<std::string>, txt);
         } else {
-            // this should never happen
-            std::stringstream why;
-            why << __PRETTY_FUNCTION__ << "\n'" << jptr << " is invalid json pointer";
-            throw catena::exception_with_status(why.str(), catena::StatusCode::INVALID_ARGUMENT);
+            throw invalid();
         }
-        // GCOVR_EXCL_STOP
     }
     frontIdx_ = 0;
 }
 
-Path::Path(const char *literal) : Path(std::string(literal)) {}
-
 bool Path::front_is_index() const {
     bool ans = false;
     if (frontIdx_ < segments_.size() && std::holds_alternative<Index>(segments_[frontIdx_])) {
@@ -195,31 +191,28 @@ void Path::escape_(std::string &str) {
     subs(str, "/", "~1");
 }
 
-std::string Path::unescape_(const std::string &str) {
-    std::string ans(str);
-    subs(ans, "~0", "~");
-    subs(ans, "~1", "/");
-    return ans;
-}
-
 std::string Path::toString(bool leading_slash, std::size_t startIdx) const {
-    std::stringstream ans{""};
+    std::string ans;
     bool first = true;
     for (auto it = segments_.cbegin() + startIdx; it != segments_.cend(); ++it) {
-        ans << (first && !leading_slash ? "" : "/");
+        if (!first || leading_slash) {
+            ans += '/';
+        }
         if (std::holds_alternative<Index>(*it)) {
             Index idx = std::get<Index>(*it);
             if (idx == kEnd) {
-                ans << "-";
+                ans += '-';
             } else {
-                ans << idx;
+                char buf[24];
+                auto [end, ec] = std::to_chars(buf, buf + sizeof(buf), idx);
+                ans.append(buf, end);
             }
         } else if (std::holds_alternative<std::string>(*it)) {
-            ans << std::get<std::string>(*it);
+            ans += std::get<std::string>(*it);
         }
         first = false;
     }
-    return ans.str();
+    return ans;
 }
 
 std::string Path::toString(bool leading_slash) const {
@@ -0,0 +1,233 @@
+/*
+ * Copyright 2026 Ross Video Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file RangeKernels.cpp
+ * @brief Implements the scalar, SSE4.1 and AVX2 range kernels.
+ * @date 2026-10-16
+ * @copyright Copyright (c) 2026 Ross Video
+ */
+
+// common
+#include <RangeKernels.h>
+
+// std
+#include <algorithm>
+#include <cmath>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define CATENA_RANGE_KERNELS_X86 1
+#include <immintrin.h>
+#endif
+
+using namespace catena::common;
+
+namespace {
+
+/*
+ * Scalar versions. These are the reference the vector versions must match
+ * bit for bit, and handle the tail of each array.
+ */
+inline float clampOne(float val, float min, float max, float step) {
+    if (val < min) {
+        val = min;
+    } else if (val > max) {
+        val = max;
+    } else if (step) {
+        const float newVal = (std::round((val - min) / step) * step) + min;
+        val = newVal < min ? min : (newVal > max ? max : newVal);
+    }
+    return val;
+}
+
+inline int32_t clampOne(int32_t val, int32_t min, int32_t max, int32_t step) {
+    if (val < min) {
+        val = min;
+    } else if (val > max) {
+        val = max;
+    } else if (step) {
+        val -= (val - min) % step;
+    }
+    return val;
+}
+
+template <typename T>
+void clampScalar(T* data, std::size_t size, T min, T max, T step) {
+    for (std::size_t i = 0; i < size; ++i) {
+        data[i] = clampOne(data[i], min, max, step);
+    }
+}
+
+#ifdef CATENA_RANGE_KERNELS_X86
+
+/*
+ * std::round rounds halfway cases away from zero, while the vector round
+ * instructions round them to even. Adding the largest float below 0.5 with
+ * the sign of x and truncating gives std::round's result.
+ */
+constexpr float kJustBelowHalf = 0.49999997f;
+
+__attribute__((target("sse4.1")))
+void clampFloatSse41(float* data, std::size_t size, float min, float max, float step) {
+    const __m128 vmin = _mm_set1_ps(min);
+    const __m128 vmax = _mm_set1_ps(max);
+    const __m128 vstep = _mm_set1_ps(step);
+    const __m128 signMask = _mm_set1_ps(-0.0f);
+    const __m128 half = _mm_set1_ps(kJustBelowHalf);
+    std::size_t i = 0;
+    for (; i + 4 <= size; i += 4) {
+        const __m128 val = _mm_loadu_ps(data + i);
+        __m128 res = val;
+        if (step) {
+            const __m128 steps = _mm_div_ps(_mm_sub_ps(val, vmin), vstep);
+            const __m128 bias = _mm_or_ps(_mm_and_ps(steps, signMask), half);
+            const __m128 rounded = _mm_round_ps(_mm_add_ps(steps, bias), _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+            res = _mm_add_ps(_mm_mul_ps(rounded, vstep), vmin);
+            res = _mm_blendv_ps(res, vmax, _mm_cmpgt_ps(res, vmax));
+            res = _mm_blendv_ps(res, vmin, _mm_cmplt_ps(res, vmin));
+        }
+        res = _mm_blendv_ps(res, vmax, _mm_cmpgt_ps(val, vmax));
+        res = _mm_blendv_ps(res, vmin, _mm_cmplt_ps(val, vmin));
+        _mm_storeu_ps(data + i, res);
+    }
+    clampScalar(data + i, size - i, min, max, step);
+}
+
+__attribute__((target("avx2")))
+void clampFloatAvx2(float* data, std::size_t size, float min, float max, float step) {
+    const __m256 vmin = _mm256_set1_ps(min);
+    const __m256 vmax = _mm256_set1_ps(max);
+    const __m256 vstep = _mm256_set1_ps(step);
+    const __m256 signMask = _mm256_set1_ps(-0.0f);
+    const __m256 half = _mm256_set1_ps(kJustBelowHalf);
+    std::size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        const __m256 val = _mm256_loadu_ps(data + i);
+        __m256 res = val;
+        if (step) {
+            const __m256 steps = _mm256_div_ps(_mm256_sub_ps(val, vmin), vstep);
+            const __m256 bias = _mm256_or_ps(_mm256_and_ps(steps, signMask), half);
+            const __m256 rounded = _mm256_round_ps(_mm256_add_ps(steps, bias), _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+            // No FMA, so the result rounds the same as the scalar version.
+            res = _mm256_add_ps(_mm256_mul_ps(rounded, vstep), vmin);
+            res = _mm256_blendv_ps(res, vmax, _mm256_cmp_ps(res, vmax, _CMP_GT_OQ));
+            res = _mm256_blendv_ps(res, vmin, _mm256_cmp_ps(res, vmin, _CMP_LT_OQ));
+        }
+        res = _mm256_blendv_ps(res, vmax, _mm256_cmp_ps(val, vmax, _CMP_GT_OQ));
+        res = _mm256_blendv_ps(res, vmin, _mm256_cmp_ps(val, vmin, _CMP_LT_OQ));
+        _mm256_storeu_ps(data + i, res);
+    }
+    clampScalar(data + i, size - i, min, max, step);
+}
+
+__attribute__((target("sse4.1")))
+void clampIntSse41(int32_t* data, std::size_t size, int32_t min, int32_t max) {
+    const __m128i vmin = _mm_set1_epi32(min);
+    const __m128i vmax = _mm_set1_epi32(max);
+    std::size_t i = 0;
+    for (; i + 4 <= size; i += 4) {
+        const __m128i val = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        __m128i res = _mm_blendv_epi8(val, vmax, _mm_cmpgt_epi32(val, vmax));
+        res = _mm_blendv_epi8(res, vmin, _mm_cmplt_epi32(val, vmin));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(data + i), res);
+    }
+    clampScalar(data + i, size - i, min, max, int32_t{0});
+}
+
+__attribute__((target("avx2")))
+void clampIntAvx2(int32_t* data, std::size_t size, int32_t min, int32_t max) {
+    const __m256i vmin = _mm256_set1_epi32(min);
+    const __m256i vmax = _mm256_set1_epi32(max);
+    std::size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        const __m256i val = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        __m256i res = _mm256_blendv_epi8(val, vmax, _mm256_cmpgt_epi32(val, vmax));
+        res = _mm256_blendv_epi8(res, vmin, _mm256_cmpgt_epi32(vmin, val));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(data + i), res);
+    }
+    clampScalar(data + i, size - i, min, max, int32_t{0});
+}
+
+#endif // CATENA_RANGE_KERNELS_X86
+
+SimdLevel detectSimdLevel() {
+    SimdLevel level = SimdLevel::kScalar;
+#ifdef CATENA_RANGE_KERNELS_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        level = SimdLevel::kAvx2;
+    } else if (__builtin_cpu_supports("sse4.1")) {
+        level = SimdLevel::kSse41;
+    }
+#endif
+    return level;
+}
+
+} // namespace
+
+SimdLevel catena::common::simdLevel() {
+    static const SimdLevel level = detectSimdLevel();
+    return level;
+}
+
+void catena::common::clampToRange(std::span<float> values, float min, float max, float step, SimdLevel level) {
+    level = std::min(level, simdLevel());
+    switch (level) {
+#ifdef CATENA_RANGE_KERNELS_X86
+        case SimdLevel::kAvx2:
+            clampFloatAvx2(values.data(), values.size(), min, max, step);
+            break;
+        case SimdLevel::kSse41:
+            clampFloatSse41(values.data(), values.size(), min, max, step);
+            break;
+#endif
+        default:
+            clampScalar(values.data(), values.size(), min, max, step);
+            break;
+    }
+}
+
+void catena::common::clampToRange(std::span<int32_t> values, int32_t min, int32_t max, int32_t step, SimdLevel level) {
+    // Stepping needs an integer remainder, which has no vector instruction.
+    level = step ? SimdLevel::kScalar : std::min(level, simdLevel());
+    switch (level) {
+#ifdef CATENA_RANGE_KERNELS_X86
+        case SimdLevel::kAvx2:
+            clampIntAvx2(values.data(), values.size(), min, max);
+            break;
+        case SimdLevel::kSse41:
+            clampIntSse41(values.data(), values.size(), min, max);
+            break;
+#endif
+        default:
+            clampScalar(values.data(), values.size(), min, max, step);
+            break;
+    }
+}
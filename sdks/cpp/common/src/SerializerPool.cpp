@@ -0,0 +1,139 @@
+/*
+ * Copyright 2026 Ross Video Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file SerializerPool.cpp
+ * @brief Implements SerializerPool.
+ * @date 2026-10-16
+ * @copyright Copyright (c) 2026 Ross Video
+ */
+
+// common
+#include <rpc/SerializerPool.h>
+#include <Config.h>
+
+#include <algorithm>
+
+using catena::common::SerializerPool;
+
+SerializerPool& SerializerPool::instance() {
+    static SerializerPool pool(config::serializer_workers);
+    return pool;
+}
+
+SerializerPool::SerializerPool(std::size_t workers) {
+    for (std::size_t i = 0; i < workers; ++i) {
+        workers_.emplace_back([this]() { run_(); });
+    }
+}
+
+SerializerPool::~SerializerPool() {
+    {
+        std::lock_guard lock(mtx_);
+        stop_ = true;
+    }
+    work_cv_.notify_all();
+    for (auto& worker : workers_) {
+        worker.join();
+    }
+}
+
+void SerializerPool::run(std::size_t count, const Task& task) {
+    // Nothing to share
+    if (workers_.empty() || count <= 1) {
+        for (std::size_t i = 0; i < count; ++i) {
+            task(i);
+        }
+        return;
+    }
+
+    Batch batch{task, count};
+    {
+        std::lock_guard lock(mtx_);
+        batches_.push_back(&batch);
+    }
+    work_cv_.notify_all();
+    work_(batch);
+
+    // Waiting for the workers' tasks, and for them to let go of the batch
+    std::unique_lock lock(mtx_);
+    done_cv_.wait(lock, [&batch]() {
+        return batch.finished.load(std::memory_order_acquire) == batch.count && batch.helpers == 0;
+    });
+    auto it = std::find(batches_.begin(), batches_.end(), &batch);
+    if (it != batches_.end()) {
+        batches_.erase(it);
+    }
+    if (batch.error) {
+        std::rethrow_exception(batch.error);
+    }
+}
+
+void SerializerPool::work_(Batch& batch) {
+    std::size_t i;
+    while ((i = batch.next.fetch_add(1, std::memory_order_relaxed)) < batch.count) {
+        try {
+            batch.task(i);
+        } catch (...) {
+            std::lock_guard lock(mtx_);
+            if (!batch.error) {
+                batch.error = std::current_exception();
+            }
+        }
+        if (batch.finished.fetch_add(1, std::memory_order_acq_rel) + 1 == batch.count) {
+            // Taking the lock so the caller cannot miss the notification
+            std::lock_guard lock(mtx_);
+            done_cv_.notify_all();
+        }
+    }
+}
+
+void SerializerPool::run_() {
+    std::unique_lock lock(mtx_);
+    while (true) {
+        work_cv_.wait(lock, [this]() { return stop_ || !batches_.empty(); });
+        if (stop_) {
+            return;
+        }
+        Batch* batch = batches_.front();
+        // Every task has been claimed, the batch's caller finishes it
+        if (batch->next.load(std::memory_order_relaxed) >= batch->count) {
+            batches_.pop_front();
+            continue;
+        }
+        ++batch->helpers;
+        lock.unlock();
+        work_(*batch);
+        lock.lock();
+        if (--batch->helpers == 0) {
+            done_cv_.notify_all();
+        }
+    }
+}
@@ -35,6 +35,9 @@
 // protobuf interface
 #include <interface/param.pb.h>
 
+// std
+#include <span>
+
 using namespace catena::common;
 
 EmptyValue catena::common::emptyValue;
@@ -45,6 +48,13 @@ catena::exception_with_status catena::common::toProto<EmptyValue>(st2138::Value&
     return catena::exception_with_status{"", catena::StatusCode::OK};
 }
 
+template<>
+catena::exception_with_status catena::common::toJson<EmptyValue>(std::string& dst, const EmptyValue* src, const IParamDescriptor& pd, const IAuthorizer& authz) {
+    // A value with nothing set
+    dst += "{}";
+    return catena::exception_with_status{"", catena::StatusCode::OK};
+}
+
 template<>
 bool catena::common::validFromProto<EmptyValue>(const st2138::Value& src, const EmptyValue* dst, const IParamDescriptor& pd, catena::exception_with_status& rc, const IAuthorizer& authz) {
     // do nothing
@@ -69,6 +79,20 @@ catena::exception_with_status catena::common::toProto<int32_t>(st2138::Value& ds
     return rc;
 }
 
+template<>
+catena::exception_with_status catena::common::toJson<int32_t>(std::string& dst, const int32_t* src, const IParamDescriptor& pd, const IAuthorizer& authz) {
+    catena::exception_with_status rc{"", catena::StatusCode::OK};
+    // Must have read authorization
+    if (!authz.readAuthz(pd)) {
+        rc = catena::exception_with_status("Not authorized to read param " + pd.getOid(), catena::StatusCode::PERMISSION_DENIED);
+    } else {
+        dst += "{\"int32Value\":";
+        appendJsonInt(dst, *src);
+        dst += '}';
+    }
+    return rc;
+}
+
 template<>
 bool catena::common::validFromProto<int32_t>(const st2138::Value& src, const int32_t* dst, const IParamDescriptor& pd, catena::exception_with_status& rc, const IAuthorizer& authz) {
     const IConstraint* constraint = pd.getConstraint();
@@ -112,6 +136,20 @@ catena::exception_with_status catena::common::toProto<float>(st2138::Value& dst,
     return rc;
 }
 
+template<>
+catena::exception_with_status catena::common::toJson<float>(std::string& dst, const float* src, const IParamDescriptor& pd, const IAuthorizer& authz) {
+    catena::exception_with_status rc{"", catena::StatusCode::OK};
+    // Must have read authorization
+    if (!authz.readAuthz(pd)) {
+        rc = catena::exception_with_status("Not authorized to read param " + pd.getOid(), catena::StatusCode::PERMISSION_DENIED);
+    } else {
+        dst += "{\"float32Value\":";
+        appendJsonFloat(dst, *src);
+        dst += '}';
+    }
+    return rc;
+}
+
 template<>
 bool catena::common::validFromProto<float>(const st2138::Value& src, const float* dst, const IParamDescriptor& pd, catena::exception_with_status& rc, const IAuthorizer& authz) {
     const IConstraint* constraint = pd.getConstraint();
@@ -155,6 +193,22 @@ catena::exception_with_status catena::common::toProto<std::string>(st2138::Value
     return rc;
 }
 
+template<>
+catena::exception_with_status catena::common::toJson<std::string>(std::string& dst, const std::string* src, const IParamDescriptor& pd, const IAuthorizer& authz) {
+    catena::exception_with_status rc{"", catena::StatusCode::OK};
+    // Must have read authorization
+    if (!authz.readAuthz(pd)) {
+        rc = catena::exception_with_status("Not authorized to read param " + pd.getOid(), catena::StatusCode::PERMISSION_DENIED);
+    } else {
+        dst += "{\"stringValue\":";
+        if (!appendJsonString(dst, *src)) {
+            rc = catena::exception_with_status("Param " + pd.getOid() + " is not valid UTF-8", catena::StatusCode::INTERNAL);
+        }
+        dst += '}';
+    }
+    return rc;
+}
+
 template<>
 bool catena::common::validFromProto<std::string>(const st2138::Value& src, const std::string* dst, const IParamDescriptor& pd, catena::exception_with_status& rc, const IAuthorizer& authz) {
     const IConstraint* constraint = pd.getConstraint();
@@ -192,9 +246,29 @@ catena::exception_with_status catena::common::toProto<std::vector<int32_t>>(st21
     } else {
         dst.clear_int32_array_values();
         st2138::Int32List& int_array = *dst.mutable_int32_array_values();
-        for (const int32_t& i : *src) {
-            int_array.add_ints(i);
+        int_array.mutable_ints()->Assign(src->begin(), src->end());
+    }
+    return rc;
+}
+
+template<>
+catena::exception_with_status catena::common::toJson<std::vector<int32_t>>(std::string& dst, const std::vector<int32_t>* src, const IParamDescriptor& pd, const IAuthorizer& authz) {
+    catena::exception_with_status rc{"", catena::StatusCode::OK};
+    // Must have read authorization
+    if (!authz.readAuthz(pd)) {
+        rc = catena::exception_with_status("Not authorized to read param " + pd.getOid(), catena::StatusCode::PERMISSION_DENIED);
+    } else {
+        dst += "{\"int32ArrayValues\":{";
+        // An empty list is the default, which is omitted
+        if (!src->empty()) {
+            dst += "\"ints\":[";
+            for (std::size_t i = 0; i < src->size(); ++i) {
+                if (i > 0) { dst += ','; }
+                appendJsonInt(dst, (*src)[i]);
+            }
+            dst += ']';
         }
+        dst += "}}";
     }
     return rc;
 }
@@ -214,13 +288,9 @@ bool catena::common::validFromProto<std::vector<int32_t>>(const st2138::Value& s
         const IConstraint* constraint = pd.getConstraint();
         // All values must satisfy present constraint
         if (constraint && !constraint->isRange()) {
-            for (int32_t i : src.int32_array_values().ints()) {
-                st2138::Value item;
-                item.set_int32_value(i);
-                if (!constraint->satisfied(item)) {
-                    rc = catena::exception_with_status(pd.getOid() + " constraint not met", catena::StatusCode::INVALID_ARGUMENT);
-                    break;
-                }
+            const auto& values = src.int32_array_values().ints();
+            if (!constraint->validate(std::span<const int32_t>(values.data(), values.size()))) {
+                rc = catena::exception_with_status(pd.getOid() + " constraint not met", catena::StatusCode::INVALID_ARGUMENT);
             }
         }
     }
@@ -231,17 +301,12 @@ template<>
 catena::exception_with_status catena::common::fromProto<std::vector<int32_t>>(const st2138::Value& src, std::vector<int32_t>* dst, const IParamDescriptor& pd, const IAuthorizer& authz) {
     catena::exception_with_status rc{"", catena::StatusCode::OK};
     if (validFromProto(src, dst, pd, rc, authz)) {
-        dst->clear();
+        const auto& values = src.int32_array_values().ints();
+        dst->assign(values.begin(), values.end());
         const IConstraint* constraint = pd.getConstraint();
-        for (int32_t i : src.int32_array_values().ints()) {
-            st2138::Value item;
-            item.set_int32_value(i);
-            if (!constraint || !constraint->isRange()) {
-                dst->push_back(i);
-            } else {
-                // round src to a valid value in the range
-                dst->push_back(constraint->apply(item).int32_value());
-            }
+        if (constraint && constraint->isRange()) {
+            // round each value to a valid value in the range
+            constraint->clamp(std::span<int32_t>(*dst));
         }
     }
     return rc;
@@ -256,9 +321,29 @@ catena::exception_with_status catena::common::toProto<std::vector<float>>(st2138
     } else {
         dst.clear_float32_array_values();
         st2138::Float32List& float_array = *dst.mutable_float32_array_values();
-        for (const float& f : *src) {
-            float_array.add_floats(f);
+        float_array.mutable_floats()->Assign(src->begin(), src->end());
+    }
+    return rc;
+}
+
+template<>
+catena::exception_with_status catena::common::toJson<std::vector<float>>(std::string& dst, const std::vector<float>* src, const IParamDescriptor& pd, const IAuthorizer& authz) {
+    catena::exception_with_status rc{"", catena::StatusCode::OK};
+    // Must have read authorization
+    if (!authz.readAuthz(pd)) {
+        rc = catena::exception_with_status("Not authorized to read param " + pd.getOid(), catena::StatusCode::PERMISSION_DENIED);
+    } else {
+        dst += "{\"float32ArrayValues\":{";
+        // An empty list is the default, which is omitted
+        if (!src->empty()) {
+            dst += "\"floats\":[";
+            for (std::size_t i = 0; i < src->size(); ++i) {
+                if (i > 0) { dst += ','; }
+                appendJsonFloat(dst, (*src)[i]);
+            }
+            dst += ']';
         }
+        dst += "}}";
     }
     return rc;
 }
@@ -278,13 +363,9 @@ bool catena::common::validFromProto<std::vector<float>>(const st2138::Value& src
         const IConstraint* constraint = pd.getConstraint();
         // All values must satisfy present constraint
         if (constraint && !constraint->isRange()) {
-            for (float i : src.float32_array_values().floats()) {
-                st2138::Value item;
-                item.set_float32_value(i);
-                if (!constraint->satisfied(item)) {
-                    rc = catena::exception_with_status(pd.getOid() + " constraint not met", catena::StatusCode::INVALID_ARGUMENT);
-                    break;
-                }
+            const auto& values = src.float32_array_values().floats();
+            if (!constraint->validate(std::span<const float>(values.data(), values.size()))) {
+                rc = catena::exception_with_status(pd.getOid() + " constraint not met", catena::StatusCode::INVALID_ARGUMENT);
             }
         }
     }
@@ -295,17 +376,12 @@ template<>
 catena::exception_with_status catena::common::fromProto<std::vector<float>>(const st2138::Value& src, std::vector<float>* dst, const IParamDescriptor& pd, const IAuthorizer& authz) {
     catena::exception_with_status rc{"", catena::StatusCode::OK};
     if (validFromProto(src, dst, pd, rc, authz)) {
-        dst->clear();
+        const auto& values = src.float32_array_values().floats();
+        dst->assign(values.begin(), values.end());
         const IConstraint* constraint = pd.getConstraint();
-        for (float f : src.float32_array_values().floats()) {
-            st2138::Value item;
-            item.set_float32_value(f);
-            if (!constraint || !constraint->isRange()) {
-                dst->push_back(f);
-            } else {
-                // round src to a valid value in the range
-                dst->push_back(constraint->apply(item).float32_value());
-            }
+        if (constraint && constraint->isRange()) {
+            // round each value to a valid value in the range
+            constraint->clamp(std::span<float>(*dst));
         }
     }
     return rc;
@@ -327,6 +403,30 @@ catena::exception_with_status catena::common::toProto<std::vector<std::string>>(
     return rc;
 }
 
+template<>
+catena::exception_with_status catena::common::toJson<std::vector<std::string>>(std::string& dst, const std::vector<std::string>* src, const IParamDescriptor& pd, const IAuthorizer& authz) {
+    catena::exception_with_status rc{"", catena::StatusCode::OK};
+    // Must have read authorization
+    if (!authz.readAuthz(pd)) {
+        rc = catena::exception_with_status("Not authorized to read param " + pd.getOid(), catena::StatusCode::PERMISSION_DENIED);
+    } else {
+        dst += "{\"stringArrayValues\":{";
+        // An empty list is the default, which is omitted
+        if (!src->empty()) {
+            dst += "\"strings\":[";
+            for (std::size_t i = 0; i < src->size() && rc.status == catena::StatusCode::OK; ++i) {
+                if (i > 0) { dst += ','; }
+                if (!appendJsonString(dst, (*src)[i])) {
+                    rc = catena::exception_with_status("Param " + pd.getOid() + " is not valid UTF-8", catena::StatusCode::INTERNAL);
+                }
+            }
+            dst += ']';
+        }
+        dst += "}}";
+    }
+    return rc;
+}
+
 template<>
 bool catena::common::validFromProto<std::vector<std::string>>(const st2138::Value& src, const std::vector<std::string>* dst, const IParamDescriptor& pd, catena::exception_with_status& rc, const IAuthorizer& authz) {
     std::size_t total_length = 0;
@@ -0,0 +1,157 @@
+/*
+ * Copyright 2026 Ross Video Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+// common
+#include <SubscribedOids.h>
+#include <IDevice.h>
+#include <IParam.h>
+#include <ParamVisitor.h>
+#include <Path.h>
+#include <Authorizer.h>
+
+// std
+#include <algorithm>
+
+using catena::common::SubscribedOids;
+using catena::common::IParam;
+using catena::common::ParamVisitor;
+using catena::common::Authorizer;
+
+namespace {
+/**
+ * @brief Visitor which collects the OIDs a wildcard subscription expands to.
+ */
+class SubscriptionVisitor : public catena::common::IParamVisitor {
+  public:
+    explicit SubscriptionVisitor(std::set<std::string>& oids) : oids_(oids) {}
+
+    void visit(IParam* param, const std::string& path) override {
+        // Skip array elements (paths ending with indices) to prevent invalid paths
+        if (!catena::common::Path(path).back_is_index()) {
+            oids_.insert(path);
+        }
+    }
+
+    void visitArray(IParam* param, const std::string& path, uint32_t length) override {
+        if (!catena::common::Path(path).back_is_index()) {
+            oids_.insert(path);
+        }
+    }
+
+  private:
+    std::set<std::string>& oids_;
+};
+} // namespace
+
+std::vector<std::string_view> SubscribedOids::split(std::string_view oid) {
+    std::vector<std::string_view> segments;
+    while (!oid.empty()) {
+        std::size_t end = oid.find('/');
+        if (end == std::string_view::npos) {
+            end = oid.size();
+        }
+        if (end > 0) {
+            segments.push_back(oid.substr(0, end));
+        }
+        oid.remove_prefix(std::min(end + 1, oid.size()));
+    }
+    return segments;
+}
+
+bool SubscribedOids::covers(const Node* root, std::string_view oid) {
+    const Node* node = root;
+    for (std::string_view segment : split(oid)) {
+        if (!node || node->wildcard) {
+            break;
+        }
+        auto it = node->children.find(segment);
+        node = it != node->children.end() ? it->second.get() : nullptr;
+    }
+    return node && (node->wildcard || node->exact);
+}
+
+bool SubscribedOids::coversAll(const Node* root, std::string_view oid) {
+    const Node* node = root;
+    for (std::string_view segment : split(oid)) {
+        if (!node || node->wildcard) {
+            break;
+        }
+        auto it = node->children.find(segment);
+        node = it != node->children.end() ? it->second.get() : nullptr;
+    }
+    return node && node->wildcard;
+}
+
+bool SubscribedOids::contains(std::string_view oid) const {
+    if (expanded_ && !root_) {
+        return expanded_->contains(std::string(oid));
+    }
+    return covers(root_.get(), oid);
+}
+
+const std::set<std::string>& SubscribedOids::expand_() const {
+    if (!expanded_) {
+        expanded_.emplace();
+        if (root_ && dm_) {
+            std::string path;
+            expandNode_(*root_, path);
+        }
+    }
+    return *expanded_;
+}
+
+void SubscribedOids::expandNode_(const Node& node, std::string& path) const {
+    if (node.wildcard) {
+        catena::exception_with_status rc{"", catena::StatusCode::OK};
+        SubscriptionVisitor visitor(*expanded_);
+        // "/*" expands to every top-level param.
+        if (path.empty()) {
+            for (auto& param : dm_->getTopLevelParams(rc)) {
+                ParamVisitor::traverseParams(param.get(), "/" + param->getOid(), visitor, Authorizer::kAuthzDisabled);
+            }
+        } else {
+            auto param = dm_->getParam(path, rc);
+            if (param) {
+                ParamVisitor::traverseParams(param.get(), path, visitor, Authorizer::kAuthzDisabled);
+            }
+        }
+        // Everything below a wildcard is already covered.
+        return;
+    }
+    if (node.exact) {
+        expanded_->insert(path);
+    }
+    for (const auto& [segment, child] : node.children) {
+        std::size_t length = path.size();
+        path.append(1, '/').append(segment);
+        expandNode_(*child, path);
+        path.resize(length);
+    }
+}
@@ -29,101 +29,79 @@
  */
 
 #include <SubscriptionManager.h>
+#include <ParamLock.h>
 using catena::common::SubscriptionManager;
+using catena::common::SubscribedOids;
 
 // Add a subscription (unique or wildcard)
-bool SubscriptionManager::addSubscription(const std::string& oid, IDevice& dm, exception_with_status& rc, const IAuthorizer& authz) {
-    std::lock_guard sg(mtx_);
+bool SubscriptionManager::addSubscription(const std::string& oid, IDevice& dm, exception_with_status& rc, const IAuthorizer& authz, const std::string& scope) {
     rc = catena::exception_with_status{"", catena::StatusCode::OK};
     bool wildcard = isWildcard(oid);
-    std::string baseOid;
-    std::unique_ptr<IParam> param = nullptr;
-    // Getting set of subscriptions for the specified device.
-    std::set<std::string>& dmSubscriptions = subscriptions_[dm.slot()];
-
-    // Getting base Oid if wildcard.
-    if (wildcard) {
-        baseOid = oid.substr(0, oid.length() - 2);
-    } else {
-        baseOid = oid;
-    }
+    std::string baseOid = wildcard ? oid.substr(0, oid.length() - 2) : oid;
 
     // Making sure the oid exists unless client is subbing to all params.
-    if (!wildcard || oid != "/*") {
-        std::lock_guard lg(dm.mutex());
-        param = dm.getParam(baseOid, rc, authz);
+    if (oid != "/*") {
+        std::unique_ptr<IParam> param = nullptr;
+        {
+            ParamReadLock lock(dm, baseOid);
+            param = dm.getParam(baseOid, rc, authz);
+        }
+        if (!param) {
+            return rc.status == catena::StatusCode::OK;
+        }
     }
 
-    // Add non-wildcard subscription.
-    if (!wildcard) {
-        if (dmSubscriptions.contains(baseOid)) {
+    std::lock_guard wg(writeMtx_);
+    // Keyed scopes belong to an open connection, which frees them on close.
+    std::shared_ptr<Scope> clientScope = scope_(scope);
+    if (!clientScope) {
+        rc = catena::exception_with_status("No open connection for subscription scope", catena::StatusCode::FAILED_PRECONDITION);
+        return false;
+    }
+    NodePtr root = root_(clientScope.get(), dm.slot());
+    // Exact subscriptions are covered by an exact or wildcard subscription,
+    // wildcards only by a wildcard. Otherwise an exact subscription is
+    // upgraded to a wildcard.
+    bool covered = wildcard ? SubscribedOids::coversAll(root.get(), baseOid) : SubscribedOids::covers(root.get(), baseOid);
+    if (covered) {
+        if (!wildcard) {
             rc = catena::exception_with_status("Subscription already exists for OID: " + baseOid, catena::StatusCode::ALREADY_EXISTS);
-        } else if (param) {
-            dmSubscriptions.insert(baseOid);
-        }
-    // Add wildcard subscription.
-    } else if (wildcard && param) {
-        SubscriptionVisitor visitor(dmSubscriptions);
-        ParamVisitor::traverseParams(param.get(), baseOid, dm, visitor, authz);   
-    // Add all params case.
-    } else if (wildcard && oid == "/*") {
-        std::vector<std::unique_ptr<IParam>> allParams;
-        {
-            std::lock_guard lg(dm.mutex());
-            allParams = dm.getTopLevelParams(rc, authz);
-        }            
-        // Now add the actual subscriptions
-        for (auto& param : allParams) {
-            if (authz.readAuthz(*param)) {
-                SubscriptionVisitor visitor(dmSubscriptions);
-                ParamVisitor::traverseParams(param.get(), "/" + param->getOid(), dm, visitor, authz);
-            }
         }
+    } else {
+        publish_(*clientScope, dm.slot(), insert_(root, SubscribedOids::split(baseOid), 0, wildcard));
     }
     return rc.status == catena::StatusCode::OK;
 }
 
 // Remove a subscription (either unique or wildcard)
-bool SubscriptionManager::removeSubscription(const std::string& oid, const IDevice& dm, catena::exception_with_status& rc) {
-    std::lock_guard sg(mtx_);
+bool SubscriptionManager::removeSubscription(const std::string& oid, const IDevice& dm, catena::exception_with_status& rc, const std::string& scope) {
     rc = catena::exception_with_status{"", catena::StatusCode::OK};
-    // Getting set of subscriptions for the specified device.
-    std::set<std::string>& dmSubscriptions = subscriptions_[dm.slot()];
-
-    // Wildcard case.
-    if (isWildcard(oid)) {
-        // Expand wildcard and remove all matching OIDs
-        std::string basePath = oid.substr(0, oid.length() - 2);
-        bool found = false;
-        auto it = dmSubscriptions.begin();
-        while (it != dmSubscriptions.end()) {
-            if (it->starts_with(basePath)) {
-                it = dmSubscriptions.erase(it);
-                found = true;
-            } else {
-                ++it;
-            }
-        }
-        if (!found) {
-            rc = catena::exception_with_status("Subscription not found for OID: " + oid, catena::StatusCode::NOT_FOUND);
-        }
-    // Normal case.
-    } else {
-        auto it = dmSubscriptions.find(oid);
-        if (it != dmSubscriptions.end()) {
-            dmSubscriptions.erase(it);
-        } else {
-            rc = catena::exception_with_status("Subscription not found for OID: " + oid, catena::StatusCode::NOT_FOUND);
+    bool wildcard = isWildcard(oid);
+    std::string baseOid = wildcard ? oid.substr(0, oid.length() - 2) : oid;
+    bool found = false;
+
+    std::lock_guard wg(writeMtx_);
+    std::shared_ptr<Scope> clientScope = scope_(scope);
+    if (!clientScope) {
+        rc = catena::exception_with_status("No open connection for subscription scope", catena::StatusCode::FAILED_PRECONDITION);
+        return false;
+    }
+    NodePtr root = root_(clientScope.get(), dm.slot());
+    if (root) {
+        NodePtr newRoot = erase_(root, SubscribedOids::split(baseOid), 0, wildcard, found);
+        if (found) {
+            publish_(*clientScope, dm.slot(), std::move(newRoot));
         }
     }
-
+    if (!found) {
+        rc = catena::exception_with_status("Subscription not found for OID: " + oid, catena::StatusCode::NOT_FOUND);
+    }
     return rc.status == catena::StatusCode::OK;
 }
 
 // Get all subscribed OIDs
-std::set<std::string> SubscriptionManager::getAllSubscribedOids(const IDevice& dm) {
-    std::lock_guard sg(mtx_);
-    return subscriptions_[dm.slot()];
+SubscribedOids SubscriptionManager::getAllSubscribedOids(const IDevice& dm, const std::string& scope) {
+    return SubscribedOids(root_(scope_(scope).get(), dm.slot()), dm);
 }
 
 // Returns true if the OID ends with "/*", indicating it's a wildcard subscription
@@ -131,7 +109,106 @@ bool SubscriptionManager::isWildcard(const std::string& oid) {
     return oid.length() >= 2 && oid.substr(oid.length() - 2) == "/*";
 }
 
-bool SubscriptionManager::isSubscribed(const std::string& oid, const IDevice& dm) {
-    std::lock_guard sg(mtx_);
-    return subscriptions_.contains(dm.slot()) && subscriptions_[dm.slot()].contains(oid);
+bool SubscriptionManager::isSubscribed(const std::string& oid, const IDevice& dm, const std::string& scope) {
+    return SubscribedOids::covers(root_(scope_(scope).get(), dm.slot()).get(), oid);
+}
+
+void SubscriptionManager::openScope(const std::string& scope) {
+    std::lock_guard wg(writeMtx_);
+    createScope_(scope)->connections += 1;
+}
+
+void SubscriptionManager::closeScope(const std::string& scope) {
+    std::lock_guard wg(writeMtx_);
+    std::shared_ptr<Scope> clientScope = scope_(scope);
+    if (clientScope && clientScope->connections > 0 && --clientScope->connections == 0 && scope != kSharedScope) {
+        auto scopes = std::make_shared<Scopes>(*scopes_.load(std::memory_order_relaxed));
+        scopes->erase(scope);
+        scopes_.store(std::move(scopes), std::memory_order_release);
+    }
+}
+
+SubscriptionManager::NodePtr SubscriptionManager::insert_(const NodePtr& node, const Segments& segments, std::size_t i, bool wildcard) {
+    auto copy = node ? std::make_shared<SubscribedOids::Node>(*node) : std::make_shared<SubscribedOids::Node>();
+    if (i == segments.size()) {
+        if (wildcard) {
+            // The wildcard covers everything below it.
+            copy->children.clear();
+            copy->exact = false;
+            copy->wildcard = true;
+        } else {
+            copy->exact = true;
+        }
+    } else {
+        auto it = copy->children.find(segments[i]);
+        NodePtr child = it != copy->children.end() ? it->second : nullptr;
+        copy->children.insert_or_assign(std::string(segments[i]), insert_(child, segments, i + 1, wildcard));
+    }
+    return copy;
+}
+
+SubscriptionManager::NodePtr SubscriptionManager::erase_(const NodePtr& node, const Segments& segments, std::size_t i, bool wildcard, bool& found) {
+    // Removing a wildcard drops the whole subtree, including the node itself.
+    if (i == segments.size() && wildcard) {
+        found = true;
+        return nullptr;
+    }
+    if (i == segments.size() && !node->exact) {
+        return node;
+    }
+    auto copy = std::make_shared<SubscribedOids::Node>(*node);
+    if (i == segments.size()) {
+        found = true;
+        copy->exact = false;
+    } else {
+        auto it = copy->children.find(segments[i]);
+        if (it == copy->children.end()) {
+            return node;
+        }
+        NodePtr child = erase_(it->second, segments, i + 1, wildcard, found);
+        if (!found) {
+            return node;
+        } else if (child) {
+            it->second = std::move(child);
+        } else {
+            copy->children.erase(it);
+        }
+    }
+    return copy->empty() ? nullptr : copy;
+}
+
+std::shared_ptr<SubscriptionManager::Scope> SubscriptionManager::scope_(const std::string& key) const {
+    auto scopes = scopes_.load(std::memory_order_acquire);
+    auto it = scopes->find(key);
+    return it != scopes->end() ? it->second : nullptr;
+}
+
+std::shared_ptr<SubscriptionManager::Scope> SubscriptionManager::createScope_(const std::string& key) {
+    std::shared_ptr<Scope> scope = scope_(key);
+    if (!scope) {
+        scope = std::make_shared<Scope>();
+        auto scopes = std::make_shared<Scopes>(*scopes_.load(std::memory_order_relaxed));
+        scopes->emplace(key, scope);
+        scopes_.store(std::move(scopes), std::memory_order_release);
+    }
+    return scope;
+}
+
+SubscriptionManager::NodePtr SubscriptionManager::root_(const Scope* scope, uint32_t slot) {
+    if (!scope) {
+        return nullptr;
+    }
+    auto snapshot = scope->subscriptions.load(std::memory_order_acquire);
+    auto it = snapshot->find(slot);
+    return it != snapshot->end() ? it->second : nullptr;
+}
+
+void SubscriptionManager::publish_(Scope& scope, uint32_t slot, NodePtr root) {
+    auto snapshot = std::make_shared<Snapshot>(*scope.subscriptions.load(std::memory_order_relaxed));
+    if (root) {
+        (*snapshot)[slot] = std::move(root);
+    } else {
+        snapshot->erase(slot);
+    }
+    scope.subscriptions.store(std::move(snapshot), std::memory_order_release);
 }
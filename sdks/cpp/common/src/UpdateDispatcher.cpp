@@ -0,0 +1,155 @@
+/*
+ * Copyright 2026 Ross Video Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+// common
+#include <rpc/UpdateDispatcher.h>
+#include <Config.h>
+
+using catena::common::UpdateDispatcher;
+
+UpdateDispatcher& UpdateDispatcher::instance() {
+    static UpdateDispatcher dispatcher(config::push_update_workers);
+    return dispatcher;
+}
+
+UpdateDispatcher::UpdateDispatcher(size_t workers) {
+    for (size_t i = 0; i < workers; ++i) {
+        workers_.push_back(std::make_unique<Worker>());
+    }
+    // Starting the threads once workers_ will no longer move.
+    for (auto& worker : workers_) {
+        worker->thread_ = std::thread([this, w = worker.get()]() { run_(*w); });
+    }
+}
+
+UpdateDispatcher::~UpdateDispatcher() {
+    stop_.store(true, std::memory_order_release);
+    for (auto& worker : workers_) {
+        worker->wake_.fetch_add(1, std::memory_order_release);
+        worker->wake_.notify_one();
+        worker->thread_.join();
+    }
+}
+
+void UpdateDispatcher::post(size_t key, std::function<void()> job) {
+    if (workers_.empty()) {
+        job();
+        return;
+    }
+    Worker& worker = *workers_[key % workers_.size()];
+    Node* node = new Node{std::move(job), Clock::now()};
+    size_t depth = worker.depth_.fetch_add(1, std::memory_order_relaxed) + 1;
+    size_t maxDepth = maxDepth_.load(std::memory_order_relaxed);
+    while (depth > maxDepth && !maxDepth_.compare_exchange_weak(maxDepth, depth, std::memory_order_relaxed)) {}
+    worker.push(node);
+    worker.wake_.fetch_add(1, std::memory_order_release);
+    worker.wake_.notify_one();
+}
+
+void UpdateDispatcher::run_(Worker& worker) {
+    while (true) {
+        uint32_t seen = worker.wake_.load(std::memory_order_acquire);
+        Node* node = worker.pop();
+        if (node) {
+            worker.depth_.fetch_sub(1, std::memory_order_relaxed);
+            dispatchLatency_.record(Clock::now() - node->postedAt);
+            // Delivery errors are handled per connection, this is a last resort.
+            try {
+                node->job();
+            } catch (...) {} // GCOVR_EXCL_LINE
+            dispatched_.fetch_add(1, std::memory_order_relaxed);
+            delete node;
+        } else if (worker.depth_.load(std::memory_order_relaxed) > 0) {
+            // A producer is part way through linking its node.
+            std::this_thread::yield();
+        } else if (stop_.load(std::memory_order_acquire)) {
+            break;
+        } else {
+            worker.wake_.wait(seen, std::memory_order_acquire);
+        }
+    }
+}
+
+UpdateDispatcher::Metrics UpdateDispatcher::metrics() const {
+    Metrics ans;
+    for (const auto& worker : workers_) {
+        ans.depth.push_back(worker->depth_.load(std::memory_order_relaxed));
+    }
+    ans.maxDepth = maxDepth_.load(std::memory_order_relaxed);
+    ans.dispatched = dispatched_.load(std::memory_order_relaxed);
+    ans.dispatchLatency = dispatchLatency_.counts();
+    ans.writeLatency = writeLatency_.counts();
+    return ans;
+}
+
+UpdateDispatcher::Worker::Worker() : head_{&stub_}, tail_{&stub_} {}
+
+UpdateDispatcher::Worker::~Worker() {
+    // Only reached once the thread has drained the queue.
+    while (Node* node = pop()) {
+        delete node; // GCOVR_EXCL_LINE
+    }
+}
+
+void UpdateDispatcher::Worker::push(Node* node) {
+    node->next.store(nullptr, std::memory_order_relaxed);
+    Node* prev = tail_.exchange(node, std::memory_order_acq_rel);
+    prev->next.store(node, std::memory_order_release);
+}
+
+UpdateDispatcher::Node* UpdateDispatcher::Worker::pop() {
+    Node* head = head_;
+    Node* next = head->next.load(std::memory_order_acquire);
+    // Skipping over the stub.
+    if (head == &stub_) {
+        if (!next) {
+            return nullptr;
+        }
+        head_ = next;
+        head = next;
+        next = next->next.load(std::memory_order_acquire);
+    }
+    if (next) {
+        head_ = next;
+        return head;
+    }
+    // head is the last node, unless a producer is mid-push.
+    if (head != tail_.load(std::memory_order_acquire)) {
+        return nullptr;
+    }
+    // Putting the stub back so head can be handed out.
+    push(&stub_);
+    next = head->next.load(std::memory_order_acquire);
+    if (next) {
+        head_ = next;
+        return head;
+    }
+    return nullptr;
+}
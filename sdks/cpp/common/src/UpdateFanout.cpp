@@ -0,0 +1,194 @@
+/*
+ * Copyright 2026 Ross Video Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+// common
+#include <rpc/UpdateFanout.h>
+#include <rpc/Connect.h>
+#include <ParamLock.h>
+#include <Logger.h>
+#include <utils.h>
+
+using catena::common::UpdateEncoder;
+using catena::common::UpdateFanout;
+using catena::common::SharedUpdatePtr;
+
+std::mutex UpdateFanout::registryMtx_;
+std::map<std::pair<const catena::common::IDevice*, uint32_t>, std::weak_ptr<UpdateFanout>> UpdateFanout::registry_;
+
+SharedUpdatePtr UpdateEncoder::encode(const Authorizer& authz) {
+    // Language packs read the same for everyone.
+    static const std::string kAllScopes = "";
+    const std::string& key = param_ ? authz.readScopeKey() : kAllScopes;
+    for (const auto& [scopes, update] : encoded_) {
+        if (scopes == key) {
+            return update;
+        }
+    }
+    st2138::PushUpdates msg;
+    msg.set_slot(slot_);
+    SharedUpdatePtr ans = nullptr;
+    if (param_) {
+        msg.mutable_value()->set_oid(*oid_);
+        st2138::Value* value = msg.mutable_value()->mutable_value();
+        catena::exception_with_status rc = param_->toProto(*value, authz);
+        if (rc.status == catena::StatusCode::OK) {
+            LOG(DEBUG) << "UpdateEncoder: Param \"" << *oid_ << "\" set to new value: " << catena::param_value_string(*value);
+            ans = std::make_shared<const SharedUpdate>(std::move(msg), emittedAt_);
+        }
+    } else {
+        languagePack_->toProto(*msg.mutable_device_component()->mutable_language_pack()->mutable_language_pack());
+        ans = std::make_shared<const SharedUpdate>(std::move(msg), emittedAt_);
+    }
+    // Failures are cached too so they are not retried for the same scopes.
+    encoded_.emplace_back(key, ans);
+    return ans;
+}
+
+std::shared_ptr<UpdateFanout> UpdateFanout::get(IDevice& dm, uint32_t slot) {
+    std::lock_guard<std::mutex> lock(registryMtx_);
+    std::erase_if(registry_, [](const auto& item) { return item.second.expired(); });
+    std::weak_ptr<UpdateFanout>& entry = registry_[{&dm, slot}];
+    std::shared_ptr<UpdateFanout> ans = entry.lock();
+    if (!ans) {
+        ans = std::make_shared<UpdateFanout>(dm, slot);
+        entry = ans;
+    }
+    return ans;
+}
+
+UpdateFanout::UpdateFanout(IDevice& dm, uint32_t slot) : dm_{dm}, slot_{slot} {
+    valueSetByServerId_ = dm_.getValueSetByServer().connect([this](const std::string& oid, const IParam* p) {
+        onValue_(oid, p);
+    });
+    valueSetByClientId_ = dm_.getValueSetByClient().connect([this](const std::string& oid, const IParam* p) {
+        onValue_(oid, p);
+    });
+    languageAddedId_ = dm_.getLanguageAddedPushUpdate().connect([this](const ILanguagePack* l) {
+        onLanguage_(l);
+    });
+}
+
+UpdateFanout::~UpdateFanout() {
+    dm_.getValueSetByServer().disconnect(valueSetByServerId_);
+    dm_.getValueSetByClient().disconnect(valueSetByClientId_);
+    dm_.getLanguageAddedPushUpdate().disconnect(languageAddedId_);
+}
+
+void UpdateFanout::add(Connect* connection) {
+    std::unique_lock lock(mtx_);
+    connections_.push_back(connection);
+}
+
+void UpdateFanout::remove(const Connect* connection) {
+    std::unique_lock lock(mtx_);
+    std::erase(connections_, connection);
+}
+
+size_t UpdateFanout::size() const {
+    std::shared_lock lock(mtx_);
+    return connections_.size();
+}
+
+void UpdateFanout::onValue_(const std::string& oid, const IParam* p) {
+    auto emittedAt = SharedUpdate::Clock::now();
+    UpdateDispatcher& dispatcher = UpdateDispatcher::instance();
+    if (!dispatcher.async()) {
+        UpdateEncoder encoder(oid, p, slot_, emittedAt);
+        deliver_(oid, p, encoder);
+        return;
+    }
+    // The emitter's p is only valid for the duration of the emit. A copy of
+    // a top level atomic param can be read without locking the device, but
+    // anything else may refer to storage that is resized or replaced
+    // before the worker runs, so the worker resolves it again.
+    std::shared_ptr<const IParam> param = nullptr;
+    if (p->lockFreeReads() && oid.find('/', 1) == std::string::npos) {
+        param = p->copy();
+    }
+    dispatcher.post(std::hash<const void*>{}(this), [self = shared_from_this(), oid, param, emittedAt]() {
+        if (param) {
+            UpdateEncoder encoder(oid, param.get(), self->slot_, emittedAt);
+            self->deliver_(oid, param.get(), encoder);
+            return;
+        }
+        ParamReadLock lock(self->dm_, oid);
+        std::unique_ptr<IParam> resolved = self->resolve_(oid);
+        if (!resolved) {
+            LOG(DEBUG) << "UpdateFanout: Param \"" << oid << "\" no longer exists, update dropped";
+            return;
+        }
+        UpdateEncoder encoder(oid, resolved.get(), self->slot_, emittedAt);
+        self->deliver_(oid, resolved.get(), encoder);
+    });
+}
+
+std::unique_ptr<catena::common::IParam> UpdateFanout::resolve_(const std::string& oid) const {
+    catena::exception_with_status rc{"", catena::StatusCode::OK};
+    if (oid.ends_with("/-")) {
+        std::string arrayOid = oid.substr(0, oid.size() - 2);
+        std::unique_ptr<IParam> array = dm_.getParam(arrayOid, rc);
+        if (!array || array->size() == 0) {
+            return nullptr;
+        }
+        return dm_.getParam(arrayOid + "/" + std::to_string(array->size() - 1), rc);
+    }
+    return dm_.getParam(oid, rc);
+}
+
+void UpdateFanout::onLanguage_(const ILanguagePack* l) {
+    auto emittedAt = SharedUpdate::Clock::now();
+    UpdateDispatcher& dispatcher = UpdateDispatcher::instance();
+    if (!dispatcher.async()) {
+        UpdateEncoder encoder(l, slot_, emittedAt);
+        deliver_(l, encoder);
+        return;
+    }
+    // Language packs are the same for every scope, so they are encoded here
+    // while l is still valid.
+    auto encoder = std::make_shared<UpdateEncoder>(l, slot_, emittedAt);
+    encoder->encode(Authorizer::kAuthzDisabled);
+    dispatcher.post(std::hash<const void*>{}(this), [self = shared_from_this(), l, encoder]() {
+        self->deliver_(l, *encoder);
+    });
+}
+
+void UpdateFanout::deliver_(const std::string& oid, const IParam* p, UpdateEncoder& encoder) {
+    std::shared_lock lock(mtx_);
+    for (Connect* connection : connections_) {
+        connection->updateResponse_(oid, p, slot_, encoder);
+    }
+}
+
+void UpdateFanout::deliver_(const ILanguagePack* l, UpdateEncoder& encoder) {
+    std::shared_lock lock(mtx_);
+    for (Connect* connection : connections_) {
+        connection->updateResponse_(l, slot_, encoder);
+    }
+}
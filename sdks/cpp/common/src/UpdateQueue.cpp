@@ -0,0 +1,106 @@
+/*
+ * Copyright 2026 Ross Video Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+// common
+#include <rpc/UpdateQueue.h>
+
+#include <algorithm>
+
+using catena::common::UpdateQueue;
+
+UpdateQueue::UpdateQueue(size_t maxDepth, Overflow overflow) : overflow_{overflow} {
+    metrics_.maxDepth = std::max<size_t>(maxDepth, 1);
+}
+
+bool UpdateQueue::push(uint32_t slot, const std::string& oid, SharedUpdatePtr update) {
+    std::string key;
+    key.reserve(oid.size() + 11);
+    key.append(std::to_string(slot)).append(1, ':').append(oid);
+    return push_(std::move(key), std::move(update));
+}
+
+bool UpdateQueue::push(SharedUpdatePtr update) {
+    return push_(std::string{}, std::move(update));
+}
+
+bool UpdateQueue::push_(std::string&& key, SharedUpdatePtr update) {
+    // Replacing the queued value for the same oid.
+    if (!key.empty()) {
+        auto it = index_.find(key);
+        if (it != index_.end()) {
+            it->second->update = std::move(update);
+            metrics_.coalesced++;
+            return true;
+        }
+    }
+    // Making room for the update.
+    if (queue_.size() >= metrics_.maxDepth) {
+        if (overflow_ == Overflow::kDisconnect) {
+            overflowed_ = true;
+            metrics_.dropped++;
+            return false;
+        }
+        if (!queue_.front().key.empty()) {
+            index_.erase(queue_.front().key);
+        }
+        queue_.pop_front();
+        metrics_.dropped++;
+    }
+    queue_.push_back(Entry{std::move(key), std::move(update), Clock::now()});
+    if (!queue_.back().key.empty()) {
+        index_.emplace(queue_.back().key, std::prev(queue_.end()));
+    }
+    metrics_.enqueued++;
+    return true;
+}
+
+size_t UpdateQueue::drain(std::vector<SharedUpdatePtr>& batch, size_t maxBatch) {
+    size_t n = std::min(maxBatch, queue_.size());
+    auto now = Clock::now();
+    for (size_t i = 0; i < n; ++i) {
+        Entry& entry = queue_.front();
+        auto lag = std::chrono::duration_cast<std::chrono::microseconds>(now - entry.queuedAt);
+        metrics_.lastLag = lag;
+        metrics_.maxLag = std::max(metrics_.maxLag, lag);
+        batch.push_back(std::move(entry.update));
+        if (!entry.key.empty()) {
+            index_.erase(entry.key);
+        }
+        queue_.pop_front();
+    }
+    metrics_.delivered += n;
+    return n;
+}
+
+UpdateQueue::Metrics UpdateQueue::metrics() const {
+    Metrics ans = metrics_;
+    ans.depth = queue_.size();
+    return ans;
+}
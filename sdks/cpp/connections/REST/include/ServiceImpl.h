@@ -66,6 +66,10 @@ using boost::asio::ip::tcp;
 #include <string>
 #include <iostream>
 #include <regex>
+#include <set>
+#include <atomic>
+#include <thread>
+#include <list>
 
 using catena::REST::SocketReader;
 using catena::REST::SocketWriter;
@@ -93,6 +97,8 @@ class ServiceConfig {
       this->EOPath = config::static_root;
       this->maxConnections = config::max_connections;
       this->authz = config::authz;
+      this->threads = config::rest_threads;
+      this->handlerThreads = config::rest_handler_threads;
     }
     /**
      * @brief Sets the vector of Device pointers.
@@ -143,6 +149,24 @@ class ServiceConfig {
       this->maxConnections = maxConnections;
       return *this;
     }
+    /**
+     * @brief Sets the number of threads serving connections.
+     * @param threads The number of threads serving connections. 0 uses one
+     * per hardware thread.
+     */
+    ServiceConfig& set_threads(uint32_t threads) {
+      this->threads = threads;
+      return *this;
+    }
+    /**
+     * @brief Sets the number of threads running requests.
+     * @param handlerThreads The number of threads running requests. 0 uses
+     * one per hardware thread.
+     */
+    ServiceConfig& set_handlerThreads(uint32_t handlerThreads) {
+      this->handlerThreads = handlerThreads;
+      return *this;
+    }
 
     /**
      * @brief A map of slots to ptrs to their corresponding device.
@@ -164,6 +188,16 @@ class ServiceConfig {
      * @brief The maximum number of connections allowed to the service.
      */
     uint32_t maxConnections = DEFAULT_MAX_CONNECTIONS;
+    /**
+     * @brief The number of threads serving connections. 0 uses one per
+     * hardware thread.
+     */
+    uint32_t threads = 0;
+    /**
+     * @brief The number of threads running requests. 0 uses one per hardware
+     * thread.
+     */
+    uint32_t handlerThreads = 0;
 };
 
 /**
@@ -188,8 +222,24 @@ class ServiceImpl : public catena::REST::IServiceImpl {
      * @brief Returns the actual port the service is bound to.
      */
     uint16_t listeningPort() const { return port_; }
+    /**
+     * @brief Returns the number of threads serving connections.
+     */
+    uint32_t threads() const { return threads_; }
+    /**
+     * @brief Returns the number of threads running requests.
+     */
+    uint32_t handlerThreads() const { return handlerThreads_; }
     /**
      * @brief Starts the API.
+     *
+     * Connections are accepted and read on a pool of threads() threads.
+     * Requests may block on the device or on a slow client, so each is run
+     * on a pool of handlerThreads() threads instead. A connection is kept
+     * open between requests while the client asks for it, and pipelined
+     * requests are answered in order. Connect and stream requests are handed
+     * their own thread since they hold the connection for a long time.
+     * Blocks until Shutdown() is called and every request has finished.
      */
     void run() override;
     /**
@@ -222,6 +272,51 @@ class ServiceImpl : public catena::REST::IServiceImpl {
      * Currently unused.
      */
     bool is_port_in_use_() const;
+    /**
+     * @brief Accepts connections until shutdown, starting a session on its
+     * own strand for each.
+     */
+    boost::asio::awaitable<void> accept_();
+    /**
+     * @brief Reads and answers requests from a connection until the client
+     * closes it, stops asking for keep-alive, or the service shuts down.
+     * @param socket The connection to serve.
+     */
+    boost::asio::awaitable<void> session_(std::shared_ptr<tcp::socket> socket);
+    /**
+     * @brief Routes a request that has been read and writes the response.
+     * @param socket The socket to respond on.
+     * @param context The request read from the socket.
+     * @return False if an error response was sent and the connection should
+     * be closed.
+     */
+    bool handle_(tcp::socket& socket, SocketReader& context);
+    /**
+     * @brief Calls handle_ as a coroutine so it can be spawned on handlers_.
+     * @param socket The socket to respond on.
+     * @param context The request read from the socket.
+     * @return The result of handle_.
+     */
+    boost::asio::awaitable<bool> handleAsync_(std::shared_ptr<tcp::socket> socket, std::shared_ptr<SocketReader> context);
+    /**
+     * @brief Runs a Connect or stream request on its own thread, joining the
+     * threads of those which have ended.
+     * @param socket The socket to respond on.
+     * @param context The request read from the socket.
+     */
+    void startStream_(std::shared_ptr<tcp::socket> socket, std::shared_ptr<SocketReader> context);
+    /**
+     * @brief Joins the threads of all Connect and stream requests.
+     */
+    void joinStreams_();
+    /**
+     * @brief Decrements activeRequests_.
+     */
+    void requestDone_();
+    /**
+     * @brief Returns threads, or one per hardware thread if it is 0.
+     */
+    static uint32_t poolSize_(uint32_t threads);
 
     /**
      * @brief Provides io functionality for tcp::sockets used in requests.
@@ -256,7 +351,7 @@ class ServiceImpl : public catena::REST::IServiceImpl {
     /**
      * @brief Flag to indicate if shutdown() has been called.
      */
-    bool shutdown_ = false;
+    std::atomic<bool> shutdown_ = false;
     /**
      * @brief The subscription manager for handling parameter subscriptions
      */
@@ -270,6 +365,41 @@ class ServiceImpl : public catena::REST::IServiceImpl {
      * @brief Mutex to protect the activeRequests_ variable.
      */
     std::mutex activeRequestMutex_;
+    /**
+     * @brief The number of threads running io_context_.
+     */
+    uint32_t threads_;
+    /**
+     * @brief The number of threads in handlers_.
+     */
+    uint32_t handlerThreads_;
+    /**
+     * @brief Runs requests off the threads running io_context_.
+     */
+    boost::asio::thread_pool handlers_;
+    /**
+     * @brief The thread of a Connect or stream request.
+     */
+    struct Stream {
+        std::thread thread;
+        std::atomic<bool> done = false;
+    };
+    /**
+     * @brief The threads of Connect and stream requests, joined once done.
+     */
+    std::list<Stream> streams_;
+    /**
+     * @brief Mutex to protect streams_.
+     */
+    std::mutex streamsMutex_;
+    /**
+     * @brief Connections waiting for their next request, closed on shutdown.
+     */
+    std::set<std::shared_ptr<tcp::socket>> idle_;
+    /**
+     * @brief Mutex to protect idle_.
+     */
+    std::mutex idleMutex_;
     /**
      * @brief The connectionQueue object for managing connections to the service
      */
@@ -59,6 +59,8 @@ using boost::asio::ip::tcp;
 using namespace boost::urls;
 
 #include <string>
+#include <string_view>
+#include <vector>
 
 namespace catena {
 namespace REST {
@@ -119,6 +121,30 @@ class SocketReader : public ISocketReader {
      * @param timeout How long to read before in ms cancelling. Socket can be read from twice and timeout is applied in full both times.
      */
     void read(std::shared_ptr<tcp::socket>& socket, uint32_t timeout = DEFAULT_TIMEOUT) override;
+    /**
+     * @brief Reads the next request from a persistent connection.
+     *
+     * Unlike read(), bytes received past the end of the request are kept for
+     * the following call so pipelined requests are not lost. Must be awaited
+     * on the socket's executor.
+     * @param socket The socket to read from.
+     * @param timeout How long to wait in ms for each part of the request.
+     * @return False if the connection closed or timed out before another
+     * request started, true once a request has been read.
+     */
+    boost::asio::awaitable<bool> asyncRead(std::shared_ptr<tcp::socket> socket, uint32_t timeout = DEFAULT_TIMEOUT);
+    /**
+     * @brief Parses the request line and headers of a request.
+     *
+     * Works directly on the bytes received, only copying the values kept.
+     * Called by read() and asyncRead() once the headers have arrived.
+     * @param request The request line and headers, up to and including the
+     * blank line ending them.
+     * @return The Content-Length of the body that follows.
+     * @throws INVALID_ARGUMENT if the request is malformed or has more than
+     * MAX_HEADER_COUNT headers.
+     */
+    std::size_t parse(std::string_view request);
     /**
      * @brief Returns the HTTP method of the request.
      */
@@ -176,6 +202,17 @@ class SocketReader : public ISocketReader {
      * @brief Returns true if the client wants a stream response.
      */
     bool stream() const override { return stream_; } 
+    /**
+     * @brief Returns true if the connection should stay open after the
+     * response is sent.
+     */
+    bool keepAlive() const override { return keepAlive_; }
+    /**
+     * @brief Returns the id of the Connect whose subscriptions the client
+     * names, taken from the "connection_id" field, or an empty string if the
+     * client did not name one.
+     */
+    std::string connectionId() const override { return fields("connection_id"); }
 
     /**
      * @brief Returns a pointer to the ServiceImpl
@@ -210,6 +247,24 @@ class SocketReader : public ISocketReader {
 
 
   private:
+    /**
+     * @brief Shared implementation of read() and asyncRead().
+     * @param socket The socket to read from.
+     * @param timeout How long to wait in ms for each part of the request.
+     * @param pipelined If false, bytes past the end of the request are
+     * treated as an incorrect Content-Length.
+     */
+    boost::asio::awaitable<bool> read_(std::shared_ptr<tcp::socket> socket, uint32_t timeout, bool pipelined);
+    /**
+     * @brief Sets slot_, endpoint_, fqoid_, and stream_ from the URL's path.
+     * @param path The path of the request's URL.
+     */
+    void parsePath_(std::string_view path);
+    /**
+     * @brief Clears everything parsed from the previous request.
+     */
+    void reset_();
+
     /**
      * @brief The HTTP method of the request (GET, PUT, etc.).
      */
@@ -230,6 +285,19 @@ class SocketReader : public ISocketReader {
      * @brief Flag indicating whether the client wants a stream response.
      */
     bool stream_ = false;
+    /**
+     * @brief Flag indicating whether the connection should be kept open.
+     */
+    bool keepAlive_ = false;
+    /**
+     * @brief Bytes read from the socket but not yet parsed.
+     */
+    boost::asio::streambuf buffer_;
+    /**
+     * @brief Views of each segment of the path being parsed. Kept between
+     * requests to reuse its storage.
+     */
+    std::vector<std::string_view> segments_;
     /**
      * @brief The origin of the request. Required for CORS headers.
      */
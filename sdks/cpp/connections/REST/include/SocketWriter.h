@@ -41,15 +41,41 @@
 // connections/REST
 #include "interface/ISocketWriter.h"
 
+// std
+#include <chrono>
+#include <string_view>
+
 namespace catena {
 namespace REST {
 
+/**
+ * @brief How much of a buffered response SocketWriter holds before it starts
+ * streaming it with chunked transfer encoding.
+ */
+const std::size_t CHUNK_BYTES = 64 * 1024;
+
+/**
+ * @brief Writes all of buffers to the socket, giving up if the client has
+ * not read enough of them for the write to finish within timeout.
+ *
+ * Used instead of boost::asio::write so a client which stops reading cannot
+ * hold the writing thread forever.
+ *
+ * @param socket The socket to write to.
+ * @param buffers The buffers to write in a single gather write.
+ * @param timeout How long to wait for the write to finish.
+ * @return The error, boost::asio::error::timed_out on timeout.
+ */
+boost::system::error_code writeWithTimeout(tcp::socket& socket, std::vector<boost::asio::const_buffer> buffers, std::chrono::milliseconds timeout);
+
 /**
  * @brief A helper class which writes a unary response to the client socket
  * using boost.
  * 
  * SocketWriter can also combine/buffer multiple messages to later send as a
- * single response.
+ * single response. Once more than CHUNK_BYTES are buffered the response is
+ * streamed with chunked transfer encoding instead, so large responses are
+ * not held in memory all at once.
  */
 class SocketWriter : public ISocketWriter {
   public:
@@ -58,8 +84,11 @@ class SocketWriter : public ISocketWriter {
      * @param socket The socket to write to.
      * @param origin The origin of the request.
      * @param buffer Flag indicating whether to buffer the response.
+     * @param keepAlive Flag indicating whether the connection stays open
+     * after the response.
      */
-    SocketWriter(tcp::socket& socket, const std::string& origin = "*", bool buffer = false) : socket_{socket}, origin_{origin}, buffer_{buffer} {}
+    SocketWriter(tcp::socket& socket, const std::string& origin = "*", bool buffer = false, bool keepAlive = false)
+      : socket_{socket}, origin_{origin}, buffer_{buffer}, keepAlive_{keepAlive} {}
 
     /**
      * @brief Writes a HTTP response to the socket.
@@ -70,13 +99,52 @@ class SocketWriter : public ISocketWriter {
      * 
      * Any error status code will be sent immediately and without
      * the jsonBody, at which point subsequent calls to this function will fail.
+     * If part of the response has already been streamed, the 200 status can
+     * no longer be changed, so the connection is closed before the response
+     * is complete instead.
      * 
      * @param msg The protobuf message to write (if status is OK).
      * @param err The error status to of the response.
      */
     void sendResponse(const catena::exception_with_status& err, const google::protobuf::Message& msg = st2138::Empty()) override;
+    /**
+     * @brief Writes a HTTP response whose message has already been written
+     * as JSON, such as by IDevice::getValueJson.
+     *
+     * Otherwise the same as sendResponse.
+     *
+     * @param err The error status of the response.
+     * @param json The message as JSON. No body is written for it if empty.
+     */
+    void sendJson(const catena::exception_with_status& err, std::string_view json);
 
   private:
+    /**
+     * @brief Adds jsonOutput_ to the response, and writes the response
+     * unless more messages are being buffered.
+     * @param err The error status of the response.
+     * @param httpStatus The HTTP status err maps to.
+     */
+    void send_(const catena::exception_with_status& err, std::pair<int, std::string> httpStatus);
+    /**
+     * @brief Returns the status line and headers of the response.
+     * @param httpStatus The HTTP status of the response.
+     * @param chunked If true, the body is sent with chunked transfer encoding
+     * rather than a Content-Length.
+     */
+    std::string headers_(const std::pair<int, std::string>& httpStatus, bool chunked) const;
+    /**
+     * @brief Writes the buffers to the socket, closing it on error or if the
+     * client does not read them within config::rest_write_timeout seconds.
+     * @param buffers The buffers to write in a single gather write.
+     */
+    void write_(const std::vector<boost::asio::const_buffer>& buffers);
+    /**
+     * @brief Writes jsonBody_ as the next chunk of the response, sending the
+     * headers first if they have not been, and clears it.
+     */
+    void writeChunk_();
+
     /**
      * @brief The socket to write to.
      */
@@ -91,9 +159,24 @@ class SocketWriter : public ISocketWriter {
      */
     bool buffer_;
     /**
-     * @brief The json body of the response to write to the client.
+     * @brief Flag to indicate whether to keep the connection open.
+     */
+    bool keepAlive_;
+    /**
+     * @brief The json body of the response to write to the client, or the
+     * part of it not yet streamed.
      */
     std::string jsonBody_ = "";
+    /**
+     * @brief Scratch string each message is converted into, reused to avoid
+     * an allocation per message. Empty if the message has no body.
+     */
+    std::string jsonOutput_ = "";
+    /**
+     * @brief Flag indicating whether the response is being streamed in
+     * chunks.
+     */
+    bool chunked_ = false;
 };
 
 /**
@@ -106,8 +189,11 @@ class SSEWriter : public ISocketWriter {
      * @brief Constructs a SSEWriter.
      * @param socket The socket to write to.
      * @param origin The origin of the request.
+     * @param connectionId The id of the Connect writing the stream, sent in
+     * the Catena-Connection-Id header if not empty.
      */
-    SSEWriter(tcp::socket& socket, const std::string& origin = "*") : socket_{socket}, origin_{origin}, headers_sent_{false} {}
+    SSEWriter(tcp::socket& socket, const std::string& origin = "*", const std::string& connectionId = "")
+        : socket_{socket}, origin_{origin}, connectionId_{connectionId}, headers_sent_{false} {}
 
     /**
      * @brief Writes a Server-Sent Event HTTP response.
@@ -120,8 +206,26 @@ class SSEWriter : public ISocketWriter {
      * @param err The error status of the response.
      */
     void sendResponse(const catena::exception_with_status& err, const google::protobuf::Message& msg = st2138::Empty()) override;
+    /**
+     * @brief Writes an already converted JSON message as a Server-Sent Event
+     * with an OK status.
+     *
+     * Lets a message converted once be sent to many clients.
+     *
+     * @param json The message as JSON. Nothing is sent if empty.
+     */
+    void sendEvent(const std::string& json);
 
   private:
+    /**
+     * @brief Writes the headers if not yet sent, followed by the event.
+     * Closes the socket on error or if the client does not read the event
+     * within config::rest_write_timeout seconds.
+     * @param httpStatus The HTTP status of the response.
+     * @param jsonOutput The event data.
+     */
+    void writeEvent_(const std::pair<int, std::string>& httpStatus, const std::string& jsonOutput);
+
     /**
      * @brief The socket to write to.
      */
@@ -130,6 +234,10 @@ class SSEWriter : public ISocketWriter {
      * @brief The origin of the request.
      */
     std::string origin_;
+    /**
+     * @brief The id of the Connect writing the stream, or empty.
+     */
+    std::string connectionId_;
     /**
      * @brief Flag indicating whether the headers have been sent.
      */
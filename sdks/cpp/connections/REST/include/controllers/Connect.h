@@ -148,21 +148,6 @@ class Connect : public ICallData, public catena::common::Connect {
      * 
      */
     ISocketReader& context_;
-    /**
-     * @brief A list of ids for the operations waiting for valueSetByClient to
-     * be emitted.
-     */
-    SignalMap valueSetByClientIds_;
-    /**
-     * @brief A list of ids for the operations waiting for valueSetByServer to
-     * be emitted.
-     */
-    SignalMap valueSetByServerIds_;
-    /**
-     * @brief A list of ids for the operations waiting for
-     * languageAddedPushUpdate to be emitted.
-     */
-    SignalMap languageAddedIds_;
     /**
      * @brief ID of the shutdown signal for the Connect object
      */
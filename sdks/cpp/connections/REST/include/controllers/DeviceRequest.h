@@ -137,7 +137,7 @@ class DeviceRequest : public ICallData {
     /**
      * @brief A list of the subscribed oids to return.
      */
-    std::set<std::string> subscribedOids_;
+    catena::common::SubscribedOids subscribedOids_;
 
     /**
      * @brief The device serializer coroutine recieved from a call to
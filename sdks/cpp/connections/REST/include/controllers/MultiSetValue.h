@@ -49,6 +49,8 @@
 #include <utils.h>
 #include <Authorizer.h>
 #include <Enums.h>
+#include <JsonReader.h>
+#include <rpc/ArenaPool.h>
 
 // Connections/REST
 #include "interface/ISocketReader.h"
@@ -149,9 +151,13 @@ class MultiSetValue : public ICallData {
     SlotMap& dms_;
 
     /**
-     * @brief The MultiSetValuePayload from the request.
+     * @brief The arena the request is parsed into.
      */
-    st2138::MultiSetValuePayload reqs_;
+    catena::common::ArenaPool::Lease arena_;
+    /**
+     * @brief The MultiSetValuePayload from the request, owned by arena_.
+     */
+    st2138::MultiSetValuePayload& reqs_;
 
     /**
      * @brief The object's unique id.
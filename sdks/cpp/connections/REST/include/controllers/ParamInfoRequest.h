@@ -50,7 +50,7 @@
 #include <IDevice.h>
 
 // common
-#include <ParamVisitor.h>
+#include <rpc/ParamInfoSerializer.h>
 #include <Authorizer.h>
 #include <rpc/TimeNow.h>
 
@@ -58,8 +58,7 @@
 
 // Forward declarations
 using catena::common::IParam;
-using catena::common::IParamVisitor;
-using catena::common::ParamVisitor;
+using catena::common::ParamInfoSerializer;
 using catena::common::Authorizer;
 using catena::common::timeNow;
 
@@ -120,19 +119,6 @@ class ParamInfoRequest : public ICallData {
                 << timeNow() << " status: "<< static_cast<int>(status)
                 <<", ok: "<< std::boolalpha << ok;
     }
-    /**
-     * @brief Helper method to add a parameter to the responses
-     * @param param The parameter to add
-     */
-    void addParamToResponses_(IParam* param, catena::common::Authorizer& authz);
-    
-    /**
-     * @brief Updates the array lengths of the responses.
-     * 
-     * @param array_name - The name of the array.
-     * @param length - The length of the array.
-     */
-    void updateArrayLengths_(const std::string& array_name, uint32_t length);
 
     /**
      * @brief The socket to write the response to.
@@ -176,65 +162,6 @@ class ParamInfoRequest : public ICallData {
      * @brief The total # of param-info endpoint controller objects.
      */
     static int objectCounter_;
-    
-    /**
-     * @brief The vector of ParamInfoResponse objects.
-     */
-    std::vector<st2138::ParamInfoResponse> responses_;
-        
-    /**
-     * @brief Visitor class for collecting parameter info
-     */
-    class ParamInfoVisitor : public catena::common::IParamVisitor {
-        public:
-            /**
-             * @brief Constructor for the ParamInfoVisitor class
-             * @param device The device to visit
-             * @param authz The authorizer
-             * @param responses The vector of responses
-             * @param request The request
-             */
-            ParamInfoVisitor(catena::common::IDevice& device, catena::common::Authorizer& authz,
-                                std::vector<st2138::ParamInfoResponse>& responses,
-                                ParamInfoRequest& request)
-                : device_(device), authz_(authz), responses_(responses), request_(request) {}
-
-            /**
-             * @brief Visit a parameter
-             * @param param The parameter to visit
-             * @param path The path of the parameter
-             */
-            void visit(IParam* param, const std::string& path) override;
-            
-            /**
-             * @brief Visit an array
-             * @param param The array to visit
-             * @param path The path of the array
-             * @param length The length of the array
-             */
-            void visitArray(IParam* param, const std::string& path, uint32_t length) override;
-
-        private:
-            /**
-             * @brief The device to visit within the visitor
-             */
-            catena::common::IDevice& device_;
-
-            /**
-             * @brief The authorizer within the visitor
-             */
-            catena::common::Authorizer& authz_;
-
-            /**
-             * @brief The vector of responses within the visitor
-             */
-            std::vector<st2138::ParamInfoResponse>& responses_;
-
-            /**
-             * @brief The request payload within the visitor
-             */
-            ParamInfoRequest& request_;
-    };
 };
 
 }; // namespace REST
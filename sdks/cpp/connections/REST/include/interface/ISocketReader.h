@@ -65,6 +65,8 @@ enum RESTMethod : uint32_t { Method_NONE, Method_GET, Method_POST, Method_PUT, M
 const long DEFAULT_REQUEST_START = 0;
 const long DEFAULT_REQUEST_RECEIVED = 0;
 const uint32_t DEFAULT_TIMEOUT = REST_READ_TIMEOUT_MS; // value is in milliseconds
+const std::size_t MAX_HEADER_BYTES = 16 * 1024; // request line and headers
+const std::size_t MAX_HEADER_COUNT = 100;
 
 /**
  * @brief Interface for the SocketReader class.
@@ -137,6 +139,17 @@ class ISocketReader {
      * @brief Returns true if the client wants a stream response.
      */
     virtual bool stream() const = 0;
+    /**
+     * @brief Returns true if the connection should stay open after the
+     * response is sent.
+     */
+    virtual bool keepAlive() const = 0;
+    /**
+     * @brief Returns the id of the Connect whose subscriptions the client
+     * names, taken from the "connection_id" field, or an empty string if the
+     * client did not name one.
+     */
+    virtual std::string connectionId() const = 0;
 
     /**
      * @brief Returns a pointer to the ServiceImpl
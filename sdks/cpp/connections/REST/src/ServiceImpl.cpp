@@ -38,6 +38,9 @@ ServiceImpl::ServiceImpl(const ServiceConfig& config)
       port_{config.port},
       authorizationEnabled_{config.authz},
       acceptor_{io_context_, tcp::endpoint(tcp::v4(), config.port)},
+      threads_{poolSize_(config.threads)},
+      handlerThreads_{poolSize_(config.handlerThreads)},
+      handlers_{handlerThreads_},
       router_{Router::getInstance()},
       connectionQueue_{config.maxConnections} {
 
@@ -85,88 +88,205 @@ vdk::signal<void()> catena::REST::Connect::shutdownSignal_;
 void ServiceImpl::run() {
     // TLS handled by Envoyproxy
     shutdown_ = false;
+    io_context_.restart();
     auto guard = boost::asio::make_work_guard(io_context_.get_executor());
-    std::thread runner([this](){ io_context_.run(); });
+    LOG(DEBUG) << "Serving REST connections on " << threads_ << " threads";
+    std::vector<std::thread> pool;
+    for (uint32_t i = 0; i < threads_; ++i) {
+        pool.emplace_back([this](){ io_context_.run(); });
+    }
 
-    while (!shutdown_) {
-        // Waiting for a connection.
-        auto socket = std::make_shared<tcp::socket>(io_context_);
-        acceptor_.accept(*socket);
-        // Once a connection is made, increment activeRequests and handle async.
-        {
-            std::lock_guard<std::mutex> lock(activeRequestMutex_);
-            activeRequests_ += 1;
+    // Accepting connections until Shutdown() is called.
+    boost::asio::co_spawn(io_context_, accept_(), boost::asio::use_future).get();
+
+    // shutdown_ is true. Send shutdown signal, close idle connections, and
+    // wait for active requests.
+    Connect::shutdownSignal_.emit();
+    {
+        std::lock_guard<std::mutex> lock(idleMutex_);
+        for (auto& socket : idle_) {
+            boost::asio::post(socket->get_executor(), [socket]() {
+                boost::system::error_code ec;
+                socket->close(ec);
+            });
         }
-        std::thread([this, socket = std::move(socket)]() mutable {
-            catena::exception_with_status rc("", catena::StatusCode::OK);
-            if (!shutdown_) {
-                try {
-                    // Reading from the socket.
-                    SocketReader context(this);
-                    context.read(socket);
-                    std::string requestKey = RESTMethodMap().getForwardMap().at(context.method()) + context.endpoint();
-                    // Returning empty response with options to the client if required.
-                    if (context.method() == Method_OPTIONS) {
-                        rc = catena::exception_with_status("", catena::StatusCode::NO_CONTENT);
-                        SocketWriter(*socket, context.origin()).sendResponse(rc);
-                    // Sending an empty 200 OK response for health check.
-                    } else if (context.method() == Method_GET && context.endpoint() == "/health") {
-                        SocketWriter(*socket, context.origin()).sendResponse(rc);
-                    // Otherwise routing to request.
-                    } else if (router_.canMake(requestKey)) {
-                        std::unique_ptr<ICallData> request = router_.makeProduct(requestKey, *socket, context, dms_);
-                        request->proceed();
-                    // ERROR
-                    } else { 
-                        rc = catena::exception_with_status("Request " + requestKey + " does not exist", catena::StatusCode::UNIMPLEMENTED);
-                    }
-                // ERROR
-                // GCOVR_EXCL_START
-                } catch (const catena::exception_with_status& e) {
-                    rc = catena::exception_with_status(e.what(), e.status); 
-                } catch (const std::invalid_argument& e) {
-                    rc = catena::exception_with_status(e.what(), catena::StatusCode::INVALID_ARGUMENT);
-                } catch (const std::runtime_error& e) {
-                    rc = catena::exception_with_status(e.what(), catena::StatusCode::INTERNAL);
-                } catch (const std::exception& e) {
-                    rc = catena::exception_with_status(e.what(), catena::StatusCode::UNKNOWN);
-                } catch (...) {
-                    rc = catena::exception_with_status{"Unknown error", catena::StatusCode::UNKNOWN};
-                }
-                // GCOVR_EXCL_STOP
-            } else {
-                rc = catena::exception_with_status{"Service unavailable", catena::StatusCode::UNAVAILABLE};
-            }
-            // Writing to socket if there was an error.
-            if (rc.status != catena::StatusCode::OK) {
-                // Try ensures that we don't fail to decrement active requests.
-                try {
-                    SocketWriter writer(*socket);
-                    writer.sendResponse(rc);
-                } catch (...) {}
-            }
-            // request completed. Decrementing activeRequests.
-            {
-                std::lock_guard<std::mutex> lock(activeRequestMutex_);
-                activeRequests_ -= 1;
-                LOG(DEBUG) << "Active requests remaining: " << activeRequests_;
-            }
-        }).detach();
     }
-    
-    // shutdown_ is true. Send shutdown signal and wait for active requests.
-    Connect::shutdownSignal_.emit();
     while(activeRequests_ > 0) {
         std::this_thread::sleep_for(std::chrono::milliseconds(100));
     }
+    joinStreams_();
     
     // Once active requests are done, close the acceptor and io_context.
     guard.reset();
-    runner.join();
+    for (auto& thread : pool) {
+        thread.join();
+    }
     io_context_.stop();
     acceptor_.close();
 }
 
+boost::asio::awaitable<void> ServiceImpl::accept_() {
+    while (!shutdown_) {
+        // Waiting for a connection.
+        auto [ec, socket] = co_await acceptor_.async_accept(boost::asio::make_strand(io_context_), boost::asio::as_tuple(boost::asio::use_awaitable));
+        if (ec) {
+            // GCOVR_EXCL_START
+            LOG(WARNING) << "Failed to accept connection: " << ec.message();
+            if (!acceptor_.is_open()) { break; }
+            continue;
+            // GCOVR_EXCL_STOP
+        }
+        // Dropping the dummy connection sent by Shutdown().
+        if (shutdown_) {
+            break;
+        }
+        // Once a connection is made, increment activeRequests and serve it
+        // on its own strand.
+        {
+            std::lock_guard<std::mutex> lock(activeRequestMutex_);
+            activeRequests_ += 1;
+        }
+        auto shared = std::make_shared<tcp::socket>(std::move(socket));
+        boost::asio::co_spawn(shared->get_executor(), session_(shared), boost::asio::detached);
+    }
+}
+
+boost::asio::awaitable<void> ServiceImpl::session_(std::shared_ptr<tcp::socket> socket) {
+    // Heap allocated so that long-lived requests can take it with them.
+    auto context = std::make_shared<SocketReader>(this);
+    bool open = true;
+    while (open && !shutdown_) {
+        catena::exception_with_status rc("", catena::StatusCode::OK);
+        {
+            std::lock_guard<std::mutex> lock(idleMutex_);
+            idle_.insert(socket);
+        }
+        try {
+            open = co_await context->asyncRead(socket);
+        } catch (const catena::exception_with_status& e) {
+            rc = catena::exception_with_status(e.what(), e.status);
+        } catch (...) {
+            rc = catena::exception_with_status{"Unknown error", catena::StatusCode::UNKNOWN}; // GCOVR_EXCL_LINE
+        }
+        {
+            std::lock_guard<std::mutex> lock(idleMutex_);
+            idle_.erase(socket);
+        }
+        if (rc.status != catena::StatusCode::OK) {
+            // The request could not be read, so neither can any after it.
+            try {
+                SocketWriter(*socket).sendResponse(rc);
+            } catch (...) {} // GCOVR_EXCL_LINE
+            break;
+        } else if (!open) {
+            break;
+        }
+        // Connect and stream requests hold the connection for a long time,
+        // so they get their own thread rather than tying up the pool.
+        if (context->stream() || (context->method() == Method_GET && context->endpoint() == "/connect")) {
+            startStream_(socket, context);
+            // The thread owns the connection from here.
+            break;
+        }
+        // Requests may block, so they run on handlers_ while this waits.
+        open = co_await boost::asio::co_spawn(handlers_, handleAsync_(socket, context), boost::asio::use_awaitable);
+        open = open && context->keepAlive() && socket->is_open();
+    }
+    requestDone_();
+}
+
+boost::asio::awaitable<bool> ServiceImpl::handleAsync_(std::shared_ptr<tcp::socket> socket, std::shared_ptr<SocketReader> context) {
+    co_return handle_(*socket, *context);
+}
+
+bool ServiceImpl::handle_(tcp::socket& socket, SocketReader& context) {
+    catena::exception_with_status rc("", catena::StatusCode::OK);
+    if (!shutdown_) {
+        try {
+            std::string requestKey = RESTMethodMap().getForwardMap().at(context.method()) + context.endpoint();
+            // Returning empty response with options to the client if required.
+            if (context.method() == Method_OPTIONS) {
+                SocketWriter(socket, context.origin(), false, context.keepAlive()).sendResponse(catena::exception_with_status("", catena::StatusCode::NO_CONTENT));
+            // Sending an empty 200 OK response for health check.
+            } else if (context.method() == Method_GET && context.endpoint() == "/health") {
+                SocketWriter(socket, context.origin(), false, context.keepAlive()).sendResponse(rc);
+            // Otherwise routing to request.
+            } else if (router_.canMake(requestKey)) {
+                std::unique_ptr<ICallData> request = router_.makeProduct(requestKey, socket, context, dms_);
+                request->proceed();
+            // ERROR
+            } else { 
+                rc = catena::exception_with_status("Request " + requestKey + " does not exist", catena::StatusCode::UNIMPLEMENTED);
+            }
+        // ERROR
+        // GCOVR_EXCL_START
+        } catch (const catena::exception_with_status& e) {
+            rc = catena::exception_with_status(e.what(), e.status); 
+        } catch (const std::invalid_argument& e) {
+            rc = catena::exception_with_status(e.what(), catena::StatusCode::INVALID_ARGUMENT);
+        } catch (const std::runtime_error& e) {
+            rc = catena::exception_with_status(e.what(), catena::StatusCode::INTERNAL);
+        } catch (const std::exception& e) {
+            rc = catena::exception_with_status(e.what(), catena::StatusCode::UNKNOWN);
+        } catch (...) {
+            rc = catena::exception_with_status{"Unknown error", catena::StatusCode::UNKNOWN};
+        }
+        // GCOVR_EXCL_STOP
+    } else {
+        rc = catena::exception_with_status{"Service unavailable", catena::StatusCode::UNAVAILABLE};
+    }
+    // Writing to socket if there was an error.
+    if (rc.status != catena::StatusCode::OK) {
+        // Try ensures that we don't fail to decrement active requests.
+        try {
+            SocketWriter writer(socket);
+            writer.sendResponse(rc);
+        } catch (...) {}
+        return false;
+    }
+    return true;
+}
+
+void ServiceImpl::startStream_(std::shared_ptr<tcp::socket> socket, std::shared_ptr<SocketReader> context) {
+    {
+        std::lock_guard<std::mutex> lock(activeRequestMutex_);
+        activeRequests_ += 1;
+    }
+    std::lock_guard<std::mutex> lock(streamsMutex_);
+    streams_.remove_if([](Stream& stream) {
+        bool done = stream.done;
+        if (done) {
+            stream.thread.join();
+        }
+        return done;
+    });
+    // streamsMutex_ is held until thread is set, so it is never joined first.
+    Stream& stream = streams_.emplace_back();
+    stream.thread = std::thread([this, socket, context, &stream]() {
+        handle_(*socket, *context);
+        requestDone_();
+        stream.done = true;
+    });
+}
+
+void ServiceImpl::joinStreams_() {
+    std::lock_guard<std::mutex> lock(streamsMutex_);
+    for (auto& stream : streams_) {
+        stream.thread.join();
+    }
+    streams_.clear();
+}
+
+uint32_t ServiceImpl::poolSize_(uint32_t threads) {
+    return threads > 0 ? threads : std::max(1u, std::thread::hardware_concurrency());
+}
+
+void ServiceImpl::requestDone_() {
+    std::lock_guard<std::mutex> lock(activeRequestMutex_);
+    activeRequests_ -= 1;
+    LOG(DEBUG) << "Active requests remaining: " << activeRequests_;
+}
+
 void ServiceImpl::Shutdown() {
     shutdown_ = true;
     // Sending dummy connection to run() loop.
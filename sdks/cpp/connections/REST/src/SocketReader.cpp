@@ -1,9 +1,13 @@
 
 #include <SocketReader.h>
 #include <string_view>
+#include <charconv>
 using catena::REST::SocketReader;
 
 namespace {
+// How much to read from the socket at a time while waiting for headers.
+constexpr std::size_t READ_CHUNK_BYTES = 4096;
+
 static inline bool iequals_header_name(std::string_view a, std::string_view b) {
     if (a.size() != b.size()) return false;
     const unsigned char* pa = reinterpret_cast<const unsigned char*>(a.data());
@@ -29,68 +33,83 @@ static inline bool iequals_header_name(std::string_view a, std::string_view b) {
 }
 
 /**
- * Result from async read coroutine.
+ * Reads exactly bytes more bytes into buf, giving up after timeout ms.
  */
-struct ReadResult {
-    std::unique_ptr<boost::asio::streambuf> buffer;
-    boost::system::error_code ec;
-
-    // Needed for co_spawn to work
-    ReadResult() = default;
-
-    // Used in read coroutines
-    ReadResult(std::unique_ptr<boost::asio::streambuf> sb, boost::system::error_code e)
-        : buffer(std::move(sb)), ec(e) {}
-};
-
-boost::asio::awaitable<ReadResult> read_with_timeout(std::shared_ptr<tcp::socket> socket, std::size_t bytes, int timeout) {
+boost::asio::awaitable<boost::system::error_code> read_with_timeout(std::shared_ptr<tcp::socket> socket, boost::asio::streambuf& buf, std::size_t bytes, int timeout) {
     using namespace boost::asio;
     using namespace experimental::awaitable_operators;
-    auto buf = std::make_unique<boost::asio::streambuf>();
     steady_timer timer(socket->get_executor(), std::chrono::milliseconds(timeout));
-    
 
     // Async_read and timer run simultaneously, the other cancels when one finishes
-    auto result = co_await (async_read(*socket, *buf, transfer_exactly(bytes), as_tuple(use_awaitable)) ||
+    auto result = co_await (async_read(*socket, buf, transfer_exactly(bytes), as_tuple(use_awaitable)) ||
         timer.async_wait(as_tuple(use_awaitable))
     );
 
     // index of 0 = read finished first
     if (result.index() == 0) {
         auto [ec, n] = std::get<0>(result);
-        if (!ec) {
-            co_return ReadResult(std::move(buf), {});
-        } else {
-            co_return ReadResult(nullptr, ec);
-        }
+        co_return ec;
     } else {
-        co_return ReadResult(nullptr, boost::asio::error::timed_out);
+        co_return boost::asio::error::timed_out;
     }
 }
 
-boost::asio::awaitable<ReadResult> read_until_with_timeout(std::shared_ptr<tcp::socket> socket, std::string delim, int timeout) {
+/**
+ * Appends whatever bytes are available to buf, waiting until deadline for at
+ * least one to arrive.
+ */
+boost::asio::awaitable<boost::system::error_code> read_some_until(std::shared_ptr<tcp::socket> socket, boost::asio::streambuf& buf, std::chrono::steady_clock::time_point deadline) {
     using namespace boost::asio;
     using namespace experimental::awaitable_operators;
-    auto buf = std::make_unique<boost::asio::streambuf>();
-    steady_timer timer(socket->get_executor(), std::chrono::milliseconds(timeout));
-
+    steady_timer timer(socket->get_executor(), deadline);
 
-    // Async_read and timer run simultaneously, the other cancels when one finishes
-    auto result = co_await (async_read_until(*socket, *buf, delim, as_tuple(use_awaitable)) ||
+    // Async_read_some and timer run simultaneously, the other cancels when one finishes
+    auto result = co_await (socket->async_read_some(buf.prepare(READ_CHUNK_BYTES), as_tuple(use_awaitable)) ||
         timer.async_wait(as_tuple(use_awaitable))
     );
 
     // index of 0 = read finished first
     if (result.index() == 0) {
         auto [ec, n] = std::get<0>(result);
-        if (!ec) {
-            co_return ReadResult(std::move(buf), {});
-        } else {
-            co_return ReadResult(nullptr, ec);
-        }
+        buf.commit(n);
+        co_return ec;
     } else {
-        co_return ReadResult(nullptr, boost::asio::error::timed_out);
+        co_return boost::asio::error::timed_out;
+    }
+}
+
+/**
+ * Returns a view of the unread bytes in buf, which asio keeps contiguous.
+ */
+inline std::string_view view(const boost::asio::streambuf& buf) {
+    auto data = buf.data();
+    return std::string_view(static_cast<const char*>(data.data()), data.size());
+}
+
+/**
+ * Removes leading and trailing spaces, tabs, and carriage returns.
+ */
+inline std::string_view trim(std::string_view s) {
+    while (!s.empty() && (s.front() == ' ' || s.front() == '\t')) {
+        s.remove_prefix(1);
+    }
+    while (!s.empty() && (s.back() == '\r' || s.back() == ' ' || s.back() == '\t')) {
+        s.remove_suffix(1);
     }
+    return s;
+}
+
+/**
+ * Returns true if s contains needle, ignoring the case of s. needle must be
+ * lowercase.
+ */
+inline bool icontains(std::string_view s, std::string_view needle) {
+    for (std::size_t i = 0; i + needle.size() <= s.size(); ++i) {
+        if (iequals_header_name(s.substr(i, needle.size()), needle)) {
+            return true;
+        }
+    }
+    return false;
 }
 
 static inline bool valid_content_type(std::string_view s, std::string_view contentType) {
@@ -124,115 +143,148 @@ static inline bool valid_content_type(std::string_view s, std::string_view conte
 }
 
 void SocketReader::read(std::shared_ptr<tcp::socket>& socket, uint32_t timeout) {
+    // Single request per socket, so leftover bytes from a failed read are dropped.
+    buffer_.consume(buffer_.size());
+    auto fut = boost::asio::co_spawn(socket->get_executor(), read_(socket, timeout, false), boost::asio::use_future);
+    fut.get();
+}
+
+boost::asio::awaitable<bool> SocketReader::asyncRead(std::shared_ptr<tcp::socket> socket, uint32_t timeout) {
+    co_return co_await read_(socket, timeout, true);
+}
+
+boost::asio::awaitable<bool> SocketReader::read_(std::shared_ptr<tcp::socket> socket, uint32_t timeout, bool pipelined) {
     // Resetting variables.
-    method_ = catena::REST::Method_NONE;
-    slot_ = 0;
-    endpoint_ = "";
-    fqoid_ = "";
-    stream_ = false;
-    origin_ = "";
-    detailLevel_ = st2138::Device_DetailLevel_UNSET;
-    jwsToken_ = "";
-    jsonBody_ = "";
-    requestStart_ = DEFAULT_REQUEST_START;
-    requestReceived_ = DEFAULT_REQUEST_RECEIVED;
+    reset_();
 
     // Getting request receival time formatted as,
     // <number of milliseconds since start of epoch>
     const auto epoch_time = std::chrono::system_clock::now().time_since_epoch();
     requestReceived_ = std::chrono::duration_cast<std::chrono::milliseconds>(epoch_time).count();
 
-    bool hasContentType = false; // Used for enforcing Content-Type
+    // Reading from the socket until the headers are complete. Each pass only
+    // scans the newly received bytes for the blank line ending the headers.
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout);
+    std::size_t scanned = 0;
+    std::size_t headerEnd = view(buffer_).find("\r\n\r\n");
+    while (headerEnd == std::string_view::npos) {
+        if (buffer_.size() >= MAX_HEADER_BYTES) {
+            throw catena::exception_with_status("Request headers too large", catena::StatusCode::INVALID_ARGUMENT);
+        }
+        scanned = buffer_.size() < 3 ? 0 : buffer_.size() - 3;
+        boost::system::error_code ec = co_await read_some_until(socket, buffer_, deadline);
+        if (ec && pipelined && buffer_.size() == 0) {
+            // Client closed or went quiet between requests.
+            co_return false;
+        } else if (ec == boost::asio::error::timed_out) {
+            throw catena::exception_with_status("Timed out", catena::StatusCode::DEADLINE_EXCEEDED);
+        } else if (ec) {
+            throw catena::exception_with_status("Read error", catena::StatusCode::UNKNOWN);
+        }
+        headerEnd = view(buffer_).find("\r\n\r\n", scanned);
+    }
+    std::size_t contentLength = parse(view(buffer_).substr(0, headerEnd + 4));
+    buffer_.consume(headerEnd + 4);
+
+    // Any body bytes read alongside the headers are already in buffer_.
+    if (buffer_.size() < contentLength) {
+        boost::system::error_code ec = co_await read_with_timeout(socket, buffer_, contentLength - buffer_.size(), timeout);
+        if (ec == boost::asio::error::timed_out) {
+            throw catena::exception_with_status("Timed out", catena::StatusCode::DEADLINE_EXCEEDED);
+        } else if (ec) {
+            throw catena::exception_with_status("Read error", catena::StatusCode::UNKNOWN);
+        }
+    }
+    // Anything past the body belongs to the next request on a persistent
+    // connection, but means the Content-Length was wrong otherwise.
+    if (!pipelined && buffer_.size() > contentLength) {
+        throw catena::exception_with_status("Incorrect Content-Length: data lost", catena::StatusCode::DATA_LOSS);
+    }
+    jsonBody_.assign(view(buffer_).substr(0, contentLength));
+    buffer_.consume(contentLength);
 
-    // Reading from the socket.
-    auto fut = boost::asio::co_spawn(socket->get_executor(), read_until_with_timeout(socket, "\r\n\r\n", timeout), boost::asio::use_future);
-    ReadResult result = fut.get();
-    if (result.ec == boost::asio::error::timed_out) {
-        throw catena::exception_with_status("Timed out", catena::StatusCode::DEADLINE_EXCEEDED);
-    } else if (result.ec) {
-        throw catena::exception_with_status("Read error", catena::StatusCode::UNKNOWN);
+    // Setting detail level to NONE if not set.
+    if (detailLevel_ == st2138::Device_DetailLevel_UNSET) {
+        detailLevel_ = st2138::Device_DetailLevel_NONE;
     }
-    std::istream header_stream(result.buffer.get());
+    co_return true;
+}
 
-    // Getting the first line from the stream (URL), splitting, and parsing.
-    std::string header;
-    std::getline(header_stream, header);
-    std::string url, httpVersion;
-    std::string methodStr;
-    std::istringstream(header) >> methodStr >> url >> httpVersion;
+std::size_t SocketReader::parse(std::string_view request) {
+    reset_();
+    std::string_view::size_type lineEnd = request.find("\r\n");
+    if (lineEnd == std::string_view::npos) {
+        throw catena::exception_with_status("Invalid request line", catena::StatusCode::INVALID_ARGUMENT);
+    }
+
+    // Splitting the request line into "<method> <target> <version>".
+    std::string_view requestLine = request.substr(0, lineEnd);
+    std::size_t sp1 = requestLine.find(' ');
+    std::size_t sp2 = sp1 == std::string_view::npos ? sp1 : requestLine.find(' ', sp1 + 1);
+    std::string_view methodStr = requestLine.substr(0, sp1);
+    std::string_view target = sp1 == std::string_view::npos ? std::string_view() : requestLine.substr(sp1 + 1, sp2 - sp1 - 1);
+    std::string_view httpVersion = sp2 == std::string_view::npos ? std::string_view() : trim(requestLine.substr(sp2 + 1));
+    // HTTP/1.1 connections are persistent unless the client says otherwise.
+    keepAlive_ = httpVersion != "HTTP/1.0";
 
     // Converting method to enum.
     auto& methodMap = RESTMethodMap().getReverseMap();
-    if (methodMap.contains(methodStr)) {
-        method_ = methodMap.at(methodStr);
+    auto method = methodMap.find(std::string(methodStr));
+    if (method != methodMap.end()) {
+        method_ = method->second;
     }
 
     // Parsing url
-    url_view u(url);
     try {
-        std::vector<std::string> path;
-        catena::split(path, u.path(), "/");
-        // Checking the url starts with "st2138-api/v1/"
-        if (path.size() >= 4 && path[1] == "st2138-api" && path[2] == service_->version()) {
-            try {
-                slot_ = std::stoi(path[3]);
-            } catch(...) {
-                endpoint_ = "/" + path[3];
-            }
-            // If the stream flag was added pop it from the path.
-            if (path.back() == "stream") {
-                path.pop_back();
-                stream_ = true;
-            }
-            // Lastly getting the endpoint (if not already set) and the fqoid.
-            if (path.size() > 4) {
-                uint32_t i = 4;
-                // First segment after "api/v1/slot" is the endpoint.
-                if (endpoint_.empty()) {
-                    endpoint_ = "/" + path[i];
-                    i++;
-                }
-                // Everything after the endpoint is the fqoid.
-                for (i; i < path.size(); i++) {
-                    fqoid_ += "/" + path.at(i);
-                }
-            }
-        } else {
-            throw catena::exception_with_status("Invalid URL", catena::StatusCode::INVALID_ARGUMENT);
+        url_view u(target);
+        // Only decoding the path if it needs it.
+        std::string decoded;
+        std::string_view path = u.encoded_path();
+        if (path.find('%') != std::string_view::npos) {
+            decoded = u.path();
+            path = decoded;
+        }
+        parsePath_(path);
+        // Parsing query parameters.
+        for (auto element : u.encoded_params()) {
+            fields_.insert_or_assign(std::string(element.key), std::string(element.value));
         }
     } catch (...) {
         throw catena::exception_with_status("Invalid URL", catena::StatusCode::INVALID_ARGUMENT);
     }
 
-    // Parsing query parameters.
-    for (auto element : u.encoded_params()) {
-        fields_[(std::string)element.key] = element.value;
-    }
-    
     // Looping through headers to retrieve JWS token and json body len.
     std::size_t contentLength = 0;
-    while(std::getline(header_stream, header) && header != "\r") {
+    bool hasContentType = false; // Used for enforcing Content-Type
+    std::size_t headerCount = 0;
+    std::size_t pos = lineEnd + 2;
+    while (pos < request.size()) {
+        lineEnd = request.find("\r\n", pos);
+        if (lineEnd == std::string_view::npos) {
+            lineEnd = request.size();
+        }
+        std::string_view header = request.substr(pos, lineEnd - pos);
+        pos = lineEnd + 2;
+        // Blank line ends the headers.
+        if (header.empty()) {
+            break;
+        }
+        if (++headerCount > MAX_HEADER_COUNT) {
+            throw catena::exception_with_status("Too many headers", catena::StatusCode::INVALID_ARGUMENT);
+        }
         // Parse "<name>: <value>" and handle header name case-insensitively
         std::size_t sep = header.find(':');
-        if (sep == std::string::npos) {
+        if (sep == std::string_view::npos) {
             continue;
         }
-        std::string name = header.substr(0, sep);
-        std::string value = header.substr(sep + 1);
-        // Trim leading spaces
-        while (!value.empty() && (value.front() == ' ' || value.front() == '\t')) {
-            value.erase(0, 1);
-        }
-        // Trim trailing CR and spaces
-        while (!value.empty() && (value.back() == '\r' || value.back() == ' ' || value.back() == '\t')) {
-            value.pop_back();
-        }
+        std::string_view name = header.substr(0, sep);
+        std::string_view value = trim(header.substr(sep + 1));
 
         // Getting jwsToken.
         if (service_->authorizationEnabled() && jwsToken_.empty() && iequals_header_name(name, "authorization")) {
             // Expect "Bearer <token>" (keep scheme check case-sensitive as before)
-            static const std::string kBearerPrefix = "Bearer ";
-            if (value.find(kBearerPrefix) == 0) {
+            constexpr std::string_view kBearerPrefix = "Bearer ";
+            if (value.starts_with(kBearerPrefix)) {
                 jwsToken_ = value.substr(kBearerPrefix.length());
             }
         }
@@ -242,30 +294,33 @@ void SocketReader::read(std::shared_ptr<tcp::socket>& socket, uint32_t timeout)
         }
         // Getting detail level from header
         else if (detailLevel_ == st2138::Device_DetailLevel_UNSET && iequals_header_name(name, "detail-level")) {
-            std::string dl = value;
             auto& dlMap = catena::common::DetailLevel().getReverseMap();
-            if (dlMap.contains(dl)) {
-                detailLevel_ = dlMap.at(dl);
+            auto dl = dlMap.find(std::string(value));
+            if (dl != dlMap.end()) {
+                detailLevel_ = dl->second;
             }
         }
         // Getting time request was sent
         else if (requestStart_ == DEFAULT_REQUEST_START && iequals_header_name(name, "request-start")){
-            catena::readTimestamp(value, requestStart_);
+            std::string timestamp(value);
+            catena::readTimestamp(timestamp, requestStart_);
         }
         // Getting body content-Length
         else if (contentLength == 0 && iequals_header_name(name, "content-length")) {
-            try {
-                if (value.empty() || value[0] == '-') {
-                    throw catena::exception_with_status("Invalid Content-Length", catena::StatusCode::INVALID_ARGUMENT);
-                }
-                size_t processed = 0;
-                contentLength = stoi(value, &processed);
-                if (processed < value.length()) {
-                    throw catena::exception_with_status("Invalid Content-Length", catena::StatusCode::INVALID_ARGUMENT);
-                }
-            } catch(...) {
+            int32_t length = 0;
+            auto [end, err] = std::from_chars(value.data(), value.data() + value.size(), length);
+            if (value.empty() || value[0] == '-' || err != std::errc() || end != value.data() + value.size()) {
                 throw catena::exception_with_status("Invalid Content-Length", catena::StatusCode::INVALID_ARGUMENT);
             }
+            contentLength = length;
+        }
+        // Getting connection persistence
+        else if (iequals_header_name(name, "connection")) {
+            if (icontains(value, "close")) {
+                keepAlive_ = false;
+            } else if (icontains(value, "keep-alive")) {
+                keepAlive_ = true;
+            }
         }
         // Checking Content-Type
         else if (iequals_header_name(name, "content-type")) {
@@ -275,35 +330,65 @@ void SocketReader::read(std::shared_ptr<tcp::socket>& socket, uint32_t timeout)
             hasContentType = true;
         }
     }
-    // If body exists, we need to handle leftover data and append the rest.
-    jsonBody_ = std::string((std::istreambuf_iterator<char>(header_stream)), std::istreambuf_iterator<char>());
-    if (contentLength <= 0 && jsonBody_.size() > 0) {
-        throw catena::exception_with_status("Incorrect Content-Length: data lost", catena::StatusCode::DATA_LOSS);
+    // All request bodies must be json according to the spec, so we can just check here
+    if (contentLength > 0 && !hasContentType) {
+        throw catena::exception_with_status("Content-Type missing", catena::StatusCode::INVALID_ARGUMENT);
+    }
+    return contentLength;
+}
+
+void SocketReader::parsePath_(std::string_view path) {
+    // Splitting into views of each segment, reusing the vector's storage.
+    segments_.clear();
+    for (std::size_t start = 0, slash = 0; slash != std::string_view::npos; start = slash + 1) {
+        slash = path.find('/', start);
+        segments_.push_back(path.substr(start, slash == std::string_view::npos ? slash : slash - start));
+    }
+    // Checking the url starts with "st2138-api/v1/"
+    if (segments_.size() < 4 || segments_[1] != "st2138-api" || segments_[2] != service_->version()) {
+        throw catena::exception_with_status("Invalid URL", catena::StatusCode::INVALID_ARGUMENT);
     }
-    if (contentLength > 0) {
-        // All request bodies must be json according to the spec, so we can just check here
-        if (!hasContentType) {
-            throw catena::exception_with_status("Content-Type missing", catena::StatusCode::INVALID_ARGUMENT);
+    int32_t slot = 0;
+    std::string_view segment = segments_[3];
+    auto [end, err] = std::from_chars(segment.data(), segment.data() + segment.size(), slot);
+    if (err == std::errc() && end != segment.data()) {
+        slot_ = slot;
+    } else {
+        endpoint_.assign("/").append(segment);
+    }
+    // If the stream flag was added pop it from the path.
+    if (segments_.back() == "stream") {
+        segments_.pop_back();
+        stream_ = true;
+    }
+    // Lastly getting the endpoint (if not already set) and the fqoid.
+    if (segments_.size() > 4) {
+        std::size_t i = 4;
+        // First segment after "api/v1/slot" is the endpoint.
+        if (endpoint_.empty()) {
+            endpoint_.assign("/").append(segments_[i]);
+            i++;
         }
-        if (jsonBody_.size() < contentLength) {
-            std::size_t leftover = contentLength - jsonBody_.size();
-            std::size_t start = jsonBody_.size();
-
-            auto fut = boost::asio::co_spawn(socket->get_executor(), read_with_timeout(socket, leftover, timeout), boost::asio::use_future);
-            ReadResult result = fut.get();
-            if (result.ec == boost::asio::error::timed_out) {
-                throw catena::exception_with_status("Timed out", catena::StatusCode::DEADLINE_EXCEEDED);
-            } else if (result.ec) {
-                throw catena::exception_with_status("Read error", catena::StatusCode::UNKNOWN);
-            }
-            auto it = boost::asio::buffers_begin(result.buffer->data());
-            jsonBody_.append(it, it + result.buffer->size());
-        } else if (jsonBody_.size() > contentLength) {
-            throw catena::exception_with_status("Incorrect Content-Length: data lost", catena::StatusCode::DATA_LOSS);
+        // Everything after the endpoint is the fqoid, which is still
+        // contiguous in path including the '/' before it.
+        if (i < segments_.size()) {
+            const char* first = segments_[i].data() - 1;
+            fqoid_.assign(first, segments_.back().data() + segments_.back().size());
         }
     }
-    // Setting detail level to NONE if not set.
-    if (detailLevel_ == st2138::Device_DetailLevel_UNSET) {
-        detailLevel_ = st2138::Device_DetailLevel_NONE;
-    }
+}
+
+void SocketReader::reset_() {
+    method_ = catena::REST::Method_NONE;
+    slot_ = 0;
+    endpoint_.clear();
+    fqoid_.clear();
+    stream_ = false;
+    keepAlive_ = false;
+    origin_.clear();
+    detailLevel_ = st2138::Device_DetailLevel_UNSET;
+    jwsToken_.clear();
+    jsonBody_.clear();
+    fields_.clear();
+    requestStart_ = DEFAULT_REQUEST_START;
 }
@@ -1,67 +1,176 @@
 #include <SocketWriter.h>
 #include <Logger.h>
+#include <Config.h>
+#include <cstdio>
+#ifndef _WIN32
+#include <poll.h>
+#endif
 using catena::REST::SocketWriter;
 using catena::REST::SSEWriter;
 
+namespace {
+// Waits up to timeout for the socket to accept more data. Returns false on
+// timeout.
+bool waitWritable(tcp::socket& socket, std::chrono::milliseconds timeout) {
+#ifdef _WIN32
+    WSAPOLLFD fd{socket.native_handle(), POLLWRNORM, 0};
+    return ::WSAPoll(&fd, 1, static_cast<int>(timeout.count())) != 0;
+#else
+    pollfd fd{socket.native_handle(), POLLOUT, 0};
+    return ::poll(&fd, 1, static_cast<int>(timeout.count())) != 0;
+#endif
+}
+} // namespace
+
+boost::system::error_code catena::REST::writeWithTimeout(tcp::socket& socket, std::vector<boost::asio::const_buffer> buffers, std::chrono::milliseconds timeout) {
+    auto deadline = std::chrono::steady_clock::now() + timeout;
+    boost::system::error_code ec;
+    // Writing in non-blocking mode so the wait for the client can time out.
+    bool nonBlocking = socket.non_blocking();
+    socket.non_blocking(true, ec);
+    while (!ec && boost::asio::buffer_size(buffers) > 0) {
+        std::size_t written = socket.write_some(buffers, ec);
+        // Dropping what was written from the front of buffers.
+        std::size_t done = 0;
+        while (done < buffers.size() && written >= buffers[done].size()) {
+            written -= buffers[done++].size();
+        }
+        buffers.erase(buffers.begin(), buffers.begin() + done);
+        if (!buffers.empty()) {
+            buffers.front() += written;
+        }
+        // The socket is full, waiting for the client to read.
+        if (ec == boost::asio::error::would_block) {
+            ec.clear();
+            auto left = std::chrono::ceil<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now());
+            if (left.count() <= 0 || !waitWritable(socket, left)) {
+                ec = boost::asio::error::timed_out;
+            }
+        }
+    }
+    boost::system::error_code ignored;
+    socket.non_blocking(nonBlocking, ignored);
+    return ec;
+}
+
 void SocketWriter::sendResponse(const catena::exception_with_status& err, const google::protobuf::Message& msg) {
     auto httpStatus = codeMap_.at(err.status);
 
     // Convert message to JSON
-    std::string jsonOutput = "";
+    jsonOutput_.clear();
     // Check if message is not Empty so we don't send empty body
     if (httpStatus.first < 300 && msg.GetTypeName() != "st2138.Empty")  {
         google::protobuf::util::JsonPrintOptions options; // Default options
-        auto status = MessageToJsonString(msg, &jsonOutput, options);
+        auto status = MessageToJsonString(msg, &jsonOutput_, options);
 
         if (!status.ok()) { // GCOVR_EXCL_START
             /* If conversion fails, this error maps to bad request.
              * This should be impossible to get to without failing on function
              * call first*/
             httpStatus = codeMap_.at(catena::StatusCode::INVALID_ARGUMENT);
+            jsonOutput_.clear();
             // GCOVR_EXCL_STOP
-        } else { // Otherwise add the output to response.
-            if (jsonBody_.empty()) {
-                jsonBody_ = jsonOutput;
-            } else {
-                jsonBody_ += "," + jsonOutput;
+        }
+    }
+    send_(err, httpStatus);
+}
+
+void SocketWriter::sendJson(const catena::exception_with_status& err, std::string_view json) {
+    auto httpStatus = codeMap_.at(err.status);
+    jsonOutput_.clear();
+    if (httpStatus.first < 300) {
+        jsonOutput_.append(json);
+    }
+    send_(err, httpStatus);
+}
+
+void SocketWriter::send_(const catena::exception_with_status& err, http_exception_with_status httpStatus) {
+    if (!jsonOutput_.empty()) {
+        if (!buffer_) { // Otherwise add the output to response.
+            jsonBody_.swap(jsonOutput_);
+            jsonOutput_.clear();
+        } else {
+            // If we are buffering a stream response we need to encapsulate the
+            // JSON in an array.
+            jsonBody_.append(jsonBody_.empty() && !chunked_ ? "{\"data\":[" : ",");
+            jsonBody_.append(jsonOutput_);
+            // Streaming what has been buffered once it gets large.
+            if (jsonBody_.size() >= CHUNK_BYTES) {
+                writeChunk_();
             }
+            return;
         }
     }
-    // If the no buffer or response is empty we need to send the response.
-    if (!buffer_ || jsonOutput.empty()) {
-        // In case of an error we clear the body and just send an err code.
+    // Once streaming the status can no longer be changed, so the response
+    // is cut short to signal the error.
+    if (chunked_) {
         if (httpStatus.first >= 300) {
-            jsonBody_ = "";
-        }
-        // If we are buffering a stream response we need to encapsulate the
-        // JSON in an array.
-        if (buffer_ && !jsonBody_.empty()) {
-            jsonBody_ = "{\"data\":[" + jsonBody_ + "]}";
-        }
-        // Adding headers and writing to client.
-        std::stringstream response;
-        response << "HTTP/1.1 " << httpStatus.first << " " << httpStatus.second << "\r\n"
-                 << "Content-Type: application/json\r\n"
-                 << "Connection: close\r\n"
-                 << "Content-Length: " << jsonBody_.length() << "\r\n"
-                 << "Access-Control-Allow-Origin: " << origin_ << "\r\n"
-                 << "Access-Control-Allow-Methods: GET, POST, PUT, DELETE, OPTIONS\r\n"
-                 << "Access-Control-Allow-Headers: Content-Type, Authorization, accept, Origin, X-Requested-With, Language, Detail-Level\r\n"
-                 << "Access-Control-Allow-Credentials: true\r\n\r\n"
-                 << jsonBody_;
-        // Use non-throwing write; on error, close socket to signal disconnect
-        boost::system::error_code ec;
-        boost::asio::write(socket_, boost::asio::buffer(response.str()), ec);
-        if (ec) {
-            LOG(WARNING) << "Socket write error (" << ec.value() << "): " << ec.message();
-            socket_.close();
+            LOG(WARNING) << "Error after response started streaming, closing connection: " << err.what();
+            boost::system::error_code ec;
+            socket_.close(ec);
+        } else {
+            jsonBody_.append("]}");
+            writeChunk_();
+            // Zero length chunk ends the response.
+            write_({boost::asio::buffer("0\r\n\r\n", 5)});
         }
+        return;
+    }
+    // In case of an error we clear the body and just send an err code.
+    if (httpStatus.first >= 300) {
+        jsonBody_.clear();
+    } else if (buffer_ && !jsonBody_.empty()) {
+        jsonBody_.append("]}");
+    }
+    // Adding headers and writing to client.
+    std::string headers = headers_(httpStatus, false);
+    write_({boost::asio::buffer(headers), boost::asio::buffer(jsonBody_)});
+}
+
+std::string SocketWriter::headers_(const http_exception_with_status& httpStatus, bool chunked) const {
+    std::string headers = "HTTP/1.1 " + std::to_string(httpStatus.first) + " " + httpStatus.second + "\r\n"
+                          "Content-Type: application/json\r\n"
+                          "Connection: " + (keepAlive_ ? "keep-alive" : "close") + "\r\n";
+    if (chunked) {
+        headers += "Transfer-Encoding: chunked\r\n";
+    } else {
+        headers += "Content-Length: " + std::to_string(jsonBody_.length()) + "\r\n";
+    }
+    headers += "Access-Control-Allow-Origin: " + origin_ + "\r\n"
+               "Access-Control-Allow-Methods: GET, POST, PUT, DELETE, OPTIONS\r\n"
+               "Access-Control-Allow-Headers: Content-Type, Authorization, accept, Origin, X-Requested-With, Language, Detail-Level\r\n"
+               "Access-Control-Allow-Credentials: true\r\n\r\n";
+    return headers;
+}
+
+void SocketWriter::writeChunk_() {
+    std::string headers = chunked_ ? "" : headers_(codeMap_.at(catena::StatusCode::OK), true);
+    chunked_ = true;
+    if (jsonBody_.empty()) {
+        return; // GCOVR_EXCL_LINE
+    }
+    // Each chunk is its size in hex followed by the data.
+    char size[20];
+    int n = std::snprintf(size, sizeof(size), "%zx\r\n", jsonBody_.size());
+    write_({boost::asio::buffer(headers), boost::asio::buffer(size, n), boost::asio::buffer(jsonBody_), boost::asio::buffer("\r\n", 2)});
+    // Keeping the capacity for the next chunk.
+    jsonBody_.clear();
+}
+
+void SocketWriter::write_(const std::vector<boost::asio::const_buffer>& buffers) {
+    // Use non-throwing write; on error, close socket to signal disconnect
+    if (!socket_.is_open()) {
+        return;
+    }
+    boost::system::error_code ec = writeWithTimeout(socket_, buffers, std::chrono::seconds(config::rest_write_timeout));
+    if (ec) {
+        LOG(WARNING) << "Socket write error (" << ec.value() << "): " << ec.message();
+        socket_.close(ec);
     }
 }
 
 void SSEWriter::sendResponse(const catena::exception_with_status& err, const google::protobuf::Message& msg) {
     auto httpStatus = codeMap_.at(err.status);
-    std::stringstream response;
 
     // Convert message to JSON
     std::string jsonOutput = "";
@@ -78,6 +187,15 @@ void SSEWriter::sendResponse(const catena::exception_with_status& err, const goo
             // GCOVR_EXCL_STOP
         }
     }
+    writeEvent_(httpStatus, jsonOutput);
+}
+
+void SSEWriter::sendEvent(const std::string& json) {
+    writeEvent_(codeMap_.at(catena::StatusCode::OK), json);
+}
+
+void SSEWriter::writeEvent_(const http_exception_with_status& httpStatus, const std::string& jsonOutput) {
+    std::stringstream response;
 
     // Send headers only once
     if (!headers_sent_) {
@@ -88,7 +206,13 @@ void SSEWriter::sendResponse(const catena::exception_with_status& err, const goo
                  << "Access-Control-Allow-Origin: " << origin_ << "\r\n"
                  << "Access-Control-Allow-Methods: GET, POST, PUT, DELETE, OPTIONS\r\n"
                  << "Access-Control-Allow-Headers: Content-Type, Authorization, accept, Origin, X-Requested-With, Language, Detail-Level\r\n"
-                 << "Access-Control-Allow-Credentials: true\r\n\r\n";
+                 << "Access-Control-Allow-Credentials: true\r\n";
+        // Lets clients name this connection's subscriptions.
+        if (!connectionId_.empty()) {
+            response << "Catena-Connection-Id: " << connectionId_ << "\r\n"
+                     << "Access-Control-Expose-Headers: Catena-Connection-Id\r\n";
+        }
+        response << "\r\n";
         headers_sent_ = true;
     }
 
@@ -98,10 +222,10 @@ void SSEWriter::sendResponse(const catena::exception_with_status& err, const goo
     }
 
     // Use non-throwing write; on error, close socket to signal disconnect
-    boost::system::error_code ec;
-    boost::asio::write(socket_, boost::asio::buffer(response.str()), ec);
+    std::string event = response.str();
+    boost::system::error_code ec = writeWithTimeout(socket_, {boost::asio::buffer(event)}, std::chrono::seconds(config::rest_write_timeout));
     if (ec) {
         LOG(WARNING) << "SSE write error (" << ec.value() << "): " << ec.message();
-        socket_.close();
+        socket_.close(ec);
     }
 }
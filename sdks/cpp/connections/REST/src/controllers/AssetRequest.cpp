@@ -1,5 +1,6 @@
 // connections/REST
 #include <controllers/AssetRequest.h>
+#include <AuthorizerCache.h>
 #include <fstream>
 #include <filesystem>
 #include <zlib.h>
@@ -11,7 +12,7 @@ using catena::REST::AssetRequest;
 int AssetRequest::objectCounter_ = 0;
 
 AssetRequest::AssetRequest(tcp::socket& socket, ISocketReader& context, SlotMap& dms) :
-    socket_{socket}, writer_{socket, context.origin()}, context_{context}, dms_{dms} {
+    socket_{socket}, writer_{socket, context.origin(), false, context.keepAlive()}, context_{context}, dms_{dms} {
     objectId_ = objectCounter_++;
     writeConsole_(CallStatus::kCreate, socket_.is_open());
 }
@@ -150,7 +151,7 @@ void AssetRequest::proceed() {
 
         if (context_.authorizationEnabled()) {
             // Authorizer throws an error if invalid jws token so no need to handle rc.
-            sharedAuthz = std::make_shared<catena::common::Authorizer>(context_.jwsToken());
+            sharedAuthz = catena::common::AuthorizerCache::instance().get(context_.jwsToken());
             authz = sharedAuthz.get();
         } else {
             authz = &catena::common::Authorizer::kAuthzDisabled;
@@ -6,7 +6,7 @@ using catena::common::ILanguagePack;
 int catena::REST::Connect::objectCounter_ = 0;
 
 catena::REST::Connect::Connect(tcp::socket& socket, ISocketReader& context, SlotMap& dms) :
-    socket_{socket}, writer_{socket, context.origin()}, context_{context},
+    socket_{socket}, writer_{socket, context.origin(), connectionId()}, context_{context},
     catena::common::Connect(dms, context.subscriptionManager()) {
     objectId_ = objectCounter_++;
     writeConsole_(CallStatus::kCreate, socket_.is_open());
@@ -15,19 +15,7 @@ catena::REST::Connect::Connect(tcp::socket& socket, ISocketReader& context, Slot
 catena::REST::Connect::~Connect() {
     // Disconnecting all initialized listeners.
     if (shutdownSignalId_ != 0) { shutdownSignal_.disconnect(shutdownSignalId_); }
-    for (auto [slot, dm] : dms_) {
-        if (dm) {
-            if (valueSetByClientIds_.contains(slot)) {
-                dm->getValueSetByClient().disconnect(valueSetByClientIds_[slot]);
-            }
-            if (valueSetByServerIds_.contains(slot)) {
-                dm->getValueSetByServer().disconnect(valueSetByServerIds_[slot]);
-            }
-            if (languageAddedIds_.contains(slot)) {
-                dm->getLanguageAddedPushUpdate().disconnect(languageAddedIds_[slot]);
-            }
-        }
-    }
+    unsubscribeUpdates_();
     context_.connectionQueue().deregisterConnection(this);
 }
 
@@ -43,23 +31,14 @@ void catena::REST::Connect::proceed() {
         detailLevel_ = context_.detailLevel();
         userAgent_ = context_.fields("user_agent");
         initAuthz_(context_.jwsToken(), context_.authorizationEnabled());
+        openSubscriptionScope_();
         if (context_.connectionQueue().registerConnection(this)) {
             // Connecting to each device in dms_.
             st2138::PushUpdates populatedSlots;
             for (auto [slot, dm] : dms_) {
                 if (dm) {
-                    // Waiting for a value set by server to be sent to execute code.
-                    valueSetByServerIds_[slot] = dm->getValueSetByServer().connect([this, slot](const std::string& oid, const IParam* p){
-                        updateResponse_(oid, p, slot);
-                    });
-                    // Waiting for a value set by client to be sent to execute code.
-                    valueSetByClientIds_[slot] = dm->getValueSetByClient().connect([this, slot](const std::string& oid, const IParam* p){
-                        updateResponse_(oid, p, slot);
-                    });
-                    // Waiting for a language to be added to execute code.
-                    languageAddedIds_[slot] = dm->getLanguageAddedPushUpdate().connect([this, slot](const ILanguagePack* l) {
-                        updateResponse_(l, slot);
-                    });
+                    // Receiving the device's value and language pack updates.
+                    subscribeUpdates_(slot, *dm);
                     populatedSlots.mutable_slots_added()->add_slots(slot);
                 }
             }
@@ -86,22 +65,31 @@ void catena::REST::Connect::proceed() {
 
     // kWrite: Waiting for updates to send to the client.
     std::unique_lock<std::mutex> connect_lock{mtx_, std::defer_lock};
+    std::vector<catena::common::SharedUpdatePtr> batch;
     while (socket_.is_open() && !shutdown_) {
         connect_lock.lock();
-        cv_.wait(connect_lock, [this] { return hasUpdate_; });
+        cv_.wait(connect_lock, [this] { return hasUpdate_ || !updates_.empty(); });
         hasUpdate_ = false;
+        drainUpdates_(batch);
+        // Writing outside of the lock so updates can keep queueing.
+        connect_lock.unlock();
         writeConsole_(CallStatus::kWrite, true);
         if (socket_.is_open()) {
-            if (shutdown_) {
+            if (updates_.overflowed()) {
+                writer_.sendResponse(catena::exception_with_status("Client is not keeping up with updates", catena::StatusCode::RESOURCE_EXHAUSTED));
+            } else if (shutdown_) {
                 writer_.sendResponse(catena::exception_with_status("", catena::StatusCode::CANCELLED));
             } else if (authz_->isExpired()) {
                 writer_.sendResponse(catena::exception_with_status("", catena::StatusCode::UNAUTHENTICATED));
                 shutdown_ = true;
             } else {
-                writer_.sendResponse(catena::exception_with_status("", catena::StatusCode::OK), res_);
+                // The JSON is shared with every client in the same scope class.
+                for (const catena::common::SharedUpdatePtr& update : batch) {
+                    writer_.sendEvent(update->json());
+                }
             }
         }
-        connect_lock.unlock();
+        batch.clear();
     }
 
     // Writing the final status to the console.
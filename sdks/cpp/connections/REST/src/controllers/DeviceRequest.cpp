@@ -1,5 +1,6 @@
 // connections/REST
 #include <controllers/DeviceRequest.h>
+#include <AuthorizerCache.h>
 #include <ISubscriptionManager.h>
 using catena::REST::DeviceRequest;
 
@@ -13,7 +14,7 @@ DeviceRequest::DeviceRequest(tcp::socket& socket, ISocketReader& context, SlotMa
     if (context.stream()) {
         writer_ = std::make_unique<catena::REST::SSEWriter>(socket, context.origin());
     } else {
-        writer_ = std::make_unique<catena::REST::SocketWriter>(socket, context.origin(), true);
+        writer_ = std::make_unique<catena::REST::SocketWriter>(socket, context.origin(), true, context.keepAlive());
     }
     writeConsole_(CallStatus::kCreate, socket_.is_open());
 
@@ -44,7 +45,7 @@ void DeviceRequest::proceed() {
             // Setting up authorizer object.
             if (context_.authorizationEnabled()) {
                 // Authorizer throws an error if invalid jws token
-                sharedAuthz = std::make_shared<catena::common::Authorizer>(context_.jwsToken());
+                sharedAuthz = catena::common::AuthorizerCache::instance().get(context_.jwsToken());
                 authz = sharedAuthz.get();
             } else {
                 authz = &catena::common::Authorizer::kAuthzDisabled;
@@ -56,7 +57,9 @@ void DeviceRequest::proceed() {
             // Getting subscribed oids if dl == SUBSCRIPTIONS.
             if (dl == st2138::Device_DetailLevel_SUBSCRIPTIONS) {
                 auto& subscriptionManager = context_.subscriptionManager();
-                subscribedOids_ = subscriptionManager.getAllSubscribedOids(*dm);
+                // Subscriptions are scoped to the Connect the client names.
+                std::string scope = catena::common::ISubscriptionManager::scopeKey(authz->subject(), context_.connectionId());
+                subscribedOids_ = subscriptionManager.getAllSubscribedOids(*dm, scope);
             }
 
             // Getting the serializer object.
@@ -66,12 +69,14 @@ void DeviceRequest::proceed() {
             if (serializer_) {
                 while (serializer_->hasMore()) {
                     writeConsole_(CallStatus::kWrite, socket_.is_open());
-                    st2138::DeviceComponent component{};
+                    // Owned by the serializer, valid until the next getNext
+                    const st2138::DeviceComponent* component = nullptr;
                     {
-                        std::lock_guard lg(dm->mutex());
-                        component = serializer_->getNext();
+                        // The serializer locks each param it reads
+                        std::shared_lock lg(dm->mutex());
+                        component = &serializer_->getNext();
                     }
-                    writer_->sendResponse(rc, component);
+                    writer_->sendResponse(rc, *component);
                 }
             } else {
                 rc = catena::exception_with_status{"Illegal state", catena::StatusCode::INTERNAL};
@@ -1,5 +1,6 @@
 // connections/REST
 #include <controllers/ExecuteCommand.h>
+#include <AuthorizerCache.h>
 
 using catena::REST::ExecuteCommand;
 
@@ -13,7 +14,7 @@ ExecuteCommand::ExecuteCommand(tcp::socket& socket, ISocketReader& context, Slot
     if (context.stream()) {
         writer_ = std::make_unique<catena::REST::SSEWriter>(socket, context.origin());
     } else {
-        writer_ = std::make_unique<catena::REST::SocketWriter>(socket, context.origin(), true);
+        writer_ = std::make_unique<catena::REST::SocketWriter>(socket, context.origin(), true, context.keepAlive());
     }
     writeConsole_(CallStatus::kCreate, socket_.is_open());
 }
@@ -53,7 +54,7 @@ void ExecuteCommand::proceed() {
             std::shared_ptr<catena::common::Authorizer> sharedAuthz;
             catena::common::Authorizer* authz;
             if (context_.authorizationEnabled()) {
-                sharedAuthz = std::make_shared<catena::common::Authorizer>(context_.jwsToken());
+                sharedAuthz = catena::common::AuthorizerCache::instance().get(context_.jwsToken());
                 authz = sharedAuthz.get();
             } else {
                 authz = &catena::common::Authorizer::kAuthzDisabled;
@@ -1,13 +1,15 @@
 
 // connections/REST
 #include <controllers/GetParam.h>
+#include <AuthorizerCache.h>
+#include <ParamLock.h>
 using catena::REST::GetParam;
 
 // Initializes the object counter for GetParam to 0.
 int GetParam::objectCounter_ = 0;
 
 GetParam::GetParam(tcp::socket& socket, ISocketReader& context, SlotMap& dms) :
-    socket_{socket}, writer_{socket, context.origin()}, context_{context}, dms_{dms} {
+    socket_{socket}, writer_{socket, context.origin(), false, context.keepAlive()}, context_{context}, dms_{dms} {
     objectId_ = objectCounter_++;
     writeConsole_(CallStatus::kCreate, socket_.is_open());
 }
@@ -39,13 +41,13 @@ void GetParam::proceed() {
             std::shared_ptr<catena::common::Authorizer> sharedAuthz;
             catena::common::Authorizer* authz;
             if (context_.authorizationEnabled()) {
-                sharedAuthz = std::make_shared<catena::common::Authorizer>(context_.jwsToken());
+                sharedAuthz = catena::common::AuthorizerCache::instance().get(context_.jwsToken());
                 authz = sharedAuthz.get();
             } else {
                 authz = &catena::common::Authorizer::kAuthzDisabled;
             }
             // Locking device and getting the param.
-            std::lock_guard lg(dm->mutex());
+            catena::common::ParamReadLock lock(*dm, context_.fqoid());
             std::unique_ptr<IParam> param = dm->getParam(context_.fqoid(), rc, *authz);
             if (rc.status == catena::StatusCode::OK && param) {
                 ans.set_oid(param->getOid());
@@ -7,7 +7,7 @@ using catena::REST::GetPopulatedSlots;
 int GetPopulatedSlots::objectCounter_ = 0;
 
 GetPopulatedSlots::GetPopulatedSlots(tcp::socket& socket, ISocketReader& context, SlotMap& dms) :
-    socket_{socket}, writer_{socket, context.origin()}, context_{context}, dms_{dms} {
+    socket_{socket}, writer_{socket, context.origin(), false, context.keepAlive()}, context_{context}, dms_{dms} {
     objectId_ = objectCounter_++;
     writeConsole_(CallStatus::kCreate, socket_.is_open());
 }
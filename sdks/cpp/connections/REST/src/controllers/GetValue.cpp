@@ -1,20 +1,23 @@
 
 // connections/REST
 #include <controllers/GetValue.h>
+#include <AuthorizerCache.h>
+#include <ParamLock.h>
 using catena::REST::GetValue;
 
 // Initializes the object counter for GetValue to 0.
 int GetValue::objectCounter_ = 0;
 
 GetValue::GetValue(tcp::socket& socket, ISocketReader& context, SlotMap& dms) :
-    socket_{socket}, writer_{socket, context.origin()}, context_{context}, dms_{dms} {
+    socket_{socket}, writer_{socket, context.origin(), false, context.keepAlive()}, context_{context}, dms_{dms} {
     objectId_ = objectCounter_++;
     writeConsole_(CallStatus::kCreate, socket_.is_open());
 }
 
 void GetValue::proceed() {
     writeConsole_(CallStatus::kProcess, socket_.is_open());
-    st2138::Value ans;
+    // The value is written straight to JSON rather than through st2138::Value
+    std::string ans;
     catena::exception_with_status rc("", catena::StatusCode::OK);
     try {
         IDevice* dm = nullptr;
@@ -34,10 +37,12 @@ void GetValue::proceed() {
 
         // Getting value at oid from device.
         } else if (context_.authorizationEnabled()) {
-            catena::common::Authorizer authz(context_.jwsToken());
-            rc = dm->getValue(context_.fqoid(), ans, authz);
+            std::shared_ptr<catena::common::Authorizer> authz = catena::common::AuthorizerCache::instance().get(context_.jwsToken());
+            catena::common::ParamReadLock lock(*dm, context_.fqoid());
+            rc = dm->getValueJson(context_.fqoid(), ans, *authz);
         } else {
-            rc = dm->getValue(context_.fqoid(), ans, catena::common::Authorizer::kAuthzDisabled);
+            catena::common::ParamReadLock lock(*dm, context_.fqoid());
+            rc = dm->getValueJson(context_.fqoid(), ans, catena::common::Authorizer::kAuthzDisabled);
         }
 
     // ERROR
@@ -50,7 +55,7 @@ void GetValue::proceed() {
     }
 
     // Finishing by writing answer to client.
-    writer_.sendResponse(rc, ans);
+    writer_.sendJson(rc, ans);
 
     // Writing the final status to the console.
     writeConsole_(CallStatus::kFinish, socket_.is_open());
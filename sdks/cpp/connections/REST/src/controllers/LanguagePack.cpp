@@ -1,13 +1,14 @@
 
 // connections/REST
 #include <controllers/LanguagePack.h>
+#include <AuthorizerCache.h>
 using catena::REST::LanguagePack;
 
 // Initializes the object counter for LanguagePack to 0.
 int LanguagePack::objectCounter_ = 0;
 
 LanguagePack::LanguagePack(tcp::socket& socket, ISocketReader& context, SlotMap& dms) :
-    socket_{socket}, writer_{socket, context.origin()}, context_{context}, dms_{dms} {
+    socket_{socket}, writer_{socket, context.origin(), false, context.keepAlive()}, context_{context}, dms_{dms} {
     objectId_ = objectCounter_++;
     writeConsole_(CallStatus::kCreate, socket_.is_open());
 }
@@ -37,7 +38,7 @@ void LanguagePack::proceed() {
         // Authz required for all methods except GET.
         if (context_.method() != Method_GET && context_.authorizationEnabled()) {
             // Authorizer throws an error if invalid jws token so no need to handle rc.
-            sharedAuthz = std::make_shared<catena::common::Authorizer>(context_.jwsToken());
+            sharedAuthz = catena::common::AuthorizerCache::instance().get(context_.jwsToken());
             authz = sharedAuthz.get();
         } else {
             authz = &catena::common::Authorizer::kAuthzDisabled;
@@ -49,7 +50,7 @@ void LanguagePack::proceed() {
 
         // GET/language-pack
         } else if (context_.method() == Method_GET) {
-            std::lock_guard lg(dm->mutex());
+            std::shared_lock lg(dm->mutex());
             rc = dm->getLanguagePack(languageId, ans);
 
         // POST/language-pack and PUT/language-pack
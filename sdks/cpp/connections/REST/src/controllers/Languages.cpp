@@ -7,7 +7,7 @@ using catena::REST::Languages;
 int Languages::objectCounter_ = 0;
 
 Languages::Languages(tcp::socket& socket, ISocketReader& context, SlotMap& dms) :
-    socket_{socket}, writer_{socket, context.origin()}, context_{context}, dms_{dms} {
+    socket_{socket}, writer_{socket, context.origin(), false, context.keepAlive()}, context_{context}, dms_{dms} {
     objectId_ = objectCounter_++;
     writeConsole_(CallStatus::kCreate, socket_.is_open());
 }
@@ -36,7 +36,7 @@ void Languages::proceed() {
 
         // GET/languages
         } else if (context_.method() == Method_GET) {
-            std::lock_guard lg(dm->mutex());
+            std::shared_lock lg(dm->mutex());
             dm->toProto(ans);
             if (ans.languages().empty()) {
                 rc = catena::exception_with_status("No languages found", catena::StatusCode::NOT_FOUND);
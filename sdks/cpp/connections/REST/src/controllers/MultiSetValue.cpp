@@ -1,6 +1,8 @@
 
 // connections/REST
 #include <controllers/MultiSetValue.h>
+#include <AuthorizerCache.h>
+#include <ParamLock.h>
 using catena::REST::MultiSetValue;
 
 // Initializes the object counter for MultiSetValue to 0.
@@ -13,12 +15,13 @@ MultiSetValue::MultiSetValue(tcp::socket& socket, ISocketReader& context, SlotMa
 }
 
 MultiSetValue::MultiSetValue(tcp::socket& socket, ISocketReader& context, SlotMap& dms, int objectId) :
-    socket_{socket}, writer_{socket, context.origin()}, context_{context}, dms_{dms}, objectId_{objectId} {}
+    socket_{socket}, writer_{socket, context.origin(), false, context.keepAlive()}, context_{context}, dms_{dms},
+    arena_{catena::common::ArenaPool::instance().acquire()}, reqs_{*arena_.create<st2138::MultiSetValuePayload>()}, objectId_{objectId} {}
 
 bool MultiSetValue::toMulti_() {
-    absl::Status status = google::protobuf::util::JsonStringToMessage(absl::string_view(context_.jsonBody()), &reqs_);
+    bool ok = catena::common::parseJson(context_.jsonBody(), reqs_);
     reqs_.set_slot(context_.slot());
-    return status.ok();
+    return ok;
 }
 
 void MultiSetValue::proceed() {
@@ -47,20 +50,19 @@ void MultiSetValue::proceed() {
             std::shared_ptr<catena::common::Authorizer> sharedAuthz;
             catena::common::Authorizer* authz;
             if (context_.authorizationEnabled()) {
-                sharedAuthz = std::make_shared<catena::common::Authorizer>(context_.jwsToken());
+                sharedAuthz = catena::common::AuthorizerCache::instance().get(context_.jwsToken());
                 authz = sharedAuthz.get();
             } else {
                 authz = &catena::common::Authorizer::kAuthzDisabled;
             }
-            // Trying and commiting the multiSetValue.
+            // Validating and commiting the multiSetValue.
             {
-            std::lock_guard lg(dm->mutex());
-            if (dm->tryMultiSetValue(reqs_, rc, *authz)) {
-                rc = dm->commitMultiSetValue(reqs_, *authz);
-            } else { // debug log (new)
-                LOG(ERROR) << "MultiSetValue: tryMultiSetValue failed for slot " << reqs_.slot()
-                        << " status=" << static_cast<int>(rc.status)
-                        << " msg=\"" << rc.what() << "\"";
+            catena::common::ParamWriteLock lock(*dm, reqs_);
+            rc = dm->multiSetValue(reqs_, *authz);
+            if (rc.status != catena::StatusCode::OK) {
+                LOG(ERROR) << "MultiSetValue: multiSetValue failed for slot " << reqs_.slot()
+                          << " status=" << static_cast<int>(rc.status)
+                          << " msg=\"" << rc.what() << "\"";
             }
             }
         } else {
@@ -30,6 +30,7 @@
 
 // connections/REST
 #include <controllers/ParamInfoRequest.h>
+#include <AuthorizerCache.h>
 using catena::REST::ParamInfoRequest;
 
 // Initializes the object counter for ParamInfoRequest to 0.
@@ -43,7 +44,7 @@ ParamInfoRequest::ParamInfoRequest(tcp::socket& socket, ISocketReader& context,
         writer_ = std::make_unique<SSEWriter>(socket_, context_.origin());
     // Unary response
     } else {
-        writer_ = std::make_unique<SocketWriter>(socket_, context_.origin());
+        writer_ = std::make_unique<SocketWriter>(socket_, context_.origin(), false, context_.keepAlive());
     }
 
     
@@ -54,11 +55,11 @@ ParamInfoRequest::ParamInfoRequest(tcp::socket& socket, ISocketReader& context,
 void ParamInfoRequest::proceed() {
     writeConsole_(CallStatus::kProcess, socket_.is_open());
 
+    std::shared_ptr<Authorizer> sharedAuthz;
+    Authorizer* authz;
+    IDevice* dm = nullptr;
+    std::unique_ptr<ParamInfoSerializer> serializer;
     try {
-        std::unique_ptr<IParam> param;
-        std::shared_ptr<Authorizer> sharedAuthz;
-        Authorizer* authz;
-        IDevice* dm = nullptr;
         // Get recursive from query parameters - presence alone means true
         recursive_ = context_.hasField("recursive");
         // Validating slot number.
@@ -83,102 +84,41 @@ void ParamInfoRequest::proceed() {
 
             // Handle authorization setup
             if (context_.authorizationEnabled()) {
-                sharedAuthz = std::make_shared<Authorizer>(context_.jwsToken());
+                sharedAuthz = catena::common::AuthorizerCache::instance().get(context_.jwsToken());
                 authz = sharedAuthz.get();
             } else {
                 authz = &Authorizer::kAuthzDisabled;
             }
 
-            // Mode 1: Get all top-level parameters without recursion
-            if (context_.fqoid().empty() && !recursive_) {
-                std::vector<std::unique_ptr<IParam>> top_level_params;
-                {
-                    std::lock_guard lg(dm->mutex());
-                    top_level_params = dm->getTopLevelParams(rc_, *authz);
-                }
-                    
-                // Process each top-level parameter
-                if (rc_.status == catena::StatusCode::OK)  {
-                    if (top_level_params.empty()) {
-                        rc_ = catena::exception_with_status("No top-level parameters found", catena::StatusCode::NOT_FOUND);
-                    } else {
-                        std::lock_guard lg(dm->mutex());
-                        responses_.clear();
-                        for (auto& top_level_param : top_level_params) {
-                            // Add the parameter to our response list
-                            addParamToResponses_(top_level_param.get(), *authz);
-                            // For array types, calculate and update array length
-                            if (top_level_param->isArrayType()) {
-                                uint32_t array_length = top_level_param->size();
-                                if (array_length > 0) {
-                                    updateArrayLengths_(top_level_param->getOid(), array_length);
-                                }
-                            }
-                        }
-                    }
-                }
-            }
-            // Mode 2: Get all top-level parameters with recursion
-            else if (context_.fqoid().empty() && recursive_) {
-                std::vector<std::unique_ptr<IParam>> top_level_params;
-                {
-                    std::lock_guard lg(dm->mutex());
-                    top_level_params = dm->getTopLevelParams(rc_, *authz);
-                }
-                if (rc_.status == catena::StatusCode::OK) {
-                    if (top_level_params.empty()) {
-                        rc_ = catena::exception_with_status("No top-level parameters found", catena::StatusCode::NOT_FOUND);
-                    } else {
-                        std::lock_guard lg(dm->mutex());
-                        responses_.clear();
-                        // Process each top-level parameter recursively
-                        for (auto& top_level_param : top_level_params) {
-                            // Add the parameter to our response list
-                            addParamToResponses_(top_level_param.get(), *authz);
-                            // For array types, calculate and update array length
-                            if (top_level_param->isArrayType()) {
-                                uint32_t array_length = top_level_param->size();
-                                if (array_length > 0) {
-                                    updateArrayLengths_(top_level_param->getOid(), array_length);
-                                }
-                            }
-                            // Recursively traverse all children of the top-level parameter
-                            ParamInfoVisitor visitor(*dm, *authz, responses_, *this);
-                            ParamVisitor::traverseParams(top_level_param.get(), "/" + top_level_param->getOid(), *dm, visitor, *authz);
-                        }
-                    }
+            // Only the roots' oids are kept, the serializer resolves them
+            // again whenever it resumes
+            std::vector<std::string> oids;
+            std::shared_lock lg(dm->mutex());
+            // Mode 1 and 2: Get all top-level parameters, recursively if requested
+            if (context_.fqoid().empty()) {
+                auto params = dm->getTopLevelParams(rc_, *authz);
+                if (rc_.status == catena::StatusCode::OK && params.empty()) {
+                    rc_ = catena::exception_with_status("No top-level parameters found", catena::StatusCode::NOT_FOUND);
                 }
-            }
-            // Mode 3: Get a specific parameter and its children
-            else if (!context_.fqoid().empty()) { 
-                {
-                    std::lock_guard lg(dm->mutex());
-                    param = dm->getParam(context_.fqoid(), rc_, *authz);
+                for (auto& param : params) {
+                    oids.push_back("/" + param->getOid());
                 }
-
+            // Mode 3: Get a specific parameter and, if requested, its children
+            } else {
+                std::shared_lock pl(dm->paramMutex(context_.fqoid()));
+                auto param = dm->getParam(context_.fqoid(), rc_, *authz);
                 if (rc_.status == catena::StatusCode::OK) {
                     if (!param) {
                         rc_ = catena::exception_with_status("Parameter not found: " + context_.fqoid(), catena::StatusCode::NOT_FOUND);
                     } else {
-                        responses_.clear();
-                        // Add the main parameter first 
-                        responses_.emplace_back();
-                        param->toProto(responses_.back(), *authz);
-                        // If the parameter is an array, update the array length
-                        if (param->isArrayType()) {
-                            uint32_t array_length = param->size();
-                            if (array_length > 0) {
-                                updateArrayLengths_(param->getOid(), array_length);
-                            }
-                        }
-                        // If recursive is true, collect all parameter info recursively through visitor pattern
-                        if (recursive_) {
-                            ParamInfoVisitor visitor(*dm, *authz, responses_, *this);
-                            ParamVisitor::traverseParams(param.get(), context_.fqoid(), *dm, visitor, *authz);
-                        }
+                        oids.push_back(context_.fqoid());
                     }
                 }
             }
+            // Responses are built as they are written
+            if (rc_.status == catena::StatusCode::OK) {
+                serializer = std::make_unique<ParamInfoSerializer>(ParamInfoSerializer::serialize(*dm, std::move(oids), recursive_, *authz));
+            }
         }
     } catch (const catena::exception_with_status& err) {
         rc_ = catena::exception_with_status(err.what(), err.status);
@@ -189,18 +129,46 @@ void ParamInfoRequest::proceed() {
     }
 
     if (context_.stream()) {
-        // Writing responses to the client.
-        if (rc_.status == catena::StatusCode::OK && !responses_.empty()) {
-            for (auto& response : responses_) {
-                writer_->sendResponse(rc_, response);
+        // Writing responses to the client as they are built.
+        try {
+            while (serializer && serializer->hasMore()) {
+                // Owned by the serializer, valid until the next getNext
+                const st2138::ParamInfoResponse* response = nullptr;
+                {
+                    std::shared_lock lg(dm->mutex());
+                    response = &serializer->getNext();
+                }
+                writer_->sendResponse(rc_, *response);
             }
+        } catch (const catena::exception_with_status& err) {
+            rc_ = catena::exception_with_status(err.what(), err.status);
+        } catch (const std::exception& e) {
+            rc_ = catena::exception_with_status(std::string("Unknown error in ParamInfoRequest: ") + e.what(), catena::StatusCode::INTERNAL);
+        } catch (...) {
+            rc_ = catena::exception_with_status("Unknown error in ParamInfoRequest", catena::StatusCode::UNKNOWN);
         }
         // Required to send errors.
         writer_->sendResponse(rc_);
-    } else if (responses_.size() == 1) {
-        writer_->sendResponse(rc_, responses_[0]);
     } else {
-        writer_->sendResponse(rc_);
+        // Unary requests are never recursive, so there is only one response.
+        const st2138::ParamInfoResponse* response = &st2138::ParamInfoResponse::default_instance();
+        try {
+            if (serializer && serializer->hasMore()) {
+                std::shared_lock lg(dm->mutex());
+                response = &serializer->getNext();
+            }
+        } catch (const catena::exception_with_status& err) {
+            rc_ = catena::exception_with_status(err.what(), err.status);
+        } catch (const std::exception& e) {
+            rc_ = catena::exception_with_status(std::string("Unknown error in ParamInfoRequest: ") + e.what(), catena::StatusCode::INTERNAL);
+        } catch (...) {
+            rc_ = catena::exception_with_status("Unknown error in ParamInfoRequest", catena::StatusCode::UNKNOWN);
+        }
+        if (rc_.status == catena::StatusCode::OK && serializer) {
+            writer_->sendResponse(rc_, *response);
+        } else {
+            writer_->sendResponse(rc_);
+        }
     }
     
     // Writing the final status to the console.
@@ -208,51 +176,3 @@ void ParamInfoRequest::proceed() {
     LOG(INFO) << RESTMethodMap().getForwardMap().at(context_.method())
             << "ParamInfoRequest[" << objectId_ << "] finished\n";
 }
-
-// Helper method to add a parameter to the responses
-void ParamInfoRequest::addParamToResponses_(IParam* param, catena::common::Authorizer& authz) {
-    responses_.emplace_back();
-    auto& response = responses_.back();
-    response.mutable_info();
-    param->toProto(response, authz);
-}
-
-// Updates the array_length field in the protobuf responses
-void ParamInfoRequest::updateArrayLengths_(const std::string& array_name, uint32_t length) {
-    if (length > 0) {
-        for (auto it = responses_.rbegin(); it != responses_.rend(); ++it) {
-            // Only update if the OID exactly matches the array name
-            if (it->info().oid() == array_name) {
-                it->set_array_length(length);
-            }
-        }
-    }
-}
-
-// Visits a parameter and adds it to the response vector
-void ParamInfoRequest::ParamInfoVisitor::visit(IParam* param, const std::string& path) {
-    // Only add non-array parameters that aren't the top-most parameter
-    bool isTopParameter = path == request_.context_.fqoid() || path == "/" + param->getOid();
-    bool isArray = param->isArrayType();
-    if (isTopParameter || isArray) {
-        return;
-    }
-
-    request_.addParamToResponses_(param, authz_);
-}
-
-// Visits an array and updates the array length information
-void ParamInfoRequest::ParamInfoVisitor::visitArray(IParam* param, const std::string& path, uint32_t length) {
-    // Only add array parameters that aren't the top-most parameter
-    bool isTopParameter = path == request_.context_.fqoid() || path == "/" + param->getOid();
-    if (isTopParameter) {
-        return;
-    }
-
-    request_.addParamToResponses_(param, authz_);
-
-    // Update array length information
-    if (length > 0) {
-        request_.updateArrayLengths_(param->getOid(), length);
-    }
-} 
@@ -14,7 +14,7 @@ SetValue::SetValue(tcp::socket& socket, ISocketReader& context, SlotMap& dms) :
 bool SetValue::toMulti_() {
     auto value = reqs_.add_values();
     reqs_.set_slot(context_.slot());
-    absl::Status status = google::protobuf::util::JsonStringToMessage(absl::string_view(context_.jsonBody()), value->mutable_value());
+    bool ok = catena::common::parseJson(context_.jsonBody(), *value->mutable_value());
     value->set_oid(context_.fqoid());
-    return status.ok();
+    return ok;
 }
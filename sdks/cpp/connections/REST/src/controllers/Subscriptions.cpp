@@ -30,6 +30,8 @@
 
 // connections/REST
 #include <controllers/Subscriptions.h>
+#include <AuthorizerCache.h>
+#include <ParamLock.h>
 using catena::REST::Subscriptions;
 
 // Initializes the object counter for Subscriptions to 0.
@@ -43,7 +45,7 @@ Subscriptions::Subscriptions(tcp::socket& socket, ISocketReader& context, SlotMa
         writer_ = std::make_unique<SSEWriter>(socket_, context_.origin());
     // GET (no stream) or PUT
     } else {
-        writer_ = std::make_unique<SocketWriter>(socket_, context_.origin(), true);
+        writer_ = std::make_unique<SocketWriter>(socket_, context_.origin(), true, context_.keepAlive());
     }
 
     objectId_ = objectCounter_++;
@@ -80,24 +82,29 @@ void Subscriptions::proceed() {
             catena::common::Authorizer* authz = nullptr;
             std::shared_ptr<catena::common::Authorizer> sharedAuthz;
             if (context_.authorizationEnabled()) {
-                sharedAuthz = std::make_shared<catena::common::Authorizer>(context_.jwsToken());
+                sharedAuthz = catena::common::AuthorizerCache::instance().get(context_.jwsToken());
                 authz = sharedAuthz.get();
             } else {
                 authz = &catena::common::Authorizer::kAuthzDisabled;
             }
+            // Subscriptions are scoped to the Connect the client names.
+            std::string scope = catena::common::ISubscriptionManager::scopeKey(authz->subject(), context_.connectionId());
 
             // GET/subscriptions - Get and write all subscribed OIDs.
             if (context_.method() == Method_GET) {
-                auto subbedOids = context_.subscriptionManager().getAllSubscribedOids(*dm);
+                auto subbedOids = context_.subscriptionManager().getAllSubscribedOids(*dm, scope);
                 for (auto oid : subbedOids) {
                     supressErr = catena::exception_with_status{"", catena::StatusCode::OK};
                     st2138::DeviceComponent_ComponentParam res;
+                    {
+                    catena::common::ParamReadLock lock(*dm, oid);
                     auto param = dm->getParam(oid, supressErr, *authz);
                     // Converting to proto.
                     if (param) {
                         res.set_oid(param->getOid());
                         supressErr = param->toProto(*res.mutable_param(), *authz);
                     }
+                    }
                     // Writing if successful.
                     if (supressErr.status == catena::StatusCode::OK) {
                         writeConsole_(CallStatus::kWrite, socket_.is_open());
@@ -115,11 +122,18 @@ void Subscriptions::proceed() {
                 } else {
                     // Process added OIDs
                     for (const auto& oid : req.added_oids()) {
-                        context_.subscriptionManager().addSubscription(oid, *dm, supressErr, *authz);
+                        context_.subscriptionManager().addSubscription(oid, *dm, supressErr, *authz, scope);
+                        // Only errors for single OIDs are supressed.
+                        if (supressErr.status == catena::StatusCode::FAILED_PRECONDITION) {
+                            throw catena::exception_with_status(supressErr.what(), supressErr.status);
+                        }
                     }
                     // Process removed OIDs
                     for (const auto& oid : req.removed_oids()) {
-                        context_.subscriptionManager().removeSubscription(oid, *dm, supressErr);
+                        context_.subscriptionManager().removeSubscription(oid, *dm, supressErr, scope);
+                        if (supressErr.status == catena::StatusCode::FAILED_PRECONDITION) {
+                            throw catena::exception_with_status(supressErr.what(), supressErr.status);
+                        }
                     }
                 }
                 
@@ -46,6 +46,7 @@
 // common
 #include <rpc/TimeNow.h>
 #include <Authorizer.h>
+#include <ISubscriptionManager.h>
 #include <utils.h>
 
 // gRPC
@@ -71,6 +72,12 @@ enum class CallStatus { kCreate, kProcess, kRead, kWrite, kPostWrite, kFinish };
 const long DEFAULT_REQUEST_START = 0;
 const long DEFAULT_REQUEST_RECEIVED = 0;
 
+/**
+ * @brief The metadata key Connect sends its connection id under, and which
+ * clients send it back under to name the connection's subscriptions.
+ */
+const std::string kConnectionIdKey = "catena-connection-id";
+
 /**
  * @brief Abstract base class for inherited by CallData child classes defining
  * the jwsToken_() method.
@@ -125,6 +132,25 @@ class CallData : public ICallData {
         return jwsToken;
     }
     
+    /**
+     * @brief Returns the key of the subscription scope the client names.
+     *
+     * Clients name the Connect whose subscriptions they want by sending back
+     * the kConnectionIdKey metadata it sent them. Requests which do not name
+     * one get a scope no connection has open, or the shared scope if the
+     * client's token has no subject.
+     *
+     * @param authz The client's authorizer.
+     */
+    std::string namedSubscriptionScope_(const catena::common::Authorizer& authz) const {
+        std::string connectionId;
+        auto kv = context_.client_metadata().find(kConnectionIdKey);
+        if (kv != context_.client_metadata().end()) {
+            connectionId.assign(kv->second.data(), kv->second.size());
+        }
+        return catena::common::ISubscriptionManager::scopeKey(authz.subject(), connectionId);
+    }
+
     /**
      * @brief Reads requestStart from metadata and records current time for requestReceived.
      */
@@ -110,6 +110,7 @@ class ServiceConfig {
       this->EOPath = config::static_root;
       this->maxConnections = config::max_connections;
       this->authz = config::authz;
+      this->threads = config::grpc_threads;
     }
     /**
      * @brief Sets the completion queue.
@@ -160,6 +161,15 @@ class ServiceConfig {
       this->maxConnections = maxConnections;
       return *this;
     }
+    /**
+     * @brief Sets the number of threads processing events.
+     * @param threads The number of threads processing events. 0 uses one
+     * per hardware thread.
+     */
+    ServiceConfig& set_threads(uint32_t threads) {
+      this->threads = threads;
+      return *this;
+    }
     /**
      * @brief The completion queue for the server.
      */
@@ -180,6 +190,11 @@ class ServiceConfig {
      * @brief The maximum number of connections allowed to the service.
      */
     uint32_t maxConnections = DEFAULT_MAX_CONNECTIONS;
+    /**
+     * @brief The number of threads processing events. 0 uses one per
+     * hardware thread.
+     */
+    uint32_t threads = 0;
 };
 
 /**
@@ -198,9 +213,19 @@ class ServiceImpl : public IServiceImpl {
      */
     void init() override;
     /**
-     * @brief Processes events in the server's completion queue.
+     * @brief Processes events in the server's completion queue on a fixed
+     * pool of threads, returning once the queue has shut down and all
+     * CallData objects have been deregistered.
+     *
+     * Each thread runs the handlers of the events it takes inline, so
+     * handlers must not block. Work which may, such as commands, runs on the
+     * CommandExecutor instead.
      */
     void processEvents() override;
+    /**
+     * @brief Returns the number of threads processing events.
+     */
+    uint32_t threads() const { return threads_; }
     /**
      * @brief Not implemented
      */
@@ -242,6 +267,11 @@ class ServiceImpl : public IServiceImpl {
     void deregisterItem(ICallData *cd) override;
 
   private:
+    /**
+     * @brief The body of each event processing thread.
+     */
+    void pollEvents_();
+
     // Aliases for special vectors and unique_ptrs.
     using Registry = std::vector<std::unique_ptr<ICallData>>;
     using RegistryItem = std::unique_ptr<ICallData>;
@@ -257,6 +287,10 @@ class ServiceImpl : public IServiceImpl {
      * @brief The completion queue for the server for event processing
      */
     ServerCompletionQueue* cq_; 
+    /**
+     * @brief The number of threads processing events.
+     */
+    uint32_t threads_;
     /**
      * @brief A map of slots to ptrs to their corresponding device.
      * 
@@ -47,6 +47,9 @@
 #include <rpc/Connect.h>
 #include <ILanguagePack.h>
 
+// gRPC
+#include <grpcpp/alarm.h>
+
 namespace catena {
 namespace gRPC {
 
@@ -59,6 +62,12 @@ namespace gRPC {
  *
  * Whether or not a PushUpdate is written to the client also depends on their
  * specified DetailLevel.
+ *
+ * No thread waits on the connection between updates. Once the queue is empty
+ * the writer parks, and the next queued update sets an alarm which brings it
+ * back through the completion queue. Updates queued meanwhile are written one
+ * per write completion, buffered so that a batch goes out in as few frames as
+ * gRPC allows.
  */
 class Connect : public CallData, public catena::common::Connect {
   public:
@@ -86,6 +95,37 @@ class Connect : public CallData, public catena::common::Connect {
     bool isCancelled() override;
 
   private:
+    /**
+     * @brief Completion queue tag for the wake alarm.
+     *
+     * Kept apart from the Connect's own tag so the alarm coming back can be
+     * told apart from write completions.
+     */
+    class WakeTag : public ICallData {
+      public:
+        explicit WakeTag(Connect& connect) : connect_{connect} {}
+        void proceed(bool ok) override { connect_.onWake_(ok); }
+
+      protected:
+        std::string jwsToken_() const override { return ""; }
+        void processTimestamps_() override {}
+
+      private:
+        Connect& connect_;
+    };
+
+    /**
+     * @brief Sets the wake alarm if the writer is parked waiting for updates.
+     *
+     * Must be called with mtx_ held.
+     */
+    void wakeWriter_() override;
+    /**
+     * @brief Called when the wake alarm fires or is cancelled.
+     * @param ok False if the alarm was cancelled.
+     */
+    void onWake_(bool ok);
+
     /**
      * @brief The client's request containing two things:
      * 
@@ -101,27 +141,44 @@ class Connect : public CallData, public catena::common::Connect {
      * @brief The RPC's state (kCreate, kProcess, kFinish, etc.).
      */
     CallStatus status_;
-
     /**
-     * @brief The total # of Connect objects.
+     * @brief The batch of updates currently being written to the client.
+     *
+     * Kept as a member since each update must outlive its async Write.
      */
-    static int objectCounter_;
-
+    std::vector<catena::common::SharedUpdatePtr> batch_;
+    /**
+     * @brief Index of the next update in batch_ to write.
+     */
+    size_t batchPos_ = 0;
+    /**
+     * @brief Alarm used to schedule the writer once updates are queued.
+     */
+    grpc::Alarm alarm_;
     /**
-     * @brief A list of ids for the operations waiting for valueSetByClient to
-     * be emitted.
+     * @brief The tag the alarm is set with.
      */
-    SignalMap valueSetByClientIds_;
+    WakeTag wakeTag_{*this};
     /**
-     * @brief A list of ids for the operations waiting for valueSetByServer to
-     * be emitted.
+     * @brief True while the writer has nothing to write and no write or
+     * alarm is pending. Guarded by mtx_.
      */
-    SignalMap valueSetByServerIds_;
+    bool parked_ = false;
     /**
-     * @brief A list of ids for the operations waiting for
-     * languageAddedPushUpdate to be emitted.
+     * @brief True from setting the alarm until it comes back. The Connect
+     * cannot be deleted in between. Guarded by mtx_.
      */
-    SignalMap languageAddedIds_;
+    bool alarmSet_ = false;
+    /**
+     * @brief True once the Connect has been cleaned up. Guarded by mtx_.
+     */
+    bool finished_ = false;
+
+    /**
+     * @brief The total # of Connect objects.
+     */
+    static int objectCounter_;
+
 
     /**
      * @brief Signal emitted in cases which require all open connections to be
@@ -125,7 +125,7 @@ class DeviceRequest : public CallData {
      * @brief The set of subscribed OIDs for use if the detail level is set to
      * SUBSCRIPTIONS.
      */
-    std::set<std::string> subscribedOids_;
+    catena::common::SubscribedOids subscribedOids_;
     /**
      * @brief The object's unique id.
      */
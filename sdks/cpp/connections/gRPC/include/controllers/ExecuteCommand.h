@@ -43,6 +43,12 @@
 // connections/gRPC
 #include "CallData.h"
 
+// gRPC
+#include <grpcpp/alarm.h>
+
+// std
+#include <mutex>
+
 namespace catena {
 namespace gRPC {
 
@@ -51,6 +57,11 @@ namespace gRPC {
  *
  * This RPC gets a slot and a command OID from the client and executes the
  * specified command on the specifed device.
+ *
+ * Commands may block, so the command and each of its responses run on the
+ * CommandExecutor rather than the threads processing gRPC events. Once a
+ * response is ready an alarm brings the RPC back through the completion
+ * queue to write it.
  */
 class ExecuteCommand : public CallData {
   public:
@@ -74,6 +85,44 @@ class ExecuteCommand : public CallData {
     void proceed(bool ok) override;
 
   private:
+    /**
+     * @brief Completion queue tag for the response alarm.
+     *
+     * Kept apart from the ExecuteCommand's own tag so the alarm coming back
+     * can be told apart from write completions.
+     */
+    class ResponseTag : public ICallData {
+      public:
+        explicit ResponseTag(ExecuteCommand& call) : call_{call} {}
+        void proceed(bool ok) override { call_.onResponse_(ok); }
+
+      protected:
+        std::string jwsToken_() const override { return ""; }
+        void processTimestamps_() override {}
+
+      private:
+        ExecuteCommand& call_;
+    };
+
+    /**
+     * @brief Runs the command if not yet run and gets its next response on
+     * the CommandExecutor, setting the alarm once done.
+     *
+     * Must be called with mtx_ held.
+     */
+    void fetchResponse_();
+    /**
+     * @brief Gets the command's next response into res_ and rc_. Runs on
+     * the CommandExecutor.
+     */
+    void getResponse_();
+    /**
+     * @brief Called when the response alarm fires. Writes the response or
+     * finishes the RPC.
+     * @param ok False if the alarm was cancelled.
+     */
+    void onResponse_(bool ok);
+
     /**
      * @brief The client's request containing four things:
      * 
@@ -91,11 +140,48 @@ class ExecuteCommand : public CallData {
      * @brief The RPC response writer for writing back to the client. 
      */
     ServerAsyncWriter<st2138::CommandResponse> writer_;
+    /**
+     * @brief The command to execute, held until it is run on the
+     * CommandExecutor.
+     */
+    std::unique_ptr<IParam> command_;
     /**
      * @brief The command's response coroutine recieved from a call to
      * Command.executeCommand().
      */
     std::unique_ptr<IParamDescriptor::ICommandResponder> responder_;
+    /**
+     * @brief The response being written to the client.
+     *
+     * Kept as a member since it must outlive its async Write.
+     */
+    st2138::CommandResponse res_;
+    /**
+     * @brief The status of the last fetched response.
+     */
+    catena::exception_with_status rc_{"", catena::StatusCode::OK};
+    /**
+     * @brief True if the command has responses after res_.
+     */
+    bool hasMore_ = false;
+    /**
+     * @brief Alarm used to resume the RPC once a response is ready.
+     */
+    grpc::Alarm alarm_;
+    /**
+     * @brief The tag the alarm is set with.
+     */
+    ResponseTag responseTag_{*this};
+    /**
+     * @brief True from posting a fetch until its alarm comes back. The
+     * ExecuteCommand cannot be deleted in between. Guarded by mtx_.
+     */
+    bool fetching_ = false;
+    /**
+     * @brief Guards status_ and fetching_ against the alarm and completion
+     * queue events arriving on different threads.
+     */
+    std::mutex mtx_;
     /**
      * @brief The RPC's state (kCreate, kProcess, kFinish, etc.)
      */
@@ -45,6 +45,9 @@
 // connections/gRPC
 #include "CallData.h"
 
+// common
+#include <rpc/ArenaPool.h>
+
 namespace catena {
 namespace gRPC {
 
@@ -115,14 +118,21 @@ class MultiSetValue : public CallData {
      * @brief Name of childclass to specify RPC in console notifications.
      */
     std::string typeName;
+    /**
+     * @brief The arena the request is read into, held for the life of the
+     * call.
+     */
+    catena::common::ArenaPool::Lease arena_;
     /**
      * @brief The client's request containing two things:
      * 
      * - The slot specifying the device containing the parameters to update.
      * 
      * - Any number of oid, value pairs specifying the parameters to update.
+     *
+     * Owned by arena_.
      */
-    st2138::MultiSetValuePayload reqs_;
+    st2138::MultiSetValuePayload& reqs_;
     /**
      * @brief The RPC response writer for writing back to the client.
      */
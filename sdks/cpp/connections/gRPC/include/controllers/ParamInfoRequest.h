@@ -42,14 +42,13 @@
 #include "CallData.h"
 
 // common
-#include <ParamVisitor.h>
+#include <rpc/ParamInfoSerializer.h>
 
 // type aliases
 using catena::common::Path;
-using catena::common::ParamVisitor;
 using catena::common::IParam;
 using catena::common::Authorizer;
-using catena::common::IParamVisitor;
+using catena::common::ParamInfoSerializer;
 using catena::common::timeNow;
 
 namespace catena {
@@ -83,22 +82,7 @@ class ParamInfoRequest : public CallData {
      */
     void proceed(bool ok) override;
 
-    /**
-     * @brief Helper method to add a parameter to the responses
-     * @param param The parameter to add
-     * @param authz The authorization object
-     */
-    void addParamToResponses(IParam* param, catena::common::Authorizer& authz);
-
   private:
-    /**
-     * @brief Updates the array lengths of the responses.
-     * 
-     * @param array_name - The name of the array.
-     * @param length - The length of the array.
-     */
-    void updateArrayLengths_(const std::string& array_name, uint32_t length);
-
     /**
      * @brief The client's request containing three things:
      * 
@@ -141,13 +125,17 @@ class ParamInfoRequest : public CallData {
     static int objectCounter_;
     
     /**
-     * @brief The vector of ParamInfoResponse objects.
+     * @brief The serializer producing the responses one at a time.
+     */
+    std::unique_ptr<ParamInfoSerializer> serializer_{nullptr};
+    /**
+     * @brief Shared ptr to the authorizer; kept alive for the serializer.
      */
-    std::vector<st2138::ParamInfoResponse> responses_;
+    std::shared_ptr<Authorizer> sharedAuthz_{nullptr};
     /**
-     * @brief The current response index.
+     * @brief Ptr to the authorizer used by the serializer.
      */
-    uint32_t current_response_{0};
+    Authorizer* authz_{nullptr};
 
     /**
      * @brief The mutex for the writer lock.
@@ -158,60 +146,6 @@ class ParamInfoRequest : public CallData {
      * @brief The writer lock.
      */
     std::unique_lock<std::mutex> writer_lock_{mtx_, std::defer_lock};
-
-    /**
-     * @brief Visitor class for collecting parameter info
-     */
-    class ParamInfoVisitor : public catena::common::IParamVisitor {
-      public:
-        /**
-         * @brief Constructor for the ParamInfoVisitor class
-         * @param device The device to visit
-         * @param authz The authorizer
-         * @param responses The vector of responses
-         * @param request The request
-         */
-        ParamInfoVisitor(catena::common::IDevice& device, catena::common::Authorizer& authz,
-                            std::vector<st2138::ParamInfoResponse>& responses,
-                            ParamInfoRequest& request)
-            : device_(device), authz_(authz), responses_(responses), request_(request) {}
-
-        /**
-         * @brief Visit a parameter
-         * @param param The parameter to visit
-         * @param path The path of the parameter
-         */
-        void visit(IParam* param, const std::string& path) override;
-        
-        /**
-         * @brief Visit an array
-         * @param param The array to visit
-         * @param path The path of the array
-         * @param length The length of the array
-         */
-        void visitArray(IParam* param, const std::string& path, uint32_t length) override;
-
-      private:
-        /**
-         * @brief The device to visit within the visitor
-         */
-        IDevice& device_;
-
-        /**
-         * @brief The authorizer within the visitor
-         */
-        catena::common::Authorizer& authz_;
-
-        /**
-         * @brief The vector of responses within the visitor
-         */
-        std::vector<st2138::ParamInfoResponse>& responses_;
-
-        /**
-         * @brief The request payload within the visitor
-         */
-        ParamInfoRequest& request_;
-    };
 };
 
 }; // namespace gRPC
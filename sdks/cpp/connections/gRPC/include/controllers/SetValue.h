@@ -94,8 +94,11 @@ class SetValue : public MultiSetValue {
      * - The slot specifying the device containing the parameter to update.
      * 
      * - An oid, value pair specifying the parameter to update.
+     *
+     * Owned by arena_, so that its value can be swapped into reqs_ without
+     * a copy.
      */
-    st2138::SingleSetValuePayload req_;
+    st2138::SingleSetValuePayload& req_;
     /**
      * @brief The total # of SetValue objects.
      */
@@ -116,13 +116,13 @@ class UpdateSubscriptions : public CallData {
      */
     catena::common::Authorizer* authz_;
     /**
-     * @brief The set of currently subscribed OIDs from sub manager.
+     * @brief The currently subscribed OIDs from sub manager.
      */
-    std::set<std::string> subbedOids_{};
+    catena::common::SubscribedOids subbedOids_{};
     /**
      * @brief Iterator for the set of subscribed OIDs.
      */
-    std::set<std::string>::iterator it_;
+    catena::common::SubscribedOids::const_iterator it_;
 
     /**
      * @brief The object's unique id counter.
@@ -42,6 +42,8 @@ ServiceImpl::ServiceImpl(const ServiceConfig& config)
     if (!cq_) {
         throw std::runtime_error("Completion queue cannot be a nullptr.");
     }
+    // Defaulting to one thread per core.
+    threads_ = config.threads > 0 ? config.threads : std::max(1u, std::thread::hardware_concurrency());
     // Adding dms to slotMap.
     for (auto dm : config.dms) {
         if (dms_.contains(dm->slot())) {
@@ -77,21 +79,33 @@ vdk::signal<void()> catena::gRPC::Connect::shutdownSignal_;
 
 // Processes events in the server's completion queue.
 void ServiceImpl::processEvents() {
+    LOG(DEBUG) << "Start processing events on " << threads_ << " threads\n";
+    std::vector<std::thread> pool;
+    for (uint32_t i = 1; i < threads_; ++i) {
+        pool.emplace_back(&ServiceImpl::pollEvents_, this);
+    }
+    pollEvents_();
+    for (auto& thread : pool) {
+        thread.join();
+    }
+    // Waiting until all events are processed to exit.
+    while (registrySize() > 0) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+}
+
+// Takes events from the completion queue until it shuts down.
+void ServiceImpl::pollEvents_() {
     void *tag;
     bool ok;
-    LOG(DEBUG) << "Start processing events\n";
     while (true) {
         gpr_timespec deadline =
             gpr_time_add(gpr_now(GPR_CLOCK_REALTIME), gpr_time_from_seconds(1, GPR_TIMESPAN));
         switch (cq_->AsyncNext(&tag, &ok, deadline)) {
             case ServerCompletionQueue::GOT_EVENT:
-                std::thread(&ICallData::proceed, static_cast<ICallData *>(tag), ok).detach();
+                static_cast<ICallData *>(tag)->proceed(ok);
                 break;
             case ServerCompletionQueue::SHUTDOWN:
-                // Waiting until all events are processed to exit.
-                while (registry_.size() > 0) {
-                    std::this_thread::sleep_for(std::chrono::milliseconds(100));
-                }
                 return;
             case ServerCompletionQueue::TIMEOUT:
                 break;
@@ -30,6 +30,7 @@
 
 // connections/gRPC
 #include <controllers/AddLanguage.h>
+#include <AuthorizerCache.h>
 #include <Logger.h>
 using catena::gRPC::AddLanguage;
 
@@ -95,7 +96,7 @@ void AddLanguage::proceed(bool ok) {
                     std::shared_ptr<catena::common::Authorizer> sharedAuthz;
                     catena::common::Authorizer* authz;
                     if (service_->authorizationEnabled()) {
-                        sharedAuthz = std::make_shared<catena::common::Authorizer>(jwsToken_());
+                        sharedAuthz = catena::common::AuthorizerCache::instance().get(jwsToken_());
                         authz = sharedAuthz.get();
                     } else {
                         authz = &catena::common::Authorizer::kAuthzDisabled;
@@ -95,23 +95,17 @@ void catena::gRPC::Connect::proceed(bool ok) {
                 // Initialize authz and add connection to the priority queue.
                 detailLevel_ = req_.detail_level();
                 initAuthz_(jwsToken_(), service_->authorizationEnabled());
+                // Subscriptions are scoped to this connection, which the
+                // client names by the id sent in the initial metadata.
+                openSubscriptionScope_();
+                context_.AddInitialMetadata(kConnectionIdKey, connectionId());
                 if (service_->connectionQueue().registerConnection(this)) {
                     // Connecting to each device in dms_.
                     st2138::PushUpdates populatedSlots;
                     for (auto [slot, dm] : dms_) {
                         if (dm) {
-                            // Waiting for a value set by server to be sent to execute code.
-                            valueSetByServerIds_[slot] = dm->getValueSetByServer().connect([this, slot](const std::string& oid, const IParam* p){
-                                updateResponse_(oid, p, slot);
-                            });
-                            // Waiting for a value set by client to be sent to execute code.
-                            valueSetByClientIds_[slot] = dm->getValueSetByClient().connect([this, slot](const std::string& oid, const IParam* p){
-                                updateResponse_(oid, p, slot);
-                            });
-                            // Waiting for a language to be added to execute code.
-                            languageAddedIds_[slot] = dm->getLanguageAddedPushUpdate().connect([this, slot](const ILanguagePack* l) {
-                                updateResponse_(l, slot);
-                            });
+                            // Receiving the device's value and language pack updates.
+                            subscribeUpdates_(slot, *dm);
                             populatedSlots.mutable_slots_added()->add_slots(slot);
                         }
                     }
@@ -134,13 +128,25 @@ void catena::gRPC::Connect::proceed(bool ok) {
             break;
             
         /**
-         * kWrite: Waits until an update to either set res to device's slot or
-         * end the process.
+         * kWrite: Writes the next queued update to the client, parking until
+         * one is queued if the current batch has been sent, or ends the
+         * process.
          */
         case CallStatus::kWrite:
             connect_lock.lock();
-            cv_.wait(connect_lock, [this] { return hasUpdate_; });
-            hasUpdate_ = false;
+            parked_ = false;
+            // Taking the next batch of updates once the last one is written.
+            if (batchPos_ >= batch_.size() && !isCancelled()) {
+                batch_.clear();
+                batchPos_ = 0;
+                hasUpdate_ = false;
+                drainUpdates_(batch_);
+                // Nothing to write, wakeWriter_ brings us back once there is.
+                if (batch_.empty()) {
+                    parked_ = true;
+                    break;
+                }
+            }
             // If connect was cancelled set state to kFinish.
             if (shutdown_ || context_.IsCancelled()) {
                 status_ = CallStatus::kFinish;
@@ -148,13 +154,21 @@ void catena::gRPC::Connect::proceed(bool ok) {
             }
             // Write to client if the context is not cancelled.
             if (!context_.IsCancelled()) {
-                if (shutdown_) {
+                if (updates_.overflowed()) {
+                    writer_.Finish(grpc::Status(grpc::StatusCode::RESOURCE_EXHAUSTED, "Client is not keeping up with updates"), this);
+                } else if (shutdown_) {
                     writer_.Finish(Status::CANCELLED, this);
                 } else if (authz_->isExpired()) {
                     status_ = CallStatus::kFinish;
                     writer_.Finish(grpc::Status(grpc::StatusCode::UNAUTHENTICATED, "JWS token expired"), this);
                 } else {
-                    writer_.Write(res_, this);
+                    // Letting gRPC hold the write back while more of the
+                    // batch follows. The last write of a batch flushes.
+                    grpc::WriteOptions options;
+                    if (batchPos_ + 1 < batch_.size()) {
+                        options.set_buffer_hint();
+                    }
+                    writer_.Write(batch_[batchPos_++]->message(), options, this);
                 }
             }
             // unlock before potentially finishing
@@ -170,24 +184,23 @@ void catena::gRPC::Connect::proceed(bool ok) {
          * kFinish: Ends the connection.
          */
         case CallStatus::kFinish:
+            connect_lock.lock();
+            // The alarm must come back before this can be deleted.
+            if (alarmSet_) {
+                alarm_.Cancel();
+                break;
+            }
+            if (finished_) {
+                break;
+            }
+            finished_ = true;
+            connect_lock.unlock();
             LOG(INFO) << "Connect[" << objectId_ << "] finished";
             // Disconnecting all initialized listeners.
             if (shutdownSignalId_ != 0) {
                 shutdownSignal_.disconnect(shutdownSignalId_);
             }
-            for (auto [slot, dm] : dms_) {
-                if (dm) {
-                    if (valueSetByClientIds_.contains(slot)) {
-                        dm->getValueSetByClient().disconnect(valueSetByClientIds_[slot]);
-                    }
-                    if (valueSetByServerIds_.contains(slot)) {
-                        dm->getValueSetByServer().disconnect(valueSetByServerIds_[slot]);
-                    }
-                    if (languageAddedIds_.contains(slot)) {
-                        dm->getLanguageAddedPushUpdate().disconnect(languageAddedIds_[slot]);
-                    }
-                }
-            }
+            unsubscribeUpdates_();
             service_->connectionQueue().deregisterConnection(this);
             service_->deregisterItem(this);
             break;
@@ -203,6 +216,24 @@ void catena::gRPC::Connect::proceed(bool ok) {
     }
 }
 
+// Sets the wake alarm if the writer is parked.
+void catena::gRPC::Connect::wakeWriter_() {
+    if (parked_) {
+        parked_ = false;
+        alarmSet_ = true;
+        alarm_.Set(service_->cq(), gpr_now(GPR_CLOCK_MONOTONIC), static_cast<ICallData*>(&wakeTag_));
+    }
+}
+
+// Resumes the writer, or finishes if the alarm was cancelled.
+void catena::gRPC::Connect::onWake_(bool ok) {
+    {
+        std::lock_guard<std::mutex> lock(mtx_);
+        alarmSet_ = false;
+    }
+    proceed(ok);
+}
+
 // Returns true if the connection has been cancelled.
 bool catena::gRPC::Connect::isCancelled() {
     return context_.IsCancelled() || shutdown_ || (authz_ && authz_->isExpired());
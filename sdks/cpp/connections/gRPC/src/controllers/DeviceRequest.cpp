@@ -30,6 +30,7 @@
 
 // connections/gRPC
 #include <controllers/DeviceRequest.h>
+#include <AuthorizerCache.h>
 #include <Logger.h>
 using catena::gRPC::DeviceRequest;
 
@@ -99,7 +100,7 @@ void DeviceRequest::proceed(bool ok) {
                     // Setting up authorizer object.
                     if (service_->authorizationEnabled()) {
                         // Authorizer throws an error if invalid jws token so no need to handle rc.
-                        sharedAuthz_ = std::make_shared<catena::common::Authorizer>(jwsToken_());
+                        sharedAuthz_ = catena::common::AuthorizerCache::instance().get(jwsToken_());
                         authz_ = sharedAuthz_.get();
                     } else {
                         authz_ = &catena::common::Authorizer::kAuthzDisabled;
@@ -110,14 +111,19 @@ void DeviceRequest::proceed(bool ok) {
 
                     // Getting subscribed oids if dl == SUBSCRIPTIONS.
                     if (dl == st2138::Device_DetailLevel_SUBSCRIPTIONS) {
+                        // Subscriptions are scoped to the Connect the client names.
+                        const std::string scope = namedSubscriptionScope_(*authz_);
                         // Add new subscriptions to both the manager and our tracking list
                         for (const auto& oid : req_.subscribed_oids()) {
-                            // Supressing errors.
+                            // Supressing errors for single OIDs.
                             catena::exception_with_status supressRc{"", catena::StatusCode::OK};
-                            service_->getSubscriptionManager().addSubscription(oid, *dm_, supressRc, *authz_);
+                            service_->getSubscriptionManager().addSubscription(oid, *dm_, supressRc, *authz_, scope);
+                            if (supressRc.status == catena::StatusCode::FAILED_PRECONDITION) {
+                                throw catena::exception_with_status(supressRc.what(), supressRc.status);
+                            }
                         }
-                        // Get service subscriptions from the manager
-                        subscribedOids_ = service_->getSubscriptionManager().getAllSubscribedOids(*dm_);
+                        // Get the client's subscriptions from the manager
+                        subscribedOids_ = service_->getSubscriptionManager().getAllSubscribedOids(*dm_, scope);
                     }
 
                     // Getting the serializer object.
@@ -148,7 +154,8 @@ void DeviceRequest::proceed(bool ok) {
         case CallStatus::kWrite:
             { // rc scope
             catena::exception_with_status rc{"", catena::StatusCode::OK};
-            st2138::DeviceComponent component{};
+            // Owned by the serializer, valid until the next getNext
+            const st2138::DeviceComponent* component = nullptr;
 
             if (!serializer_) {
                 // It should not be possible to get here
@@ -156,8 +163,9 @@ void DeviceRequest::proceed(bool ok) {
             } else {
                 // Getting the next component.
                 try {     
-                    std::lock_guard lg(dm_->mutex());
-                    component = serializer_->getNext();
+                    // The serializer locks each param it reads
+                    std::shared_lock lg(dm_->mutex());
+                    component = &serializer_->getNext();
                     status_ = serializer_->hasMore() ? CallStatus::kWrite : CallStatus::kPostWrite;
                 // ERROR
                 } catch (catena::exception_with_status &err) {
@@ -169,7 +177,7 @@ void DeviceRequest::proceed(bool ok) {
 
             // Writing to the client.
             if (rc.status == catena::StatusCode::OK) {
-                writer_.Write(component, this);
+                writer_.Write(*component, this);
             } else {
                 status_ = CallStatus::kFinish;
                 writer_.Finish(Status(static_cast<grpc::StatusCode>(rc.status), rc.what()), this);
@@ -30,6 +30,8 @@
 
 // connections/gRPC
 #include <controllers/ExecuteCommand.h>
+#include <AuthorizerCache.h>
+#include <rpc/CommandExecutor.h>
 #include <Logger.h>
 using catena::gRPC::ExecuteCommand;
 
@@ -53,6 +55,7 @@ ExecuteCommand::ExecuteCommand(IServiceImpl *service, SlotMap& dms, bool ok)
  * handling errors and responses accordingly 
  */
 void ExecuteCommand::proceed(bool ok) {
+    std::unique_lock<std::mutex> lock(mtx_);
     LOG(DEBUG) << "ExecuteCommand proceed[" << objectId_ << "]: " << timeNow()
               << " status: " << static_cast<int>(status_) << ", ok: "
               << std::boolalpha << ok;
@@ -62,6 +65,10 @@ void ExecuteCommand::proceed(bool ok) {
         LOG(INFO) << "ExecuteCommand[" << objectId_ << "] cancelled";
         status_ = CallStatus::kFinish;
     }
+    // A response is being fetched, onResponse_ carries on once it is back.
+    if (fetching_) {
+        return;
+    }
 
     //State machine to manage the process
     switch (status_) {
@@ -75,7 +82,7 @@ void ExecuteCommand::proceed(bool ok) {
             break;
         /**
          * Processes the command by reading the initial request from the client
-         * and transitioning to kRead
+         * and fetching its first response
          */
         case CallStatus::kProcess:
             processTimestamps_();
@@ -100,17 +107,19 @@ void ExecuteCommand::proceed(bool ok) {
                     // Setting up authorizer object.
                     if (service_->authorizationEnabled()) {
                         // Authorizer throws an error if invalid jws token so no need to handle rc.
-                        sharedAuthz_ = std::make_shared<catena::common::Authorizer>(jwsToken_());
+                        sharedAuthz_ = catena::common::AuthorizerCache::instance().get(jwsToken_());
                         authz_ = sharedAuthz_.get();
                     } else {
                         authz_ = &catena::common::Authorizer::kAuthzDisabled;
                     }
-                    // Getting the command.
-                    std::unique_ptr<IParam> command = dm->getCommand(req_.oid(), rc, *authz_);
-                    // Executing the command if found.
-                    if (command != nullptr) {
-                        responder_ = command->executeCommand(req_.value(), req_.respond(), rc, *authz_);
-                        status_ = CallStatus::kWrite; 
+                    // Getting the command, which is executed with the first fetch.
+                    command_ = dm->getCommand(req_.oid(), rc, *authz_);
+                    if (command_ != nullptr) {
+                        status_ = CallStatus::kWrite;
+                        fetchResponse_();
+                    } else if (rc.status == catena::StatusCode::OK) {
+                        // It should not be possible to get here
+                        rc = catena::exception_with_status{"Illegal state", catena::StatusCode::INTERNAL};
                     }
                 }
             // ERROR
@@ -119,55 +128,21 @@ void ExecuteCommand::proceed(bool ok) {
             } catch (...) {
                 rc = catena::exception_with_status("Unknown error", catena::StatusCode::UNKNOWN);
             }
-            // Ending process if an error occured, falling through otherwise.
+            // Ending process if an error occured.
             if (rc.status != catena::StatusCode::OK) {
                 status_ = CallStatus::kFinish;
                 writer_.Finish(Status(static_cast<grpc::StatusCode>(rc.status), rc.what()), this);
-                break;
             }
             } // rc scope
+            break;
 
         /**
-         * Writes the response to the client by sending the external object and
-         * then continues to kPostWrite or kFinish
+         * Fetches the next response once the last one has been written to the
+         * client
          */
         case CallStatus::kWrite:
-            { // rc scope
-            catena::exception_with_status rc{"", catena::StatusCode::OK};
-            st2138::CommandResponse res{};
-            do {
-                if (!responder_) {
-                    // It should not be possible to get here
-                    rc = catena::exception_with_status{"Illegal state", catena::StatusCode::INTERNAL};
-                } else if (authz_->isExpired()) {
-                    rc = catena::exception_with_status{"JWS token expired", catena::StatusCode::UNAUTHENTICATED};
-                } else {
-                    // Getting the next component.
-                    try {     
-                        res = responder_->getNext();
-                        status_ = responder_->hasMore() ? CallStatus::kWrite : CallStatus::kPostWrite;
-                    // ERROR
-                    } catch (catena::exception_with_status &err) {
-                        rc = catena::exception_with_status{err.what(), err.status};
-                    } catch (...) {
-                        rc = catena::exception_with_status{"Unknown error", catena::StatusCode::UNKNOWN};
-                    }
-                }
-            // Looping required if we aren't writing to the client.
-            } while (!req_.respond() && rc.status == catena::StatusCode::OK && status_ == CallStatus::kWrite);
-            // Writing to the client.
-            if (rc.status == catena::StatusCode::OK) {
-                if (req_.respond()) {
-                    writer_.Write(res, this);
-                    break;
-                }
-            } else {
-                status_ = CallStatus::kFinish;
-                writer_.Finish(Status(static_cast<grpc::StatusCode>(rc.status), rc.what()), this);
-                break;
-            }
-            // Fall through of OK and respond = false;
-            }
+            fetchResponse_();
+            break;
 
         // Status after finishing writing the response, transitions to kFinish
         case CallStatus::kPostWrite:
@@ -181,6 +156,7 @@ void ExecuteCommand::proceed(bool ok) {
          */
         case CallStatus::kFinish:
             LOG(INFO) << "ExecuteCommand[" << objectId_ << "] finished";
+            lock.unlock();
             service_->deregisterItem(this);
             break;
 
@@ -195,3 +171,75 @@ void ExecuteCommand::proceed(bool ok) {
             // GCOVR_EXCL_STOP
     }
 }
+
+// Posts the next fetch to the CommandExecutor.
+void ExecuteCommand::fetchResponse_() {
+    fetching_ = true;
+    catena::common::CommandExecutor::instance().post([this]() {
+        getResponse_();
+        alarm_.Set(service_->cq(), gpr_now(GPR_CLOCK_MONOTONIC), static_cast<ICallData*>(&responseTag_));
+    });
+}
+
+// Runs the command if needed and gets its next response.
+void ExecuteCommand::getResponse_() {
+    rc_ = catena::exception_with_status{"", catena::StatusCode::OK};
+    // Executing the command on the first fetch.
+    if (command_) {
+        try {
+            responder_ = command_->executeCommand(req_.value(), req_.respond(), rc_, *authz_);
+        // ERROR
+        } catch (catena::exception_with_status& err) {
+            rc_ = catena::exception_with_status(err.what(), err.status);
+        } catch (...) {
+            rc_ = catena::exception_with_status("Unknown error", catena::StatusCode::UNKNOWN);
+        }
+        command_.reset();
+        if (rc_.status != catena::StatusCode::OK) {
+            return;
+        }
+    }
+    do {
+        if (!responder_) {
+            // It should not be possible to get here
+            rc_ = catena::exception_with_status{"Illegal state", catena::StatusCode::INTERNAL};
+        } else if (authz_->isExpired()) {
+            rc_ = catena::exception_with_status{"JWS token expired", catena::StatusCode::UNAUTHENTICATED};
+        } else {
+            // Getting the next component.
+            try {
+                res_ = responder_->getNext();
+                hasMore_ = responder_->hasMore();
+            // ERROR
+            } catch (catena::exception_with_status &err) {
+                rc_ = catena::exception_with_status{err.what(), err.status};
+            } catch (...) {
+                rc_ = catena::exception_with_status{"Unknown error", catena::StatusCode::UNKNOWN};
+            }
+        }
+    // Looping required if we aren't writing to the client.
+    } while (!req_.respond() && rc_.status == catena::StatusCode::OK && hasMore_);
+}
+
+// Writes the fetched response, or finishes the RPC.
+void ExecuteCommand::onResponse_(bool ok) {
+    std::unique_lock<std::mutex> lock(mtx_);
+    fetching_ = false;
+    // Cancelled while the response was being fetched.
+    if (!ok || status_ == CallStatus::kFinish) {
+        status_ = CallStatus::kFinish;
+        lock.unlock();
+        proceed(false);
+        return;
+    }
+    if (rc_.status != catena::StatusCode::OK) {
+        status_ = CallStatus::kFinish;
+        writer_.Finish(Status(static_cast<grpc::StatusCode>(rc_.status), rc_.what()), this);
+    } else if (req_.respond()) {
+        status_ = hasMore_ ? CallStatus::kWrite : CallStatus::kPostWrite;
+        writer_.Write(res_, this);
+    } else {
+        status_ = CallStatus::kFinish;
+        writer_.Finish(Status::OK, this);
+    }
+}
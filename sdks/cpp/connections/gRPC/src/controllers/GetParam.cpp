@@ -30,6 +30,9 @@
 
 // connections/gRPC
 #include <controllers/GetParam.h>
+#include <AuthorizerCache.h>
+#include <ParamLock.h>
+#include <rpc/ArenaPool.h>
 #include <Logger.h>
 using catena::gRPC::GetParam;
 
@@ -86,7 +89,9 @@ void GetParam::proceed( bool ok) {
             { // var scope
             catena::exception_with_status rc{"", catena::StatusCode::OK};
             std::unique_ptr<IParam> param = nullptr;
-            st2138::DeviceComponent_ComponentParam res;
+            // The response is built on a pooled arena, returned once sent
+            catena::common::ArenaPool::Lease arena = catena::common::ArenaPool::instance().acquire();
+            st2138::DeviceComponent_ComponentParam& res = *arena.create<st2138::DeviceComponent_ComponentParam>();
             std::shared_ptr<catena::common::Authorizer> sharedAuthz;
             catena::common::Authorizer* authz;
             IDevice* dm = nullptr;
@@ -108,13 +113,13 @@ void GetParam::proceed( bool ok) {
                 } else {
                     // Creating authorizer.
                     if (service_->authorizationEnabled()) {
-                        sharedAuthz = std::make_shared<catena::common::Authorizer>(jwsToken_());
+                        sharedAuthz = catena::common::AuthorizerCache::instance().get(jwsToken_());
                         authz = sharedAuthz.get();
                     } else {
                         authz = &catena::common::Authorizer::kAuthzDisabled;
                     }
                     // Getting the param.
-                    std::lock_guard lg(dm->mutex());
+                    catena::common::ParamReadLock lock(*dm, req_.oid());
                     param = dm->getParam(req_.oid(), rc, *authz);
                     // If we found a param update the response.
                     if (param && rc.status == catena::StatusCode::OK) {
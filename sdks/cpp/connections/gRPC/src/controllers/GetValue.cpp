@@ -30,6 +30,9 @@
 
 // connections/gRPC
 #include <controllers/GetValue.h>
+#include <AuthorizerCache.h>
+#include <ParamLock.h>
+#include <rpc/ArenaPool.h>
 #include <Logger.h>
 using catena::gRPC::GetValue;
 
@@ -83,7 +86,9 @@ void GetValue::proceed( bool ok) {
             context_.AsyncNotifyWhenDone(this);
 
             { // var scope
-            st2138::Value ans;
+            // The value is built on a pooled arena, returned once sent
+            catena::common::ArenaPool::Lease arena = catena::common::ArenaPool::instance().acquire();
+            st2138::Value& ans = *arena.create<st2138::Value>();
             catena::exception_with_status rc{"", catena::StatusCode::OK};
             IDevice* dm = nullptr;
             try {
@@ -109,13 +114,13 @@ void GetValue::proceed( bool ok) {
                     std::shared_ptr<catena::common::Authorizer> sharedAuthz;
                     catena::common::Authorizer* authz;
                     if (service_->authorizationEnabled()) {
-                        sharedAuthz = std::make_shared<catena::common::Authorizer>(jwsToken_());
+                        sharedAuthz = catena::common::AuthorizerCache::instance().get(jwsToken_());
                         authz = sharedAuthz.get();
                     } else {
                         authz = &catena::common::Authorizer::kAuthzDisabled;
                     }
                     // Getting the value.
-                    std::lock_guard lg(dm->mutex());
+                    catena::common::ParamReadLock lock(*dm, req_.oid());
                     rc = dm->getValue(req_.oid(), ans, *authz);
                 }
             // ERROR.
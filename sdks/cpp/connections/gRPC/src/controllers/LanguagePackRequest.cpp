@@ -93,7 +93,7 @@ void LanguagePackRequest::proceed(bool ok) {
 
                 // Getting and returning the requested language.
                 } else {
-                    std::lock_guard lg(dm->mutex());
+                    std::shared_lock lg(dm->mutex());
                     rc = dm->getLanguagePack(req_.language(), ans);
                     status_ = CallStatus::kFinish;
                 }
@@ -91,7 +91,7 @@ void ListLanguages::proceed(bool ok) {
                     rc = catena::exception_with_status("device not found in slot " + std::to_string(req_.slot()), catena::StatusCode::NOT_FOUND);
                 // Getting and returning languages.
                 } else {
-                    std::lock_guard lg(dm->mutex());
+                    std::shared_lock lg(dm->mutex());
                     dm->toProto(ans);
                 }
             // ERROR.
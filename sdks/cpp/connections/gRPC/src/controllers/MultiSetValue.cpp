@@ -30,6 +30,8 @@
 
 // connections/gRPC
 #include <controllers/MultiSetValue.h>
+#include <AuthorizerCache.h>
+#include <ParamLock.h>
 #include <Logger.h>
 using catena::gRPC::MultiSetValue;
 
@@ -44,8 +46,9 @@ MultiSetValue::MultiSetValue(IServiceImpl *service, SlotMap& dms, bool ok)
 }
 
 MultiSetValue::MultiSetValue(IServiceImpl *service, SlotMap& dms, bool ok, int objectId)
-    : CallData(service), dms_{dms}, objectId_(objectId), responder_(&context_),
-    status_{ok ? CallStatus::kCreate : CallStatus::kFinish} {}
+    : CallData(service), arena_{catena::common::ArenaPool::instance().acquire()},
+    reqs_{*arena_.create<st2138::MultiSetValuePayload>()}, dms_{dms}, objectId_(objectId),
+    responder_(&context_), status_{ok ? CallStatus::kCreate : CallStatus::kFinish} {}
 
 void MultiSetValue::request_() {
     service_->RequestMultiSetValue(&context_, &reqs_, &responder_, service_->cq(), service_->cq(), this);
@@ -111,18 +114,17 @@ void MultiSetValue::proceed(bool ok) {
                     std::shared_ptr<catena::common::Authorizer> sharedAuthz;
                     catena::common::Authorizer* authz;
                     if (service_->authorizationEnabled()) {
-                        sharedAuthz = std::make_shared<catena::common::Authorizer>(jwsToken_());
+                        sharedAuthz = catena::common::AuthorizerCache::instance().get(jwsToken_());
                         authz = sharedAuthz.get();
                     } else {
                         authz = &catena::common::Authorizer::kAuthzDisabled;
                     }
-                    // Locking device and setting value(s).
-                    std::lock_guard lg(dm->mutex());
-                    // Trying and commiting the multiSetValue.
-                    if (dm->tryMultiSetValue(reqs_, rc, *authz)) {
-                        rc = dm->commitMultiSetValue(reqs_, *authz);
-                    } else { // debug log new
-                        LOG(ERROR) << "MultiSetValue: tryMultiSetValue failed for slot " << reqs_.slot()
+                    // Locking the params and setting value(s).
+                    catena::common::ParamWriteLock lock(*dm, reqs_);
+                    // Validating and commiting the multiSetValue.
+                    rc = dm->multiSetValue(reqs_, *authz);
+                    if (rc.status != catena::StatusCode::OK) {
+                        LOG(ERROR) << "MultiSetValue: multiSetValue failed for slot " << reqs_.slot()
                                   << " status=" << static_cast<int>(rc.status)
                                   << " msg=\"" << rc.what() << "\"";
                     }
@@ -30,6 +30,7 @@
 
 // connections/gRPC
 #include <controllers/ParamInfoRequest.h>
+#include <AuthorizerCache.h>
 #include <Logger.h>
 using catena::gRPC::ParamInfoRequest;
 
@@ -68,9 +69,6 @@ void ParamInfoRequest::proceed(bool ok) {
             context_.AsyncNotifyWhenDone(this);
             
             catena::exception_with_status rc{"", catena::StatusCode::OK};
-            std::unique_ptr<IParam> param;
-            std::shared_ptr<Authorizer> sharedAuthz;
-            Authorizer* authz;
             
             try {
                 // Validate the slot range
@@ -87,93 +85,41 @@ void ParamInfoRequest::proceed(bool ok) {
                     rc = catena::exception_with_status("Device not found in slot " + std::to_string(req_.slot()), catena::StatusCode::NOT_FOUND);
                 } else {
                     if (service_->authorizationEnabled()) {
-                        sharedAuthz = std::make_shared<Authorizer>(jwsToken_());
-                        authz = sharedAuthz.get();
+                        sharedAuthz_ = catena::common::AuthorizerCache::instance().get(jwsToken_());
+                        authz_ = sharedAuthz_.get();
                     } else {
-                        authz = &Authorizer::kAuthzDisabled;
+                        authz_ = &Authorizer::kAuthzDisabled;
                     }
                     
-                    // Mode 1: Get all top-level parameters
-                    if (req_.oid_prefix().empty() && !req_.recursive()) {
-                        std::vector<std::unique_ptr<IParam>> top_level_params;
-                        std::lock_guard lg(dm_->mutex());
-                        top_level_params = dm_->getTopLevelParams(rc, *authz);
-                        if (rc.status == catena::StatusCode::OK) {
-                            if (top_level_params.empty()) {
-                                rc = catena::exception_with_status("No top-level parameters found", catena::StatusCode::NOT_FOUND);
-                            } else {
-                                // Success case - process parameters               
-                                responses_.clear();  
-                                // Process each top-level parameter
-                                for (auto& top_level_param : top_level_params) {
-                                    // Add the parameter to our response list
-                                    addParamToResponses(top_level_param.get(), *authz);
-                                    // For array types, calculate and update array length
-                                    if (top_level_param->isArrayType()) {
-                                        uint32_t array_length = top_level_param->size();
-                                        if (array_length > 0) {
-                                            updateArrayLengths_(top_level_param->getOid(), array_length);
-                                        }
-                                    }   
-                                }                        
-                            }
+                    // Only the roots' oids are kept, the serializer resolves them
+                    // again whenever it resumes
+                    std::vector<std::string> oids;
+                    std::shared_lock lg(dm_->mutex());
+                    // Mode 1 and 2: Get all top-level parameters, recursively if requested
+                    if (req_.oid_prefix().empty()) {
+                        auto params = dm_->getTopLevelParams(rc, *authz_);
+                        if (rc.status == catena::StatusCode::OK && params.empty()) {
+                            rc = catena::exception_with_status("No top-level parameters found", catena::StatusCode::NOT_FOUND);
                         }
-                    // Mode 2: Get ALL parameters recursively
-                    } else if (req_.oid_prefix().empty() && req_.recursive()) {
-                        std::vector<std::unique_ptr<IParam>> top_level_params;
-                        std::lock_guard lg(dm_->mutex());
-                        top_level_params = dm_->getTopLevelParams(rc, *authz);
-                        if (rc.status == catena::StatusCode::OK) {
-                            if (top_level_params.empty()) {
-                                rc = catena::exception_with_status("No top-level parameters found", catena::StatusCode::NOT_FOUND);
-                            } else {
-                                // Success case - process parameters recursively                  
-                                responses_.clear();  
-                                // Process each top-level parameter recursively
-                                for (auto& top_level_param : top_level_params) {
-                                    // Add the parameter to our response list
-                                    addParamToResponses(top_level_param.get(), *authz);
-                                    // For array types, calculate and update array length
-                                    if (top_level_param->isArrayType()) {
-                                        uint32_t array_length = top_level_param->size();
-                                        if (array_length > 0) {
-                                            updateArrayLengths_(top_level_param->getOid(), array_length);
-                                        }
-                                    }
-                                    // Collect all parameter info recursively through visitor pattern
-                                    ParamInfoVisitor visitor(*dm_, *authz, responses_, *this);
-                                    ParamVisitor::traverseParams(top_level_param.get(), "/" + top_level_param->getOid(), *dm_, visitor, *authz);
-                                }                        
-                            }
+                        for (auto& param : params) {
+                            oids.push_back("/" + param->getOid());
                         }
-                    // Mode 3: Get a specific parameter and its children
-                    } else if (!req_.oid_prefix().empty()) { 
-                        std::lock_guard lg(dm_->mutex());
-                        param = dm_->getParam(req_.oid_prefix(), rc, *authz);
+                    // Mode 3: Get a specific parameter and, if requested, its children
+                    } else {
+                        std::shared_lock pl(dm_->paramMutex(req_.oid_prefix()));
+                        auto param = dm_->getParam(req_.oid_prefix(), rc, *authz_);
                         if (rc.status == catena::StatusCode::OK) {
                             if (!param) {
                                 rc = catena::exception_with_status("Parameter not found: " + req_.oid_prefix(), catena::StatusCode::NOT_FOUND);
                             } else {
-                                // Success case - process parameter
-                                responses_.clear();
-                                // Add the main parameter first 
-                                responses_.emplace_back();
-                                param->toProto(responses_.back(), *authz);                        
-                                // If the parameter is an array, update the array length
-                                if (param->isArrayType()) {
-                                    uint32_t array_length = param->size();
-                                    if (array_length > 0) {
-                                        updateArrayLengths_(param->getOid(), array_length);
-                                    }
-                                }                        
-                                // If recursive is true, collect all parameter info recursively through visitor pattern
-                                if (req_.recursive()) {
-                                    ParamInfoVisitor visitor(*dm_, *authz, responses_, *this);
-                                    ParamVisitor::traverseParams(param.get(), req_.oid_prefix(), *dm_, visitor, *authz);
-                                }
+                                oids.push_back(req_.oid_prefix());
                             }
                         }
                     }
+                    // Responses are built as they are written
+                    if (rc.status == catena::StatusCode::OK) {
+                        serializer_ = std::make_unique<ParamInfoSerializer>(ParamInfoSerializer::serialize(*dm_, std::move(oids), req_.recursive(), *authz_));
+                    }
                 }
             } catch (catena::exception_with_status& err) {
                 rc = catena::exception_with_status(err.what(), err.status);
@@ -195,17 +141,38 @@ void ParamInfoRequest::proceed(bool ok) {
             } // rc scope
 
         case CallStatus::kWrite:
-            { // lock scope
-                std::lock_guard lg(dm_->mutex());
-                writer_.Write(responses_.at(current_response_), this);
-                // Check if we have more responses to write
-                if (current_response_ < responses_.size()-1) { 
-                    current_response_++;
-                    status_ = CallStatus::kWrite;
-                } else { 
-                    status_ = CallStatus::kPostWrite; 
+            { // rc scope
+            catena::exception_with_status rc{"", catena::StatusCode::OK};
+            // Owned by the serializer, valid until the next getNext
+            const st2138::ParamInfoResponse* response = nullptr;
+
+            if (!serializer_) {
+                // It should not be possible to get here
+                rc = catena::exception_with_status{"Illegal state", catena::StatusCode::INTERNAL};
+            } else {
+                // Building the next response.
+                try {
+                    std::shared_lock lg(dm_->mutex());
+                    response = &serializer_->getNext();
+                    status_ = serializer_->hasMore() ? CallStatus::kWrite : CallStatus::kPostWrite;
+                // ERROR
+                } catch (catena::exception_with_status& err) {
+                    rc = catena::exception_with_status{err.what(), err.status};
+                } catch (const std::exception& e) {
+                    rc = catena::exception_with_status("Failed due to unknown error in ParamInfoRequest: " + std::string(e.what()), catena::StatusCode::UNKNOWN);
+                } catch (...) {
+                    rc = catena::exception_with_status{"Failed due to unknown error in ParamInfoRequest", catena::StatusCode::UNKNOWN};
                 }
-            } // lock scope
+            }
+
+            // Writing to the client.
+            if (rc.status == catena::StatusCode::OK) {
+                writer_.Write(*response, this);
+            } else {
+                status_ = CallStatus::kFinish;
+                writer_.Finish(grpc::Status(static_cast<grpc::StatusCode>(rc.status), rc.what()), this);
+            }
+            } // rc scope
             break;
 
         case CallStatus::kPostWrite:
@@ -226,53 +193,3 @@ void ParamInfoRequest::proceed(bool ok) {
             // GCOVR_EXCL_STOP
     }
 }
-
-/** Updates the array_length field in the protobuf responses
- * for all responses that contain array_name in their OID
- */
-void ParamInfoRequest::updateArrayLengths_(const std::string& array_name, uint32_t length) {
-    if (length > 0) {
-        for (auto it = responses_.rbegin(); it != responses_.rend(); ++it) {
-            // Only update if the OID exactly matches the array name
-            if (it->info().oid() == array_name) {
-                it->set_array_length(length);
-            }
-        }
-    }
-}
-
-// Helper method to add a parameter to the responses
-void ParamInfoRequest::addParamToResponses(IParam* param, Authorizer& authz) {
-    responses_.emplace_back();
-    auto& response = responses_.back();
-    response.mutable_info();
-    param->toProto(response, authz);
-}
-
-// Visits a parameter and adds it to the response vector
-void ParamInfoRequest::ParamInfoVisitor::visit(IParam* param, const std::string& path) {
-    // Only add non-array parameters that aren't the top-most parameter
-    bool isTopParameter = path == request_.req_.oid_prefix() || path == "/" + param->getOid();
-    bool isArray = param->isArrayType();
-    if (isTopParameter || isArray) {
-        return;
-    }
-
-    request_.addParamToResponses(param, authz_);
-}
-
-// Visits an array and updates the array length information
-void ParamInfoRequest::ParamInfoVisitor::visitArray(IParam* param, const std::string& path, uint32_t length) {
-    // Only add array parameters that aren't the top-most parameter
-    bool isTopParameter = path == request_.req_.oid_prefix() || path == "/" + param->getOid();
-    if (isTopParameter) {
-        return;
-    }
-
-    request_.addParamToResponses(param, authz_);
-
-    // Update array length information
-    if (length > 0) {
-        request_.updateArrayLengths_(param->getOid(), length);
-    }
-}
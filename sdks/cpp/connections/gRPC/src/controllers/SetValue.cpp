@@ -36,7 +36,8 @@ using catena::gRPC::SetValue;
 int SetValue::objectCounter_ = 0;
 
 SetValue::SetValue(IServiceImpl *service, SlotMap& dms, bool ok)
-    : MultiSetValue(service, dms, ok, objectCounter_++) {
+    : MultiSetValue(service, dms, ok, objectCounter_++),
+    req_{*arena_.create<st2138::SingleSetValuePayload>()} {
     typeName = "SetValue";
     service_->registerItem(this);
     proceed(ok);
@@ -52,5 +53,6 @@ void SetValue::create_(bool ok) {
 
 void SetValue::toMulti_() {
     reqs_.set_slot(req_.slot());
-    reqs_.add_values()->CopyFrom(req_.value());
+    // Moves the value across rather than copying it
+    reqs_.add_values()->Swap(req_.mutable_value());
 }
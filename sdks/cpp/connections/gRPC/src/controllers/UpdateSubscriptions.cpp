@@ -30,6 +30,9 @@
 
 // connections/gRPC
 #include <controllers/UpdateSubscriptions.h>
+#include <AuthorizerCache.h>
+#include <ParamLock.h>
+#include <rpc/ArenaPool.h>
 #include <Logger.h>
 using catena::gRPC::UpdateSubscriptions;
 
@@ -90,21 +93,30 @@ void UpdateSubscriptions::proceed(bool ok) {
                     catena::exception_with_status supressErr{"", catena::StatusCode::OK};
                     // Creating authorizer.
                     if (service_->authorizationEnabled()) {
-                        sharedAuthz_ = std::make_shared<catena::common::Authorizer>(jwsToken_());
+                        sharedAuthz_ = catena::common::AuthorizerCache::instance().get(jwsToken_());
                         authz_ = sharedAuthz_.get();
                     } else {
                         authz_ = &catena::common::Authorizer::kAuthzDisabled;
                     }
+                    // Subscriptions are scoped to the Connect the client names.
+                    const std::string scope = namedSubscriptionScope_(*authz_);
                     // Process added OIDs
                     for (const auto& oid : req_.added_oids()) {                    
-                        service_->getSubscriptionManager().addSubscription(oid, *dm_, supressErr, *authz_);
+                        service_->getSubscriptionManager().addSubscription(oid, *dm_, supressErr, *authz_, scope);
+                        // Only errors for single OIDs are supressed.
+                        if (supressErr.status == catena::StatusCode::FAILED_PRECONDITION) {
+                            throw catena::exception_with_status(supressErr.what(), supressErr.status);
+                        }
                     }
                     // Process removed OIDs
                     for (const auto& oid : req_.removed_oids()) {     
-                        service_->getSubscriptionManager().removeSubscription(oid, *dm_, supressErr);
+                        service_->getSubscriptionManager().removeSubscription(oid, *dm_, supressErr, scope);
+                        if (supressErr.status == catena::StatusCode::FAILED_PRECONDITION) {
+                            throw catena::exception_with_status(supressErr.what(), supressErr.status);
+                        }
                     }
                     // Getting all subscribed OIDs and entering kWrite
-                    subbedOids_ = service_->getSubscriptionManager().getAllSubscribedOids(*dm_);
+                    subbedOids_ = service_->getSubscriptionManager().getAllSubscribedOids(*dm_, scope);
                     it_ = subbedOids_.begin();
                     status_ = CallStatus::kWrite;
                 }
@@ -127,12 +139,14 @@ void UpdateSubscriptions::proceed(bool ok) {
             { // rc scope
             catena::exception_with_status rc{"", catena::StatusCode::OK};
             std::unique_ptr<IParam> param = nullptr;
-            st2138::DeviceComponent_ComponentParam res;
+            // The response is built on a pooled arena, returned once sent
+            catena::common::ArenaPool::Lease arena = catena::common::ArenaPool::instance().acquire();
+            st2138::DeviceComponent_ComponentParam& res = *arena.create<st2138::DeviceComponent_ComponentParam>();
 
             try {
                 // Getting the next parameter while ignoring errors.
                 while (!param && it_ != subbedOids_.end() && dm_) {
-                    std::lock_guard lg(dm_->mutex());
+                    catena::common::ParamReadLock lock(*dm_, *it_);
                     catena::exception_with_status supressErr{"", catena::StatusCode::OK};
                     param = dm_->getParam(*it_, supressErr);
                     // If param exists then serialize the response.
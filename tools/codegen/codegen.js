@@ -17,7 +17,7 @@
 import { program } from 'commander';
 
 import packageJson from './package.json' with { type: "json" };
-import { QUIET_OPTION, MANDATORY_OPTION, OUTPUT_OPTION, VERSION, createLogger, sync } from './common.js';
+import { QUIET_OPTION, MANDATORY_OPTION, OUTPUT_OPTION, ATOMIC_OPTION, VERSION, createLogger, sync } from './common.js';
 import { DeviceModel } from './DeviceModel.js';
 import Validator from 'smpte-validator';
 import { validateRequiredParamsAndScopes } from './mandatory.js';
@@ -34,6 +34,7 @@ program
     .option(...QUIET_OPTION)
     .option(...MANDATORY_OPTION)
     .option(...OUTPUT_OPTION)
+    .option(...ATOMIC_OPTION)
     .argument("<language>", "Target programming language (cpp)")
     .argument("<deviceModel>", "Catena device model to process")
     .action(generate);
@@ -54,6 +55,9 @@ function logOptions(log, language, deviceModel, options) {
     if (options.disableMandatoryEnforcement) {
         log(`Mandatory parameter enforcement disabled`);
     }
+    if (options.atomicParams) {
+        log(`atomic params: ${options.atomicParams}`);
+    }
 }
 
 // run the command line parser
@@ -77,7 +81,8 @@ async function generate(language, deviceModelPath, options) {
     switch (language) {
         case 'cpp':
             log("Generating C++ code...");
-            const cppGen = new CppGen(deviceModel, options.output);
+            const atomicParams = options.atomicParams.split(',').map(oid => oid.trim()).filter(oid => oid.length > 0);
+            const cppGen = new CppGen(deviceModel, options.output, atomicParams);
             cppGen.generate();
             break;
         default:
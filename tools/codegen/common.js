@@ -21,6 +21,7 @@ import packageJson from './package.json' with { type: "json" };
 export const QUIET_OPTION = ["-q, --quiet", "Suppress non-error console output", false];
 export const MANDATORY_OPTION = ["--disable-mandatory-enforcement", "Disable enforcement of mandatory parameters during code generation"];
 export const OUTPUT_OPTION = ["-o --output <string>", "Output folder for results", "."];
+export const ATOMIC_OPTION = ["--atomic-params <oids>", "Comma separated top level INT32, FLOAT32 or STRING params to back with lock-free AtomicValue cells", ""];
 export const PROTOS_OPTION = ["--protos <string>", "path to protobuf definitions", "../../smpte/interface/proto"];
 export const VERSION = packageJson.version;
 
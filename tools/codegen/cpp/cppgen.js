@@ -83,8 +83,9 @@ class CppGen {
    *
    * @param {DeviceModel} deviceModel to the device model's top-level json file
    * @param {string} outputDir folder for generated code
+   * @param {string[]} atomicParams oids of the top level params to back with AtomicValue cells
    */
-  constructor(deviceModel, outputDir) {
+  constructor(deviceModel, outputDir, atomicParams = []) {
     this.headerFilename = `${deviceModel.baseFilename}.h`;
     let header = fs.openSync(path.join(outputDir, `${this.headerFilename}`), "w");
     let body = fs.openSync(path.join(outputDir, `${deviceModel.baseFilename}.cpp`), "w");
@@ -103,6 +104,7 @@ class CppGen {
     coda = Cloc.deliver.bind(Cloc);
 
     this.device = new Device(deviceModel);
+    this.atomicParams = atomicParams;
   }
 
   /**
@@ -250,6 +252,11 @@ class CppGen {
    * generate the code to instantiate the params
    */
   params() {
+    for (let oid of this.atomicParams) {
+      if (!("params" in this.device.desc) || !(oid in this.device.desc.params)) {
+        throw new Error(`Atomic param ${oid} not found`);
+      }
+    }
     if (!("params" in this.device.desc)) {
       return;
     }
@@ -271,6 +278,9 @@ class CppGen {
 
       // add the param to the device
       let param = this.device.params[oid] = new Param(oid, this.device.desc.params[oid], this.device.namespace, this.device);
+      if (this.atomicParams.includes(oid)) {
+        param.makeAtomic();
+      }
 
       // define the param in the header file
       if (param.hasTypeInfo()) {
@@ -25,6 +25,12 @@ function initialCap(s) {
   return s.charAt(0).toUpperCase() + s.slice(1);
 }
 
+/**
+ * types that can be backed by an AtomicValue, and the longest string one can hold
+ */
+const ATOMIC_TYPES = new Set(["INT32", "FLOAT32", "STRING"]);
+const ATOMIC_STRING_CAPACITY = 64;
+
 /**
  * converts a catena type to a c++ type for simple types
  * @param {string} type the catena type of the param
@@ -214,6 +220,7 @@ class Param {
     this.isCommand = isCommand;
     this.parent = parent;
     this.minimal_set = desc.minimal_set === true;
+    this.atomic = false;
     this.response = desc.response === true;
 
     if ("constraint" in desc) {
@@ -324,13 +331,34 @@ class Param {
     return this.value != undefined;
   }
 
+  /**
+   * Backs the param's value with a lock-free AtomicValue cell
+   * @throws if the param is not a top level INT32, FLOAT32 or STRING param
+   * with a value, or its string value does not fit in the cell
+   */
+  makeAtomic() {
+    if (!ATOMIC_TYPES.has(this.type)) {
+      throw new Error(`${this.type} param ${this.oid} can not be atomic`);
+    }
+    if (this.parent != undefined || this.isCommand) {
+      throw new Error(`Only top level params can be atomic, not ${this.oid}`);
+    }
+    if (!this.hasValue()) {
+      throw new Error(`Atomic param ${this.oid} must have a value`);
+    }
+    if (this.type == "STRING" && this.value.string_value.length > ATOMIC_STRING_CAPACITY) {
+      throw new Error(`Value of atomic param ${this.oid} exceeds ${ATOMIC_STRING_CAPACITY} characters`);
+    }
+    this.atomic = true;
+  }
+
   /**
    * 
    * @returns the c++ type of the param's value as a string
    */
   objectType() {
     if (!this.hasTypeInfo()) {
-      return typeArg(this.type);
+      return this.atomic ? `catena::common::AtomicValue<${typeArg(this.type)}>` : typeArg(this.type);
     }
     // Not templated returns param
     if (!this.isTemplated()) {
@@ -350,7 +378,7 @@ class Param {
    */
   objectNamespaceType() {
     if (!this.hasTypeInfo()) {
-      return typeArg(this.type);
+      return this.objectType();
     }
     // Not templated returns namespace::param
     if (!this.isTemplated()) {
@@ -30,10 +30,10 @@ function pathsForBaseFilename(baseFilename) {
   return { headerPath, bodyPath };
 }
 
-function runGenerate(baseFilename, deviceName, desc) {
+function runGenerate(baseFilename, deviceName, desc, atomicParams = []) {
   fs.mkdirSync(OUTPUT_DIR, { recursive: true });
   const deviceModel = { baseFilename, deviceName, desc };
-  const gen = new CppGen(deviceModel, OUTPUT_DIR);
+  const gen = new CppGen(deviceModel, OUTPUT_DIR, atomicParams);
   gen.generate();
   return pathsForBaseFilename(baseFilename);
 }
@@ -102,6 +102,28 @@ describe('CppGen.generate', () => {
     expect(body).toContain('shared_range');
   });
 
+  test('atomic params are backed by AtomicValue', () => {
+    const { bodyPath } = runGenerate(
+      'atomic.json',
+      'AtomicDev',
+      baseDesc({
+        params: {
+          meter: { type: 'FLOAT32', value: { float32_value: -60 } },
+          gain: { type: 'FLOAT32', value: { float32_value: 0 } }
+        }
+      }),
+      ['meter']
+    );
+    const body = fs.readFileSync(bodyPath, 'utf8');
+    expect(body).toContain('catena::common::AtomicValue<float> meter{-60};');
+    expect(body).toContain('ParamWithValue<catena::common::AtomicValue<float>> _meterParam');
+    expect(body).toContain('float gain{0};');
+  });
+
+  test('throws for unknown atomic params', () => {
+    expect(() => runGenerate('atomic_missing.json', 'AtomicDev', baseDesc(), ['meter'])).toThrow(/Atomic param meter not found/);
+  });
+
   test('emits commands as ParamWithValue with is_command', () => {
     const { bodyPath } = runGenerate(
       'commands.json',
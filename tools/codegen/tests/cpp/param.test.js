@@ -896,6 +896,65 @@ describe('Param class STRUCT_VARIANT', () => {
   });
 });
 
+describe('Param.makeAtomic', () => {
+  const descriptorWithMeters = {
+    slot: 1,
+    detail_level: 'FULL',
+    access_scopes: ['test:op'],
+    default_scope: 'test:op',
+    params: {
+      meter: { type: 'FLOAT32', value: { float32_value: -60 } },
+      tally: { type: 'INT32', value: { int32_value: 0 } },
+      label: { type: 'STRING', value: { string_value: 'CAM 1' } },
+      long_label: { type: 'STRING', value: { string_value: 'x'.repeat(65) } },
+      unset: { type: 'INT32' },
+      levels: { type: 'INT32_ARRAY', value: { int32_array_values: { ints: [1, 2] } } },
+      channel: {
+        type: 'STRUCT',
+        value: { struct_value: { fields: { gain: { float32_value: 0 } } } },
+        params: { gain: { type: 'FLOAT32' } }
+      }
+    }
+  };
+
+  test('backs scalar params with AtomicValue', () => {
+    const { params } = createMockDeviceWithParams(descriptorWithMeters, 'Test');
+    params.meter.makeAtomic();
+    params.tally.makeAtomic();
+    params.label.makeAtomic();
+    expect(params.meter.objectType()).toBe('catena::common::AtomicValue<float>');
+    expect(params.tally.objectNamespaceType()).toBe('catena::common::AtomicValue<int32_t>');
+    expect(params.label.initializeValue()).toBe('catena::common::AtomicValue<std::string> label{"CAM 1"};');
+    expect(params.meter.initializeParamWithValue()).toContain('ParamWithValue<catena::common::AtomicValue<float>>');
+  });
+
+  test('leaves other params alone', () => {
+    const { params } = createMockDeviceWithParams(descriptorWithMeters, 'Test');
+    expect(params.meter.objectType()).toBe('float');
+  });
+
+  test('throws for types that can not be atomic', () => {
+    const { params } = createMockDeviceWithParams(descriptorWithMeters, 'Test');
+    expect(() => params.levels.makeAtomic()).toThrow(/can not be atomic/);
+    expect(() => params.channel.makeAtomic()).toThrow(/can not be atomic/);
+  });
+
+  test('throws for sub-params', () => {
+    const { params } = createMockDeviceWithParams(descriptorWithMeters, 'Test');
+    expect(() => params.channel.getParam(['gain']).makeAtomic()).toThrow(/Only top level params/);
+  });
+
+  test('throws for params without a value', () => {
+    const { params } = createMockDeviceWithParams(descriptorWithMeters, 'Test');
+    expect(() => params.unset.makeAtomic()).toThrow(/must have a value/);
+  });
+
+  test('throws for strings longer than the cell', () => {
+    const { params } = createMockDeviceWithParams(descriptorWithMeters, 'Test');
+    expect(() => params.long_label.makeAtomic()).toThrow(/exceeds 64 characters/);
+  });
+});
+
 describe('C++ codegen keyword safeguarding', () => {
   const deviceModel = {
     baseFilename: 'device.keywords.json',
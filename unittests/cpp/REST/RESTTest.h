@@ -335,7 +335,7 @@ class RESTTest {
     /*
      *Returns what an expect response from SSEWriter should look like.
      */
-    inline std::string expectedSSEResponse(const catena::exception_with_status& rc, const std::vector<std::string>& msgs = {}) {
+    inline std::string expectedSSEResponse(const catena::exception_with_status& rc, const std::vector<std::string>& msgs = {}, const std::string& connectionId = "") {
         http_exception_with_status httpStatus = codeMap_.at(rc.status);
         // Compiling body response from messages.
         std::string jsonBody = "";
@@ -351,7 +351,10 @@ class RESTTest {
                "Access-Control-Allow-Origin: " + origin_ + "\r\n"
                "Access-Control-Allow-Methods: GET, POST, PUT, DELETE, OPTIONS\r\n"
                "Access-Control-Allow-Headers: Content-Type, Authorization, accept, Origin, X-Requested-With, Language, Detail-Level\r\n"
-               "Access-Control-Allow-Credentials: true\r\n\r\n" +
+               "Access-Control-Allow-Credentials: true\r\n" +
+               (connectionId.empty() ? "" : "Catena-Connection-Id: " + connectionId + "\r\n"
+                                            "Access-Control-Expose-Headers: Catena-Connection-Id\r\n") +
+               "\r\n" +
                jsonBody;
     }
 
@@ -410,9 +413,12 @@ class RESTEndpointTest : public ::testing::Test, public RESTTest {
         EXPECT_CALL(context_, jwsToken()).WillRepeatedly(::testing::ReturnRef(jwsToken_));
         EXPECT_CALL(context_, authorizationEnabled()).WillRepeatedly(::testing::Invoke([this]() { return authzEnabled_; }));
         EXPECT_CALL(context_, stream()).WillRepeatedly(::testing::Invoke([this]() { return stream_; }));
+        EXPECT_CALL(context_, connectionId()).WillRepeatedly(::testing::Invoke([this]() { return connectionId_; }));
         // Default expectations for the device model.
         EXPECT_CALL(dm0_, mutex()).WillRepeatedly(::testing::ReturnRef(mtx0_));
+        EXPECT_CALL(dm0_, paramMutex(::testing::_)).WillRepeatedly(::testing::ReturnRef(paramMtx0_));
         EXPECT_CALL(dm1_, mutex()).WillRepeatedly(::testing::ReturnRef(mtx1_));
+        EXPECT_CALL(dm1_, paramMutex(::testing::_)).WillRepeatedly(::testing::ReturnRef(paramMtx1_));
 
         ICallData* ep = makeOne();
         endpoint_.reset(ep);
@@ -436,12 +442,15 @@ class RESTEndpointTest : public ::testing::Test, public RESTTest {
     bool authzEnabled_ = false;
     std::string jsonBody_ = "";
     std::string jwsToken_ = "";
+    std::string connectionId_ = "";
     // Expected variables
     catena::exception_with_status expRc_{"", catena::StatusCode::OK};
     // Mock objects and endpoint.
     MockSocketReader context_;
-    std::mutex mtx0_;
-    std::mutex mtx1_;
+    std::shared_mutex mtx0_;
+    std::shared_mutex mtx1_;
+    std::shared_mutex paramMtx0_;
+    std::shared_mutex paramMtx1_;
     MockDevice dm0_;
     MockDevice dm1_;
     SlotMap dms_ = {{0, &dm0_}, {1, &dm1_}};
@@ -59,6 +59,8 @@ class MockSocketReader : public ISocketReader {
     MOCK_METHOD(st2138::Device_DetailLevel, detailLevel, (), (const, override));
     MOCK_METHOD(const std::string&, jsonBody, (), (const, override));
     MOCK_METHOD(bool, stream, (), (const, override));
+    MOCK_METHOD(bool, keepAlive, (), (const, override));
+    MOCK_METHOD(std::string, connectionId, (), (const, override));
     MOCK_METHOD(IServiceImpl*, service, (), (override));
     MOCK_METHOD(IConnectionQueue&, connectionQueue, (), (override));
     MOCK_METHOD(bool, authorizationEnabled, (), (const, override));
@@ -95,6 +95,15 @@ protected:
      */
     ICallData* makeOne() override { return catena::REST::Connect::makeOne(serverSocket_, context_, dms_); }
 
+    /*
+     * Returns what the stream should look like, with the Connect's id in its
+     * headers.
+     */
+    std::string expectedSSEResponse(const catena::exception_with_status& rc, const std::vector<std::string>& msgs = {}) {
+        auto* connect = dynamic_cast<catena::REST::Connect*>(endpoint_.get());
+        return RESTEndpointTest::expectedSSEResponse(rc, msgs, connect ? connect->connectionId() : "");
+    }
+
     // Helper function to build slot response
     std::string buildSlotResponse() {
         st2138::PushUpdates populatedSlots;
@@ -140,7 +140,7 @@ TEST_F(RESTDeviceRequestTests, DeviceRequest_Normal) {
     initExpVal(3);
     // Set up expectation for getComponentSerializer to return a working serializer
     EXPECT_CALL(dm0_, getComponentSerializer(testing::_, testing::_, testing::_, testing::_))
-        .WillOnce(testing::Invoke([this](const IAuthorizer &authz, const std::set<std::string> &subscribedOids, st2138::Device_DetailLevel dl, bool shallow){
+        .WillOnce(testing::Invoke([this](const IAuthorizer &authz, const SubscribedOids &subscribedOids, st2138::Device_DetailLevel dl, bool shallow){
             EXPECT_EQ(!authzEnabled_, &authz == &Authorizer::kAuthzDisabled);
             EXPECT_EQ(dl, st2138::Device_DetailLevel_FULL);
             EXPECT_TRUE(subscribedOids.empty());
@@ -151,9 +151,9 @@ TEST_F(RESTDeviceRequestTests, DeviceRequest_Normal) {
                 .WillOnce(testing::Return(true))
                 .WillOnce(testing::Return(false));
             EXPECT_CALL(*mockSerializer, getNext())
-                .WillOnce(testing::Return(expVals_[0]))
-                .WillOnce(testing::Return(expVals_[1]))
-                .WillOnce(testing::Return(expVals_[2]));
+                .WillOnce(testing::ReturnRef(expVals_[0]))
+                .WillOnce(testing::ReturnRef(expVals_[1]))
+                .WillOnce(testing::ReturnRef(expVals_[2]));
             return mockSerializer;
         }));
     // Calling proceed and testing the output
@@ -169,7 +169,7 @@ TEST_F(RESTDeviceRequestTests, DeviceRequest_Stream) {
     initExpVal(3);
     // Set up expectation for getComponentSerializer to return a working serializer
     EXPECT_CALL(dm0_, getComponentSerializer(testing::_, testing::_, testing::_, testing::_))
-        .WillOnce(testing::Invoke([this](const IAuthorizer &authz, const std::set<std::string> &subscribedOids, st2138::Device_DetailLevel dl, bool shallow){
+        .WillOnce(testing::Invoke([this](const IAuthorizer &authz, const SubscribedOids &subscribedOids, st2138::Device_DetailLevel dl, bool shallow){
             EXPECT_EQ(!authzEnabled_, &authz == &Authorizer::kAuthzDisabled);
             EXPECT_EQ(dl, st2138::Device_DetailLevel_FULL);
             EXPECT_TRUE(subscribedOids.empty());
@@ -180,9 +180,9 @@ TEST_F(RESTDeviceRequestTests, DeviceRequest_Stream) {
                 .WillOnce(testing::Return(true))
                 .WillOnce(testing::Return(false));
             EXPECT_CALL(*mockSerializer, getNext()).Times(3)
-                .WillOnce(testing::Return(expVals_[0]))
-                .WillOnce(testing::Return(expVals_[1]))
-                .WillOnce(testing::Return(expVals_[2]));
+                .WillOnce(testing::ReturnRef(expVals_[0]))
+                .WillOnce(testing::ReturnRef(expVals_[1]))
+                .WillOnce(testing::ReturnRef(expVals_[2]));
             return mockSerializer;
         }));
     // Calling proceed and testing the output
@@ -194,7 +194,7 @@ TEST_F(RESTDeviceRequestTests, DeviceRequest_AuthzValid) {
     authzEnabled_ = true;
     // Set up expectation for getComponentSerializer to return a working serializer
     EXPECT_CALL(dm0_, getComponentSerializer(testing::_, testing::_, testing::_, testing::_)).Times(1)
-        .WillOnce(testing::Invoke([this](const IAuthorizer &authz, const std::set<std::string> &subscribedOids, st2138::Device_DetailLevel dl, bool shallow){
+        .WillOnce(testing::Invoke([this](const IAuthorizer &authz, const SubscribedOids &subscribedOids, st2138::Device_DetailLevel dl, bool shallow){
             EXPECT_EQ(!authzEnabled_, &authz == &Authorizer::kAuthzDisabled);
             EXPECT_EQ(dl, st2138::Device_DetailLevel_FULL);
             EXPECT_TRUE(subscribedOids.empty());
@@ -215,12 +215,12 @@ TEST_F(RESTDeviceRequestTests, DeviceRequest_Subscriptions) {
     EXPECT_CALL(context_, detailLevel()).WillOnce(testing::Return(st2138::Device_DetailLevel_SUBSCRIPTIONS));
     EXPECT_CALL(context_, subscriptionManager()).Times(1)
         .WillOnce(testing::ReturnRef(mockSubManager));
-    EXPECT_CALL(mockSubManager, getAllSubscribedOids(testing::Ref(dm0_))).Times(1)
+    EXPECT_CALL(mockSubManager, getAllSubscribedOids(testing::Ref(dm0_), testing::_)).Times(1)
         .WillOnce(testing::Return(expectedSubscribedOids));
     // Set up expectation for getComponentSerializer to verify subscribed OIDs are passed
     EXPECT_CALL(dm0_, getComponentSerializer(testing::_, testing::_, testing::_, testing::_)).Times(1)
-        .WillOnce(testing::Invoke([&expectedSubscribedOids](const IAuthorizer &authz, const std::set<std::string> &subscribedOids, st2138::Device_DetailLevel dl, bool shallow){
-            EXPECT_EQ(subscribedOids, expectedSubscribedOids);
+        .WillOnce(testing::Invoke([&expectedSubscribedOids](const IAuthorizer &authz, const SubscribedOids &subscribedOids, st2138::Device_DetailLevel dl, bool shallow){
+            EXPECT_EQ(std::set<std::string>(subscribedOids.begin(), subscribedOids.end()), expectedSubscribedOids);
             EXPECT_EQ(dl, st2138::Device_DetailLevel_SUBSCRIPTIONS);
             auto mockSerializer = std::make_unique<MockDeviceSerializer>();
             EXPECT_CALL(*mockSerializer, hasMore()).WillOnce(testing::Return(false));
@@ -212,7 +212,7 @@ TEST_F(RESTParamInfoRequestTests, ParamInfoRequest_AuthzValid) {
     EXPECT_CALL(dm0_, getParam(fqoid_, testing::_, testing::_))
        .WillRepeatedly(testing::Invoke([&param](const std::string&, catena::exception_with_status &status, const IAuthorizer &) {
             status = catena::exception_with_status("", catena::StatusCode::OK);
-            return std::move(param);
+            return borrowParam(*param);
         }));
     
     endpoint_->proceed();
@@ -262,11 +262,7 @@ TEST_F(RESTParamInfoRequestTests, ParamInfoRequest_getTopLevelParamsStream) {
     top_level_params.push_back(std::move(param2));
 
     // Setup mock expectations
-    EXPECT_CALL(dm0_, getTopLevelParams(testing::_, testing::_))
-        .WillOnce(testing::Invoke([&top_level_params](catena::exception_with_status& status, const IAuthorizer&) -> std::vector<std::unique_ptr<IParam>> {
-            status = catena::exception_with_status("", catena::StatusCode::OK);
-            return std::move(top_level_params);
-        }));
+    serveTopLevelParams(dm0_, top_level_params);
 
     endpoint_->proceed();
 
@@ -336,11 +332,7 @@ TEST_F(RESTParamInfoRequestTests, ParamInfoRequest_getTopLevelParamsWithArray) {
     top_level_params.push_back(std::move(arrayParam));
 
     // Setup mock expectations
-    EXPECT_CALL(dm0_, getTopLevelParams(testing::_, testing::_))
-        .WillOnce(testing::Invoke([&top_level_params](catena::exception_with_status& status, const IAuthorizer&) {
-            status = catena::exception_with_status("", catena::StatusCode::OK);
-            return std::move(top_level_params);
-        }));
+    serveTopLevelParams(dm0_, top_level_params);
 
     endpoint_->proceed();
 
@@ -402,11 +394,7 @@ TEST_F(RESTParamInfoRequestTests, ParamInfoRequest_getTopLevelParamsThrow) {
     top_level_params.push_back(std::move(param2));
 
     // Setup mock expectations
-    EXPECT_CALL(dm0_, getTopLevelParams(testing::_, testing::_))
-        .WillOnce(testing::Invoke([&top_level_params](catena::exception_with_status& status, const IAuthorizer&) {
-            status = catena::exception_with_status("", catena::StatusCode::OK);
-            return std::move(top_level_params);
-        }));
+    serveTopLevelParams(dm0_, top_level_params);
 
     endpoint_->proceed();
 
@@ -447,9 +435,11 @@ TEST_F(RESTParamInfoRequestTests, ParamInfoRequest_getTopLevelParamsWithDeepNest
 
     auto level1 = std::make_unique<MockParam>();
     catena::REST::test::setupMockParam(*level1, level1_info_struct, *level1Desc.descriptor);
+    resolveChildrenFromDevice(*level1, level1Oid, dm0_);
 
     auto level2 = std::make_unique<MockParam>();
     catena::REST::test::setupMockParam(*level2, level2_info_struct, *level2Desc.descriptor);
+    resolveChildrenFromDevice(*level2, level2Oid, dm0_);
 
     auto level3 = std::make_unique<MockParam>();
     catena::REST::test::setupMockParam(*level3, level3_info_struct, *level3Desc.descriptor);
@@ -462,13 +452,6 @@ TEST_F(RESTParamInfoRequestTests, ParamInfoRequest_getTopLevelParamsWithDeepNest
     EXPECT_CALL(context_, hasField("recursive")).WillOnce(testing::Return(true));
     stream_ = true;
 
-    // Setup mock expectations
-    EXPECT_CALL(dm0_, getTopLevelParams(testing::_, testing::_))
-        .WillOnce(testing::Invoke([&top_level_params](catena::exception_with_status& status, const IAuthorizer&) {
-            status = catena::exception_with_status("", catena::StatusCode::OK);
-            return std::move(top_level_params);
-        }));
-
     // Setup mock expectations for getParam to handle child traversal
     EXPECT_CALL(dm0_, getParam(testing::An<const std::string&>(), testing::An<catena::exception_with_status&>(), testing::An<const IAuthorizer&>()))
         .WillRepeatedly(testing::Invoke(
@@ -478,16 +461,19 @@ TEST_F(RESTParamInfoRequestTests, ParamInfoRequest_getTopLevelParamsWithDeepNest
                 std::string level3Oid = level3Desc.descriptor->getOid();
                 if (fqoid == level2Oid) {
                     status = catena::exception_with_status("", catena::StatusCode::OK);
-                    return std::move(level2);
+                    return borrowParam(*level2);
                 } else if (fqoid == level3Oid) {
                     status = catena::exception_with_status("", catena::StatusCode::OK);
-                    return std::move(level3);
+                    return borrowParam(*level3);
                 }
                 status = catena::exception_with_status("Parameter not found", catena::StatusCode::NOT_FOUND);
                 return nullptr;
             }
         ));
 
+    // Serve the top-level params after any broader getParam expectation
+    serveTopLevelParams(dm0_, top_level_params);
+
     endpoint_->proceed();
 
     // Match expected and actual responses
@@ -526,6 +512,7 @@ TEST_F(RESTParamInfoRequestTests, ParamInfoRequest_getTopLevelParamsWithRecursio
     // Create mock params using helpers
     auto parentParam = std::make_unique<MockParam>();
     catena::REST::test::setupMockParam(*parentParam, parent_info, *parentDesc.descriptor);
+    resolveChildrenFromDevice(*parentParam, parentOid, dm0_);
 
     auto arrayChild = std::make_unique<MockParam>();
     catena::REST::test::setupMockParam(*arrayChild, arrayChild_info, *childDesc.descriptor);
@@ -538,25 +525,21 @@ TEST_F(RESTParamInfoRequestTests, ParamInfoRequest_getTopLevelParamsWithRecursio
     EXPECT_CALL(context_, hasField("recursive")).WillOnce(testing::Return(true));
     stream_ = true;
 
-    // Setup mock expectations for getTopLevelParams
-    EXPECT_CALL(dm0_, getTopLevelParams(testing::_, testing::_))
-        .WillOnce(testing::Invoke([&top_level_params](catena::exception_with_status& status, const IAuthorizer&) {
-            status = catena::exception_with_status("", catena::StatusCode::OK);
-            return std::move(top_level_params);
-        }));
-
     // Setup mock expectations for getParam to handle child traversal
     EXPECT_CALL(dm0_, getParam(testing::An<const std::string&>(), testing::An<catena::exception_with_status&>(), testing::An<const IAuthorizer&>()))
         .WillRepeatedly(testing::Invoke([this, &arrayChild, childOid, arrayChild_info, childDesc]
             (const std::string& fqoid, catena::exception_with_status& status, const IAuthorizer&) -> std::unique_ptr<IParam> {
                 if (fqoid == childOid) {
                     status = catena::exception_with_status("", catena::StatusCode::OK);
-                    return std::move(arrayChild);
+                    return borrowParam(*arrayChild);
                 }
                 status = catena::exception_with_status("Parameter not found", catena::StatusCode::NOT_FOUND);
                 return nullptr;
             }));
 
+    // Serve the top-level params after any broader getParam expectation
+    serveTopLevelParams(dm0_, top_level_params);
+
     endpoint_->proceed();
 
     // Match expected and actual responses
@@ -598,6 +581,7 @@ TEST_F(RESTParamInfoRequestTests, ParamInfoRequest_getTopLevelParamsWithRecursio
 
     auto parentParam = std::make_unique<MockParam>();
     catena::REST::test::setupMockParam(*parentParam, parent_info_struct, *parentDesc.descriptor);
+    resolveChildrenFromDevice(*parentParam, parentOid, dm0_);
 
     // For the error child, set up a param that throws in toProto
     auto errorChild = std::make_unique<MockParam>();
@@ -615,25 +599,21 @@ TEST_F(RESTParamInfoRequestTests, ParamInfoRequest_getTopLevelParamsWithRecursio
     EXPECT_CALL(context_, hasField("recursive")).WillOnce(testing::Return(true));
     stream_ = true;
 
-    // Setup mock expectations for getTopLevelParams
-    EXPECT_CALL(dm0_, getTopLevelParams(testing::_, testing::_))
-        .WillOnce(testing::Invoke([&top_level_params](catena::exception_with_status& status, const IAuthorizer&) {
-            status = catena::exception_with_status("", catena::StatusCode::OK);
-            return std::move(top_level_params);
-        }));
-
     // Setup mock expectations for getParam to handle child traversal
     EXPECT_CALL(dm0_, getParam(testing::An<const std::string&>(), testing::An<catena::exception_with_status&>(), testing::An<const IAuthorizer&>()))
         .WillRepeatedly(testing::Invoke([&errorChild, childOid]
             (const std::string& fqoid, catena::exception_with_status& status, const IAuthorizer&) -> std::unique_ptr<IParam> {
                 if (fqoid == childOid) {
                     status = catena::exception_with_status("", catena::StatusCode::OK);
-                    return std::move(errorChild);
+                    return borrowParam(*errorChild);
                 }
                 status = catena::exception_with_status("Parameter not found", catena::StatusCode::NOT_FOUND);
                 return nullptr;
             }));
 
+    // Serve the top-level params after any broader getParam expectation
+    serveTopLevelParams(dm0_, top_level_params);
+
     endpoint_->proceed();
 
     // Match expected and actual responses
@@ -682,10 +662,10 @@ TEST_F(RESTParamInfoRequestTests, ParamInfoRequest_proceedSpecificParam) {
 
     // Setup mock expectations for mode 2 (specific parameter)
     EXPECT_CALL(dm0_, getParam(fqoid_, testing::_, testing::_))
-        .WillOnce(testing::Invoke(
+        .WillRepeatedly(testing::Invoke(
             [&mockParam](const std::string&, catena::exception_with_status& status, const IAuthorizer&) {
                 status = catena::exception_with_status("", catena::StatusCode::OK);
-                return std::move(mockParam);
+                return borrowParam(*mockParam);
             }
         ));
     
@@ -717,10 +697,10 @@ TEST_F(RESTParamInfoRequestTests, ParamInfoRequest_getSpecificParamWithRecursion
     // Setup mock expectations
     EXPECT_CALL(context_, hasField("recursive")).WillOnce(testing::Return(true));
     EXPECT_CALL(dm0_, getParam(fqoid_, testing::_, testing::_))
-        .WillOnce(testing::Invoke(
+        .WillRepeatedly(testing::Invoke(
             [&mockParam](const std::string&, catena::exception_with_status& status, const IAuthorizer&) {
                 status = catena::exception_with_status("", catena::StatusCode::OK);
-                return std::move(mockParam);
+                return borrowParam(*mockParam);
             }
         ));
 
@@ -230,3 +230,49 @@ TEST_F(RESTServiceImplTests, ServiceImpl_Router) {
     service_->Shutdown();
     run_thread.join();
 }
+
+/*
+ * TEST 6 - Setting the number of threads serving connections.
+ */
+TEST_F(RESTServiceImplTests, ServiceImpl_Threads) {
+    EXPECT_GE(service_->threads(), 1);
+    ServiceConfig config = ServiceConfig().set_port(0).set_threads(2);
+    EXPECT_EQ(config.threads, 2);
+    EXPECT_EQ(ServiceImpl(config).threads(), 2);
+}
+
+/*
+ * TEST 7 - Pipelining requests on a persistent connection.
+ */
+TEST_F(RESTServiceImplTests, ServiceImpl_KeepAlive) {
+    // Starting the service.
+    std::thread run_thread([this]() {
+        service_->run();
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(100)); // Allow some time for the server to start
+    boost::asio::io_context io_context;
+    tcp::socket clientSocket(io_context);
+    clientSocket.connect(tcp::endpoint(tcp::v4(), port_));
+    // Writing both requests before reading either response.
+    std::string health = "GET /st2138-api/" + service_->version() + "/health HTTP/1.1\r\n";
+    boost::asio::write(clientSocket, boost::asio::buffer(health + "\r\n" + health + "Connection: close\r\n\r\n"));
+    // Responses come back in order, and only the last closes the connection.
+    boost::asio::streambuf buffer;
+    std::size_t n = boost::asio::read_until(clientSocket, buffer, "\r\n\r\n");
+    std::string first(boost::asio::buffers_begin(buffer.data()), boost::asio::buffers_begin(buffer.data()) + n);
+    buffer.consume(n);
+    EXPECT_TRUE(first.starts_with("HTTP/1.1 200 OK"));
+    EXPECT_NE(first.find("Connection: keep-alive\r\n"), std::string::npos);
+    n = boost::asio::read_until(clientSocket, buffer, "\r\n\r\n");
+    std::string second(boost::asio::buffers_begin(buffer.data()), boost::asio::buffers_begin(buffer.data()) + n);
+    buffer.consume(n);
+    EXPECT_TRUE(second.starts_with("HTTP/1.1 200 OK"));
+    EXPECT_NE(second.find("Connection: close\r\n"), std::string::npos);
+    boost::system::error_code ec;
+    boost::asio::read(clientSocket, buffer, boost::asio::transfer_at_least(1), ec);
+    EXPECT_EQ(ec, boost::asio::error::eof);
+
+    // Shutting down the service.
+    service_->Shutdown();
+    run_thread.join();
+}
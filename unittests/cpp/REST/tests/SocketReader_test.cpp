@@ -836,3 +836,114 @@ TEST_F(RESTSocketReaderTests, SocketReader_ReadUntilErrors) {
     work.reset();
     runner.join();
 }
+
+/*
+ * Test 27 - asyncRead keeps pipelined requests for the next call
+ */
+TEST_F(RESTSocketReaderTests, SocketReader_AsyncReadPipelined) {
+    EXPECT_CALL(service_, authorizationEnabled()).WillRepeatedly(testing::Return(false));
+    // Writing two requests at once, the second without a body.
+    std::string request =
+        "PUT /st2138-api/v1/1/value/oid/0?test-field=1 HTTP/1.1\r\n"
+        "Content-Type: application/json\r\n"
+        "Content-Length: 16\r\n"
+        "\r\n"
+        "{test_json_body}"
+        "GET /st2138-api/v1/2/param/oid/1 HTTP/1.1\r\n"
+        "Connection: close\r\n"
+        "\r\n";
+    boost::asio::write(clientSocket_, boost::asio::buffer(request));
+    io_context_.restart();
+    auto work = boost::asio::make_work_guard(io_context_);
+    std::thread runner([this](){ io_context_.run(); });
+    auto asyncRead = [this]() {
+        return boost::asio::co_spawn(serverSocketPtr->get_executor(), socketReader.asyncRead(serverSocketPtr, 50), boost::asio::use_future).get();
+    };
+    // First request.
+    EXPECT_TRUE(asyncRead());
+    EXPECT_EQ(socketReader.method(), Method_PUT);
+    EXPECT_EQ(socketReader.slot(), 1);
+    EXPECT_EQ(socketReader.endpoint(), "/value");
+    EXPECT_EQ(socketReader.fqoid(), "/oid/0");
+    EXPECT_EQ(socketReader.fields("test-field"), "1");
+    EXPECT_EQ(socketReader.jsonBody(), "{test_json_body}");
+    EXPECT_TRUE(socketReader.keepAlive());
+    // Second request, left over from the first read.
+    EXPECT_TRUE(asyncRead());
+    EXPECT_EQ(socketReader.method(), Method_GET);
+    EXPECT_EQ(socketReader.slot(), 2);
+    EXPECT_EQ(socketReader.endpoint(), "/param");
+    EXPECT_EQ(socketReader.fqoid(), "/oid/1");
+    EXPECT_FALSE(socketReader.hasField("test-field"));
+    EXPECT_EQ(socketReader.jsonBody(), "");
+    EXPECT_FALSE(socketReader.keepAlive());
+    // Nothing else arrives, so the connection is idle rather than in error.
+    EXPECT_FALSE(asyncRead());
+    clientSocket_.close();
+    EXPECT_FALSE(asyncRead());
+    work.reset();
+    runner.join();
+}
+
+/*
+ * Test 28 - HTTP/1.0 connections close unless keep-alive is requested
+ */
+TEST_F(RESTSocketReaderTests, SocketReader_KeepAliveHttp10) {
+    EXPECT_CALL(service_, authorizationEnabled()).WillRepeatedly(testing::Return(false));
+    io_context_.restart();
+    auto work = boost::asio::make_work_guard(io_context_);
+    std::thread runner([this](){ io_context_.run(); });
+    boost::asio::write(clientSocket_, boost::asio::buffer(std::string("GET /st2138-api/v1/1/value/oid HTTP/1.0\r\n\r\n")));
+    socketReader.read(serverSocketPtr);
+    EXPECT_FALSE(socketReader.keepAlive());
+    boost::asio::write(clientSocket_, boost::asio::buffer(std::string("GET /st2138-api/v1/1/value/oid HTTP/1.0\r\nConnection: Keep-Alive\r\n\r\n")));
+    socketReader.read(serverSocketPtr);
+    EXPECT_TRUE(socketReader.keepAlive());
+    work.reset();
+    runner.join();
+}
+
+/*
+ * Test 29 - Requests over the header limits are rejected
+ */
+TEST_F(RESTSocketReaderTests, SocketReader_HeaderLimits) {
+    EXPECT_CALL(service_, authorizationEnabled()).WillRepeatedly(testing::Return(false));
+    io_context_.restart();
+    auto work = boost::asio::make_work_guard(io_context_);
+    std::thread runner([this](){ io_context_.run(); });
+    // Too many headers.
+    std::string request = "GET /st2138-api/v1/1/value/oid HTTP/1.1\r\n";
+    for (std::size_t i = 0; i <= MAX_HEADER_COUNT; ++i) {
+        request += "X-Header-" + std::to_string(i) + ": value\r\n";
+    }
+    boost::asio::write(clientSocket_, boost::asio::buffer(request + "\r\n"));
+    try {
+        socketReader.read(serverSocketPtr);
+        FAIL() << "expected exception_with_status";
+    } catch (const catena::exception_with_status& e) {
+        EXPECT_EQ(e.status, catena::StatusCode::INVALID_ARGUMENT);
+    }
+    // Headers that never end are rejected once they reach the size limit
+    // rather than buffered until the timeout.
+    request = "GET /st2138-api/v1/1/value/oid HTTP/1.1\r\nX-Header: " + std::string(MAX_HEADER_BYTES, 'a');
+    boost::asio::write(clientSocket_, boost::asio::buffer(request));
+    try {
+        socketReader.read(serverSocketPtr, 60000);
+        FAIL() << "expected exception_with_status";
+    } catch (const catena::exception_with_status& e) {
+        EXPECT_EQ(e.status, catena::StatusCode::INVALID_ARGUMENT);
+    }
+    work.reset();
+    runner.join();
+}
+
+/*
+ * Test 30 - Percent-encoded paths are decoded
+ */
+TEST_F(RESTSocketReaderTests, SocketReader_EncodedPath) {
+    EXPECT_CALL(service_, authorizationEnabled()).WillRepeatedly(testing::Return(false));
+    EXPECT_EQ(socketReader.parse("GET /st2138-api/v1/1/param/some%20param/0 HTTP/1.1\r\n\r\n"), 0);
+    EXPECT_EQ(socketReader.slot(), 1);
+    EXPECT_EQ(socketReader.endpoint(), "/param");
+    EXPECT_EQ(socketReader.fqoid(), "/some param/0");
+}
@@ -198,6 +198,131 @@ TEST_F(RESTSocketWriterTests, SocketWriter_BufferErrEnd) {
     EXPECT_EQ(readResponse(), expectedResponse(rc));
 }
 
+/* 
+ * TEST 7 - SocketWriter streams a large buffered response in chunks.
+ */
+TEST_F(RESTSocketWriterTests, SocketWriter_BufferChunked) {
+    // msg variables.
+    catena::exception_with_status rc("", catena::StatusCode::OK);
+    st2138::Value msg;
+    msg.set_string_value(std::string(1000, 'a'));
+    std::string jsonMsg;
+    google::protobuf::util::JsonPrintOptions options; // Default options
+    auto status = google::protobuf::util::MessageToJsonString(msg, &jsonMsg, options);
+
+    // Reading on another thread since the response is larger than the socket buffers.
+    std::string response;
+    std::thread reader([this, &response]() {
+        boost::system::error_code ec;
+        boost::asio::streambuf buffer;
+        boost::asio::read(clientSocket_, buffer, ec);
+        response = std::string(boost::asio::buffers_begin(buffer.data()), boost::asio::buffers_end(buffer.data()));
+    });
+    // Writing enough messages to exceed CHUNK_BYTES.
+    SocketWriter writer(serverSocket_, origin_, true);
+    std::string expJson = "{\"data\":[";
+    for (std::size_t i = 0; i < 3 * CHUNK_BYTES / jsonMsg.size(); ++i) {
+        writer.sendResponse(rc, msg);
+        expJson += (i == 0 ? "" : ",") + jsonMsg;
+    }
+    expJson += "]}";
+    writer.sendResponse(rc);
+    serverSocket_.close();
+    reader.join();
+
+    // Headers announce a chunked body instead of its length.
+    std::size_t headerEnd = response.find("\r\n\r\n");
+    ASSERT_NE(headerEnd, std::string::npos);
+    std::string headers = response.substr(0, headerEnd);
+    EXPECT_TRUE(headers.starts_with("HTTP/1.1 200 OK"));
+    EXPECT_NE(headers.find("Transfer-Encoding: chunked"), std::string::npos);
+    EXPECT_EQ(headers.find("Content-Length"), std::string::npos);
+    // Reassembling the chunks, which must end with a zero length chunk.
+    std::string body;
+    std::size_t pos = headerEnd + 4;
+    std::size_t chunks = 0;
+    while (true) {
+        std::size_t lineEnd = response.find("\r\n", pos);
+        ASSERT_NE(lineEnd, std::string::npos);
+        std::size_t size = std::stoul(response.substr(pos, lineEnd - pos), nullptr, 16);
+        if (size == 0) {
+            EXPECT_EQ(response.substr(lineEnd), "\r\n\r\n");
+            break;
+        }
+        body += response.substr(lineEnd + 2, size);
+        pos = lineEnd + 2 + size + 2;
+        chunks++;
+    }
+    EXPECT_GT(chunks, 1);
+    EXPECT_EQ(body, expJson);
+}
+
+/* 
+ * TEST 8 - SocketWriter closes the connection on an error mid-stream.
+ */
+TEST_F(RESTSocketWriterTests, SocketWriter_BufferChunkedErr) {
+    st2138::Value msg;
+    msg.set_string_value(std::string(CHUNK_BYTES, 'a'));
+    std::string response;
+    std::thread reader([this, &response]() {
+        boost::system::error_code ec;
+        boost::asio::streambuf buffer;
+        boost::asio::read(clientSocket_, buffer, ec);
+        response = std::string(boost::asio::buffers_begin(buffer.data()), boost::asio::buffers_end(buffer.data()));
+    });
+    SocketWriter writer(serverSocket_, origin_, true);
+    writer.sendResponse(catena::exception_with_status("", catena::StatusCode::OK), msg);
+    writer.sendResponse(catena::exception_with_status("Internal", catena::StatusCode::INTERNAL));
+    // The 200 has already been sent, so the response is cut short instead.
+    EXPECT_FALSE(serverSocket_.is_open());
+    reader.join();
+    EXPECT_TRUE(response.starts_with("HTTP/1.1 200 OK"));
+    EXPECT_FALSE(response.ends_with("0\r\n\r\n"));
+}
+
+/* 
+ * TEST 9 - writeWithTimeout writes every buffer to a client which reads.
+ */
+TEST_F(RESTSocketWriterTests, SocketWriter_WriteWithTimeout) {
+    std::string head = "head:";
+    std::string empty = "";
+    std::string body(4 * 1024 * 1024, 'b');
+    std::string received;
+    std::thread reader([this, &received, size = head.size() + body.size()]() {
+        received.resize(size);
+        boost::system::error_code ec;
+        boost::asio::read(clientSocket_, boost::asio::buffer(received), ec);
+    });
+    auto ec = writeWithTimeout(serverSocket_, {boost::asio::buffer(head), boost::asio::buffer(empty), boost::asio::buffer(body)}, std::chrono::seconds(10));
+    reader.join();
+    EXPECT_FALSE(ec) << ec.message();
+    EXPECT_EQ(received, head + body);
+    // The socket is left in blocking mode.
+    EXPECT_FALSE(serverSocket_.non_blocking());
+}
+
+/* 
+ * TEST 10 - writeWithTimeout gives up on a client which stops reading, and
+ *           SocketWriter closes its connection.
+ */
+TEST_F(RESTSocketWriterTests, SocketWriter_WriteTimeout) {
+    // More than the socket buffers can hold, and nothing reads it.
+    std::string body(64 * 1024 * 1024, 'b');
+    auto start = std::chrono::steady_clock::now();
+    auto ec = writeWithTimeout(serverSocket_, {boost::asio::buffer(body)}, std::chrono::milliseconds(200));
+    EXPECT_EQ(ec, boost::asio::error::timed_out);
+    EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(200));
+
+    uint32_t timeout = config::rest_write_timeout;
+    config::rest_write_timeout = 0;
+    st2138::Value msg;
+    msg.set_string_value(body);
+    SocketWriter writer(serverSocket_, origin_);
+    writer.sendResponse(catena::exception_with_status("", catena::StatusCode::OK), msg);
+    config::rest_write_timeout = timeout;
+    EXPECT_FALSE(serverSocket_.is_open());
+}
+
 /*
  * ============================================================================
  *                               SSEWriter tests
@@ -312,7 +437,28 @@ TEST_F(RESTSocketWriterTests, SSEWriter_WriteErrEnd) {
 }
 
 /* 
- * TEST 6 - SocketWriter handles graceful shutdown when client disconnects.
+ * TEST 6 - SSEWriter writes pre-converted JSON the same as messages.
+ */
+TEST_F(RESTSocketWriterTests, SSEWriter_SendEvent) {
+    catena::exception_with_status rc("", catena::StatusCode::OK);
+    std::vector<std::string> msgs = {
+        "{\"stringValue\":\"Test string #1\"}",
+        "{\"int32Value\":5}"
+    };
+
+    // Initializing SSEWriter with serverSocket_ and writing events.
+    SSEWriter writer(serverSocket_, origin_);
+    for (const std::string& msgJson : msgs) {
+        writer.sendEvent(msgJson);
+    }
+    writer.sendEvent("");
+
+    // Reading from clientSocket_ and checking the response.
+    EXPECT_EQ(readResponse(), expectedSSEResponse(rc, msgs));
+}
+
+/* 
+ * TEST 7 - SocketWriter handles graceful shutdown when client disconnects.
  * This test verifies that the bug fix properly handles socket write errors
  * when the client disconnects unexpectedly. Tests that write errors don't
  * cause crashes and are handled gracefully without throwing exceptions.
@@ -353,3 +499,18 @@ TEST_F(RESTSocketWriterTests, GracefulShutdownOnClientDisconnect) {
     }
     EXPECT_TRUE(socketClosed) << "Socket should have been closed after detecting write error";
 }
+
+/* 
+ * TEST 8 - SSEWriter sends the id of the Connect writing the stream.
+ */
+TEST_F(RESTSocketWriterTests, SSEWriter_ConnectionId) {
+    catena::exception_with_status rc("", catena::StatusCode::OK);
+    std::vector<std::string> msgs = {"{\"int32Value\":5}"};
+    std::string connectionId = "0123456789abcdef0123456789abcdef";
+
+    SSEWriter writer(serverSocket_, origin_, connectionId);
+    writer.sendEvent(msgs[0]);
+
+    // Reading from clientSocket_ and checking the response.
+    EXPECT_EQ(readResponse(), expectedSSEResponse(rc, msgs, connectionId));
+}
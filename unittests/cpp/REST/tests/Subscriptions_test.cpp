@@ -74,8 +74,8 @@ class RESTSubscriptionsTests : public RESTEndpointTest {
         EXPECT_CALL(dm1_, subscriptions()).Times(0);
         EXPECT_CALL(dm1_, getParam(testing::An<const std::string&>(), testing::_, testing::_)).Times(0);
         // Default expectations for sub manager.
-        EXPECT_CALL(subManager_, getAllSubscribedOids(testing::_))
-            .WillRepeatedly(testing::Invoke([this](const catena::common::IDevice &dm){
+        EXPECT_CALL(subManager_, getAllSubscribedOids(testing::_, testing::_))
+            .WillRepeatedly(testing::Invoke([this](const catena::common::IDevice &dm, const std::string& scope){
                 // Make sure device is passed in.
                 EXPECT_EQ(&dm, &dm0_);
                 return std::set<std::string>(oids_.begin(), oids_.end());
@@ -112,15 +112,15 @@ class RESTSubscriptionsTests : public RESTEndpointTest {
                 }));
 
             // Default expectations for test params_ for PUT calls.
-            EXPECT_CALL(subManager_, removeSubscription(oids_[i], testing::_, testing::_)).WillRepeatedly(testing::Invoke(
-                [this](const std::string& oid, const catena::common::IDevice& dm, catena::exception_with_status& rc) {
+            EXPECT_CALL(subManager_, removeSubscription(oids_[i], testing::_, testing::_, testing::_)).WillRepeatedly(testing::Invoke(
+                [this](const std::string& oid, const catena::common::IDevice& dm, catena::exception_with_status& rc, const std::string& scope) {
                     // Make sure device is correctly passed in.
                     EXPECT_EQ(&dm, &dm0_);
                     this->removedOids_++;
                     return true;
                 }));
-            EXPECT_CALL(subManager_, addSubscription(oids_[i], testing::_, testing::_, testing::_)).WillRepeatedly(testing::Invoke(
-                [this](const std::string& oid, const catena::common::IDevice& dm, catena::exception_with_status& rc, const IAuthorizer& authz) {
+            EXPECT_CALL(subManager_, addSubscription(oids_[i], testing::_, testing::_, testing::_, testing::_)).WillRepeatedly(testing::Invoke(
+                [this](const std::string& oid, const catena::common::IDevice& dm, catena::exception_with_status& rc, const IAuthorizer& authz, const std::string& scope) {
                     // Make sure authz and device are correctly passed in.
                     EXPECT_EQ(!authzEnabled_, &authz == &Authorizer::kAuthzDisabled);
                     EXPECT_EQ(&dm, &dm0_);
@@ -522,15 +522,15 @@ TEST_F(RESTSubscriptionsTests, Subscriptions_PUTReturnErr) {
     initPayload(0, {"errParam", "param1", "param2"}, {"errParam", "param1", "param2"});
     
     // Set up expectations for errParam specifically to increment counters
-    EXPECT_CALL(subManager_, removeSubscription("errParam", testing::_, testing::_)).WillRepeatedly(testing::Invoke(
-        [this](const std::string& oid, const catena::common::IDevice& dm, catena::exception_with_status& rc) {
+    EXPECT_CALL(subManager_, removeSubscription("errParam", testing::_, testing::_, testing::_)).WillRepeatedly(testing::Invoke(
+        [this](const std::string& oid, const catena::common::IDevice& dm, catena::exception_with_status& rc, const std::string& scope) {
             // Simulating an error in removing subscription.
             rc = catena::exception_with_status("Failed to remove subscription", catena::StatusCode::INVALID_ARGUMENT);
             this->removedOids_++; 
             return false;
         }));
-    EXPECT_CALL(subManager_, addSubscription("errParam", testing::_, testing::_, testing::_)).WillRepeatedly(testing::Invoke(
-        [this](const std::string& oid, const catena::common::IDevice& dm, catena::exception_with_status& rc, const IAuthorizer& authz) {
+    EXPECT_CALL(subManager_, addSubscription("errParam", testing::_, testing::_, testing::_, testing::_)).WillRepeatedly(testing::Invoke(
+        [this](const std::string& oid, const catena::common::IDevice& dm, catena::exception_with_status& rc, const IAuthorizer& authz, const std::string& scope) {
             // Simulating an error in adding subscription.
             rc = catena::exception_with_status("Failed to add subscription", catena::StatusCode::INVALID_ARGUMENT);
             this->addedOids_++;
@@ -549,8 +549,8 @@ TEST_F(RESTSubscriptionsTests, Subscriptions_PUTRemThrowCatena) {
     expRc_ = catena::exception_with_status{"Failed to remove subscription", catena::StatusCode::INVALID_ARGUMENT};
     initPayload(0, {}, {"errParam", "param1", "param2"});
     // Setting expectations.
-    EXPECT_CALL(subManager_, removeSubscription("errParam", testing::_, testing::_)).WillRepeatedly(testing::Invoke(
-        [this](const std::string& oid, const catena::common::IDevice& dm, catena::exception_with_status& rc) {
+    EXPECT_CALL(subManager_, removeSubscription("errParam", testing::_, testing::_, testing::_)).WillRepeatedly(testing::Invoke(
+        [this](const std::string& oid, const catena::common::IDevice& dm, catena::exception_with_status& rc, const std::string& scope) {
             // Simulating an error in removing subscription.
             throw catena::exception_with_status(expRc_.what(), expRc_.status);
             return false;
@@ -567,7 +567,7 @@ TEST_F(RESTSubscriptionsTests, Subscriptions_PUTRemThrowUnknown) {
     expRc_ = catena::exception_with_status{"Unknown error", catena::StatusCode::UNKNOWN};
     initPayload(0, {}, {"errParam", "param1", "param2"});
     // Setting expectations.
-    EXPECT_CALL(subManager_, removeSubscription("errParam", testing::_, testing::_))
+    EXPECT_CALL(subManager_, removeSubscription("errParam", testing::_, testing::_, testing::_))
         .WillRepeatedly(testing::Throw(std::runtime_error(expRc_.what())));
     // Calling proceed and testing the output
     testCall();
@@ -581,8 +581,8 @@ TEST_F(RESTSubscriptionsTests, Subscriptions_PUTAddThrowCatena) {
     expRc_ = catena::exception_with_status{"Failed to remove subscription", catena::StatusCode::INVALID_ARGUMENT};
     initPayload(0, {"errParam", "param1", "param2"}, {});
     // Setting expectations.
-    EXPECT_CALL(subManager_, addSubscription("errParam", testing::_, testing::_, testing::_)).WillRepeatedly(testing::Invoke(
-        [this](const std::string& oid, const catena::common::IDevice& dm, catena::exception_with_status& rc, const IAuthorizer& authz) {
+    EXPECT_CALL(subManager_, addSubscription("errParam", testing::_, testing::_, testing::_, testing::_)).WillRepeatedly(testing::Invoke(
+        [this](const std::string& oid, const catena::common::IDevice& dm, catena::exception_with_status& rc, const IAuthorizer& authz, const std::string& scope) {
             // Simulating an error in adding subscription.
             throw catena::exception_with_status(expRc_.what(), expRc_.status);
             return false;
@@ -599,8 +599,51 @@ TEST_F(RESTSubscriptionsTests, Subscriptions_PUTAddThrowUnknown) {
     expRc_ = catena::exception_with_status{"Unknown error", catena::StatusCode::UNKNOWN};
     initPayload(0, {"errParam", "param1", "param2"}, {});
     // Setting expectations.
-    EXPECT_CALL(subManager_, addSubscription("errParam", testing::_, testing::_, testing::_))
+    EXPECT_CALL(subManager_, addSubscription("errParam", testing::_, testing::_, testing::_, testing::_))
         .WillRepeatedly(testing::Throw(std::runtime_error(expRc_.what())));
     // Calling proceed and testing the output
     testCall();
 }
+
+/* 
+ * TEST 2.12 - PUT Subscriptions for a Connect which is not open returns the
+ * error.
+ */
+TEST_F(RESTSubscriptionsTests, Subscriptions_PUTScopeNotOpen) {
+    method_ = Method_PUT;
+    expRc_ = catena::exception_with_status{"No open connection for subscription scope", catena::StatusCode::FAILED_PRECONDITION};
+    initPayload(0, {"param1", "param2"}, {});
+    // Setting expectations.
+    EXPECT_CALL(subManager_, addSubscription("param1", testing::_, testing::_, testing::_, testing::_)).WillOnce(testing::Invoke(
+        [this](const std::string& oid, const catena::common::IDevice& dm, catena::exception_with_status& rc, const IAuthorizer& authz, const std::string& scope) {
+            rc = catena::exception_with_status(expRc_.what(), expRc_.status);
+            return false;
+        }));
+    EXPECT_CALL(subManager_, addSubscription("param2", testing::_, testing::_, testing::_, testing::_)).Times(0);
+    // Calling proceed and testing the output
+    testCall();
+}
+
+/* 
+ * TEST 2.13 - PUT Subscriptions changes the scope of the Connect the client
+ * names.
+ */
+TEST_F(RESTSubscriptionsTests, Subscriptions_PUTConnectionId) {
+    method_ = Method_PUT;
+    connectionId_ = "0123456789abcdef0123456789abcdef";
+    const std::string scope = catena::common::ISubscriptionManager::scopeKey("", connectionId_);
+    initPayload(0, {"param1"}, {"param2"});
+    // Setting expectations.
+    EXPECT_CALL(subManager_, addSubscription("param1", testing::_, testing::_, testing::_, scope)).WillOnce(testing::Invoke(
+        [this](const std::string& oid, const catena::common::IDevice& dm, catena::exception_with_status& rc, const IAuthorizer& authz, const std::string& scope) {
+            this->addedOids_++;
+            return true;
+        }));
+    EXPECT_CALL(subManager_, removeSubscription("param2", testing::_, testing::_, scope)).WillOnce(testing::Invoke(
+        [this](const std::string& oid, const catena::common::IDevice& dm, catena::exception_with_status& rc, const std::string& scope) {
+            this->removedOids_++;
+            return true;
+        }));
+    // Calling proceed and testing the output
+    testCall();
+}
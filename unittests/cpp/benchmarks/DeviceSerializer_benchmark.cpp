@@ -0,0 +1,107 @@
+/*
+ * Copyright 2026 Ross Video Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @brief Micro-benchmark of serializing a device for a FULL DeviceRequest,
+ * reporting how the serializer uses the ArenaPool.
+ * @file DeviceSerializer_benchmark.cpp
+ * @copyright Copyright © 2026 Ross Video Ltd
+ */
+
+// benchmark
+#include <benchmark/benchmark.h>
+
+// common
+#include "Authorizer.h"
+#include "Device.h"
+#include "ParamDescriptor.h"
+#include "ParamWithValue.h"
+#include "rpc/ArenaPool.h"
+
+#include <deque>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <vector>
+
+using namespace catena::common;
+
+namespace {
+
+/**
+ * @brief A device with the given number of string params.
+ */
+class StringDeviceModel {
+  public:
+    explicit StringDeviceModel(std::size_t params) : values_(params, std::string(32, 'a')) {
+        for (std::size_t i = 0; i < params; ++i) {
+            std::string oid = "param_" + std::to_string(i);
+            auto& descriptor = descriptors_.emplace_back(st2138::ParamType::STRING, OidAliases{}, PolyglotText::ListInitializer{{"en", oid}}, "", "", false, false, oid, "", nullptr, false, false, dm_, 0, 0, 2, false, nullptr);
+            params_.push_back(std::make_unique<ParamWithValue<std::string>>(values_[i], descriptor, dm_, false));
+        }
+    }
+
+    Device& device() { return dm_; }
+
+  private:
+    Device dm_;
+    std::vector<std::string> values_;
+    std::deque<ParamDescriptor> descriptors_;
+    std::vector<std::unique_ptr<ParamWithValue<std::string>>> params_;
+};
+
+}  // namespace
+
+/*
+ * Counters are per iteration: leases taken, bytes built on the arenas, and
+ * bytes which did not fit in the arenas' blocks. arenas is the number the
+ * pool had to create over the whole run.
+ */
+static void BM_DeviceSerializer(benchmark::State& state) {
+    StringDeviceModel model(state.range(0));
+    ArenaPool::Stats before = ArenaPool::instance().stats();
+    std::size_t components = 0;
+    for (auto _ : state) {
+        std::shared_lock lock(model.device().mutex());
+        auto serializer = model.device().getDeviceSerializer(Authorizer::kAuthzDisabled, {}, st2138::Device_DetailLevel_FULL);
+        components = 0;
+        while (serializer.hasMore()) {
+            benchmark::DoNotOptimize(&serializer.getNext());
+            ++components;
+        }
+    }
+    ArenaPool::Stats after = ArenaPool::instance().stats();
+    state.SetItemsProcessed(state.iterations() * components);
+    state.counters["leases"] = benchmark::Counter(after.leases - before.leases, benchmark::Counter::kAvgIterations);
+    state.counters["arenas"] = benchmark::Counter(after.arenas - before.arenas);
+    state.counters["bytesUsed"] = benchmark::Counter(after.bytesUsed - before.bytesUsed, benchmark::Counter::kAvgIterations);
+    state.counters["bytesSpilled"] = benchmark::Counter(after.bytesSpilled - before.bytesSpilled, benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(BM_DeviceSerializer)->RangeMultiplier(8)->Range(8, 4096);
@@ -0,0 +1,100 @@
+/*
+ * Copyright 2026 Ross Video Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @brief Micro-benchmark comparing the direct JSON reader with protobuf's
+ * JsonStringToMessage for the set value requests REST receives.
+ * @file JsonReader_benchmark.cpp
+ * @copyright Copyright © 2026 Ross Video Ltd
+ */
+
+// benchmark
+#include <benchmark/benchmark.h>
+
+// common
+#include "JsonReader.h"
+
+// protobuf
+#include <google/protobuf/util/json_util.h>
+
+#include <random>
+#include <string>
+
+using namespace catena::common;
+
+/*
+ * The JSON of a preset recall setting n struct params.
+ */
+static std::string makeRecall(size_t n) {
+    std::mt19937 rng(2138);
+    std::uniform_real_distribution<float> dist(-1000.0f, 1000.0f);
+    st2138::MultiSetValuePayload reqs;
+    reqs.set_slot(1);
+    for (size_t i = 0; i < n; ++i) {
+        st2138::SetValuePayload& req = *reqs.add_values();
+        req.set_oid("/audio/channels/" + std::to_string(i));
+        auto& fields = *req.mutable_value()->mutable_struct_value()->mutable_fields();
+        fields["gain"].set_float32_value(dist(rng));
+        fields["name"].set_string_value("input " + std::to_string(i));
+        fields["mute"].set_int32_value(static_cast<int32_t>(i % 2));
+        for (int j = 0; j < 8; ++j) {
+            fields["eq"].mutable_float32_array_values()->add_floats(dist(rng));
+        }
+    }
+    std::string ans;
+    google::protobuf::util::MessageToJsonString(reqs, &ans);
+    return ans;
+}
+
+/*
+ * Baseline: the reflection based protobuf parser.
+ */
+static void BM_JsonStringToMessage(benchmark::State& state) {
+    const std::string json = makeRecall(state.range(0));
+    for (auto _ : state) {
+        st2138::MultiSetValuePayload reqs;
+        benchmark::DoNotOptimize(google::protobuf::util::JsonStringToMessage(json, &reqs).ok());
+    }
+    state.SetBytesProcessed(state.iterations() * json.size());
+}
+BENCHMARK(BM_JsonStringToMessage)->Arg(1)->Arg(64)->Arg(1024);
+
+/*
+ * The direct reader.
+ */
+static void BM_ParseJson(benchmark::State& state) {
+    const std::string json = makeRecall(state.range(0));
+    for (auto _ : state) {
+        st2138::MultiSetValuePayload reqs;
+        benchmark::DoNotOptimize(parseJson(json, reqs));
+    }
+    state.SetBytesProcessed(state.iterations() * json.size());
+}
+BENCHMARK(BM_ParseJson)->Arg(1)->Arg(64)->Arg(1024);
@@ -0,0 +1,138 @@
+/*
+ * Copyright 2026 Ross Video Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @brief Micro-benchmark comparing the direct JSON writer with protobuf's
+ * MessageToJsonString for the values and push updates REST sends.
+ * @file JsonWriter_benchmark.cpp
+ * @copyright Copyright © 2026 Ross Video Ltd
+ */
+
+// benchmark
+#include <benchmark/benchmark.h>
+
+// common
+#include "JsonWriter.h"
+
+// protobuf
+#include <google/protobuf/util/json_util.h>
+
+#include <random>
+#include <string>
+
+using namespace catena::common;
+
+/*
+ * The kinds of value benchmarked, selected by the benchmark's first arg.
+ */
+enum Kind : int64_t { kFloats = 0, kStrings = 1, kStructs = 2 };
+
+/*
+ * A value of the given kind with n elements.
+ */
+static st2138::Value makeValue(int64_t kind, size_t n) {
+    std::mt19937 rng(2138);
+    std::uniform_real_distribution<float> dist(-1000.0f, 1000.0f);
+    st2138::Value ans;
+    for (size_t i = 0; i < n; ++i) {
+        if (kind == kFloats) {
+            ans.mutable_float32_array_values()->add_floats(dist(rng));
+        } else if (kind == kStrings) {
+            ans.mutable_string_array_values()->add_strings("channel \"" + std::to_string(i) + "\"\n");
+        } else {
+            auto& fields = *ans.mutable_struct_array_values()->add_struct_values()->mutable_fields();
+            fields["gain"].set_float32_value(dist(rng));
+            fields["name"].set_string_value("input " + std::to_string(i));
+            fields["mute"].set_int32_value(static_cast<int32_t>(i % 2));
+        }
+    }
+    return ans;
+}
+
+/*
+ * Baseline: the reflection based protobuf printer.
+ */
+static void BM_MessageToJsonString(benchmark::State& state) {
+    const st2138::Value value = makeValue(state.range(0), state.range(1));
+    google::protobuf::util::JsonPrintOptions options;
+    std::string json;
+    for (auto _ : state) {
+        json.clear();
+        benchmark::DoNotOptimize(google::protobuf::util::MessageToJsonString(value, &json, options).ok());
+    }
+    state.SetBytesProcessed(state.iterations() * json.size());
+}
+BENCHMARK(BM_MessageToJsonString)->ArgsProduct({{kFloats, kStrings, kStructs}, {16, 1024}});
+
+/*
+ * The direct writer, reusing its output buffer as SocketWriter does.
+ */
+static void BM_AppendJson(benchmark::State& state) {
+    const st2138::Value value = makeValue(state.range(0), state.range(1));
+    std::string json;
+    for (auto _ : state) {
+        json.clear();
+        benchmark::DoNotOptimize(appendJson(json, value));
+    }
+    state.SetBytesProcessed(state.iterations() * json.size());
+}
+BENCHMARK(BM_AppendJson)->ArgsProduct({{kFloats, kStrings, kStructs}, {16, 1024}});
+
+/*
+ * A single param update, as converted once per SharedUpdate.
+ */
+static st2138::PushUpdates makeUpdate() {
+    st2138::PushUpdates ans;
+    ans.set_slot(1);
+    ans.mutable_value()->set_oid("/audio/channels/3/gain");
+    ans.mutable_value()->mutable_value()->set_float32_value(-12.5f);
+    return ans;
+}
+
+static void BM_PushUpdate_MessageToJsonString(benchmark::State& state) {
+    const st2138::PushUpdates update = makeUpdate();
+    google::protobuf::util::JsonPrintOptions options;
+    for (auto _ : state) {
+        std::string json;
+        benchmark::DoNotOptimize(google::protobuf::util::MessageToJsonString(update, &json, options).ok());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_PushUpdate_MessageToJsonString);
+
+static void BM_PushUpdate_AppendJson(benchmark::State& state) {
+    const st2138::PushUpdates update = makeUpdate();
+    for (auto _ : state) {
+        std::string json;
+        benchmark::DoNotOptimize(appendJson(json, update));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_PushUpdate_AppendJson);
@@ -0,0 +1,202 @@
+/*
+ * Copyright 2026 Ross Video Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+
+/**
+ * @brief Micro-benchmark comparing a visitor traversal that re-resolves every
+ * child from the device root with ParamVisitor::traverseParams, which
+ * resolves children directly from their parent.
+ * @file ParamVisitor_benchmark.cpp
+ * @copyright Copyright © 2026 Ross Video Ltd
+ */
+
+// benchmark
+#include <benchmark/benchmark.h>
+
+// common
+#include "Authorizer.h"
+#include "Device.h"
+#include "ParamDescriptor.h"
+#include "ParamVisitor.h"
+#include "ParamWithValue.h"
+#include "Path.h"
+#include "StructInfo.h"
+
+#include <deque>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace catena::common;
+
+/*
+ * An AudioDeck style model: an array of channels, each with a struct of
+ * scalar controls and an array of eq bands.
+ */
+struct EqBand {
+    int32_t response;
+    float frequency;
+    float gain;
+    float q;
+    using isCatenaStruct = void;
+};
+template<>
+struct StructInfo<EqBand> {
+    using Type = std::tuple<FieldInfo<int32_t, EqBand>, FieldInfo<float, EqBand>, FieldInfo<float, EqBand>, FieldInfo<float, EqBand>>;
+    static constexpr Type fields = {{"response", &EqBand::response}, {"frequency", &EqBand::frequency}, {"gain", &EqBand::gain}, {"q", &EqBand::q}};
+};
+
+struct AudioChannel {
+    float fader;
+    int32_t mute;
+    float pan;
+    using isCatenaStruct = void;
+};
+template<>
+struct StructInfo<AudioChannel> {
+    using Type = std::tuple<FieldInfo<float, AudioChannel>, FieldInfo<int32_t, AudioChannel>, FieldInfo<float, AudioChannel>>;
+    static constexpr Type fields = {{"fader", &AudioChannel::fader}, {"mute", &AudioChannel::mute}, {"pan", &AudioChannel::pan}};
+};
+
+struct AudioSlot {
+    AudioChannel audio_channel;
+    std::vector<EqBand> eq_list;
+    using isCatenaStruct = void;
+};
+template<>
+struct StructInfo<AudioSlot> {
+    using Type = std::tuple<FieldInfo<AudioChannel, AudioSlot>, FieldInfo<std::vector<EqBand>, AudioSlot>>;
+    static constexpr Type fields = {{"audio_channel", &AudioSlot::audio_channel}, {"eq_list", &AudioSlot::eq_list}};
+};
+
+namespace {
+
+constexpr std::size_t kEqBands = 4;
+
+/**
+ * @brief The device model the benchmarks traverse.
+ */
+class AudioDeckModel {
+  public:
+    explicit AudioDeckModel(std::size_t channels)
+        : deck_(channels, AudioSlot{{0.0f, 0, 0.0f}, std::vector<EqBand>(kEqBands)}) {
+        auto& deck = descriptor_(st2138::ParamType::STRUCT_ARRAY, "audio_deck", nullptr);
+        auto& channel = descriptor_(st2138::ParamType::STRUCT, "audio_channel", &deck);
+        descriptor_(st2138::ParamType::FLOAT32, "fader", &channel);
+        descriptor_(st2138::ParamType::INT32, "mute", &channel);
+        descriptor_(st2138::ParamType::FLOAT32, "pan", &channel);
+        auto& eqList = descriptor_(st2138::ParamType::STRUCT_ARRAY, "eq_list", &deck);
+        descriptor_(st2138::ParamType::INT32, "response", &eqList);
+        descriptor_(st2138::ParamType::FLOAT32, "frequency", &eqList);
+        descriptor_(st2138::ParamType::FLOAT32, "gain", &eqList);
+        descriptor_(st2138::ParamType::FLOAT32, "q", &eqList);
+        param_ = std::make_unique<ParamWithValue<std::vector<AudioSlot>>>(deck_, deck, dm_, false);
+    }
+
+    Device& device() { return dm_; }
+    IParam* root() { return param_.get(); }
+
+  private:
+    ParamDescriptor& descriptor_(st2138::ParamType type, const std::string& oid, IParamDescriptor* parent) {
+        return descriptors_.emplace_back(type, OidAliases{}, PolyglotText::ListInitializer{{"en", oid}}, "", "", false, false, oid, "", nullptr, false, false, dm_, 0, 0, 2, false, parent);
+    }
+
+    Device dm_;
+    std::vector<AudioSlot> deck_;
+    std::deque<ParamDescriptor> descriptors_;
+    std::unique_ptr<ParamWithValue<std::vector<AudioSlot>>> param_;
+};
+
+/**
+ * @brief Counts the params it is shown.
+ */
+class CountingVisitor : public IParamVisitor {
+  public:
+    void visit(IParam* param, const std::string& path) override { benchmark::DoNotOptimize(path.data()); ++count; }
+    void visitArray(IParam* param, const std::string& path, uint32_t length) override {}
+    std::size_t count = 0;
+};
+
+/**
+ * @brief The traversal ParamVisitor used before it resolved children from
+ * their parent, kept here as the reference point for the benchmark.
+ */
+void legacyTraverse(IParam* param, const std::string& path, const IDevice& device, IParamVisitor& visitor, const IAuthorizer& authz) {
+    visitor.visit(param, path);
+    if (param->isArrayType()) {
+        uint32_t length = param->size();
+        if (length > 0) {
+            visitor.visitArray(param, path, length);
+            for (uint32_t i = 0; i < length; i++) {
+                Path indexed(path);
+                indexed.push_back(std::to_string(i));
+                catena::exception_with_status rc{"", catena::StatusCode::OK};
+                auto element = device.getParam(indexed.toString(true), rc, authz);
+                if (element && authz.readAuthz(*element)) {
+                    legacyTraverse(element.get(), indexed.toString(true), device, visitor, authz);
+                }
+            }
+        }
+    }
+    for (const auto& [name, desc] : param->getDescriptor().getAllSubParams()) {
+        if (name.empty() || name[0] == '/') continue;
+        Path child(path);
+        child.push_back(name);
+        catena::exception_with_status rc{"", catena::StatusCode::OK};
+        auto sub = device.getParam(child.toString(true), rc, authz);
+        if (rc.status == catena::StatusCode::OK && sub && authz.readAuthz(*sub)) {
+            legacyTraverse(sub.get(), child.toString(true), device, visitor, authz);
+        }
+    }
+}
+
+}  // namespace
+
+static void BM_TraverseFromDeviceRoot(benchmark::State& state) {
+    AudioDeckModel model(state.range(0));
+    std::size_t visited = 0;
+    for (auto _ : state) {
+        CountingVisitor visitor;
+        legacyTraverse(model.root(), "/audio_deck", model.device(), visitor, Authorizer::kAuthzDisabled);
+        visited = visitor.count;
+    }
+    state.SetItemsProcessed(state.iterations() * visited);
+}
+BENCHMARK(BM_TraverseFromDeviceRoot)->RangeMultiplier(8)->Range(8, 4096);
+
+static void BM_TraverseFromParent(benchmark::State& state) {
+    AudioDeckModel model(state.range(0));
+    std::size_t visited = 0;
+    for (auto _ : state) {
+        CountingVisitor visitor;
+        ParamVisitor::traverseParams(model.root(), "/audio_deck", visitor, Authorizer::kAuthzDisabled);
+        visited = visitor.count;
+    }
+    state.SetItemsProcessed(state.iterations() * visited);
+}
+BENCHMARK(BM_TraverseFromParent)->RangeMultiplier(8)->Range(8, 4096);
@@ -0,0 +1,125 @@
+/*
+ * Copyright 2026 Ross Video Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @brief Micro-benchmark comparing the regex based json-pointer parser that
+ * Path used to rely on with the single pass parser in Path.cpp.
+ * @file Path_benchmark.cpp
+ * @copyright Copyright © 2026 Ross Video Ltd
+ */
+
+// benchmark
+#include <benchmark/benchmark.h>
+
+// common
+#include "Path.h"
+
+#include <regex>
+#include <string>
+#include <variant>
+#include <vector>
+
+using catena::common::Path;
+
+namespace {
+
+/**
+ * @brief Realistic fqoids, taken from the example device models.
+ */
+const std::vector<std::string> kFqoids = {
+    "/counter",
+    "/hello",
+    "/audio_deck/12/eq_list/3/response",
+    "/audio_deck/0/audio_channel/fader",
+    "/product/serial_number",
+    "/audio_deck/-",
+    "/number_example/0/struct_array/254/nested_struct/float_field",
+};
+
+/**
+ * @brief The regex based parser Path used before it was replaced, kept here
+ * as the reference point for the benchmark.
+ */
+std::vector<Path::Segment> legacyParse(const std::string& jptr) {
+    const std::string kSegmentRegex = "(\\/[a-zA-Z_]\\w*)|(\\/\\d+)|(\\/-)";
+    const std::string kPathRegex = "(" + kSegmentRegex + ")*";
+    std::vector<Path::Segment> segments;
+    std::regex path_regex(kPathRegex);
+    if (!std::regex_match(jptr, path_regex)) {
+        return segments;
+    }
+    std::regex segment_regex(kSegmentRegex);
+    for (auto it = std::sregex_iterator(jptr.begin(), jptr.end(), segment_regex); it != std::sregex_iterator(); ++it) {
+        std::smatch match = *it;
+        std::string txt = match.str().substr(1, std::string::npos);
+        if (match[1].matched) {
+            segments.emplace_back(std::in_place_type<std::string>, txt);
+        } else if (match[2].matched) {
+            segments.emplace_back(std::in_place_type<Path::Index>, std::stoul(txt));
+        } else {
+            segments.emplace_back(std::in_place_type<Path::Index>, Path::kEnd);
+        }
+    }
+    return segments;
+}
+
+}  // namespace
+
+static void BM_LegacyRegexParse(benchmark::State& state) {
+    for (auto _ : state) {
+        for (const auto& fqoid : kFqoids) {
+            benchmark::DoNotOptimize(legacyParse(fqoid));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * kFqoids.size());
+}
+BENCHMARK(BM_LegacyRegexParse);
+
+static void BM_PathParse(benchmark::State& state) {
+    for (auto _ : state) {
+        for (const auto& fqoid : kFqoids) {
+            Path path(fqoid);
+            benchmark::DoNotOptimize(path);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * kFqoids.size());
+}
+BENCHMARK(BM_PathParse);
+
+static void BM_PathParseAndFqoid(benchmark::State& state) {
+    for (auto _ : state) {
+        for (const auto& fqoid : kFqoids) {
+            Path path(fqoid);
+            benchmark::DoNotOptimize(path.fqoid());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * kFqoids.size());
+}
+BENCHMARK(BM_PathParseAndFqoid);
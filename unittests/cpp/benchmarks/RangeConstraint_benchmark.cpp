@@ -0,0 +1,126 @@
+/*
+ * Copyright 2026 Ross Video Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @brief Micro-benchmark comparing clamping a float array one boxed value
+ * at a time through RangeConstraint::apply with the scalar and dispatched
+ * range kernels used by RangeConstraint::clamp.
+ * @file RangeConstraint_benchmark.cpp
+ * @copyright Copyright © 2026 Ross Video Ltd
+ */
+
+// benchmark
+#include <benchmark/benchmark.h>
+
+// common
+#include "RangeConstraint.h"
+#include "RangeKernels.h"
+
+#include <random>
+#include <vector>
+
+using namespace catena::common;
+
+/*
+ * A stepped range with inputs spread past both bounds.
+ */
+static constexpr float kMin = -100.0f;
+static constexpr float kMax = 100.0f;
+static constexpr float kStep = 0.5f;
+
+static std::vector<float> makeValues(size_t n) {
+    std::mt19937 rng(2138);
+    std::uniform_real_distribution<float> dist(2 * kMin, 2 * kMax);
+    std::vector<float> ans(n);
+    for (float& v : ans) { v = dist(rng); }
+    return ans;
+}
+
+/*
+ * Baseline: each element boxed into a st2138::Value and passed to apply.
+ */
+static void BM_ApplyPerElement(benchmark::State& state) {
+    RangeConstraint<float> constraint(kMin, kMax, kStep, "bench", false);
+    const std::vector<float> src = makeValues(state.range(0));
+    std::vector<float> dst(src.size());
+    st2138::Value boxed;
+    for (auto _ : state) {
+        for (size_t i = 0; i < src.size(); ++i) {
+            boxed.set_float32_value(src[i]);
+            dst[i] = constraint.apply(boxed).float32_value();
+        }
+        benchmark::DoNotOptimize(dst.data());
+    }
+    state.SetItemsProcessed(state.iterations() * src.size());
+}
+BENCHMARK(BM_ApplyPerElement)->Arg(1 << 10)->Arg(1 << 16)->Arg(1 << 20);
+
+/*
+ * The kernel at a fixed level, including the copy into the output array.
+ */
+static void clampAtLevel(benchmark::State& state, SimdLevel level) {
+    if (level > simdLevel()) {
+        state.SkipWithError("instruction set not supported");
+        return;
+    }
+    const std::vector<float> src = makeValues(state.range(0));
+    std::vector<float> dst(src.size());
+    for (auto _ : state) {
+        dst.assign(src.begin(), src.end());
+        clampToRange(dst, kMin, kMax, kStep, level);
+        benchmark::DoNotOptimize(dst.data());
+    }
+    state.SetItemsProcessed(state.iterations() * src.size());
+}
+
+static void BM_KernelScalar(benchmark::State& state) { clampAtLevel(state, SimdLevel::kScalar); }
+BENCHMARK(BM_KernelScalar)->Arg(1 << 10)->Arg(1 << 16)->Arg(1 << 20);
+
+static void BM_KernelSse41(benchmark::State& state) { clampAtLevel(state, SimdLevel::kSse41); }
+BENCHMARK(BM_KernelSse41)->Arg(1 << 10)->Arg(1 << 16)->Arg(1 << 20);
+
+static void BM_KernelAvx2(benchmark::State& state) { clampAtLevel(state, SimdLevel::kAvx2); }
+BENCHMARK(BM_KernelAvx2)->Arg(1 << 10)->Arg(1 << 16)->Arg(1 << 20);
+
+/*
+ * The path array fromProto takes: RangeConstraint::clamp at the detected level.
+ */
+static void BM_ConstraintClamp(benchmark::State& state) {
+    RangeConstraint<float> constraint(kMin, kMax, kStep, "bench", false);
+    const std::vector<float> src = makeValues(state.range(0));
+    std::vector<float> dst(src.size());
+    for (auto _ : state) {
+        dst.assign(src.begin(), src.end());
+        constraint.clamp(std::span<float>(dst));
+        benchmark::DoNotOptimize(dst.data());
+    }
+    state.SetItemsProcessed(state.iterations() * src.size());
+}
+BENCHMARK(BM_ConstraintClamp)->Arg(1 << 10)->Arg(1 << 16)->Arg(1 << 20);
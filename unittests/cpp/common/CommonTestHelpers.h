@@ -140,6 +140,84 @@ inline void setupMockParam(MockParam& param, const std::string& oid, MockParamDe
         .WillRepeatedly(testing::Return(stateless));
 }
 
+/**
+ * @brief Resolves a mock parameter's children through the mock device
+ *
+ * Traversals resolve children from their parent param. This forwards those
+ * lookups to device.getParam(fqoid + "/" + child) so that tests can keep
+ * describing their hierarchy in a single device expectation.
+ * @param param The mock parameter to set up
+ * @param fqoid The fully qualified oid of param
+ * @param device The mock device that resolves the children
+ */
+inline void resolveChildrenFromDevice(MockParam& param, const std::string& fqoid, const MockDevice& device) {
+    EXPECT_CALL(param, getParam(::testing::An<Path&>(), ::testing::_, ::testing::_))
+        .WillRepeatedly(::testing::Invoke([fqoid, &device](Path& oid, const IAuthorizer& authz, catena::exception_with_status& status) {
+            return device.getParam(fqoid + oid.toString(true), status, authz);
+        }));
+}
+
+/**
+ * @brief Creates a handle to a mock parameter that the test keeps ownership of
+ *
+ * Serializers resolve their params from the device again after every
+ * response, so a device expectation can be hit more than once for the same
+ * oid. Returning a borrowed handle instead of moving the param out keeps
+ * each of those calls valid.
+ * @param param The parameter to forward to. Must outlive the handle.
+ * @return A new handle forwarding to param
+ */
+inline std::unique_ptr<IParam> borrowParam(IParam& param) {
+    auto handle = std::make_unique<MockParam>();
+    EXPECT_CALL(*handle, getOid())
+        .WillRepeatedly(::testing::Invoke([&param]() -> const std::string& { return param.getOid(); }));
+    EXPECT_CALL(*handle, getDescriptor())
+        .WillRepeatedly(::testing::Invoke([&param]() -> const IParamDescriptor& { return param.getDescriptor(); }));
+    EXPECT_CALL(*handle, getScope())
+        .WillRepeatedly(::testing::Invoke([&param]() -> const std::string& { return param.getScope(); }));
+    EXPECT_CALL(*handle, isArrayType())
+        .WillRepeatedly(::testing::Invoke([&param]() { return param.isArrayType(); }));
+    EXPECT_CALL(*handle, size())
+        .WillRepeatedly(::testing::Invoke([&param]() { return param.size(); }));
+    EXPECT_CALL(*handle, toProto(::testing::An<st2138::ParamInfoResponse&>(), ::testing::_))
+        .WillRepeatedly(::testing::Invoke([&param](st2138::ParamInfoResponse& response, const IAuthorizer& authz) {
+            return param.toProto(response, authz);
+        }));
+    EXPECT_CALL(*handle, getParam(::testing::An<Path&>(), ::testing::_, ::testing::_))
+        .WillRepeatedly(::testing::Invoke([&param](Path& oid, const IAuthorizer& authz, catena::exception_with_status& status) {
+            return param.getParam(oid, authz, status);
+        }));
+    return handle;
+}
+
+/**
+ * @brief Serves params as a mock device's top-level params
+ *
+ * Sets up device.getTopLevelParams to return them and device.getParam to
+ * resolve each by its fqoid, as many times as asked. Must come after any
+ * broader getParam expectation on device so that it takes precedence.
+ * @param device The mock device to set up
+ * @param params The top-level params. Must outlive the device's use.
+ */
+inline void serveTopLevelParams(MockDevice& device, const std::vector<std::unique_ptr<IParam>>& params) {
+    EXPECT_CALL(device, getTopLevelParams(::testing::_, ::testing::_))
+        .WillOnce(::testing::Invoke([&params](catena::exception_with_status& status, const IAuthorizer&) {
+            status = catena::exception_with_status("", catena::StatusCode::OK);
+            std::vector<std::unique_ptr<IParam>> handles;
+            for (auto& param : params) {
+                handles.push_back(borrowParam(*param));
+            }
+            return handles;
+        }));
+    for (auto& param : params) {
+        EXPECT_CALL(device, getParam(::testing::Matcher<const std::string&>("/" + param->getOid()), ::testing::_, ::testing::_))
+            .WillRepeatedly(::testing::Invoke([&param = *param](const std::string&, catena::exception_with_status& status, const IAuthorizer&) {
+                status = catena::exception_with_status("", catena::StatusCode::OK);
+                return borrowParam(param);
+            }));
+    }
+}
+
 /**
  * @brief Helper function to get a JWS token for a specific scope
  * @param scope The scope string to get the token for (e.g., "st2138:mon", "st2138:op:w")
@@ -48,7 +48,8 @@ class MockDevice : public IDevice {
   public:
     MOCK_METHOD(void, slot, (const uint32_t slot), (override));
     MOCK_METHOD(uint32_t, slot, (), (const, override));
-    MOCK_METHOD(std::mutex&, mutex, (), (override));
+    MOCK_METHOD(std::shared_mutex&, mutex, (), (override));
+    MOCK_METHOD(std::shared_mutex&, paramMutex, (const std::string& oid), (const, override));
     MOCK_METHOD(void, detail_level, (const st2138::Device_DetailLevel detail_level), (override));
     MOCK_METHOD(st2138::Device_DetailLevel, detail_level, (), (const, override));
     MOCK_METHOD(const std::string&, getDefaultScope, (), (const, override));
@@ -64,7 +65,7 @@ class MockDevice : public IDevice {
     MOCK_METHOD(exception_with_status, addLanguage, (st2138::AddLanguagePayload& language, const IAuthorizer& authz), (override));
     MOCK_METHOD(exception_with_status, removeLanguage, (const std::string& LanguageId, const IAuthorizer& authz), (override));
     MOCK_METHOD(exception_with_status, getLanguagePack, (const std::string& languageId, ComponentLanguagePack& pack), (const, override));
-    MOCK_METHOD(std::unique_ptr<IDeviceSerializer>, getComponentSerializer, (const IAuthorizer& authz, const std::set<std::string>& subscribedOids, st2138::Device_DetailLevel dl, bool shallow), (const, override));
+    MOCK_METHOD(std::unique_ptr<IDeviceSerializer>, getComponentSerializer, (const IAuthorizer& authz, const SubscribedOids& subscribedOids, st2138::Device_DetailLevel dl, bool shallow), (const, override));
     MOCK_METHOD(void, addItem, (const std::string& key, IParam* item), (override));
     MOCK_METHOD(void, addItem, (const std::string& key, IConstraint* item), (override));
     MOCK_METHOD(void, addItem, (const std::string& key, IMenuGroup* item), (override));
@@ -67,6 +67,7 @@ class MockParam : public IParam {
     MOCK_METHOD(std::unique_ptr<IParamDescriptor::ICommandResponder>, executeCommand, (const st2138::Value& value, const bool respond, catena::exception_with_status& rc, const IAuthorizer& authz), (const, override));
     MOCK_METHOD(const IParamDescriptor&, getDescriptor, (), (const, override));
     MOCK_METHOD(bool, isArrayType, (), (const, override));
+    MOCK_METHOD(bool, lockFreeReads, (), (const, override));
     MOCK_METHOD(bool, validateSetValue, (const st2138::Value& value, Path::Index index, const IAuthorizer& authz, catena::exception_with_status& ans), (override));
     MOCK_METHOD(void, resetValidate, (), (override));
 };
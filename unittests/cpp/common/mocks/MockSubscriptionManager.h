@@ -46,11 +46,13 @@ namespace common {
 // Mock implementation for the ISubscriptionManager class.
 class MockSubscriptionManager : public ISubscriptionManager {
   public:
-    MOCK_METHOD(bool, addSubscription, (const std::string& oid, IDevice& dm, exception_with_status& rc, const IAuthorizer& authz), (override));
-    MOCK_METHOD(bool, removeSubscription, (const std::string& oid, const IDevice& dm, exception_with_status& rc), (override));
-    MOCK_METHOD(std::set<std::string>, getAllSubscribedOids, (const IDevice& dm), (override));
+    MOCK_METHOD(bool, addSubscription, (const std::string& oid, IDevice& dm, exception_with_status& rc, const IAuthorizer& authz, const std::string& scope), (override));
+    MOCK_METHOD(bool, removeSubscription, (const std::string& oid, const IDevice& dm, exception_with_status& rc, const std::string& scope), (override));
+    MOCK_METHOD(SubscribedOids, getAllSubscribedOids, (const IDevice& dm, const std::string& scope), (override));
     MOCK_METHOD(bool, isWildcard, (const std::string& oid), (override));
-    MOCK_METHOD(bool, isSubscribed, (const std::string& oid, const IDevice& dm), (override));
+    MOCK_METHOD(bool, isSubscribed, (const std::string& oid, const IDevice& dm, const std::string& scope), (override));
+    MOCK_METHOD(void, openScope, (const std::string& scope), (override));
+    MOCK_METHOD(void, closeScope, (const std::string& scope), (override));
 };
 
 } // namespace common
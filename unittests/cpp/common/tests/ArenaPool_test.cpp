@@ -0,0 +1,161 @@
+/*
+ * Copyright 2026 Ross Video Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @brief This file is for testing the ArenaPool.cpp file.
+ * @date 2026-10-16
+ * @copyright Copyright © 2026 Ross Video Ltd
+ */
+
+#include <gtest/gtest.h>
+#include "CommonTestHelpers.h"
+#include <rpc/ArenaPool.h>
+
+// protobuf interface
+#include <interface/param.pb.h>
+
+#include <string>
+
+using namespace catena::common;
+
+class ArenaPoolTest : public ::testing::Test {
+  protected:
+    // Set up and tear down Google Logging
+    static void SetUpTestSuite() {
+        set_up_test_logs(UNITTEST_LOG_DIR, "ArenaPoolTest");
+    }
+};
+
+/*
+ * TEST 1 - Messages created on a lease live on its arena, nested ones too.
+ */
+TEST_F(ArenaPoolTest, ArenaPool_Create) {
+    ArenaPool pool(1);
+    ArenaPool::Lease lease = pool.acquire();
+    st2138::Value* value = lease.create<st2138::Value>();
+    EXPECT_EQ(value->GetArena(), lease.arena());
+    st2138::StructValue* fields = value->mutable_struct_value();
+    (*fields->mutable_fields())["a"].set_int32_value(1);
+    EXPECT_EQ(fields->GetArena(), lease.arena());
+    EXPECT_EQ(fields->fields().at("a").GetArena(), lease.arena());
+    EXPECT_EQ(fields->fields().at("a").int32_value(), 1);
+}
+
+/*
+ * TEST 2 - Returned arenas are reused, up to the pool's capacity.
+ */
+TEST_F(ArenaPoolTest, ArenaPool_Reuse) {
+    ArenaPool pool(1);
+    google::protobuf::Arena* first;
+    {
+        ArenaPool::Lease lease = pool.acquire();
+        first = lease.arena();
+        EXPECT_EQ(pool.idle(), 0);
+    }
+    EXPECT_EQ(pool.idle(), 1);
+    {
+        ArenaPool::Lease lease = pool.acquire();
+        EXPECT_EQ(lease.arena(), first);
+        // Only one of these is kept.
+        ArenaPool::Lease other = pool.acquire();
+        EXPECT_NE(other.arena(), first);
+    }
+    EXPECT_EQ(pool.idle(), 1);
+    ArenaPool::Stats stats = pool.stats();
+    EXPECT_EQ(stats.leases, 3);
+    EXPECT_EQ(stats.arenas, 2);
+}
+
+/*
+ * TEST 3 - A capacity of 0 creates a new arena for every lease.
+ */
+TEST_F(ArenaPoolTest, ArenaPool_Disabled) {
+    ArenaPool pool(0);
+    { ArenaPool::Lease lease = pool.acquire(); }
+    { ArenaPool::Lease lease = pool.acquire(); }
+    EXPECT_EQ(pool.idle(), 0);
+    EXPECT_EQ(pool.stats().arenas, 2);
+}
+
+/*
+ * TEST 4 - Messages within the block are counted as used but not spilled,
+ * larger ones spill past it.
+ */
+TEST_F(ArenaPoolTest, ArenaPool_Stats) {
+    ArenaPool pool(1, 4096);
+    {
+        ArenaPool::Lease lease = pool.acquire();
+        lease.create<st2138::Value>()->set_int32_value(1);
+    }
+    ArenaPool::Stats stats = pool.stats();
+    EXPECT_GT(stats.bytesUsed, 0);
+    EXPECT_EQ(stats.bytesSpilled, 0);
+    {
+        ArenaPool::Lease lease = pool.acquire();
+        st2138::Value* value = lease.create<st2138::Value>();
+        for (int i = 0; i < 1000; ++i) {
+            value->mutable_string_array_values()->add_strings(std::string(64, 'a'));
+        }
+    }
+    stats = pool.stats();
+    EXPECT_GT(stats.bytesSpilled, 0);
+    EXPECT_EQ(stats.arenas, 1);
+}
+
+/*
+ * TEST 5 - A moved lease returns its arena once.
+ */
+TEST_F(ArenaPoolTest, ArenaPool_Move) {
+    ArenaPool pool(2);
+    {
+        ArenaPool::Lease lease = pool.acquire();
+        ArenaPool::Lease moved(std::move(lease));
+        EXPECT_NE(moved.arena(), nullptr);
+    }
+    EXPECT_EQ(pool.idle(), 1);
+}
+
+/*
+ * TEST 6 - Resetting a lease frees its messages but keeps its arena.
+ */
+TEST_F(ArenaPoolTest, ArenaPool_Reset) {
+    ArenaPool pool(1);
+    ArenaPool::Lease lease = pool.acquire();
+    google::protobuf::Arena* arena = lease.arena();
+    lease.create<st2138::Value>()->set_string_value(std::string(64, 'a'));
+    EXPECT_GT(arena->SpaceUsed(), 0);
+    lease.reset();
+    EXPECT_EQ(arena->SpaceUsed(), 0);
+    EXPECT_EQ(lease.arena(), arena);
+    EXPECT_GT(pool.stats().bytesUsed, 0) << "Reset usage should be counted";
+    // The arena is still usable after a reset.
+    EXPECT_EQ(lease.create<st2138::Value>()->GetArena(), arena);
+    EXPECT_EQ(pool.stats().leases, 1);
+}
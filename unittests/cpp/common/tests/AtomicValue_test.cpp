@@ -0,0 +1,218 @@
+/*
+ * Copyright 2026 Ross Video Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @brief This file is for testing the AtomicValue.cpp file.
+ * @date 2026-10-16
+ * @copyright Copyright © 2026 Ross Video Ltd
+ */
+
+// gtest
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+// Mock objects
+#include <mocks/MockParamDescriptor.h>
+#include <mocks/MockConstraint.h>
+#include <mocks/MockAuthorizer.h>
+
+// common
+#include "CommonTestHelpers.h"
+#include <AtomicValue.h>
+#include <ParamWithValue.h>
+
+// std
+#include <algorithm>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace catena::common;
+
+class AtomicValueTest : public ::testing::Test {
+  protected:
+    // Set up and tear down Google Logging
+    static void SetUpTestSuite() {
+        set_up_test_logs(UNITTEST_LOG_DIR, "AtomicValueTest");
+    }
+
+    void SetUp() override {
+        EXPECT_CALL(pd_, getConstraint()).WillRepeatedly(testing::Return(nullptr));
+        EXPECT_CALL(pd_, max_length()).WillRepeatedly(testing::Return(1024));
+        EXPECT_CALL(pd_, total_length()).WillRepeatedly(testing::Return(1024));
+        EXPECT_CALL(pd_, type()).WillRepeatedly(testing::Return(st2138::ParamType::STRING));
+        EXPECT_CALL(pd_, getOid()).WillRepeatedly(testing::ReturnRef(oid_));
+        EXPECT_CALL(authz_, readAuthz(testing::Matcher<const IParamDescriptor&>(testing::Ref(pd_)))).WillRepeatedly(testing::Return(true));
+        EXPECT_CALL(authz_, writeAuthz(testing::Matcher<const IParamDescriptor&>(testing::Ref(pd_)))).WillRepeatedly(testing::Return(true));
+    }
+
+    std::string oid_ = "meter";
+    catena::exception_with_status rc_{"", catena::StatusCode::OK};
+    st2138::Value val_;
+    MockParamDescriptor pd_;
+    MockConstraint constraint_;
+    MockAuthorizer authz_;
+};
+
+/*
+ * TEST 1 - Scalar cells load what was stored.
+ */
+TEST_F(AtomicValueTest, AtomicValue_Scalar) {
+    AtomicValue<int32_t> tally{3};
+    AtomicValue<float> meter;
+    EXPECT_EQ(tally.load(), 3);
+    EXPECT_EQ(meter.load(), 0.0f);
+    tally = 7;
+    meter.store(-12.5f);
+    EXPECT_EQ(static_cast<int32_t>(tally), 7);
+    EXPECT_EQ(static_cast<float>(meter), -12.5f);
+}
+
+/*
+ * TEST 2 - String cells load what was stored, up to their capacity.
+ */
+TEST_F(AtomicValueTest, AtomicValue_String) {
+    AtomicValue<std::string> label{"CAM 1"};
+    EXPECT_EQ(label.load(), "CAM 1");
+    EXPECT_EQ(label.size(), 5);
+    std::string full(AtomicValue<std::string>::kCapacity, 'x');
+    label = full;
+    EXPECT_EQ(label.load(), full);
+    label.store("");
+    EXPECT_EQ(static_cast<std::string>(label), "");
+    // Too long strings are rejected and leave the value alone.
+    label.store("PGM");
+    try {
+        label.store(full + "x");
+        FAIL() << "Expected an exception";
+    } catch (const catena::exception_with_status& err) {
+        EXPECT_EQ(err.status, catena::StatusCode::OUT_OF_RANGE);
+    }
+    EXPECT_EQ(label.load(), "PGM");
+}
+
+/*
+ * TEST 3 - Readers never see a torn string while a writer stores.
+ */
+TEST_F(AtomicValueTest, AtomicValue_ConcurrentSnapshots) {
+    const std::vector<std::string> values{"PGM", std::string(AtomicValue<std::string>::kCapacity, 'p'), "", "PVW tally on"};
+    AtomicValue<std::string> label{"PGM"};
+    std::atomic<bool> done{false};
+    std::atomic<int> torn{0};
+    std::vector<std::thread> readers;
+    for (int i = 0; i < 4; ++i) {
+        readers.emplace_back([&]() {
+            while (!done.load()) {
+                if (std::find(values.begin(), values.end(), label.load()) == values.end()) {
+                    torn++;
+                }
+            }
+        });
+    }
+    for (int i = 0; i < 20000; ++i) {
+        label.store(values[i % values.size()]);
+    }
+    done = true;
+    for (auto& reader : readers) {
+        reader.join();
+    }
+    EXPECT_EQ(torn.load(), 0);
+}
+
+/*
+ * TEST 4 - Scalar cells serialize like the value they hold.
+ */
+TEST_F(AtomicValueTest, AtomicValue_ToProto) {
+    AtomicValue<float> meter{-6.0f};
+    rc_ = toProto(val_, &meter, pd_, authz_);
+    EXPECT_EQ(rc_.status, catena::StatusCode::OK);
+    EXPECT_EQ(val_.float32_value(), -6.0f);
+    // Without read authz
+    EXPECT_CALL(authz_, readAuthz(testing::Matcher<const IParamDescriptor&>(testing::Ref(pd_)))).WillOnce(testing::Return(false));
+    rc_ = toProto(val_, &meter, pd_, authz_);
+    EXPECT_EQ(rc_.status, catena::StatusCode::PERMISSION_DENIED);
+}
+
+/*
+ * TEST 5 - Scalar cells store the range constrained value from fromProto.
+ */
+TEST_F(AtomicValueTest, AtomicValue_FromProto) {
+    AtomicValue<int32_t> tally{0};
+    st2138::Value constrainedVal;
+    constrainedVal.set_int32_value(2);
+    val_.set_int32_value(64);
+    EXPECT_CALL(pd_, getConstraint()).WillRepeatedly(testing::Return(&constraint_));
+    EXPECT_CALL(constraint_, isRange()).WillRepeatedly(testing::Return(true));
+    EXPECT_CALL(constraint_, apply(testing::_)).WillRepeatedly(testing::Return(constrainedVal));
+    rc_ = fromProto(val_, &tally, pd_, authz_);
+    EXPECT_EQ(rc_.status, catena::StatusCode::OK);
+    EXPECT_EQ(tally.load(), 2);
+    // Type mismatches leave the value alone.
+    val_.set_float32_value(1.0f);
+    rc_ = fromProto(val_, &tally, pd_, authz_);
+    EXPECT_EQ(rc_.status, catena::StatusCode::INVALID_ARGUMENT);
+    EXPECT_EQ(tally.load(), 2);
+}
+
+/*
+ * TEST 6 - String cells reject values longer than their capacity.
+ */
+TEST_F(AtomicValueTest, AtomicValue_FromProtoCapacity) {
+    AtomicValue<std::string> label{"PGM"};
+    val_.set_string_value("PVW");
+    EXPECT_TRUE(validFromProto(val_, &label, pd_, rc_, authz_));
+    rc_ = fromProto(val_, &label, pd_, authz_);
+    EXPECT_EQ(label.load(), "PVW");
+    val_.set_string_value(std::string(AtomicValue<std::string>::kCapacity + 1, 'x'));
+    EXPECT_FALSE(validFromProto(val_, &label, pd_, rc_, authz_));
+    EXPECT_EQ(rc_.status, catena::StatusCode::OUT_OF_RANGE);
+    rc_ = fromProto(val_, &label, pd_, authz_);
+    EXPECT_EQ(rc_.status, catena::StatusCode::OUT_OF_RANGE);
+    EXPECT_EQ(label.load(), "PVW");
+}
+
+/*
+ * TEST 7 - ParamWithValue reports atomic params as lock-free.
+ */
+TEST_F(AtomicValueTest, AtomicValue_LockFreeReads) {
+    AtomicValue<std::string> label{"PGM"};
+    std::string plain = "PGM";
+    ParamWithValue<AtomicValue<std::string>> atomicParam(label, pd_);
+    ParamWithValue<std::string> plainParam(plain, pd_);
+    EXPECT_TRUE(atomicParam.lockFreeReads());
+    EXPECT_FALSE(plainParam.lockFreeReads());
+    EXPECT_EQ(atomicParam.size(), 3);
+    st2138::Value setVal;
+    setVal.set_string_value("PVW");
+    EXPECT_TRUE(atomicParam.validateSetValue(setVal, Path::kNone, authz_, rc_));
+    EXPECT_EQ(atomicParam.fromProto(setVal, authz_).status, catena::StatusCode::OK);
+    EXPECT_EQ(label.load(), "PVW");
+}
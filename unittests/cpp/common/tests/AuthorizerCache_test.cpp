@@ -0,0 +1,141 @@
+/*
+ * Copyright 2026 Ross Video Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @brief This file is for testing the AuthorizerCache.cpp file.
+ * @date 2026-10-16
+ * @copyright Copyright © 2026 Ross Video Ltd
+ */
+
+#include <gtest/gtest.h>
+#include "CommonTestHelpers.h"
+#include <AuthorizerCache.h>
+#include <Enums.h>
+
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace catena::common;
+
+class AuthorizerCacheTest : public ::testing::Test {
+  protected:
+    // Set up and tear down Google Logging
+    static void SetUpTestSuite() {
+        set_up_test_logs(UNITTEST_LOG_DIR, "AuthorizerCacheTest");
+    }
+
+    std::string monitor_ = Scopes().getForwardMap().at(Scopes_e::kMonitor);
+    std::string operate_ = Scopes().getForwardMap().at(Scopes_e::kOperate);
+    std::string admin_ = Scopes().getForwardMap().at(Scopes_e::kAdmin);
+};
+
+/*
+ * TEST 1 - A token is decoded once and its Authorizer shared.
+ */
+TEST_F(AuthorizerCacheTest, AuthorizerCache_Hit) {
+    AuthorizerCache cache(4);
+    std::shared_ptr<Authorizer> first = cache.get(getJwsToken(monitor_));
+    std::shared_ptr<Authorizer> second = cache.get(getJwsToken(monitor_));
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(cache.size(), 1);
+    EXPECT_TRUE(first->readAuthz(Scopes_e::kMonitor));
+    EXPECT_FALSE(first->writeAuthz(Scopes_e::kMonitor));
+    // A different token gets its own Authorizer.
+    std::shared_ptr<Authorizer> other = cache.get(getJwsToken(operate_ + ":w"));
+    EXPECT_NE(first, other);
+    EXPECT_TRUE(other->writeAuthz(Scopes_e::kOperate));
+    EXPECT_EQ(cache.size(), 2);
+}
+
+/*
+ * TEST 2 - The least recently used token is evicted when the cache is full.
+ */
+TEST_F(AuthorizerCacheTest, AuthorizerCache_Evict) {
+    AuthorizerCache cache(2);
+    std::shared_ptr<Authorizer> monitor = cache.get(getJwsToken(monitor_));
+    std::shared_ptr<Authorizer> operate = cache.get(getJwsToken(operate_));
+    // Using monitor makes operate the least recently used.
+    EXPECT_EQ(cache.get(getJwsToken(monitor_)), monitor);
+    cache.get(getJwsToken(admin_));
+    EXPECT_EQ(cache.size(), 2);
+    EXPECT_EQ(cache.get(getJwsToken(monitor_)), monitor);
+    EXPECT_NE(cache.get(getJwsToken(operate_)), operate);
+}
+
+/*
+ * TEST 3 - Expired and invalid tokens are not cached.
+ */
+TEST_F(AuthorizerCacheTest, AuthorizerCache_NotCached) {
+    AuthorizerCache cache(4);
+    std::shared_ptr<Authorizer> expired = cache.get(getJwsToken("expired"));
+    EXPECT_TRUE(expired->isExpired());
+    EXPECT_EQ(cache.size(), 0);
+    try {
+        cache.get("This is not a valid token");
+        FAIL() << "Expected an exception";
+    } catch (const catena::exception_with_status& err) {
+        EXPECT_EQ(err.status, catena::StatusCode::UNAUTHENTICATED);
+    }
+    EXPECT_EQ(cache.size(), 0);
+}
+
+/*
+ * TEST 4 - A capacity of 0 decodes the token every time.
+ */
+TEST_F(AuthorizerCacheTest, AuthorizerCache_Disabled) {
+    AuthorizerCache cache(0);
+    EXPECT_NE(cache.get(getJwsToken(monitor_)), cache.get(getJwsToken(monitor_)));
+    EXPECT_EQ(cache.size(), 0);
+}
+
+/*
+ * TEST 5 - Concurrent requests share the cache.
+ */
+TEST_F(AuthorizerCacheTest, AuthorizerCache_Concurrent) {
+    AuthorizerCache cache(2);
+    std::vector<std::string> tokens{getJwsToken(monitor_), getJwsToken(operate_), getJwsToken(admin_)};
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < 4; ++t) {
+        threads.emplace_back([&, t]() {
+            for (size_t i = 0; i < 200; ++i) {
+                const std::string& token = tokens[(t + i) % tokens.size()];
+                EXPECT_FALSE(cache.get(token)->isExpired());
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(cache.size(), 2);
+    cache.clear();
+    EXPECT_EQ(cache.size(), 0);
+}
@@ -66,7 +66,24 @@ class TestAuthorizer : public Authorizer {
     // Returns the client scopes.
     ClientScopes& clientScopes() { return clientScopes_; }
     // Sets the client scopes.
-    void clientScopes(const ClientScopes& newScopes) { clientScopes_ = newScopes; }
+    void clientScopes(const ClientScopes& newScopes) {
+        clientScopes_ = newScopes;
+        updateScopeMasks_();
+    }
+};
+
+/*
+ * Mocks which report a precomputed scope bit, like ParamDescriptor does.
+ */
+class MaskedParam : public MockParam {
+  public:
+    uint32_t getScopeMask() const override { return mask; }
+    uint32_t mask = 0;
+};
+class MaskedParamDescriptor : public MockParamDescriptor {
+  public:
+    uint32_t getScopeMask() const override { return mask; }
+    uint32_t mask = 0;
 };
 
 class AuthorizationTest : public ::testing::Test {
@@ -233,3 +250,92 @@ TEST_F(AuthorizationTest, isExpired) {
     authz.exp(time + 100);
     EXPECT_FALSE(authz.isExpired()) << "Authz should not be expired exp is in the future.";
 }
+
+/* 
+ * TEST 8 - Testing readScopeKey.
+ */
+TEST_F(AuthorizationTest, readScopeKey) {
+    std::string monitor = Scopes().getForwardMap().at(Scopes_e::kMonitor);
+    std::string operate = Scopes().getForwardMap().at(Scopes_e::kOperate);
+    Authorizer read(getJwsToken(monitor));
+    Authorizer write(getJwsToken(monitor + ":w"));
+    Authorizer other(getJwsToken(operate));
+    EXPECT_EQ(read.readScopeKey(), write.readScopeKey()) << "Write scopes should read the same as read scopes";
+    EXPECT_NE(read.readScopeKey(), other.readScopeKey());
+    EXPECT_EQ(Authorizer::kAuthzDisabled.readScopeKey(), "*");
+}
+
+/* 
+ * TEST 9 - Testing scopes which are not Scopes_e values.
+ */
+TEST_F(AuthorizationTest, CustomScopes) {
+    TestAuthorizer authz;
+    authz.clientScopes({"vendor:eng:w", "vendor:tally", Scopes().getForwardMap().at(Scopes_e::kMonitor)});
+    EXPECT_TRUE(authz.readAuthz("vendor:eng"));
+    EXPECT_TRUE(authz.writeAuthz("vendor:eng"));
+    EXPECT_TRUE(authz.readAuthz("vendor:tally"));
+    EXPECT_FALSE(authz.writeAuthz("vendor:tally"));
+    EXPECT_FALSE(authz.readAuthz("vendor:other"));
+    // Scopes_e values still come from the mask.
+    EXPECT_TRUE(authz.readAuthz(Scopes_e::kMonitor));
+    EXPECT_FALSE(authz.writeAuthz(Scopes_e::kMonitor));
+    EXPECT_FALSE(authz.readAuthz(Scopes_e::kOperate));
+}
+
+/* 
+ * TEST 10 - Testing subject.
+ */
+TEST_F(AuthorizationTest, Subject) {
+    Authorizer authz(getJwsToken(Scopes().getForwardMap().at(Scopes_e::kMonitor)));
+    EXPECT_EQ(authz.subject(), "1234567890");
+    EXPECT_EQ(Authorizer::kAuthzDisabled.subject(), "") << "Disabled authz should use the shared subscription scope";
+}
+
+/* 
+ * TEST 11 - Testing scopeMask and authorization from a precomputed bit.
+ */
+TEST_F(AuthorizationTest, ScopeMask) {
+    // Each Scopes_e value has its own bit, and other scopes have none.
+    Authorizer::ScopeMask seen = 0;
+    for (auto& [scopeEnum, scopeStr] : Scopes().getForwardMap()) {
+        Authorizer::ScopeMask bit = Authorizer::scopeMask(scopeStr);
+        EXPECT_EQ(Authorizer::ScopeMask{1} << static_cast<uint32_t>(scopeEnum), bit);
+        EXPECT_EQ(0u, seen & bit) << scopeStr << " shares a bit with another scope";
+        seen |= bit;
+    }
+    EXPECT_EQ(0u, Authorizer::scopeMask("vendor:eng"));
+    EXPECT_EQ(0u, Authorizer::scopeMask(""));
+    // Params with a bit are checked without looking at their scope.
+    testing::NiceMock<MaskedParam> param;
+    testing::NiceMock<MaskedParamDescriptor> pd;
+    EXPECT_CALL(param, getScope()).Times(0);
+    EXPECT_CALL(pd, getScope()).Times(0);
+    for (auto& [cScopeEnum, cScopeStr] : Scopes().getForwardMap()) {
+        for (auto& suffix : {"", ":w"}) {
+            TestAuthorizer authz;
+            authz.clientScopes({cScopeStr + suffix});
+            for (auto& [pScopeEnum, pScopeStr] : Scopes().getForwardMap()) {
+                param.mask = pd.mask = Authorizer::scopeMask(pScopeStr);
+                bool canRead = cScopeStr == pScopeStr;
+                bool canWrite = cScopeStr + suffix == pScopeStr + ":w";
+                EXPECT_EQ(canRead, authz.readAuthz(param));
+                EXPECT_EQ(canRead, authz.readAuthz(pd));
+                EXPECT_EQ(canWrite, authz.writeAuthz(param));
+                EXPECT_EQ(canWrite, authz.writeAuthz(pd));
+                EXPECT_TRUE(Authorizer::kAuthzDisabled.readAuthz(param));
+                EXPECT_TRUE(Authorizer::kAuthzDisabled.writeAuthz(pd));
+            }
+        }
+    }
+    testing::Mock::VerifyAndClearExpectations(&param);
+    testing::Mock::VerifyAndClearExpectations(&pd);
+    // Without a bit, the scope is looked up by name.
+    TestAuthorizer authz;
+    authz.clientScopes({"vendor:eng:w"});
+    std::string custom = "vendor:eng";
+    param.mask = pd.mask = 0;
+    EXPECT_CALL(param, getScope()).WillRepeatedly(::testing::ReturnRef(custom));
+    EXPECT_CALL(pd, getScope()).WillRepeatedly(::testing::ReturnRef(custom));
+    EXPECT_TRUE(authz.readAuthz(param));
+    EXPECT_TRUE(authz.writeAuthz(pd));
+}
@@ -48,6 +48,10 @@
 
 #include "ChoiceConstraint.h"
 
+// std
+#include <vector>
+#include <span>
+
 using namespace catena::common;
 
 // Test fixture class for ChoiceConstraint tests
@@ -105,6 +109,18 @@ TEST_F(ChoiceConstraintTest, ChoiceConstraint_IntSatisfied) {
     src.set_int32_value(3);
     EXPECT_FALSE(constraint.satisfied(src)) << "Constraint should not be satisfied by invalid value 3";
 }
+/* 
+ * TEST 1.2b - Testing Int ChoiceConstraint typed satisfied and validate
+ */
+TEST_F(ChoiceConstraintTest, ChoiceConstraint_IntBulk) {
+    ChoiceConstraint<int32_t, st2138::Constraint::INT_CHOICE> constraint({{1, {}}, {2, {}}}, true, "test_oid", false);
+    EXPECT_TRUE(constraint.satisfied(int32_t(1)));
+    EXPECT_FALSE(constraint.satisfied(int32_t(3))) << "Constraint should not be satisfied by invalid value 3";
+    std::vector<int32_t> valid{1, 2, 2, 1};
+    std::vector<int32_t> invalid{1, 2, 3};
+    EXPECT_TRUE(constraint.validate(std::span<const int32_t>(valid)));
+    EXPECT_FALSE(constraint.validate(std::span<const int32_t>(invalid)));
+}
 /* 
  * TEST 1.3 - Testing Int ChoiceConstraint apply
  */
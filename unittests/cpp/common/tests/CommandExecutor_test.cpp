@@ -0,0 +1,130 @@
+/*
+ * Copyright 2026 Ross Video Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @brief This file is for testing the CommandExecutor.cpp file.
+ * @date 2026-10-16
+ * @copyright Copyright © 2026 Ross Video Ltd
+ */
+
+#include <gtest/gtest.h>
+#include "CommonTestHelpers.h"
+#include <rpc/CommandExecutor.h>
+
+#include <atomic>
+#include <future>
+#include <stdexcept>
+#include <thread>
+
+using namespace catena::common;
+
+class CommandExecutorTest : public ::testing::Test {
+  protected:
+    // Set up and tear down Google Logging
+    static void SetUpTestSuite() {
+        set_up_test_logs(UNITTEST_LOG_DIR, "CommandExecutorTest");
+    }
+};
+
+/*
+ * TEST 1 - With no workers jobs run inline.
+ */
+TEST_F(CommandExecutorTest, CommandExecutor_Inline) {
+    CommandExecutor executor(0);
+    EXPECT_EQ(executor.workers(), 0);
+    std::thread::id caller = std::this_thread::get_id();
+    bool ran = false;
+    executor.post([&ran, caller]() {
+        EXPECT_EQ(std::this_thread::get_id(), caller);
+        ran = true;
+    });
+    EXPECT_TRUE(ran);
+    // Errors are dropped.
+    EXPECT_NO_THROW(executor.post([]() { throw std::runtime_error("Job failed"); }));
+}
+
+/*
+ * TEST 2 - Jobs run off the posting thread and post does not wait on them.
+ */
+TEST_F(CommandExecutorTest, CommandExecutor_DoesNotBlock) {
+    CommandExecutor executor(1);
+    EXPECT_EQ(executor.workers(), 1);
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+    std::promise<std::thread::id> ranOn;
+    executor.post([released, &ranOn]() {
+        ranOn.set_value(std::this_thread::get_id());
+        released.wait();
+    });
+    // The job is blocked, but posting is not.
+    std::promise<void> second;
+    executor.post([&second]() { second.set_value(); });
+    EXPECT_NE(ranOn.get_future().get(), std::this_thread::get_id());
+    release.set_value();
+    EXPECT_EQ(second.get_future().wait_for(std::chrono::seconds(5)), std::future_status::ready);
+}
+
+/*
+ * TEST 3 - A blocked job does not hold up the other workers.
+ */
+TEST_F(CommandExecutorTest, CommandExecutor_BlockedWorker) {
+    CommandExecutor executor(2);
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+    executor.post([released]() { released.wait(); });
+    std::promise<void> other;
+    executor.post([&other]() { other.set_value(); });
+    EXPECT_EQ(other.get_future().wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    release.set_value();
+}
+
+/*
+ * TEST 4 - Every job runs exactly once, including those still queued when
+ *          the executor is destroyed, and a throwing job does not stop a
+ *          worker.
+ */
+TEST_F(CommandExecutorTest, CommandExecutor_RunsEveryJob) {
+    constexpr size_t kJobs = 1000;
+    std::vector<std::atomic<uint32_t>> ran(kJobs);
+    {
+        CommandExecutor executor(3);
+        for (size_t i = 0; i < kJobs; ++i) {
+            executor.post([&ran, i]() {
+                ran[i].fetch_add(1, std::memory_order_relaxed);
+                if (i % 100 == 7) {
+                    throw std::runtime_error("Job failed");
+                }
+            });
+        }
+    }
+    for (size_t i = 0; i < kJobs; ++i) {
+        ASSERT_EQ(ran[i].load(), 1) << "job " << i;
+    }
+}
@@ -54,6 +54,10 @@
 #include <mocks/MockHeartbeat.h>
 #include "Config.h"
 
+#include <array>
+#include <shared_mutex>
+#include <thread>
+
 using namespace catena::common;
 
 class DeviceTest : public ::testing::Test {
@@ -232,10 +236,7 @@ protected:
                             return false;
                         }));
                 }
-                return mock;
-            }))
-            .WillOnce(testing::Invoke([]() { 
-                auto mock = std::make_unique<MockParam>();
+                // The same handle is reset once validation is done.
                 EXPECT_CALL(*mock, resetValidate())
                     .Times(1);
                 return mock;
@@ -394,7 +395,9 @@ TEST_F(DeviceTest, TryMultiSetValue_MultiSetDisabled) {
 
 // 1.4: Error Case - Multi-Set Value with Overlapping OIDs
 TEST_F(DeviceTest, TryMultiSetValue_OverlappingOids) {
-    auto mockParam1 = createMultiSetMockParam("/param1");
+    auto mockParam1 = std::make_shared<MockParam>();
+    // Overlap is rejected before any path is resolved.
+    EXPECT_CALL(*mockParam1, copy()).Times(0);
     device_->addItem("param1", mockParam1.get());
     
     auto payload = createMultiSetPayload({
@@ -485,6 +488,24 @@ TEST_F(DeviceTest, TryMultiSetValue_ValidationFailure) {
     EXPECT_EQ(std::string(status.what()), "Validation failed");
 }
 
+// 1.8b: Error Case - Overlap detected between oids that are not adjacent in the request
+TEST_F(DeviceTest, TryMultiSetValue_OverlappingOidsNotAdjacent) {
+    auto payload = createMultiSetPayload({
+        {"/param1/f1", 42},
+        {"/param2", 1},
+        {"/param3/-", 2},
+        {"/param3/-", 3},
+        {"/param1", 4}
+    });
+    
+    catena::exception_with_status status{"", catena::StatusCode::OK};
+    bool result = device_->tryMultiSetValue(payload, status, *adminAuthz_);
+    
+    EXPECT_FALSE(result);
+    EXPECT_EQ(status.status, catena::StatusCode::INVALID_ARGUMENT);
+    EXPECT_EQ(std::string(status.what()), "Overlapping actions for /param1/f1 and /param1");
+}
+
 // --- commitMultiSetValue Tests ---
 
 // 1.9: Success Case - Test commitMultiSetValue with single value
@@ -792,6 +813,63 @@ TEST_F(DeviceTest, CommitMultiSetValue_CatenaException) {
     EXPECT_EQ(std::string(status.what()), "Test catena exception");
 }
 
+// --- multiSetValue Tests ---
+
+// 1.14: Success Case - Each param is resolved once, then validated and committed through the same handle
+TEST_F(DeviceTest, MultiSetValue_SinglePass) {
+    const std::array<std::string, 3> oids{"param0", "param1", "param2"};
+    const std::array<std::string, 3> fqoids{"/param0", "/param1", "/param2"};
+    st2138::MultiSetValuePayload payload;
+    for (std::size_t i = 0; i < oids.size(); ++i) {
+        const std::string& fqoid = fqoids[i];
+        auto mockParam = std::make_shared<MockParam>();
+        auto mockDescriptor = std::make_shared<MockParamDescriptor>();
+        mockParams_.push_back(mockParam);
+        mockDescriptors_.push_back(mockDescriptor);
+        setupMockParam(*mockParam, fqoid, *mockDescriptor, false, 0, adminScope_);
+        EXPECT_CALL(*mockParam, copy())
+            .WillOnce(testing::Invoke([mockDescriptor, &fqoid, this]() {
+                auto mock = std::make_unique<MockParam>();
+                setupMockParam(*mock, fqoid, *mockDescriptor, false, 0, adminScope_);
+                testing::InSequence seq;
+                EXPECT_CALL(*mock, validateSetValue(testing::_, testing::_, testing::_, testing::_))
+                    .WillOnce(testing::Return(true));
+                EXPECT_CALL(*mock, fromProto(testing::_, testing::_))
+                    .WillOnce(testing::Return(catena::exception_with_status("", catena::StatusCode::OK)));
+                EXPECT_CALL(*mock, resetValidate())
+                    .Times(1);
+                return mock;
+            }));
+        device_->addItem(oids[i], mockParam.get());
+        auto* setValue = payload.add_values();
+        setValue->set_oid(fqoid);
+        setValue->mutable_value()->set_int32_value(i);
+    }
+    
+    auto status = device_->multiSetValue(payload, *adminAuthz_);
+    
+    EXPECT_EQ(status.status, catena::StatusCode::OK);
+}
+
+// 1.15: Error Case - Nothing is committed if any request fails validation
+TEST_F(DeviceTest, MultiSetValue_ValidationFailure) {
+    auto mockParam1 = createMultiSetMockParam("/param1");
+    auto mockParam2 = createMultiSetMockParam("/param2", "Validation failed");
+    
+    device_->addItem("param1", mockParam1.get());
+    device_->addItem("param2", mockParam2.get());
+    
+    auto payload = createMultiSetPayload({
+        {"/param1", 42},
+        {"/param2", "test"}
+    });
+    
+    auto status = device_->multiSetValue(payload, *adminAuthz_);
+    
+    EXPECT_EQ(status.status, catena::StatusCode::INVALID_ARGUMENT);
+    EXPECT_EQ(std::string(status.what()), "Validation failed");
+}
+
 // ======== 2. Set/Get Value Tests ========
 
 // --- Set Value Tests ---
@@ -803,31 +881,16 @@ TEST_F(DeviceTest, SetValue_String) {
     auto mockDescriptor = std::make_shared<MockParamDescriptor>();
     setupMockParam(*mockParam, "/setParam", *mockDescriptor, false, 0, adminScope_);
 
-    // Setup 3 copies of the mock param: validation, reset, commit
+    // One copy of the mock param is validated, then committed through
     EXPECT_CALL(*mockParam, copy())
-        .WillOnce(testing::Invoke([mockDescriptor, this]() {        
+        .WillOnce(testing::Invoke([mockDescriptor, this]() {
             auto mock = std::make_unique<MockParam>();
             setupMockParam(*mock, "/setParam", *mockDescriptor, false, 0, adminScope_);
-            // First copy is for validation - expect validateSetValue
             EXPECT_CALL(*mock, validateSetValue(testing::_, testing::_, testing::_, testing::_))
                 .WillOnce(testing::Invoke([](const st2138::Value&, catena::common::Path::Index, const IAuthorizer&, catena::exception_with_status& status) {
                     status = catena::exception_with_status("", catena::StatusCode::OK);
                     return true;
                 }));
-            return mock;
-        }))
-        .WillOnce(testing::Invoke([mockDescriptor, this]() { 
-            auto mock = std::make_unique<MockParam>();
-            setupMockParam(*mock, "/setParam", *mockDescriptor, false, 0, adminScope_);
-            // Second copy is for reset in tryMultiSetValue cleanup - expect resetValidate
-            EXPECT_CALL(*mock, resetValidate())
-                .Times(1);
-            return mock;
-        }))
-        .WillOnce(testing::Invoke([mockDescriptor, this]() { 
-            auto mock = std::make_unique<MockParam>();
-            setupMockParam(*mock, "/setParam", *mockDescriptor, false, 0, adminScope_);
-            // Third copy is for commit - expect fromProto and resetValidate
             EXPECT_CALL(*mock, fromProto(testing::_, testing::_))
                 .WillOnce(testing::Invoke([](const st2138::Value&, const IAuthorizer&) {
                     return catena::exception_with_status("", catena::StatusCode::OK);
@@ -859,31 +922,16 @@ TEST_F(DeviceTest, SetValue_Integer) {
     EXPECT_CALL(*mockParam, getDescriptor())
         .WillRepeatedly(testing::ReturnRef(*mockDescriptor));
 
-    // Setup 3 copies of the mock param: validation, reset, commit
+    // One copy of the mock param is validated, then committed through
     EXPECT_CALL(*mockParam, copy())
-        .WillOnce(testing::Invoke([mockDescriptor, this]() { 
+        .WillOnce(testing::Invoke([mockDescriptor, this]() {
             auto mock = std::make_unique<MockParam>();
             setupMockParam(*mock, "/intSetParam", *mockDescriptor, false, 0, adminScope_);
-            // First copy is for validation - expect validateSetValue
             EXPECT_CALL(*mock, validateSetValue(testing::_, testing::_, testing::_, testing::_))
                 .WillOnce(testing::Invoke([](const st2138::Value&, catena::common::Path::Index, const IAuthorizer&, catena::exception_with_status& status) {
                     status = catena::exception_with_status("", catena::StatusCode::OK);
                     return true;
                 }));
-            return mock;
-        }))
-        .WillOnce(testing::Invoke([mockDescriptor, this]() { 
-            auto mock = std::make_unique<MockParam>();
-            setupMockParam(*mock, "/intSetParam", *mockDescriptor, false, 0, adminScope_);
-            // Second copy is for reset in tryMultiSetValue cleanup - expect resetValidate
-            EXPECT_CALL(*mock, resetValidate())
-                .Times(1);
-            return mock;
-        }))
-        .WillOnce(testing::Invoke([mockDescriptor, this]() { 
-            auto mock = std::make_unique<MockParam>();
-            setupMockParam(*mock, "/intSetParam", *mockDescriptor, false, 0, adminScope_);
-            // Third copy is for commit - expect fromProto and resetValidate
             EXPECT_CALL(*mock, fromProto(testing::_, testing::_))
                 .WillOnce(testing::Invoke([](const st2138::Value&, const IAuthorizer&) {
                     return catena::exception_with_status("", catena::StatusCode::OK);
@@ -915,21 +963,15 @@ TEST_F(DeviceTest, SetValue_ValidationFailed) {
     EXPECT_CALL(*mockParam, getDescriptor())
         .WillRepeatedly(testing::ReturnRef(*mockDescriptor));
 
-    // Setup 2 copies of the mock param: validation, reset
+    // One copy of the mock param: validated, then reset
     EXPECT_CALL(*mockParam, copy())
         .WillOnce(testing::Invoke([]() { 
             auto mock = std::make_unique<MockParam>();
-            // First copy is for validation - expect validateSetValue to fail
             EXPECT_CALL(*mock, validateSetValue(testing::_, testing::_, testing::_, testing::_))
                 .WillOnce(testing::Invoke([](const st2138::Value&, catena::common::Path::Index, const IAuthorizer&, catena::exception_with_status& status) {
                     status = catena::exception_with_status("Validation failed", catena::StatusCode::INVALID_ARGUMENT);
                     return false;
                 }));
-            return mock;
-        }))
-        .WillOnce(testing::Invoke([]() { 
-            auto mock = std::make_unique<MockParam>();
-            // Second copy is for reset - expect resetValidate
             EXPECT_CALL(*mock, resetValidate())
                 .Times(1);
             return mock;
@@ -1057,6 +1099,27 @@ TEST_F(DeviceTest, GetValue_UnknownException) {
     EXPECT_EQ(std::string(status.what()), "Unknown error");
 }
 
+// 2.12: Success Case - Get Value as JSON
+TEST_F(DeviceTest, GetValueJson_Integer) {
+    auto mockParam = createGetValueMockParam("/intParam", "", 42);
+    device_->addItem("intParam", mockParam.get());
+
+    std::string result;
+    auto status = device_->getValueJson("/intParam", result, *adminAuthz_);
+
+    EXPECT_EQ(status.status, catena::StatusCode::OK);
+    EXPECT_EQ(result, "{\"int32Value\":42}");
+}
+
+// 2.13: Error Case - Get Value as JSON Path Not Found
+TEST_F(DeviceTest, GetValueJson_PathNotFound) {
+    std::string result;
+    auto status = device_->getValueJson("/nonexistent", result, *adminAuthz_);
+
+    EXPECT_EQ(status.status, catena::StatusCode::NOT_FOUND);
+    EXPECT_TRUE(result.empty());
+}
+
 // ======== 3. Language Tests ========
 
 // --- Get Language Tests ---
@@ -2380,6 +2443,143 @@ TEST_F(DeviceTest, UnhandledException) {
     }
 }
 
+// 6.9: Success Case - Static components are built once and shared
+TEST_F(DeviceTest, GetDeviceSerializer_StaticComponentsCached) {
+    auto mockConstraint = std::make_shared<MockConstraint>();
+    // Only the first serializer should encode the constraint
+    EXPECT_CALL(*mockConstraint, toProto(testing::An<st2138::Constraint&>()))
+        .Times(1)
+        .WillOnce(testing::Invoke([](st2138::Constraint& constraint) {
+            constraint.set_ref_oid("testConstraint");
+        }));
+    device_->addItem("testConstraint", mockConstraint.get());
+
+    std::set<std::string> subscribedOids = {};
+    for (int i = 0; i < 2; ++i) {
+        auto serializer = device_->getDeviceSerializer(*monitorAuthz_, subscribedOids, st2138::Device_DetailLevel_FULL, false);
+        int constraintCount = 0;
+        while (serializer.hasMore()) {
+            auto component = serializer.getNext();
+            if (component.has_shared_constraint()) {
+                constraintCount++;
+                EXPECT_EQ(component.shared_constraint().oid(), "testConstraint");
+                EXPECT_EQ(component.shared_constraint().constraint().ref_oid(), "testConstraint");
+            }
+        }
+        EXPECT_EQ(constraintCount, 1);
+    }
+}
+
+// 6.10: Success Case - Adding and removing languages invalidates the static components
+TEST_F(DeviceTest, GetDeviceSerializer_LanguageChangesInvalidate) {
+    std::set<std::string> subscribedOids = {};
+    auto countLanguagePacks = [&]() {
+        auto serializer = device_->getDeviceSerializer(*monitorAuthz_, subscribedOids, st2138::Device_DetailLevel_FULL, false);
+        int count = 0;
+        while (serializer.hasMore()) {
+            count += serializer.getNext().has_language_pack();
+        }
+        return count;
+    };
+    EXPECT_EQ(countLanguagePacks(), 2);
+
+    st2138::AddLanguagePayload payload;
+    payload.set_language("es");
+    payload.mutable_language_pack()->set_name("Spanish");
+    ASSERT_EQ(device_->addLanguage(payload, *adminAuthz_).status, catena::StatusCode::OK);
+    EXPECT_EQ(countLanguagePacks(), 3);
+
+    // A serializer already in progress keeps the components it started with
+    auto serializer = device_->getDeviceSerializer(*monitorAuthz_, subscribedOids, st2138::Device_DetailLevel_FULL, false);
+    serializer.getNext();
+    ASSERT_EQ(device_->removeLanguage("es", *adminAuthz_).status, catena::StatusCode::OK);
+    int count = 0;
+    while (serializer.hasMore()) {
+        count += serializer.getNext().has_language_pack();
+    }
+    EXPECT_EQ(count, 3);
+    EXPECT_EQ(countLanguagePacks(), 2);
+}
+
+// 6.11: Success Case - A pool serializes params in parallel, in the same order
+TEST_F(DeviceTest, GetDeviceSerializer_SerializerPool) {
+    constexpr size_t kParams = 100;
+    auto mockDescriptor = std::make_shared<MockParamDescriptor>();
+    EXPECT_CALL(*mockDescriptor, minimalSet()).WillRepeatedly(testing::Return(false));
+    mockDescriptors_.push_back(mockDescriptor);
+    for (size_t i = 0; i < kParams; ++i) {
+        auto mockParam = std::make_unique<MockParam>();
+        std::string oid = "param" + std::to_string(i);
+        setupMockParam(*mockParam, "/" + oid, *mockDescriptor);
+        EXPECT_CALL(*mockParam, toProto(testing::An<st2138::Param&>(), testing::_))
+            .WillRepeatedly(testing::Invoke([oid](st2138::Param& param, const IAuthorizer&) {
+                param.set_template_oid(oid);
+                return catena::exception_with_status("", catena::StatusCode::OK);
+            }));
+        device_->addItem(oid, mockParam.get());
+        mockParams_.push_back(std::move(mockParam));
+    }
+
+    std::set<std::string> subscribedOids = {};
+    auto serialize = [&]() {
+        std::vector<std::string> oids;
+        auto serializer = device_->getDeviceSerializer(*monitorAuthz_, subscribedOids, st2138::Device_DetailLevel_FULL, false);
+        while (serializer.hasMore()) {
+            auto component = serializer.getNext();
+            if (component.has_param()) {
+                oids.push_back(component.param().oid());
+                // Each param's components stay together
+                if (component.param().oid() != "minimalSetParam") {
+                    EXPECT_EQ(component.param().param().template_oid(), component.param().oid());
+                }
+            }
+        }
+        return oids;
+    };
+    std::vector<std::string> sequential = serialize();
+    EXPECT_EQ(sequential.size(), kParams + 1);
+
+    SerializerPool pool(3);
+    device_->serializerPool(&pool);
+    EXPECT_EQ(serialize(), sequential);
+    device_->serializerPool(nullptr);
+}
+
+// 6.12: Success Case - Each param is serialized with its mutex held
+TEST_F(DeviceTest, GetDeviceSerializer_HoldsParamMutex) {
+    // Sub-params share their top level param's mutex
+    EXPECT_EQ(&device_->paramMutex("/lockedParam/0/child"), &device_->paramMutex("lockedParam"));
+
+    auto mockDescriptor = std::make_shared<MockParamDescriptor>();
+    EXPECT_CALL(*mockDescriptor, minimalSet()).WillRepeatedly(testing::Return(false));
+    mockDescriptors_.push_back(mockDescriptor);
+    auto mockParam = std::make_unique<MockParam>();
+    setupMockParam(*mockParam, "/lockedParam", *mockDescriptor);
+    bool locked = false;
+    EXPECT_CALL(*mockParam, toProto(testing::An<st2138::Param&>(), testing::_))
+        .WillOnce(testing::Invoke([this, &locked](st2138::Param&, const IAuthorizer&) {
+            // Writers on another thread have to wait
+            std::thread([this, &locked]() {
+                std::shared_mutex& mutex = device_->paramMutex("/lockedParam");
+                locked = !mutex.try_lock();
+                if (!locked) {
+                    mutex.unlock();
+                }
+            }).join();
+            return catena::exception_with_status("", catena::StatusCode::OK);
+        }));
+    device_->addItem("lockedParam", mockParam.get());
+    mockParams_.push_back(std::move(mockParam));
+
+    std::set<std::string> subscribedOids = {};
+    auto serializer = device_->getDeviceSerializer(*monitorAuthz_, subscribedOids, st2138::Device_DetailLevel_FULL, false);
+    std::shared_lock lock(device_->mutex());
+    while (serializer.hasMore()) {
+        serializer.getNext();
+    }
+    EXPECT_TRUE(locked);
+}
+
 // ==== 7. Helper Function Tests ====
 
 // 7.1: Success Case - Test Get Next method
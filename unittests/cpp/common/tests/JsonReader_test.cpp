@@ -0,0 +1,217 @@
+/*
+ * Copyright 2026 Ross Video Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @brief This file is for testing the JsonReader.cpp file, against the
+ * results of protobuf's JSON parser.
+ * @date 2026-10-16
+ * @copyright Copyright © 2026 Ross Video Ltd
+ */
+
+// gtest
+#include <gtest/gtest.h>
+
+// protobuf
+#include <google/protobuf/util/json_util.h>
+#include <google/protobuf/util/message_differencer.h>
+
+// common
+#include "CommonTestHelpers.h"
+#include "JsonReader.h"
+#include "JsonWriter.h"
+
+#include <string>
+#include <vector>
+
+using namespace catena::common;
+
+// Fixture
+class JsonReaderTest : public ::testing::Test {
+  protected:
+    static void SetUpTestSuite() {
+        set_up_test_logs(UNITTEST_LOG_DIR, "JsonReaderTest");
+    }
+
+    /*
+     * Expects parseJson to accept or reject each of srcs as protobuf's parser
+     * does, and when accepted to produce the same message.
+     */
+    template <typename M>
+    static void expectSameAsProtobuf(const std::vector<std::string>& srcs) {
+        for (const std::string& src : srcs) {
+            M parsed, expected;
+            bool ok = parseJson(src, parsed);
+            EXPECT_EQ(ok, google::protobuf::util::JsonStringToMessage(src, &expected).ok()) << src;
+            if (ok) {
+                EXPECT_TRUE(google::protobuf::util::MessageDifferencer::Equals(parsed, expected)) << src;
+            }
+        }
+    }
+};
+
+/*
+ * TEST 1 - Ints, including the extremes and forms which fall back to
+ * protobuf.
+ */
+TEST_F(JsonReaderTest, ParseJson_Ints) {
+    expectSameAsProtobuf<st2138::Value>({
+        R"({"int32Value":0})", R"({"int32Value":-0})", R"({"int32Value":2138})",
+        R"({"int32Value":2147483647})", R"({"int32Value":-2147483648})",
+        R"({"int32Value":2147483648})", R"({"int32Value":-2147483649})",
+        R"({"int32Value":1.0})", R"({"int32Value":1e2})", R"({"int32Value":1.5})",
+        R"({"int32Value":"5"})", R"({"int32Value":05})", R"({"int32Value":+5})"});
+}
+
+/*
+ * TEST 2 - Floats are rounded as protobuf rounds them.
+ */
+TEST_F(JsonReaderTest, ParseJson_Floats) {
+    expectSameAsProtobuf<st2138::Value>({
+        R"({"float32Value":0})", R"({"float32Value":-0})", R"({"float32Value":-0.0})",
+        R"({"float32Value":0.1})", R"({"float32Value":1.5})", R"({"float32Value":-3e2})",
+        R"({"float32Value":16777216})", R"({"float32Value":16777217})",
+        R"({"float32Value":3.4028235e38})", R"({"float32Value":3.5e38})",
+        R"({"float32Value":1.17549435e-38})", R"({"float32Value":1e-45})", R"({"float32Value":1e-50})",
+        R"({"float32Value":"Infinity"})", R"({"float32Value":"1.5"})", R"({"float32Value":.5})",
+        R"({"float32Value":1.})"});
+}
+
+/*
+ * TEST 3 - Strings, with every escape, surrogate pairs and UTF-8.
+ */
+TEST_F(JsonReaderTest, ParseJson_Strings) {
+    expectSameAsProtobuf<st2138::Value>({
+        R"({"stringValue":""})", R"({"stringValue":"plain ascii"})",
+        R"({"stringValue":"a\"b\\c\/d\b\f\n\r\t"})", R"({"stringValue":"\u0000\u001fé "})",
+        R"({"stringValue":"😀"})", R"({"stringValue":"\ud83d"})", R"({"stringValue":"\ude00"})",
+        R"({"stringValue":"\x"})", "{\"stringValue\":\"h\xc3\xa9llo \xf0\x9f\x98\x80\"}",
+        "{\"stringValue\":\"raw\ttab\"}", R"({"stringValue":"unterminated})"});
+}
+
+/*
+ * TEST 4 - Arrays, structs and variants, nested.
+ */
+TEST_F(JsonReaderTest, ParseJson_Compound) {
+    expectSameAsProtobuf<st2138::Value>({
+        R"({"int32ArrayValues":{"ints":[1,2,3]}})", R"({"int32ArrayValues":{"ints":[]}})",
+        R"({"int32ArrayValues":{}})", R"({"float32ArrayValues":{"floats":[1,2.5,-3e2]}})",
+        R"({"stringArrayValues":{"strings":["a","b"]}})",
+        R"({"structValue":{"fields":{"a":{"int32Value":1},"b":{"stringValue":"x"}}}})",
+        R"({"structValue":{"fields":{"inner":{"structValue":{"fields":{"c":{"float32Value":2}}}}}}})",
+        R"({"structVariantValue":{"structVariantType":"t","value":{"float32Value":2}}})",
+        R"({"structArrayValues":{"structValues":[{"fields":{"a":{"int32Value":1}}},{}]}})",
+        R"({"structVariantArrayValues":{"structVariants":[{"structVariantType":"t","value":{}}]}})",
+        R"(  { "int32ArrayValues" : { "ints" : [ 1 , 2 ] } }  )", R"({})", R"({"emptyValue":{}})"});
+}
+
+/*
+ * TEST 5 - Documents which are not valid, or which only protobuf handles.
+ */
+TEST_F(JsonReaderTest, ParseJson_Fallback) {
+    expectSameAsProtobuf<st2138::Value>({
+        "", "Not a JSON string", R"({"int32Value":1} trailing)", R"({"int32Value":1)",
+        R"({"int32_value":5})", R"({"string_array_values":{"strings":["a"]}})", R"({"int32Value":null})",
+        R"({"int32Value":1,"float32Value":2})", R"({"int32Value":1,"int32Value":2})",
+        R"({"int32ArrayValues":{"ints":[1,]}})", R"({"int32ArrayValues":{"ints":[1],"ints":[2]}})",
+        R"({"structValue":{"fields":{"a":{"int32Value":1},"a":{"int32Value":2}}}})",
+        R"({"unknownField":1})", R"([{"int32Value":1}])"});
+}
+
+/*
+ * TEST 6 - Multi set value requests.
+ */
+TEST_F(JsonReaderTest, ParseJson_MultiSetValue) {
+    expectSameAsProtobuf<st2138::MultiSetValuePayload>({
+        R"({"slot":1,"values":[{"oid":"/a","value":{"int32Value":1}},{"oid":"/b","value":{"stringValue":"x"}}]})",
+        R"({"values":[]})", R"({})", R"({"slot":4294967295})", R"({"slot":4294967296})", R"({"slot":-1})",
+        R"({"slot":"1"})", R"({"values":[{"oid":"/a"}]})", R"({"values":[{"oid":"/a","oid":"/b"}]})",
+        R"({"values":[{"oid":"/a","value":{"int32_value":3}}]})", R"({"multi_set_values":[]})",
+        R"({"values":[{"oid":"/a","value":{"int32Value":1}},]})"});
+}
+
+/*
+ * TEST 7 - A large preset recall, as written by appendJson and protobuf,
+ * reads back as the request it came from.
+ */
+TEST_F(JsonReaderTest, ParseJson_RoundTrip) {
+    st2138::MultiSetValuePayload reqs;
+    reqs.set_slot(2);
+    for (int i = 0; i < 256; ++i) {
+        st2138::SetValuePayload& req = *reqs.add_values();
+        req.set_oid("/channels/" + std::to_string(i));
+        auto& fields = *req.mutable_value()->mutable_struct_value()->mutable_fields();
+        fields["gain"].set_float32_value(i * 0.37f);
+        fields["name"].set_string_value("channel \"" + std::to_string(i) + "\"\n");
+        for (int j = 0; j < 8; ++j) {
+            fields["taps"].mutable_int32_array_values()->add_ints(i * j - 1000);
+        }
+    }
+    std::string printed;
+    ASSERT_TRUE(google::protobuf::util::MessageToJsonString(reqs, &printed).ok());
+    st2138::MultiSetValuePayload parsed;
+    ASSERT_TRUE(parseJson(printed, parsed));
+    EXPECT_TRUE(google::protobuf::util::MessageDifferencer::Equals(parsed, reqs));
+
+    st2138::Value value = reqs.values(0).value();
+    std::string written;
+    ASSERT_TRUE(appendJson(written, value));
+    st2138::Value parsedValue;
+    ASSERT_TRUE(parseJson(written, parsedValue));
+    EXPECT_TRUE(google::protobuf::util::MessageDifferencer::Equals(parsedValue, value));
+}
+
+/*
+ * TEST 8 - Deeply nested documents are rejected rather than overflowing the
+ * stack, and nesting either side of the limit matches protobuf.
+ */
+TEST_F(JsonReaderTest, ParseJson_Depth) {
+    auto nested = [](std::size_t depth) {
+        std::string src;
+        for (std::size_t i = 0; i < depth; ++i) {
+            src += R"({"structVariantValue":{"value":)";
+        }
+        src += "{}";
+        for (std::size_t i = 0; i < depth; ++i) {
+            src += "}}";
+        }
+        return src;
+    };
+    std::vector<std::string> srcs;
+    for (std::size_t depth = 45; depth <= 55; ++depth) {
+        srcs.push_back(nested(depth));
+    }
+    expectSameAsProtobuf<st2138::Value>(srcs);
+
+    st2138::Value value;
+    EXPECT_FALSE(parseJson(nested(100000), value));
+    std::string reqs = R"({"values":[{"oid":"/a","value":)" + nested(100000) + "}]}";
+    st2138::MultiSetValuePayload parsed;
+    EXPECT_FALSE(parseJson(reqs, parsed));
+}
@@ -0,0 +1,332 @@
+/*
+ * Copyright 2026 Ross Video Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @brief This file is for testing the JsonWriter.cpp file and the toJson
+ * serializers, against the output of protobuf's JSON printer.
+ * @date 2026-10-16
+ * @copyright Copyright © 2026 Ross Video Ltd
+ */
+
+// gtest
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+// Mock objects
+#include <mocks/MockParamDescriptor.h>
+#include <mocks/MockAuthorizer.h>
+
+// protobuf
+#include <google/protobuf/util/json_util.h>
+#include <google/protobuf/util/message_differencer.h>
+
+// common
+#include "CommonTestHelpers.h"
+#include "JsonWriter.h"
+#include "StructInfo.h"
+
+#include <cmath>
+#include <limits>
+
+using namespace catena::common;
+
+// Fixture
+class JsonWriterTest : public ::testing::Test {
+  protected:
+    static void SetUpTestSuite() {
+        set_up_test_logs(UNITTEST_LOG_DIR, "JsonWriterTest");
+    }
+
+    void SetUp() override {
+        EXPECT_CALL(pd_, getSubParam(testing::_)).WillRepeatedly(testing::ReturnRef(pd_));
+        EXPECT_CALL(pd_, getOid()).WillRepeatedly(testing::ReturnRef(oid_));
+        EXPECT_CALL(authz_, readAuthz(testing::Matcher<const IParamDescriptor&>(testing::_))).WillRepeatedly(testing::Return(true));
+    }
+
+    /*
+     * Returns msg as written by the protobuf JSON printer.
+     */
+    static std::string printed(const google::protobuf::Message& msg) {
+        std::string ans;
+        EXPECT_TRUE(google::protobuf::util::MessageToJsonString(msg, &ans, {}).ok());
+        return ans;
+    }
+
+    /*
+     * Expects appendJson to write value exactly as the printer does.
+     */
+    static void expectGolden(const st2138::Value& value) {
+        std::string json;
+        EXPECT_TRUE(appendJson(json, value));
+        EXPECT_EQ(json, printed(value));
+    }
+
+    /*
+     * Expects toJson to write src as the JSON of toProto's value. Struct
+     * fields follow the map order of the message they were written from,
+     * which protobuf varies between messages, so the JSON is compared by
+     * parsing it back unless byteExact is set.
+     */
+    template <typename T>
+    void expectSameAsProto(const T& src, bool byteExact) {
+        st2138::Value proto;
+        ASSERT_EQ(toProto(proto, &src, pd_, authz_).status, catena::StatusCode::OK);
+        std::string json;
+        ASSERT_EQ(toJson(json, &src, pd_, authz_).status, catena::StatusCode::OK);
+        if (byteExact) {
+            EXPECT_EQ(json, printed(proto));
+        }
+        st2138::Value parsed;
+        ASSERT_TRUE(google::protobuf::util::JsonStringToMessage(json, &parsed).ok()) << json;
+        EXPECT_TRUE(google::protobuf::util::MessageDifferencer::Equals(parsed, proto)) << json;
+    }
+
+    std::string oid_ = "test_oid";
+    MockParamDescriptor pd_;
+    MockAuthorizer authz_;
+};
+
+/*
+ * TEST 1 - Strings are escaped the same as the printer.
+ */
+TEST_F(JsonWriterTest, AppendJson_StringEscapes) {
+    st2138::Value value;
+    for (std::string str : {std::string(""), std::string("plain ascii / & = '"),
+                            std::string("quote \" backslash \\ <tag>"),
+                            std::string("\b\f\n\r\t\x01\x1f\x7f", 8), std::string("nul \0 byte", 10),
+                            std::string("\xc3\xa9 \xf0\x9f\x98\x80"), // é and an emoji are not escaped
+                            std::string("\xc2\x80 \xc2\xad \xe2\x80\x8b \xe2\x80\xa8 \xef\xbb\xbf"),
+                            std::string("\xf3\xa0\x80\x81")}) { // above the BMP, escaped as a surrogate pair
+        value.set_string_value(str);
+        expectGolden(value);
+    }
+}
+
+/*
+ * TEST 2 - Floats use the printer's shortest round trip digits.
+ */
+TEST_F(JsonWriterTest, AppendJson_Floats) {
+    st2138::Value value;
+    for (float f : {0.0f, -0.0f, 1.0f, 0.1f, 0.3f, 2.0f / 3, 1.5f, 123456.0f, 1234567.0f, 1e6f, 1e-5f,
+                    16777217.0f, std::numeric_limits<float>::max(), std::numeric_limits<float>::min(),
+                    std::numeric_limits<float>::denorm_min(), -std::numeric_limits<float>::infinity(),
+                    std::numeric_limits<float>::infinity(), std::numeric_limits<float>::quiet_NaN()}) {
+        value.set_float32_value(f);
+        expectGolden(value);
+    }
+}
+
+/*
+ * TEST 3 - Ints, including the extremes.
+ */
+TEST_F(JsonWriterTest, AppendJson_Ints) {
+    st2138::Value value;
+    for (int32_t i : {0, 1, -1, 2138, std::numeric_limits<int32_t>::max(), std::numeric_limits<int32_t>::min()}) {
+        value.set_int32_value(i);
+        expectGolden(value);
+    }
+}
+
+/*
+ * TEST 4 - Arrays, which are written as {} when empty.
+ */
+TEST_F(JsonWriterTest, AppendJson_Arrays) {
+    st2138::Value value;
+    value.mutable_int32_array_values();
+    expectGolden(value);
+    value.mutable_int32_array_values()->add_ints(-3);
+    value.mutable_int32_array_values()->add_ints(7);
+    expectGolden(value);
+    value.mutable_float32_array_values();
+    expectGolden(value);
+    value.mutable_float32_array_values()->add_floats(1.5f);
+    value.mutable_float32_array_values()->add_floats(NAN);
+    expectGolden(value);
+    value.mutable_string_array_values();
+    expectGolden(value);
+    value.mutable_string_array_values()->add_strings("");
+    value.mutable_string_array_values()->add_strings("line\n");
+    expectGolden(value);
+}
+
+/*
+ * TEST 5 - Structs, variants and their arrays, byte for byte with the
+ * printer's field order.
+ */
+TEST_F(JsonWriterTest, AppendJson_Structs) {
+    st2138::Value value;
+    value.mutable_struct_value();
+    expectGolden(value);
+    auto& fields = *value.mutable_struct_value()->mutable_fields();
+    fields["f1"].set_int32_value(1);
+    expectGolden(value);
+    // Enough fields that the map's order is unlikely to be insertion order
+    for (const char* name : {"zeta", "alpha", "mid", "b", "aa", "q", "yy", "k1", "k0"}) {
+        fields[name].set_string_value(name);
+    }
+    st2138::StructValue nested = value.struct_value();
+    *fields["nested"].mutable_struct_value() = nested;
+    expectGolden(value);
+    st2138::Value structValue = value;
+
+    value.mutable_struct_variant_value();
+    expectGolden(value);
+    value.mutable_struct_variant_value()->set_struct_variant_type("TestStruct1");
+    expectGolden(value);
+    *value.mutable_struct_variant_value()->mutable_value() = structValue;
+    expectGolden(value);
+    st2138::Value variantValue = value;
+
+    value.mutable_struct_array_values();
+    expectGolden(value);
+    value.mutable_struct_array_values()->add_struct_values();
+    *value.mutable_struct_array_values()->add_struct_values() = structValue.struct_value();
+    expectGolden(value);
+
+    value.mutable_struct_variant_array_values();
+    expectGolden(value);
+    *value.mutable_struct_variant_array_values()->add_struct_variants() = variantValue.struct_variant_value();
+    expectGolden(value);
+}
+
+/*
+ * TEST 5.1 - Invalid UTF-8 fails, as it does in the printer, rather than
+ * being dropped.
+ */
+TEST_F(JsonWriterTest, AppendJson_InvalidUtf8) {
+    for (std::string str : {std::string("bad \xff byte"), std::string("truncated \xc3"),
+                            std::string("surrogate \xed\xa0\x80"), std::string("overlong \xc0\xaf")}) {
+        std::string json;
+        EXPECT_FALSE(appendJsonString(json, str));
+        st2138::Value value;
+        value.set_string_value(str);
+        EXPECT_FALSE(appendJson(json, value));
+        value.mutable_string_array_values()->add_strings("ok");
+        value.mutable_string_array_values()->add_strings(str);
+        EXPECT_FALSE(appendJson(json, value));
+        value.mutable_struct_value()->mutable_fields()->insert({str, st2138::Value{}});
+        EXPECT_FALSE(appendJson(json, value));
+        value.mutable_struct_variant_value()->set_struct_variant_type(str);
+        EXPECT_FALSE(appendJson(json, value));
+        st2138::PushUpdates update;
+        update.mutable_value()->set_oid(str);
+        EXPECT_FALSE(appendJson(json, update));
+
+        json.clear();
+        EXPECT_EQ(toJson(json, &str, pd_, authz_).status, catena::StatusCode::INTERNAL);
+        std::vector<std::string> strings{"ok", str};
+        EXPECT_EQ(toJson(json, &strings, pd_, authz_).status, catena::StatusCode::INTERNAL);
+    }
+    std::string json;
+    EXPECT_TRUE(appendJsonString(json, "\xc3\xa9"));
+}
+
+/*
+ * TEST 6 - Values with no kind, and kinds handed to the printer.
+ */
+TEST_F(JsonWriterTest, AppendJson_OtherKinds) {
+    st2138::Value value;
+    expectGolden(value);
+    value.mutable_empty_value();
+    expectGolden(value);
+    value.mutable_data_payload()->set_payload("payload");
+    expectGolden(value);
+}
+
+/*
+ * TEST 7 - Push updates of values, and of anything else.
+ */
+TEST_F(JsonWriterTest, AppendJson_PushUpdates) {
+    st2138::PushUpdates update;
+    for (uint32_t slot : {0, 3}) {
+        update.Clear();
+        update.set_slot(slot);
+        update.mutable_value()->set_oid("/a/b");
+        update.mutable_value()->mutable_value()->set_float32_value(0.1f);
+        std::string json;
+        EXPECT_TRUE(appendJson(json, update));
+        EXPECT_EQ(json, printed(update));
+    }
+    update.mutable_value()->clear_value();
+    std::string json;
+    EXPECT_TRUE(appendJson(json, update));
+    EXPECT_EQ(json, printed(update));
+    update.Clear();
+    update.set_slot(1);
+    update.mutable_device_component()->mutable_language_pack()->set_language("en");
+    json.clear();
+    EXPECT_TRUE(appendJson(json, update));
+    EXPECT_EQ(json, printed(update));
+}
+
+/*
+ * TEST 8 - toJson of scalars and their arrays.
+ */
+TEST_F(JsonWriterTest, ToJson_Scalars) {
+    expectSameAsProto(int32_t{-42}, true);
+    expectSameAsProto(0.1f, true);
+    expectSameAsProto(std::string("a \"b\"\n"), true);
+    expectSameAsProto(std::vector<int32_t>{}, true);
+    expectSameAsProto(std::vector<int32_t>{1, 2, 3}, true);
+    expectSameAsProto(std::vector<float>{1.5f, -0.0f}, true);
+    expectSameAsProto(std::vector<std::string>{"", "x"}, true);
+    // EmptyValue sets nothing
+    std::string json;
+    EXPECT_EQ(toJson(json, &emptyValue, pd_, authz_).status, catena::StatusCode::OK);
+    EXPECT_EQ(json, "{}");
+}
+
+/*
+ * TEST 9 - toJson of structs and variants.
+ */
+TEST_F(JsonWriterTest, ToJson_Structs) {
+    expectSameAsProto(TestStruct1{.f1{1}, .f2{2}}, false);
+    expectSameAsProto(TestNestedStruct{.f1{.f1{1}, .f2{2}}, .f2{.f1{1.5f}, .f2{0.1f}}}, false);
+    expectSameAsProto(TestVariantStruct{TestStruct2{.f1{1.1f}, .f2{2.2f}}}, false);
+    expectSameAsProto(std::vector<TestStruct1>{}, true);
+    expectSameAsProto(std::vector<TestStruct1>{{.f1{1}, .f2{2}}, {.f1{3}, .f2{4}}}, false);
+    expectSameAsProto(std::vector<TestVariantStruct>{}, true);
+    expectSameAsProto(std::vector<TestVariantStruct>{TestStruct1{.f1{1}, .f2{2}}, TestStruct2{.f1{3}, .f2{4}}}, false);
+}
+
+/*
+ * TEST 10 - toJson without read authorization.
+ */
+TEST_F(JsonWriterTest, ToJson_NoAuthz) {
+    EXPECT_CALL(authz_, readAuthz(testing::Matcher<const IParamDescriptor&>(testing::_))).WillRepeatedly(testing::Return(false));
+    std::string json;
+    int32_t i = 1;
+    EXPECT_EQ(toJson(json, &i, pd_, authz_).status, catena::StatusCode::PERMISSION_DENIED);
+    TestStruct1 s{.f1{1}, .f2{2}};
+    EXPECT_EQ(toJson(json, &s, pd_, authz_).status, catena::StatusCode::PERMISSION_DENIED);
+    std::vector<TestVariantStruct> variants{TestStruct1{}};
+    EXPECT_EQ(toJson(json, &variants, pd_, authz_).status, catena::StatusCode::PERMISSION_DENIED);
+    EXPECT_TRUE(json.empty());
+}
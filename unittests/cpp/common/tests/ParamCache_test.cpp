@@ -0,0 +1,256 @@
+/*
+ * Copyright 2026 Ross Video Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @brief This file is for testing the ParamCache.cpp file.
+ * @date 2026-10-16
+ * @copyright Copyright © 2026 Ross Video Ltd
+ */
+
+// gtest
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+// common
+#include "ParamCache.h"
+#include "Authorizer.h"
+#include "CommonTestHelpers.h"
+#include "Config.h"
+
+// mocks
+#include "MockParam.h"
+#include "MockParamDescriptor.h"
+#include "MockAuthorizer.h"
+
+using namespace catena::common;
+using ::testing::Return;
+using ::testing::ReturnRef;
+
+// Test fixture class for ParamCache tests
+class ParamCacheTest : public ::testing::Test {
+  protected:
+    // Set up and tear down Google Logging
+    static void SetUpTestSuite() {
+        set_up_test_logs(UNITTEST_LOG_DIR, "ParamCacheTest");
+    }
+
+    void SetUp() override {
+        // "/top" is a struct with a field "/top/field" and an int array
+        // "/top/array".
+        subParams_ = {{"field", &fieldDescriptor_}, {"array", &arrayDescriptor_}};
+        EXPECT_CALL(topDescriptor_, type()).WillRepeatedly(Return(st2138::ParamType::STRUCT));
+        EXPECT_CALL(topDescriptor_, getAllSubParams()).WillRepeatedly(ReturnRef(subParams_));
+        EXPECT_CALL(arrayDescriptor_, type()).WillRepeatedly(Return(st2138::ParamType::INT32_ARRAY));
+        EXPECT_CALL(topParam_, getDescriptor()).WillRepeatedly(ReturnRef(topDescriptor_));
+        for (auto* pd : {&topDescriptor_, &fieldDescriptor_, &arrayDescriptor_}) {
+            EXPECT_CALL(*pd, getScope()).WillRepeatedly(ReturnRef(scope_));
+        }
+        cache_.capacity(16);
+    }
+
+    // Returns a resolved param whose copy() hands back a fresh mock, which
+    // in turn hands back fresh mocks to find().
+    std::unique_ptr<MockParam> resolved() {
+        auto param = std::make_unique<MockParam>();
+        EXPECT_CALL(*param, copy()).WillOnce(::testing::Invoke([]() {
+            auto handle = std::make_unique<MockParam>();
+            EXPECT_CALL(*handle, resetValidate()).Times(1);
+            EXPECT_CALL(*handle, copy()).WillRepeatedly(::testing::Invoke([]() {
+                return std::make_unique<MockParam>();
+            }));
+            return handle;
+        }));
+        return param;
+    }
+
+    ParamCache cache_;
+    MockParam topParam_;
+    MockParamDescriptor topDescriptor_;
+    MockParamDescriptor fieldDescriptor_;
+    MockParamDescriptor arrayDescriptor_;
+    std::unordered_map<std::string, IParamDescriptor*> subParams_;
+    std::string scope_ = Scopes().getForwardMap().at(Scopes_e::kMonitor);
+};
+
+/*
+ * TEST 1 - The cache is disabled until a capacity is set.
+ */
+TEST_F(ParamCacheTest, ParamCache_DisabledByDefault) {
+    ParamCache cache;
+    EXPECT_FALSE(cache.enabled());
+    auto param = std::make_unique<MockParam>();
+    EXPECT_CALL(*param, copy()).Times(0);
+    cache.insert("/top", topParam_, *param);
+    EXPECT_EQ(cache.find("/top", Authorizer::kAuthzDisabled), nullptr);
+    auto stats = cache.stats();
+    EXPECT_EQ(stats.size, 0);
+    EXPECT_EQ(stats.hits, 0);
+    EXPECT_EQ(stats.misses, 0);
+}
+
+/*
+ * TEST 2 - Inserting a resolved param makes subsequent lookups hit.
+ */
+TEST_F(ParamCacheTest, ParamCache_InsertAndFind) {
+    EXPECT_EQ(cache_.find("/top/field", Authorizer::kAuthzDisabled), nullptr) << "Empty cache should miss";
+    auto param = resolved();
+    cache_.insert("/top/field", topParam_, *param);
+    std::unique_ptr<IParam> handle = cache_.find("/top/field", Authorizer::kAuthzDisabled);
+    EXPECT_NE(handle, nullptr) << "Inserted oid should hit";
+    EXPECT_NE(handle.get(), param.get()) << "Cache should hold its own copy of the param";
+    auto stats = cache_.stats();
+    EXPECT_EQ(stats.hits, 1);
+    EXPECT_EQ(stats.misses, 1);
+    EXPECT_EQ(stats.size, 1);
+    EXPECT_EQ(stats.capacity, 16);
+}
+
+/*
+ * TEST 3 - Array indices stay on the array's descriptor.
+ */
+TEST_F(ParamCacheTest, ParamCache_ArrayElement) {
+    auto param = resolved();
+    cache_.insert("/top/array/3", topParam_, *param);
+    EXPECT_NE(cache_.find("/top/array/3", Authorizer::kAuthzDisabled), nullptr);
+}
+
+/*
+ * TEST 4 - Oids that can not be mapped to descriptors are not cached.
+ */
+TEST_F(ParamCacheTest, ParamCache_InsertUnresolvable) {
+    auto param = std::make_unique<MockParam>();
+    EXPECT_CALL(*param, copy()).Times(0);
+    cache_.insert("/top/missing", topParam_, *param);
+    cache_.insert("/top/array/-", topParam_, *param);
+    cache_.insert("/top/field~", topParam_, *param);
+    EXPECT_EQ(cache_.stats().size, 0);
+}
+
+/*
+ * TEST 5 - Clients that can not read every descriptor on the way miss.
+ */
+TEST_F(ParamCacheTest, ParamCache_FindNotAuthorized) {
+    auto param = resolved();
+    cache_.insert("/top/field", topParam_, *param);
+    MockAuthorizer authz;
+    EXPECT_CALL(authz, readAuthz(::testing::Matcher<const IParamDescriptor&>(::testing::Ref(topDescriptor_)))).WillOnce(Return(true));
+    EXPECT_CALL(authz, readAuthz(::testing::Matcher<const IParamDescriptor&>(::testing::Ref(fieldDescriptor_)))).WillOnce(Return(false));
+    EXPECT_EQ(cache_.find("/top/field", authz), nullptr);
+    EXPECT_EQ(cache_.stats().misses, 1);
+}
+
+/*
+ * TEST 6 - Invalidating an oid drops entries below it but keeps its own.
+ */
+TEST_F(ParamCacheTest, ParamCache_Invalidate) {
+    auto top = resolved();
+    auto element = resolved();
+    auto field = resolved();
+    cache_.insert("/top", topParam_, *top);
+    cache_.insert("/top/array/0", topParam_, *element);
+    cache_.insert("/top/field", topParam_, *field);
+    cache_.invalidate("/top/array");
+    EXPECT_EQ(cache_.find("/top/array/0", Authorizer::kAuthzDisabled), nullptr);
+    EXPECT_NE(cache_.find("/top/field", Authorizer::kAuthzDisabled), nullptr);
+    cache_.invalidate("/top");
+    EXPECT_EQ(cache_.find("/top/field", Authorizer::kAuthzDisabled), nullptr);
+    EXPECT_NE(cache_.find("/top", Authorizer::kAuthzDisabled), nullptr);
+    EXPECT_EQ(cache_.stats().invalidations, 2);
+    cache_.clear();
+    EXPECT_EQ(cache_.stats().size, 0);
+}
+
+/*
+ * TEST 7 - The cache stops growing at capacity, evicting to make room, and
+ * empties when disabled.
+ */
+TEST_F(ParamCacheTest, ParamCache_Capacity) {
+    cache_.capacity(1);
+    auto top = resolved();
+    auto field = resolved();
+    cache_.insert("/top", topParam_, *top);
+    cache_.insert("/top/field", topParam_, *field);
+    EXPECT_EQ(cache_.stats().size, 1);
+    EXPECT_EQ(cache_.stats().evictions, 1);
+    EXPECT_EQ(cache_.find("/top", Authorizer::kAuthzDisabled), nullptr);
+    EXPECT_NE(cache_.find("/top/field", Authorizer::kAuthzDisabled), nullptr);
+    cache_.capacity(0);
+    EXPECT_FALSE(cache_.enabled());
+    EXPECT_EQ(cache_.stats().size, 0);
+}
+
+/*
+ * TEST 8 - Handles returned by find() outlive the entry they were copied
+ * from, so a concurrent insert or invalidate can not free them.
+ */
+TEST_F(ParamCacheTest, ParamCache_FindReturnsCopy) {
+    auto param = resolved();
+    cache_.insert("/top/array/0", topParam_, *param);
+    std::unique_ptr<IParam> first = cache_.find("/top/array/0", Authorizer::kAuthzDisabled);
+    std::unique_ptr<IParam> second = cache_.find("/top/array/0", Authorizer::kAuthzDisabled);
+    ASSERT_NE(first, nullptr);
+    ASSERT_NE(second, nullptr);
+    EXPECT_NE(first.get(), second.get()) << "Each lookup should get its own copy";
+    cache_.invalidate("/top/array");
+    cache_.clear();
+    EXPECT_EQ(cache_.stats().size, 0);
+    // Still owned by the caller, and safe to use.
+    EXPECT_CALL(static_cast<MockParam&>(*first), getOid()).WillOnce(::testing::ReturnRefOfCopy(std::string("0")));
+    EXPECT_EQ(first->getOid(), "0");
+}
+
+/*
+ * TEST 9 - A full cache evicts the least recently used entry, and shrinking
+ * it keeps the most recently used ones.
+ */
+TEST_F(ParamCacheTest, ParamCache_EvictLeastRecentlyUsed) {
+    cache_.capacity(2);
+    auto top = resolved();
+    auto field = resolved();
+    auto element = resolved();
+    cache_.insert("/top", topParam_, *top);
+    cache_.insert("/top/field", topParam_, *field);
+    // Using "/top" leaves "/top/field" as the least recently used.
+    EXPECT_NE(cache_.find("/top", Authorizer::kAuthzDisabled), nullptr);
+    cache_.insert("/top/array/0", topParam_, *element);
+    EXPECT_EQ(cache_.find("/top/field", Authorizer::kAuthzDisabled), nullptr);
+    EXPECT_NE(cache_.find("/top/array/0", Authorizer::kAuthzDisabled), nullptr);
+    EXPECT_NE(cache_.find("/top", Authorizer::kAuthzDisabled), nullptr);
+    cache_.capacity(1);
+    EXPECT_NE(cache_.find("/top", Authorizer::kAuthzDisabled), nullptr);
+    EXPECT_EQ(cache_.find("/top/array/0", Authorizer::kAuthzDisabled), nullptr);
+    auto stats = cache_.stats();
+    EXPECT_EQ(stats.evictions, 2);
+    EXPECT_EQ(stats.size, 1);
+    // Invalidated entries leave the use order too.
+    cache_.invalidate("/top");
+    cache_.clear();
+    EXPECT_EQ(cache_.stats().size, 0);
+}
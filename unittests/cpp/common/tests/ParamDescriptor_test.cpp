@@ -53,6 +53,9 @@
 #include "gmock/gmock.h"
 #include <gtest/gtest.h>
 
+// std
+#include <array>
+
 using namespace catena::common;
 
 class ParamDescriptorTest : public ::testing::Test {
@@ -98,14 +101,15 @@ class ParamDescriptorTest : public ::testing::Test {
         const std::string& paramOid,
         const std::string& paramName = "test_param",
         bool paramReadOnly = false,  // Default to false so parent readOnly can propagate
-        IParamDescriptor* paramParent = nullptr
+        IParamDescriptor* paramParent = nullptr,
+        const std::string& paramScope = "scope"
     ) {
         return std::make_unique<ParamDescriptor>(
             st2138::ParamType::EMPTY,                           
             ParamDescriptor::OidAliases{},                      
             PolyglotText::ListInitializer{{"en", paramName}},  
             "widget",                                           
-            "scope",                                           
+            paramScope,                                        
             paramReadOnly,
             false,                                    
             paramOid,                                           
@@ -529,3 +533,56 @@ TEST_F(ParamDescriptorTest, ParamDescriptor_GettersWithStateless) {
     EXPECT_EQ(minimalSet, pd->minimalSet());
     EXPECT_EQ(&constraint, pd->getConstraint());
 }
+
+/*
+ * TEST 15 - Testing ParamDescriptor getSubParams resolves and caches a field list.
+ */
+TEST_F(ParamDescriptorTest, ParamDescriptor_GetSubParams) {
+    MockParamDescriptor subPd1, subPd2, subPd3;
+    pd->addSubParam("f1", &subPd1);
+    pd->addSubParam("f2", &subPd2);
+    static constexpr std::array<const char*, 2> names{"f2", "f1"};
+    std::array<IParamDescriptor*, 2> subParams{};
+    // Resolved in the order of names, and again from the cache.
+    for (int i = 0; i < 2; ++i) {
+        subParams = {};
+        pd->getSubParams(names, subParams);
+        EXPECT_EQ(&subPd2, subParams[0]);
+        EXPECT_EQ(&subPd1, subParams[1]);
+    }
+    // A different list does not read the cached table.
+    static constexpr std::array<const char*, 1> otherNames{"f1"};
+    std::array<IParamDescriptor*, 1> otherSubParams{};
+    pd->getSubParams(otherNames, otherSubParams);
+    EXPECT_EQ(&subPd1, otherSubParams[0]);
+    // Replacing a sub param invalidates the cache.
+    pd->addSubParam("f1", &subPd3);
+    pd->getSubParams(names, subParams);
+    EXPECT_EQ(&subPd3, subParams[1]);
+    // Missing names throw like getSubParam.
+    static constexpr std::array<const char*, 1> missing{"f3"};
+    EXPECT_THROW(pd->getSubParams(missing, otherSubParams), std::runtime_error);
+}
+
+/*
+ * TEST 16 - Testing ParamDescriptor getScopeMask.
+ */
+TEST_F(ParamDescriptorTest, ParamDescriptor_GetScopeMask) {
+    std::string monitor = Scopes().getForwardMap().at(Scopes_e::kMonitor);
+    std::string operate = Scopes().getForwardMap().at(Scopes_e::kOperate);
+    // Scopes outside of Scopes_e have no bit.
+    EXPECT_EQ(0u, pd->getScopeMask()) << "Custom scopes should be checked by name";
+    // The param's own scope is resolved at construction.
+    EXPECT_CALL(dm, getDefaultScope()).Times(0);
+    auto withScope = createRealParamDescriptor("withScope", "withScope", false, nullptr, monitor);
+    EXPECT_EQ(Authorizer::scopeMask(monitor), withScope->getScopeMask());
+    EXPECT_NE(0u, withScope->getScopeMask());
+    // An empty scope uses the parent's bit.
+    auto child = createRealParamDescriptor("child", "child", false, withScope.get(), "");
+    EXPECT_EQ(withScope->getScopeMask(), child->getScopeMask());
+    testing::Mock::VerifyAndClearExpectations(&dm);
+    // An empty scope with no parent uses the device's default scope.
+    EXPECT_CALL(dm, getDefaultScope()).WillOnce(testing::ReturnRef(operate));
+    auto top = createRealParamDescriptor("top", "top", false, nullptr, "");
+    EXPECT_EQ(Authorizer::scopeMask(operate), top->getScopeMask());
+}
@@ -0,0 +1,372 @@
+/*
+ * Copyright 2026 Ross Video Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file ParamInfoSerializer_test.cpp
+ * @brief This file is for testing the ParamInfoSerializer.cpp file.
+ * @date 2026-10-16
+ * @copyright Copyright (c) 2026 Ross Video
+ */
+
+#include <gtest/gtest.h>
+#include "MockParam.h"
+#include "MockParamDescriptor.h"
+#include "MockAuthorizer.h"
+#include "MockDevice.h"
+#include <rpc/ParamInfoSerializer.h>
+#include <Status.h>
+#include <Logger.h>
+
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <shared_mutex>
+#include <thread>
+
+using namespace catena::common;
+
+class ParamInfoSerializerTest : public ::testing::Test {
+  protected:
+    // Set up and tear down Google Logging
+    static void SetUpTestSuite() {
+        set_up_test_logs(UNITTEST_LOG_DIR, "ParamInfoSerializerTest");
+    }
+
+    static void TearDownTestSuite() {
+    }
+
+    /*
+     * A node in the fake param tree. Params are resolved from their parent
+     * each time, so changing the tree mid-stream is seen by the serializer.
+     */
+    struct Node {
+        std::string oid;
+        bool isArray = false;
+        bool readable = true;
+        bool throws = false;
+        std::function<void()> onDescribe;
+        std::vector<std::shared_ptr<Node>> elements;
+        std::map<std::string, std::shared_ptr<Node>> children;
+        std::unordered_map<std::string, IParamDescriptor*> subParams;
+        MockParamDescriptor descriptor;
+    };
+
+    void SetUp() override {
+        EXPECT_CALL(authz_, readAuthz(::testing::An<const IParam&>()))
+            .WillRepeatedly(::testing::Invoke([](const IParam& param) {
+                return param.getOid() != "denied";
+            }));
+        // Roots are resolved from roots_ each time, like children
+        EXPECT_CALL(dm_, getParam(::testing::An<const std::string&>(), ::testing::_, ::testing::_))
+            .WillRepeatedly(::testing::Invoke([this](const std::string& fqoid, catena::exception_with_status& status, const IAuthorizer&) -> std::unique_ptr<IParam> {
+                if (!roots_.contains(fqoid)) {
+                    status = catena::exception_with_status("Param not found", catena::StatusCode::NOT_FOUND);
+                    return nullptr;
+                }
+                return makeParam(roots_.at(fqoid));
+            }));
+        EXPECT_CALL(dm_, paramMutex(::testing::_)).WillRepeatedly(::testing::ReturnRef(mutex_));
+    }
+
+    std::shared_ptr<Node> node(const std::string& oid, bool isArray = false) {
+        auto n = std::make_shared<Node>();
+        n->oid = oid;
+        n->isArray = isArray;
+        EXPECT_CALL(n->descriptor, getAllSubParams()).WillRepeatedly(::testing::ReturnRef(n->subParams));
+        return n;
+    }
+
+    void addChild(Node& parent, const std::string& name, std::shared_ptr<Node> child) {
+        parent.subParams[name] = &child->descriptor;
+        parent.children[name] = std::move(child);
+    }
+
+    /*
+     * Creates a mock param backed by n.
+     */
+    std::unique_ptr<IParam> makeParam(std::shared_ptr<Node> n) {
+        auto param = std::make_unique<MockParam>();
+        EXPECT_CALL(*param, getOid()).WillRepeatedly(::testing::ReturnRef(n->oid));
+        EXPECT_CALL(*param, getDescriptor()).WillRepeatedly(::testing::ReturnRef(n->descriptor));
+        EXPECT_CALL(*param, isArrayType()).WillRepeatedly(::testing::Return(n->isArray));
+        EXPECT_CALL(*param, size()).WillRepeatedly(::testing::Invoke([n]() { return n->elements.size(); }));
+        EXPECT_CALL(*param, toProto(::testing::An<st2138::ParamInfoResponse&>(), ::testing::_))
+            .WillRepeatedly(::testing::Invoke([n](st2138::ParamInfoResponse& response, const IAuthorizer&) {
+                if (n->onDescribe) {
+                    n->onDescribe();
+                }
+                if (n->throws) {
+                    throw catena::exception_with_status("Error processing " + n->oid, catena::StatusCode::INTERNAL);
+                }
+                response.mutable_info()->set_oid(n->oid);
+                return catena::exception_with_status("", catena::StatusCode::OK);
+            }));
+        EXPECT_CALL(*param, getParam(::testing::An<Path&>(), ::testing::_, ::testing::_))
+            .WillRepeatedly(::testing::Invoke([this, n](Path& oid, const IAuthorizer&, catena::exception_with_status& status) -> std::unique_ptr<IParam> {
+                std::shared_ptr<Node> child = nullptr;
+                if (oid.front_is_index() && oid.front_as_index() < n->elements.size()) {
+                    child = n->elements[oid.front_as_index()];
+                } else if (oid.front_is_string() && n->children.contains(oid.front_as_string())) {
+                    child = n->children.at(oid.front_as_string());
+                }
+                if (!child) {
+                    status = catena::exception_with_status("Param not found", catena::StatusCode::NOT_FOUND);
+                    return nullptr;
+                }
+                return makeParam(child);
+            }));
+        return param;
+    }
+
+    /*
+     * Serializes roots, served from the device by their oids, and returns the
+     * oid and array length of each response. between is called after each
+     * response is received.
+     */
+    std::vector<std::pair<std::string, uint32_t>> serialize(const std::vector<std::shared_ptr<Node>>& roots, bool recursive,
+                                                             std::function<void(std::size_t)> between = {}) {
+        std::vector<std::string> oids;
+        for (auto& root : roots) {
+            oids.push_back("/" + root->oid);
+            roots_[oids.back()] = root;
+        }
+        return serializeOids(std::move(oids), recursive, between);
+    }
+
+    /*
+     * Serializes the roots at oids in roots_.
+     */
+    std::vector<std::pair<std::string, uint32_t>> serializeOids(std::vector<std::string> oids, bool recursive,
+                                                                 std::function<void(std::size_t)> between = {}) {
+        auto serializer = ParamInfoSerializer::serialize(dm_, std::move(oids), recursive, authz_);
+        std::vector<std::pair<std::string, uint32_t>> out;
+        while (serializer.hasMore()) {
+            auto response = serializer.getNext();
+            out.emplace_back(response.info().oid(), response.array_length());
+            if (between) {
+                between(out.size());
+            }
+        }
+        return out;
+    }
+
+    /*
+     * Builds array[n] of {child, nested[2]{leaf}}.
+     */
+    std::shared_ptr<Node> makeArray(std::size_t n) {
+        auto array = node("array", true);
+        for (std::size_t i = 0; i < n; ++i) {
+            auto element = node("element");
+            addChild(*element, "child", node("child"));
+            auto nested = node("nested", true);
+            for (std::size_t j = 0; j < 2; ++j) {
+                auto nestedElement = node("nested_element");
+                addChild(*nestedElement, "leaf", node("leaf"));
+                nested->elements.push_back(nestedElement);
+            }
+            addChild(*element, "nested", nested);
+            array->elements.push_back(element);
+        }
+        return array;
+    }
+
+    using Responses = std::vector<std::pair<std::string, uint32_t>>;
+    MockAuthorizer authz_;
+    MockDevice dm_;
+    // The device's roots by fqoid
+    std::map<std::string, std::shared_ptr<Node>> roots_;
+    std::shared_mutex mutex_;
+};
+
+// Non-recursive requests describe each root and nothing else
+TEST_F(ParamInfoSerializerTest, NonRecursive) {
+    auto array = makeArray(2);
+    auto scalar = node("scalar");
+    addChild(*scalar, "child", node("child"));
+
+    Responses expected{{"array", 2}, {"scalar", 0}};
+    EXPECT_EQ(serialize({array, scalar}, false), expected);
+}
+
+// Recursive requests walk each root in pre-order, array elements first
+TEST_F(ParamInfoSerializerTest, RecursivePreOrder) {
+    auto array = makeArray(1);
+    auto scalar = node("scalar");
+    addChild(*scalar, "child", node("child"));
+
+    Responses expected{
+        {"array", 1},
+            {"element", 0},
+                {"nested", 2},
+                    {"nested_element", 0}, {"leaf", 0},
+                    {"nested_element", 0}, {"leaf", 0},
+                {"child", 0},
+        {"scalar", 0},
+            {"child", 0}
+    };
+    Responses actual = serialize({array, scalar}, true);
+    // Sub-param order follows the descriptor's map, so only compare it once sorted
+    ASSERT_EQ(actual.size(), expected.size());
+    EXPECT_EQ(actual.front(), expected.front());
+    EXPECT_EQ(actual[8], expected[8]);
+    EXPECT_TRUE(std::is_permutation(actual.begin(), actual.end(), expected.begin()));
+}
+
+// Empty arrays below the root and unreadable params are skipped
+TEST_F(ParamInfoSerializerTest, SkipsEmptyAndDenied) {
+    auto root = node("root", true);
+    auto parent = node("parent");
+    addChild(*parent, "empty", node("empty", true));
+    addChild(*parent, "denied", node("denied"));
+    root->elements.push_back(parent);
+
+    Responses expected{{"root", 1}, {"parent", 0}};
+    EXPECT_EQ(serialize({root}, true), expected);
+    // The root itself is always described, even when empty
+    expected = {{"empty", 0}};
+    EXPECT_EQ(serialize({node("empty", true)}, true), expected);
+}
+
+// Elements removed while the stream is suspended are not described
+TEST_F(ParamInfoSerializerTest, ArrayShrinksMidStream) {
+    auto array = node("array", true);
+    for (std::size_t i = 0; i < 4; ++i) {
+        array->elements.push_back(node("element"));
+    }
+
+    // element 1 was built before the array shrank, so is still sent
+    Responses expected{{"array", 4}, {"element", 0}, {"element", 0}};
+    EXPECT_EQ(serialize({array}, true, [&array](std::size_t sent) {
+        if (sent == 2) {
+            array->elements.resize(1);
+        }
+    }), expected);
+}
+
+// An error is thrown after the responses already sent
+TEST_F(ParamInfoSerializerTest, ErrorMidStream) {
+    auto array = node("array", true);
+    array->elements.push_back(node("element"));
+    auto bad = node("bad");
+    bad->throws = true;
+    array->elements.push_back(bad);
+
+    roots_["/array"] = array;
+    auto serializer = ParamInfoSerializer::serialize(dm_, {"/array"}, true, authz_);
+    ASSERT_TRUE(serializer.hasMore());
+    EXPECT_EQ(serializer.getNext().info().oid(), "array");
+    try {
+        serializer.getNext();
+        FAIL() << "Expected an exception";
+    } catch (const catena::exception_with_status& err) {
+        EXPECT_EQ(err.status, catena::StatusCode::INTERNAL);
+        EXPECT_EQ(std::string(err.what()), "Error processing bad");
+    }
+    EXPECT_FALSE(serializer.hasMore());
+}
+
+// Each root's lock is held while it is read, and released between responses
+TEST_F(ParamInfoSerializerTest, HoldsRootLocks) {
+    std::shared_mutex lockA, lockB;
+    // try_lock from another thread, as this one may hold the lock shared
+    auto locked = [](std::shared_mutex& mutex) {
+        bool acquired = false;
+        std::thread([&]() {
+            acquired = mutex.try_lock();
+            if (acquired) {
+                mutex.unlock();
+            }
+        }).join();
+        return !acquired;
+    };
+    auto a = node("a");
+    a->onDescribe = [&]() {
+        EXPECT_TRUE(locked(lockA));
+        EXPECT_FALSE(locked(lockB));
+    };
+    auto b = node("b");
+    b->onDescribe = [&]() {
+        EXPECT_FALSE(locked(lockA));
+        EXPECT_TRUE(locked(lockB));
+    };
+
+    roots_["/a"] = a;
+    roots_["/b"] = b;
+    EXPECT_CALL(dm_, paramMutex("/a")).WillRepeatedly(::testing::ReturnRef(lockA));
+    EXPECT_CALL(dm_, paramMutex("/b")).WillRepeatedly(::testing::ReturnRef(lockB));
+    auto serializer = ParamInfoSerializer::serialize(dm_, {"/a", "/b"}, false, authz_);
+    std::vector<std::string> oids;
+    while (serializer.hasMore()) {
+        oids.push_back(serializer.getNext().info().oid());
+        EXPECT_FALSE(locked(lockA));
+        EXPECT_FALSE(locked(lockB));
+    }
+    EXPECT_EQ(oids, std::vector<std::string>({"a", "b"}));
+}
+
+/*
+ * A root replaced while the stream is suspended is resolved again, so the
+ * rest of the stream is read from the new tree rather than the old handle.
+ */
+TEST_F(ParamInfoSerializerTest, RootReplacedMidStream) {
+    auto makeItems = [this](const std::string& name) {
+        auto items = node("items", true);
+        for (std::size_t i = 0; i < 3; ++i) {
+            items->elements.push_back(node(name + std::to_string(i)));
+        }
+        return items;
+    };
+    roots_["/structarr/2"] = makeItems("old_item");
+
+    // old_item0 was built before the root was replaced, so is still sent
+    Responses expected{{"items", 3}, {"old_item0", 0}, {"new_item1", 0}, {"new_item2", 0}};
+    EXPECT_EQ(serializeOids({"/structarr/2"}, true, [&](std::size_t sent) {
+        if (sent == 1) {
+            roots_["/structarr/2"] = makeItems("new_item");
+        }
+    }), expected);
+}
+
+// A root removed while the stream is suspended ends its walk early
+TEST_F(ParamInfoSerializerTest, RootRemovedMidStream) {
+    auto items = node("items", true);
+    for (std::size_t i = 0; i < 3; ++i) {
+        items->elements.push_back(node("item"));
+    }
+    roots_["/items"] = items;
+    roots_["/other"] = node("other");
+
+    Responses expected{{"items", 3}, {"item", 0}, {"other", 0}};
+    EXPECT_EQ(serializeOids({"/items", "/other"}, true, [&](std::size_t sent) {
+        if (sent == 1) {
+            roots_.erase("/items");
+        }
+    }), expected);
+}
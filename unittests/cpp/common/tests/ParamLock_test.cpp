@@ -0,0 +1,171 @@
+/*
+ * Copyright 2026 Ross Video Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @brief This file is for testing the ParamLock.h file.
+ * @date 2026-10-16
+ * @copyright Copyright © 2026 Ross Video Ltd
+ */
+
+#include <gtest/gtest.h>
+#include "MockDevice.h"
+#include "CommonTestHelpers.h"
+#include <ParamLock.h>
+
+#include <map>
+#include <thread>
+
+using namespace catena::common;
+
+class ParamLockTest : public ::testing::Test {
+  protected:
+    // Set up and tear down Google Logging
+    static void SetUpTestSuite() {
+        set_up_test_logs(UNITTEST_LOG_DIR, "ParamLockTest");
+    }
+
+    void SetUp() override {
+        EXPECT_CALL(dm_, mutex()).WillRepeatedly(::testing::ReturnRef(deviceMutex_));
+        // One mutex per top level param, named by the oid's first character
+        for (char name : {'a', 'b', 'c'}) {
+            paramMutexes_[name];
+        }
+        EXPECT_CALL(dm_, paramMutex(::testing::_)).WillRepeatedly(::testing::Invoke([this](const std::string& oid) -> std::shared_mutex& {
+            return paramMutexes_.at(oid.at(oid.starts_with("/") ? 1 : 0));
+        }));
+    }
+
+    /*
+     * Returns true if mutex can not be locked exclusively. Tried from
+     * another thread, as this one may hold it.
+     */
+    static bool locked(std::shared_mutex& mutex) {
+        bool acquired = false;
+        std::thread([&]() {
+            acquired = mutex.try_lock();
+            if (acquired) {
+                mutex.unlock();
+            }
+        }).join();
+        return !acquired;
+    }
+
+    /*
+     * Returns true if mutex can not be locked shared, from another thread.
+     */
+    static bool lockedExclusive(std::shared_mutex& mutex) {
+        bool acquired = false;
+        std::thread([&]() {
+            acquired = mutex.try_lock_shared();
+            if (acquired) {
+                mutex.unlock_shared();
+            }
+        }).join();
+        return !acquired;
+    }
+
+    MockDevice dm_;
+    std::shared_mutex deviceMutex_;
+    std::map<char, std::shared_mutex> paramMutexes_;
+};
+
+/*
+ * TEST 1 - A read lock holds the device and the param shared.
+ */
+TEST_F(ParamLockTest, ParamReadLock) {
+    {
+        ParamReadLock lock(dm_, "/a/b/0");
+        EXPECT_TRUE(locked(deviceMutex_));
+        EXPECT_FALSE(lockedExclusive(deviceMutex_));
+        EXPECT_TRUE(locked(paramMutexes_['a']));
+        EXPECT_FALSE(lockedExclusive(paramMutexes_['a']));
+        // Other readers of the param are not blocked
+        ParamReadLock other(dm_, "/a/c");
+        EXPECT_FALSE(locked(paramMutexes_['b']));
+    }
+    EXPECT_FALSE(locked(deviceMutex_));
+    EXPECT_FALSE(locked(paramMutexes_['a']));
+}
+
+/*
+ * TEST 2 - A write lock holds the device shared and each param it sets
+ * exclusively, once.
+ */
+TEST_F(ParamLockTest, ParamWriteLock) {
+    st2138::MultiSetValuePayload src;
+    for (const std::string& oid : {"/b/0", "/a", "/b/-", "b/x"}) {
+        src.add_values()->set_oid(oid);
+    }
+    {
+        ParamWriteLock lock(dm_, src);
+        EXPECT_FALSE(lockedExclusive(deviceMutex_));
+        EXPECT_TRUE(lockedExclusive(paramMutexes_['a']));
+        EXPECT_TRUE(lockedExclusive(paramMutexes_['b']));
+        EXPECT_FALSE(locked(paramMutexes_['c']));
+    }
+    EXPECT_FALSE(locked(deviceMutex_));
+    EXPECT_FALSE(locked(paramMutexes_['a']));
+    EXPECT_FALSE(locked(paramMutexes_['b']));
+}
+
+/*
+ * TEST 3 - Writers to different params do not wait for each other, and
+ * writers to the same param take turns.
+ */
+TEST_F(ParamLockTest, ParamWriteLock_Concurrent) {
+    constexpr int kWrites = 2000;
+    st2138::MultiSetValuePayload setA, setAB;
+    setA.add_values()->set_oid("/a");
+    setAB.add_values()->set_oid("/b");
+    setAB.add_values()->set_oid("/a");
+    int a = 0;
+    int b = 0;
+    {
+        // Held by a reader of c throughout
+        ParamReadLock reader(dm_, "/c");
+        std::thread first([&]() {
+            for (int i = 0; i < kWrites; ++i) {
+                ParamWriteLock lock(dm_, setA);
+                ++a;
+            }
+        });
+        std::thread second([&]() {
+            for (int i = 0; i < kWrites; ++i) {
+                ParamWriteLock lock(dm_, setAB);
+                ++a;
+                ++b;
+            }
+        });
+        first.join();
+        second.join();
+    }
+    EXPECT_EQ(a, 2 * kWrites);
+    EXPECT_EQ(b, kWrites);
+}
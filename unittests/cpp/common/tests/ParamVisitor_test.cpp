@@ -75,14 +75,18 @@ protected:
             }));
 
         // Set up default behavior for mutex
-        static std::mutex test_mutex;
+        static std::shared_mutex test_mutex;
         EXPECT_CALL(*device, mutex())
             .WillRepeatedly(::testing::ReturnRef(test_mutex));
+        static std::shared_mutex test_param_mutex;
+        EXPECT_CALL(*device, paramMutex(::testing::_))
+            .WillRepeatedly(::testing::ReturnRef(test_param_mutex));
 
         // Set up default behavior for getParam
         EXPECT_CALL(*device, getParam(::testing::Matcher<const std::string&>(::testing::_), ::testing::_, ::testing::_))
             .WillRepeatedly(::testing::Invoke([this](const std::string& fqoid, catena::exception_with_status& status, const IAuthorizer& authz) -> std::unique_ptr<IParam> {
                 auto param = std::make_unique<MockParam>();
+                resolveChildrenFromDevice(*param, fqoid, *device);
                 EXPECT_CALL(*param, getDescriptor())
                     .WillRepeatedly(::testing::ReturnRef(test_descriptor));
                 EXPECT_CALL(*param, isArrayType())
@@ -121,7 +125,8 @@ protected:
 TEST_F(ParamVisitorTest, VisitSingleParam) {
     MockParamVisitor visitor;
     EXPECT_CALL(test_descriptor, getAllSubParams).Times(1).WillOnce(::testing::ReturnRef(empty_SubParams));
-    ParamVisitor::traverseParams(mockParam.get(), "/test/param", *device, visitor, authz_);
+    resolveChildrenFromDevice(*mockParam, "/test/param", *device);
+    ParamVisitor::traverseParams(mockParam.get(), "/test/param", visitor, authz_);
     
     EXPECT_EQ(visitor.visitedPaths.size(), 1);
     EXPECT_EQ(visitor.visitedPaths[0], "/test/param");
@@ -146,6 +151,7 @@ TEST_F(ParamVisitorTest, VisitArrayParam) {
     EXPECT_CALL(*device, getParam(::testing::Matcher<const std::string&>(::testing::_), ::testing::_, ::testing::_))
         .WillRepeatedly(::testing::Invoke([this](const std::string& fqoid, catena::exception_with_status& status, const IAuthorizer& authz) -> std::unique_ptr<IParam> {
             auto param = std::make_unique<MockParam>();
+            resolveChildrenFromDevice(*param, fqoid, *device);
             EXPECT_CALL(*param, getDescriptor())
                 .WillRepeatedly(::testing::ReturnRef(test_descriptor));
             EXPECT_CALL(*param, isArrayType())
@@ -161,7 +167,8 @@ TEST_F(ParamVisitorTest, VisitArrayParam) {
         }));
 
     MockParamVisitor visitor;
-    ParamVisitor::traverseParams(mockParam.get(), array_oid, *device, visitor, authz_);
+    resolveChildrenFromDevice(*mockParam, array_oid, *device);
+    ParamVisitor::traverseParams(mockParam.get(), array_oid, visitor, authz_);
     
     EXPECT_EQ(visitor.visitedPaths.size(), 4);  // Array + 3 elements
     EXPECT_EQ(visitor.visitedPaths[0], array_oid);
@@ -200,8 +207,9 @@ TEST_F(ParamVisitorTest, VisitNestedParams) {
 
     // Set up device to return different params based on the path
     EXPECT_CALL(*device, getParam(::testing::Matcher<const std::string&>(::testing::_), ::testing::_, ::testing::_))
-        .WillRepeatedly(::testing::Invoke([parent, nested, nested2, full_nested_oid, full_nested2_oid](const std::string& fqoid, catena::exception_with_status& status, const IAuthorizer& authz) -> std::unique_ptr<IParam> {
+        .WillRepeatedly(::testing::Invoke([this, parent, nested, nested2, full_nested_oid, full_nested2_oid](const std::string& fqoid, catena::exception_with_status& status, const IAuthorizer& authz) -> std::unique_ptr<IParam> {
             auto param = std::make_unique<MockParam>();
+            resolveChildrenFromDevice(*param, fqoid, *device);
             
             // Set up getScope for authorization (same for all params in this test)
             static const std::string scope = Scopes().getForwardMap().at(Scopes_e::kMonitor);
@@ -238,7 +246,8 @@ TEST_F(ParamVisitorTest, VisitNestedParams) {
         }));
 
     MockParamVisitor visitor;
-    ParamVisitor::traverseParams(mockParam.get(), parent_oid, *device, visitor, authz_);
+    resolveChildrenFromDevice(*mockParam, parent_oid, *device);
+    ParamVisitor::traverseParams(mockParam.get(), parent_oid, visitor, authz_);
     
     EXPECT_EQ(visitor.visitedPaths.size(), 3);
     EXPECT_EQ(visitor.visitedPaths[0], parent_oid);  // First path should be parent
@@ -276,8 +285,9 @@ TEST_F(ParamVisitorTest, VisitArrayElements) {
 
     // Set up device to return array elements with proper descriptors
     EXPECT_CALL(*device, getParam(::testing::Matcher<const std::string&>(::testing::_), ::testing::_, ::testing::_))
-        .WillRepeatedly(::testing::Invoke([array_root, element0, element1, element_param0, element_param1, array_oid, element_param](const std::string& fqoid, catena::exception_with_status& status, const IAuthorizer& authz) -> std::unique_ptr<IParam> {
+        .WillRepeatedly(::testing::Invoke([this, array_root, element0, element1, element_param0, element_param1, array_oid, element_param](const std::string& fqoid, catena::exception_with_status& status, const IAuthorizer& authz) -> std::unique_ptr<IParam> {
             auto param = std::make_unique<MockParam>();
+            resolveChildrenFromDevice(*param, fqoid, *device);
             
             // Set up getScope for authorization (same for all params in this test)
             static const std::string scope = Scopes().getForwardMap().at(Scopes_e::kMonitor);
@@ -303,7 +313,8 @@ TEST_F(ParamVisitorTest, VisitArrayElements) {
         }));
 
     MockParamVisitor visitor;
-    ParamVisitor::traverseParams(mockParam.get(), array_oid, *device, visitor, authz_);
+    resolveChildrenFromDevice(*mockParam, array_oid, *device);
+    ParamVisitor::traverseParams(mockParam.get(), array_oid, visitor, authz_);
     
     EXPECT_EQ(visitor.visitedPaths.size(), 5); 
     EXPECT_EQ(visitor.visitedPaths[0], array_oid); 
@@ -314,4 +325,35 @@ TEST_F(ParamVisitorTest, VisitArrayElements) {
     EXPECT_EQ(visitor.visitedArrays.size(), 1); 
     EXPECT_EQ(visitor.visitedArrays[0].first, array_oid); 
     EXPECT_EQ(visitor.visitedArrays[0].second, 2);  
-} 
\ No newline at end of file
+} 
+// Test that children are resolved from their parent rather than from the device
+TEST_F(ParamVisitorTest, ResolvesChildrenFromParent) {
+    std::string parent_oid = "/parent";
+    std::string child_oid = parent_oid + "/child~1name";
+    auto parent = ParamHierarchyBuilder::createDescriptor(parent_oid);
+    auto child = ParamHierarchyBuilder::createDescriptor(child_oid);
+    ParamHierarchyBuilder::addChild(parent, "child/name", child);
+    EXPECT_CALL(*mockParam, getDescriptor())
+        .WillRepeatedly(::testing::ReturnRef(*parent.descriptor));
+
+    // The device is never asked to re-resolve a child from its root
+    EXPECT_CALL(*device, getParam(::testing::Matcher<const std::string&>(::testing::_), ::testing::_, ::testing::_)).Times(0);
+    EXPECT_CALL(*mockParam, getParam(::testing::An<Path&>(), ::testing::_, ::testing::_))
+        .WillOnce(::testing::Invoke([child](Path& oid, const IAuthorizer& authz, catena::exception_with_status& status) -> std::unique_ptr<IParam> {
+            EXPECT_EQ(oid.size(), 1);
+            EXPECT_EQ(oid.front_as_string(), "child/name");
+            auto param = std::make_unique<MockParam>();
+            static const std::string scope = Scopes().getForwardMap().at(Scopes_e::kMonitor);
+            static const std::string oidStr = "child/name";
+            setupMockParam(*param, oidStr, *child.descriptor, false, 0, scope);
+            status = catena::exception_with_status("", catena::StatusCode::OK);
+            return param;
+        }));
+
+    MockParamVisitor visitor;
+    ParamVisitor::traverseParams(mockParam.get(), parent_oid, visitor, authz_);
+
+    ASSERT_EQ(visitor.visitedPaths.size(), 2);
+    EXPECT_EQ(visitor.visitedPaths[0], parent_oid);
+    EXPECT_EQ(visitor.visitedPaths[1], child_oid);
+}
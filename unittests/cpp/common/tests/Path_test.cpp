@@ -79,7 +79,8 @@ TEST_F(PathTest, Path_CreateValid) {
  */
 TEST_F(PathTest, Path_CreateInvalid) {
     std::vector<std::string> paths = {
-        "/1test", "/test/1path", "/test-path", "/test//path", "test/path"
+        "/1test", "/test/1path", "/test-path", "/test//path", "test/path",
+        "/", "/test/", "/-1", "/test~0path", "/99999999999999999999999"
     };
     for (std::string& path : paths) {
         EXPECT_THROW(Path p(path), catena::exception_with_status) << "Path \"" << path << "\" should throw an exception.";
@@ -278,3 +279,13 @@ TEST_F(PathTest, Path_Operator) {
     Path p2("/test/path/1/-");
     EXPECT_EQ(p1.fqoid(), p2.fqoid());
 }
+
+/*
+ * TEST 13 - Testing Path constructor with an empty json pointer.
+ */
+TEST_F(PathTest, Path_CreateEmpty) {
+    Path p("");
+    EXPECT_TRUE(p.empty())     << "Empty json pointer should have no segments";
+    EXPECT_EQ(p.size(), 0)     << "Empty json pointer should have no segments";
+    EXPECT_EQ(p.fqoid(), "")   << "fqoid of an empty path should be empty";
+}
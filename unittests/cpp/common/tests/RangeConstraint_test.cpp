@@ -48,6 +48,10 @@
 
 #include "RangeConstraint.h"
 
+// std
+#include <vector>
+#include <span>
+
 using namespace catena::common;
 
 // Test fixture class for RangeConstraint tests
@@ -197,6 +201,31 @@ TEST_F(RangeConstraintTest, RangeConstraint_IntToProto) {
     EXPECT_EQ(protoConstraint.int32_range().display_min(), displayMin);
     EXPECT_EQ(protoConstraint.int32_range().display_max(), displayMax);
 }
+/* 
+ * TEST 1.5 - Testing Int RangeConstraint typed satisfied, validate and clamp
+ */
+TEST_F(RangeConstraintTest, RangeConstraint_IntBulk) {
+    RangeConstraint<int32_t> constraint(0, 10, 2, "test_oid", false);
+    // Typed satisfied matches satisfied(st2138::Value).
+    EXPECT_TRUE(constraint.satisfied(int32_t(4)));
+    EXPECT_FALSE(constraint.satisfied(int32_t(3))) << "Should not be satisfied off step";
+    EXPECT_FALSE(constraint.satisfied(4.0f)) << "Int range should not be satisfied by a float";
+    // validate
+    std::vector<int32_t> valid{0, 2, 10};
+    std::vector<int32_t> invalid{0, 2, 11};
+    EXPECT_TRUE(constraint.validate(std::span<const int32_t>(valid)));
+    EXPECT_FALSE(constraint.validate(std::span<const int32_t>(invalid)));
+    // clamp matches apply
+    std::vector<int32_t> values{-2, 3, 4, 12};
+    constraint.clamp(std::span<int32_t>(values));
+    EXPECT_EQ(values, (std::vector<int32_t>{0, 2, 4, 10}));
+    // Without a step
+    RangeConstraint<int32_t> noStep(0, 10, 0, "test_oid", false);
+    values = {-2, 3, 12};
+    noStep.clamp(std::span<int32_t>(values));
+    EXPECT_EQ(values, (std::vector<int32_t>{0, 3, 10}));
+    EXPECT_TRUE(noStep.validate(std::span<const int32_t>(values)));
+}
 
 
 
@@ -361,3 +390,34 @@ TEST_F(RangeConstraintTest, RangeConstraint_FloatToProto) {
     EXPECT_EQ(protoConstraint.float_range().display_min(), displayMin);
     EXPECT_EQ(protoConstraint.float_range().display_max(), displayMax);
 }
+/* 
+ * TEST 2.5 - Testing Float RangeConstraint typed satisfied, validate and clamp
+ */
+TEST_F(RangeConstraintTest, RangeConstraint_FloatBulk) {
+    RangeConstraint<float> constraint(0.5, 9.5, 0.5, "test_oid", false);
+    // Typed satisfied matches satisfied(st2138::Value).
+    EXPECT_TRUE(constraint.satisfied(4.5f));
+    EXPECT_FALSE(constraint.satisfied(4.6f)) << "Should not be satisfied off step";
+    EXPECT_FALSE(constraint.satisfied(int32_t(4))) << "Float range should not be satisfied by an int";
+    // validate
+    std::vector<float> valid{0.5, 1, 9.5};
+    std::vector<float> invalid{0.5, 1, 10};
+    EXPECT_TRUE(constraint.validate(std::span<const float>(valid)));
+    EXPECT_FALSE(constraint.validate(std::span<const float>(invalid)));
+    // clamp matches apply
+    std::vector<float> values{0, 4.6, 4.5, 10};
+    std::vector<float> expected;
+    for (float f : values) {
+        st2138::Value src;
+        src.set_float32_value(f);
+        expected.push_back(constraint.apply(src).float32_value());
+    }
+    constraint.clamp(std::span<float>(values));
+    EXPECT_EQ(values, expected);
+    // Without a step
+    RangeConstraint<float> noStep(0.5, 9.5, 0, "test_oid", false);
+    values = {0, 4.6, 10};
+    noStep.clamp(std::span<float>(values));
+    EXPECT_EQ(values, (std::vector<float>{0.5, 4.6, 9.5}));
+    EXPECT_TRUE(noStep.validate(std::span<const float>(values)));
+}
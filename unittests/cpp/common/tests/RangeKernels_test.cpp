@@ -0,0 +1,168 @@
+/*
+ * Copyright 2026 Ross Video Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @brief This file is for testing the RangeKernels.cpp file.
+ * @date 2026-10-16
+ * @copyright Copyright © 2026 Ross Video Ltd
+ */
+
+// gtest
+#include <gtest/gtest.h>
+
+#include "CommonTestHelpers.h"
+
+#include "RangeConstraint.h"
+#include "RangeKernels.h"
+
+// std
+#include <bit>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+using namespace catena::common;
+
+// Test fixture class for RangeKernels tests
+class RangeKernelsTest : public ::testing::Test {
+protected:
+    // Set up and tear down Google Logging
+    static void SetUpTestSuite() {
+        set_up_test_logs(UNITTEST_LOG_DIR, "RangeKernelsTest");
+    }
+
+    /*
+     * Every level the CPU supports.
+     */
+    static std::vector<SimdLevel> levels() {
+        std::vector<SimdLevel> ans{SimdLevel::kScalar};
+        if (simdLevel() >= SimdLevel::kSse41) { ans.push_back(SimdLevel::kSse41); }
+        if (simdLevel() >= SimdLevel::kAvx2) { ans.push_back(SimdLevel::kAvx2); }
+        return ans;
+    }
+
+    /*
+     * Float values around the bounds and steps of [min, max], with ties,
+     * signed zeros, infinities and NaN. Odd lengths exercise the tails.
+     */
+    static std::vector<float> floatValues(float min, float max, float step) {
+        std::vector<float> ans{0.0f, -0.0f, min, max,
+                               std::numeric_limits<float>::infinity(),
+                               -std::numeric_limits<float>::infinity(),
+                               std::numeric_limits<float>::quiet_NaN()};
+        for (float v = min - 2 * step; v <= max + 2 * step; v += step / 2) {
+            ans.push_back(v);
+            ans.push_back(std::nextafter(v, min - 10 * step));
+            ans.push_back(std::nextafter(v, max + 10 * step));
+        }
+        std::mt19937 rng(2138);
+        std::uniform_real_distribution<float> dist(min - 10 * step, max + 10 * step);
+        for (int i = 0; i < 1001; ++i) { ans.push_back(dist(rng)); }
+        return ans;
+    }
+
+    /*
+     * The result of RangeConstraint::apply for one float value.
+     */
+    static float applied(const RangeConstraint<float>& constraint, float v) {
+        st2138::Value src;
+        src.set_float32_value(v);
+        return constraint.apply(src).float32_value();
+    }
+
+    /*
+     * The result of RangeConstraint::apply for one int value.
+     */
+    static int32_t applied(const RangeConstraint<int32_t>& constraint, int32_t v) {
+        st2138::Value src;
+        src.set_int32_value(v);
+        return constraint.apply(src).int32_value();
+    }
+};
+
+/*
+ * TEST 1 - Float kernels match RangeConstraint::apply at every level.
+ */
+TEST_F(RangeKernelsTest, Float_MatchesApply) {
+    struct Range { float min, max, step; };
+    for (const Range& r : {Range{0.0f, 10.0f, 0.0f}, Range{-5.0f, 5.0f, 0.5f},
+                           Range{0.0f, 1.0f, 0.1f}, Range{-3.0f, 7.0f, 3.0f}}) {
+        RangeConstraint<float> constraint(r.min, r.max, r.step, r.min, r.max, "test_oid", false);
+        std::vector<float> src = floatValues(r.min, r.max, r.step ? r.step : 1.0f);
+        for (SimdLevel level : levels()) {
+            std::vector<float> dst = src;
+            clampToRange(dst, r.min, r.max, r.step, level);
+            for (size_t i = 0; i < src.size(); ++i) {
+                float expected = applied(constraint, src[i]);
+                if (std::isnan(expected)) {
+                    EXPECT_TRUE(std::isnan(dst[i])) << "level " << int(level) << " value " << src[i];
+                } else {
+                    EXPECT_EQ(std::bit_cast<uint32_t>(dst[i]), std::bit_cast<uint32_t>(expected))
+                        << "level " << int(level) << " value " << src[i] << " got " << dst[i] << " expected " << expected;
+                }
+            }
+        }
+    }
+}
+
+/*
+ * TEST 2 - Int kernels match RangeConstraint::apply at every level.
+ */
+TEST_F(RangeKernelsTest, Int_MatchesApply) {
+    struct Range { int32_t min, max, step; };
+    for (const Range& r : {Range{0, 100, 0}, Range{-50, 50, 0}, Range{-10, 10, 3}, Range{0, 100, 7}}) {
+        RangeConstraint<int32_t> constraint(r.min, r.max, r.step, r.min, r.max, "test_oid", false);
+        std::vector<int32_t> src{std::numeric_limits<int32_t>::min(), std::numeric_limits<int32_t>::max()};
+        for (int32_t v = r.min - 20; v <= r.max + 20; ++v) { src.push_back(v); }
+        for (SimdLevel level : levels()) {
+            std::vector<int32_t> dst = src;
+            clampToRange(dst, r.min, r.max, r.step, level);
+            for (size_t i = 0; i < src.size(); ++i) {
+                EXPECT_EQ(dst[i], applied(constraint, src[i])) << "level " << int(level) << " value " << src[i];
+            }
+        }
+    }
+}
+
+/*
+ * TEST 3 - Requesting a level the CPU does not support falls back safely,
+ * and empty spans are left alone.
+ */
+TEST_F(RangeKernelsTest, LevelFallbackAndEmpty) {
+    std::vector<float> floats{-1.0f, 0.5f, 2.0f};
+    clampToRange(floats, 0.0f, 1.0f, 0.0f, SimdLevel::kAvx2);
+    EXPECT_EQ(floats, (std::vector<float>{0.0f, 0.5f, 1.0f}));
+    std::vector<int32_t> ints{-1, 5, 20};
+    clampToRange(ints, 0, 10, 0, SimdLevel::kAvx2);
+    EXPECT_EQ(ints, (std::vector<int32_t>{0, 5, 10}));
+    EXPECT_NO_THROW(clampToRange(std::span<float>{}, 0.0f, 1.0f, 0.0f));
+    EXPECT_NO_THROW(clampToRange(std::span<int32_t>{}, 0, 1, 0));
+}
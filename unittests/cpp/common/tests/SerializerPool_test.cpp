@@ -0,0 +1,133 @@
+/*
+ * Copyright 2026 Ross Video Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @brief This file is for testing the SerializerPool.cpp file.
+ * @date 2026-10-16
+ * @copyright Copyright © 2026 Ross Video Ltd
+ */
+
+#include <gtest/gtest.h>
+#include "CommonTestHelpers.h"
+#include <rpc/SerializerPool.h>
+
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+
+using namespace catena::common;
+
+class SerializerPoolTest : public ::testing::Test {
+  protected:
+    // Set up and tear down Google Logging
+    static void SetUpTestSuite() {
+        set_up_test_logs(UNITTEST_LOG_DIR, "SerializerPoolTest");
+    }
+};
+
+/*
+ * TEST 1 - With no workers tasks run inline, in order.
+ */
+TEST_F(SerializerPoolTest, SerializerPool_Inline) {
+    SerializerPool pool(0);
+    EXPECT_EQ(pool.workers(), 0);
+    std::vector<size_t> ran;
+    std::thread::id caller = std::this_thread::get_id();
+    pool.run(5, [&ran, caller](size_t i) {
+        EXPECT_EQ(std::this_thread::get_id(), caller);
+        ran.push_back(i);
+    });
+    EXPECT_EQ(ran, std::vector<size_t>({0, 1, 2, 3, 4}));
+    pool.run(0, [](size_t) { FAIL() << "No tasks to run"; });
+}
+
+/*
+ * TEST 2 - Every task runs exactly once before run returns.
+ */
+TEST_F(SerializerPoolTest, SerializerPool_RunsEveryTask) {
+    constexpr size_t kTasks = 1000;
+    SerializerPool pool(3);
+    EXPECT_EQ(pool.workers(), 3);
+    for (size_t batch = 0; batch < 50; ++batch) {
+        std::vector<std::atomic<uint32_t>> ran(kTasks);
+        pool.run(kTasks, [&ran](size_t i) { ran[i].fetch_add(1, std::memory_order_relaxed); });
+        for (size_t i = 0; i < kTasks; ++i) {
+            ASSERT_EQ(ran[i].load(), 1) << "task " << i << " of batch " << batch;
+        }
+    }
+}
+
+/*
+ * TEST 3 - The first exception is rethrown once the batch has finished.
+ */
+TEST_F(SerializerPoolTest, SerializerPool_Exception) {
+    constexpr size_t kTasks = 200;
+    SerializerPool pool(2);
+    std::atomic<size_t> ran{0};
+    EXPECT_THROW(pool.run(kTasks, [&ran](size_t i) {
+        ran.fetch_add(1);
+        if (i % 50 == 7) {
+            throw std::runtime_error("Task failed");
+        }
+    }), std::runtime_error);
+    EXPECT_EQ(ran.load(), kTasks);
+    // The pool is still usable afterwards.
+    ran = 0;
+    pool.run(kTasks, [&ran](size_t) { ran.fetch_add(1); });
+    EXPECT_EQ(ran.load(), kTasks);
+}
+
+/*
+ * TEST 4 - Batches from several callers share the pool.
+ */
+TEST_F(SerializerPoolTest, SerializerPool_ConcurrentCallers) {
+    constexpr size_t kCallers = 4;
+    constexpr size_t kTasks = 300;
+    SerializerPool pool(2);
+    std::vector<std::thread> callers;
+    std::vector<size_t> sums(kCallers, 0);
+    for (size_t c = 0; c < kCallers; ++c) {
+        callers.emplace_back([&pool, &sums, c]() {
+            for (size_t batch = 0; batch < 20; ++batch) {
+                std::vector<size_t> results(kTasks, 0);
+                pool.run(kTasks, [&results](size_t i) { results[i] = i; });
+                for (size_t r : results) {
+                    sums[c] += r;
+                }
+            }
+        });
+    }
+    for (auto& caller : callers) {
+        caller.join();
+    }
+    for (size_t sum : sums) {
+        EXPECT_EQ(sum, 20 * kTasks * (kTasks - 1) / 2);
+    }
+}
@@ -73,9 +73,12 @@ protected:
             .WillRepeatedly(::testing::Invoke([](const std::string& jptr, st2138::Value& value, const IAuthorizer& authz) -> catena::exception_with_status {
                 return catena::exception_with_status("", catena::StatusCode::OK);
             }));
-        static std::mutex test_mutex;
+        static std::shared_mutex test_mutex;
         EXPECT_CALL(*device, mutex())
             .WillRepeatedly(::testing::ReturnRef(test_mutex));
+        static std::shared_mutex test_param_mutex;
+        EXPECT_CALL(*device, paramMutex(::testing::_))
+            .WillRepeatedly(::testing::ReturnRef(test_param_mutex));
         EXPECT_CALL(*device, slot())
             .WillRepeatedly(::testing::Return(0));
 
@@ -83,6 +86,7 @@ protected:
         EXPECT_CALL(*device, getParam(::testing::Matcher<const std::string&>(::testing::_), ::testing::_, ::testing::_))
             .WillRepeatedly(::testing::Invoke([this](const std::string& fqoid, catena::exception_with_status& status, const IAuthorizer& authz) -> std::unique_ptr<IParam> {
                 auto param = std::make_unique<MockParam>();
+                resolveChildrenFromDevice(*param, fqoid, *device);
                 EXPECT_CALL(*param, getDescriptor())
                     .WillRepeatedly(::testing::ReturnRef(test_descriptor));
                 EXPECT_CALL(*param, isArrayType())
@@ -279,8 +283,8 @@ TEST_F(SubscriptionManagerTest, Subscription_GetAllSubscribedOids) {
     manager->addSubscription("/test/param2", *device, rc, authz_);
     auto oids = manager->getAllSubscribedOids(*device);
     EXPECT_EQ(oids.size(), 2);
-    EXPECT_TRUE(oids.find("/test/param1") != oids.end());
-    EXPECT_TRUE(oids.find("/test/param2") != oids.end());
+    EXPECT_TRUE(oids.contains("/test/param1"));
+    EXPECT_TRUE(oids.contains("/test/param2"));
 }
 
 //Test 1.6: Success case - isSubscribed
@@ -323,6 +327,7 @@ TEST_F(SubscriptionManagerTest, Wildcard_AddWildcardSubscription) {
         .WillRepeatedly(::testing::Invoke(
             [this](const std::string& fqoid, catena::exception_with_status& status, const IAuthorizer& authz) -> std::unique_ptr<IParam> {
                 auto param = std::make_unique<MockParam>();
+                resolveChildrenFromDevice(*param, fqoid, *device);
                 if (fqoid == "/test/*") {
                     setupMockParam(*param, "/test", *wildcardDescriptors.at("/test").descriptor);
                 } else if (wildcardDescriptors.find(fqoid) != wildcardDescriptors.end()) {
@@ -350,6 +355,7 @@ TEST_F(SubscriptionManagerTest, Wildcard_ExpansionVerification) {
         .WillRepeatedly(::testing::Invoke(
             [this](const std::string& fqoid, catena::exception_with_status& status, const IAuthorizer& authz) -> std::unique_ptr<IParam> {
                 auto param = std::make_unique<MockParam>();
+                resolveChildrenFromDevice(*param, fqoid, *device);
                 if (fqoid == "/test/*") {
                     setupMockParam(*param, "/test", *wildcardDescriptors.at("/test").descriptor);
                 } else if (wildcardDescriptors.find(fqoid) != wildcardDescriptors.end()) {
@@ -382,15 +388,15 @@ TEST_F(SubscriptionManagerTest, Wildcard_ExpansionVerification) {
     // Verify all 9 parameters were subscribed
     auto oids = manager->getAllSubscribedOids(*device);
     EXPECT_EQ(oids.size(), 9);
-    EXPECT_TRUE(oids.find("/test") != oids.end());
-    EXPECT_TRUE(oids.find("/test/param1") != oids.end());
-    EXPECT_TRUE(oids.find("/test/basic") != oids.end());
-    EXPECT_TRUE(oids.find("/test/basic/param2") != oids.end());
-    EXPECT_TRUE(oids.find("/test/basic/deeper") != oids.end());
-    EXPECT_TRUE(oids.find("/test/basic/deeper/param3") != oids.end());
-    EXPECT_TRUE(oids.find("/test/array") != oids.end());
-    EXPECT_TRUE(oids.find("/test/array/0/subparam") != oids.end());
-    EXPECT_TRUE(oids.find("/test/array/1/subparam") != oids.end());
+    EXPECT_TRUE(oids.contains("/test"));
+    EXPECT_TRUE(oids.contains("/test/param1"));
+    EXPECT_TRUE(oids.contains("/test/basic"));
+    EXPECT_TRUE(oids.contains("/test/basic/param2"));
+    EXPECT_TRUE(oids.contains("/test/basic/deeper"));
+    EXPECT_TRUE(oids.contains("/test/basic/deeper/param3"));
+    EXPECT_TRUE(oids.contains("/test/array"));
+    EXPECT_TRUE(oids.contains("/test/array/0/subparam"));
+    EXPECT_TRUE(oids.contains("/test/array/1/subparam"));
 }
 
 // Test 2.4: Success case - Wildcard subscription removal
@@ -402,6 +408,7 @@ TEST_F(SubscriptionManagerTest, Wildcard_RemoveWildcardSubscription) {
         .WillRepeatedly(::testing::Invoke(
             [this](const std::string& fqoid, catena::exception_with_status& status, const IAuthorizer& authz) -> std::unique_ptr<IParam> {
                 auto param = std::make_unique<MockParam>();
+                resolveChildrenFromDevice(*param, fqoid, *device);
                 if (fqoid == "/test/*") {
                     setupMockParam(*param, "/test", *wildcardDescriptors.at("/test").descriptor);
                 } else if (wildcardDescriptors.find(fqoid) != wildcardDescriptors.end()) {
@@ -449,8 +456,8 @@ TEST_F(SubscriptionManagerTest, Wildcard_RemoveWildcardSubscription) {
     // Verify the state after removal
     auto oids = manager->getAllSubscribedOids(*device);
     EXPECT_EQ(oids.size(), 1);
-    EXPECT_TRUE(oids.find("/nonwildcard/param") != oids.end());
-    EXPECT_TRUE(oids.find("/test") == oids.end()); // Wildcard subscriptions should be removed
+    EXPECT_TRUE(oids.contains("/nonwildcard/param"));
+    EXPECT_TRUE(!oids.contains("/test")); // Wildcard subscriptions should be removed
 }
 
 // Test 2.5: Error case - Wildcard removal
@@ -483,11 +490,12 @@ TEST_F(SubscriptionManagerTest, AllParams_AddAllParamsSubscription) {
     // Set up device to return all parameters 
     EXPECT_CALL(*device, getTopLevelParams(::testing::_, ::testing::_))
         .WillOnce(::testing::Invoke(
-            [&setup](catena::exception_with_status& status, const IAuthorizer& authz) -> std::vector<std::unique_ptr<IParam>> {
+            [this, &setup](catena::exception_with_status& status, const IAuthorizer& authz) -> std::vector<std::unique_ptr<IParam>> {
                 std::vector<std::unique_ptr<IParam>> params;
                 // Create new parameters with proper authorization setup
                 auto parentParam = std::make_unique<MockParam>();
                 setupMockParam(*parentParam, setup.parentOid, *setup.descriptors[setup.parentOid].descriptor);
+                resolveChildrenFromDevice(*parentParam, "/" + setup.parentOid, *device);
                 auto subParam = std::make_unique<MockParam>();
                 setupMockParam(*subParam, setup.subOid, *setup.descriptors[setup.subOid].descriptor);
                 // Return both parameters
@@ -505,8 +513,8 @@ TEST_F(SubscriptionManagerTest, AllParams_AddAllParamsSubscription) {
     // Verify that both the parent and sub-parameter were subscribed
     auto oids = manager->getAllSubscribedOids(*device);
     EXPECT_EQ(oids.size(), 2);
-    EXPECT_TRUE(oids.find("/param") != oids.end());
-    EXPECT_TRUE(oids.find("/param/subparam") != oids.end());
+    EXPECT_TRUE(oids.contains("/param"));
+    EXPECT_TRUE(oids.contains("/param/subparam"));
 
     // Now remove the "all params" subscription
     EXPECT_TRUE(manager->removeSubscription("/*", *device, rc));
@@ -531,8 +539,9 @@ TEST_F(SubscriptionManagerTest, AllParams_MixedAuthorizationResults) {
     // Override getParam behavior for this test to return parameters with correct scopes
     EXPECT_CALL(*device, getParam(::testing::Matcher<const std::string&>(::testing::_), ::testing::_, ::testing::_))
         .WillRepeatedly(::testing::Invoke(
-            [&setup, &authorized_scope, &unauthorized_scope](const std::string& fqoid, catena::exception_with_status& status, const IAuthorizer& authz) -> std::unique_ptr<IParam> {
+            [this, &setup, &authorized_scope, &unauthorized_scope](const std::string& fqoid, catena::exception_with_status& status, const IAuthorizer& authz) -> std::unique_ptr<IParam> {
                 auto param = std::make_unique<MockParam>();
+                resolveChildrenFromDevice(*param, fqoid, *device);
                 // Setup parameters with correct scopes based on OID pattern
                 if (fqoid.find(setup.subOid) != std::string::npos) {
                     setupMockParam(*param, fqoid, *setup.descriptors[setup.subOid].descriptor, false, 0, unauthorized_scope);
@@ -550,10 +559,11 @@ TEST_F(SubscriptionManagerTest, AllParams_MixedAuthorizationResults) {
     // Set up device to return all parameters
     EXPECT_CALL(*device, getTopLevelParams(::testing::_, ::testing::_))
         .WillOnce(::testing::Invoke(
-            [&setup, &authorized_scope, &unauthorized_scope](catena::exception_with_status& status, const IAuthorizer& authz) -> std::vector<std::unique_ptr<IParam>> {
+            [this, &setup, &authorized_scope, &unauthorized_scope](catena::exception_with_status& status, const IAuthorizer& authz) -> std::vector<std::unique_ptr<IParam>> {
                 std::vector<std::unique_ptr<IParam>> params;
                 auto parentParam = std::make_unique<MockParam>();
                 setupMockParam(*parentParam, setup.parentOid, *setup.descriptors[setup.parentOid].descriptor);
+                resolveChildrenFromDevice(*parentParam, "/" + setup.parentOid, *device);
                 params.push_back(std::move(parentParam));
                 status = catena::exception_with_status("", catena::StatusCode::OK);
                 return params;
@@ -564,11 +574,12 @@ TEST_F(SubscriptionManagerTest, AllParams_MixedAuthorizationResults) {
     EXPECT_TRUE(manager->addSubscription("/*", *device, rc, authz_));
     EXPECT_EQ(rc.status, catena::StatusCode::OK);
     
-    // Verify that only the authorized parameter was subscribed
+    // The wildcard covers both params. Read authorization is checked when
+    // the subscribed params are read, not when the wildcard is expanded.
     auto oids = manager->getAllSubscribedOids(*device);
-    EXPECT_EQ(oids.size(), 1);
-    EXPECT_TRUE(oids.find("/param") != oids.end());
-    EXPECT_TRUE(oids.find("/param/subparam") == oids.end()); // Should not be subscribed due to authorization
+    EXPECT_EQ(oids.size(), 2);
+    EXPECT_TRUE(oids.contains("/param"));
+    EXPECT_TRUE(oids.contains("/param/subparam"));
 }
 
 // Test 3.3: Error case - Remove non-existent "all params" subscription
@@ -597,11 +608,12 @@ TEST_F(SubscriptionManagerTest, AllParams_GetTopLevelParamsError) {
             }
         ));
 
-    // Test adding "all params" subscription when getTopLevelParams fails
-    EXPECT_FALSE(manager->addSubscription("/*", *device, rc, authz_));
-    EXPECT_EQ(rc.status, catena::StatusCode::INTERNAL);
+    // "/*" is stored as a single wildcard, top level params are only fetched
+    // when the subscriptions are expanded.
+    EXPECT_TRUE(manager->addSubscription("/*", *device, rc, authz_));
+    EXPECT_EQ(rc.status, catena::StatusCode::OK);
     
-    // Verify no subscriptions were added
+    // Verify the failed expansion yields no OIDs
     auto oids = manager->getAllSubscribedOids(*device);
     EXPECT_EQ(oids.size(), 0);
 }
@@ -637,8 +649,9 @@ TEST_F(SubscriptionManagerTest, AllParams_ParameterTraversalException) {
             }
         ));
 
-    // Test adding "all params" subscription when parameter traversal throws an exception
-    EXPECT_THROW(manager->addSubscription("/*", *device, rc, authz_), std::runtime_error);
+    // Test expanding "all params" subscription when parameter traversal throws an exception
+    EXPECT_TRUE(manager->addSubscription("/*", *device, rc, authz_));
+    EXPECT_THROW(manager->getAllSubscribedOids(*device).size(), std::runtime_error);
 }
 
 // ======= 4. ARRAY SUBSCRIPTION TESTS =======
@@ -665,7 +678,7 @@ TEST_F(SubscriptionManagerTest, Array_ElementSubscription) {
     // Verify array element sub-parameter is subscribed
     auto oids = manager->getAllSubscribedOids(*device);
     EXPECT_EQ(oids.size(), 1);
-    EXPECT_TRUE(oids.find("/test/array/0/subparam") != oids.end());
+    EXPECT_TRUE(oids.contains("/test/array/0/subparam"));
 }
 
 // Test 4.2: Success case - Basic array subscription with nested elements
@@ -680,6 +693,7 @@ TEST_F(SubscriptionManagerTest, Array_BasicArraySubscriptionWithNestedElements)
     EXPECT_CALL(*device, getParam(::testing::Matcher<const std::string&>(::testing::_), ::testing::_, ::testing::_))
         .WillRepeatedly(::testing::Invoke([this](const std::string& fqoid, catena::exception_with_status& status, const IAuthorizer&) -> std::unique_ptr<IParam> {
             auto param = std::make_unique<MockParam>();
+            resolveChildrenFromDevice(*param, fqoid, *device);
             setupMockParam(*param, fqoid, test_descriptor, false);
             static const std::string scope = Scopes().getForwardMap().at(Scopes_e::kMonitor);
             EXPECT_CALL(*param, getScope())
@@ -695,7 +709,7 @@ TEST_F(SubscriptionManagerTest, Array_BasicArraySubscriptionWithNestedElements)
     // Verify array is subscribed
     auto oids = manager->getAllSubscribedOids(*device);
     EXPECT_EQ(oids.size(), 1);
-    EXPECT_TRUE(oids.find("/test/array") != oids.end());
+    EXPECT_TRUE(oids.contains("/test/array"));
     
     // Remove array subscription
     EXPECT_TRUE(manager->removeSubscription("/test/array", *device, rc));
@@ -725,6 +739,7 @@ TEST_F(SubscriptionManagerTest, Array_WildcardSubscriptionWithNestedElements) {
                 auto it = wildcardDescriptors.find(fqoid);
                 if (it != wildcardDescriptors.end()) {
                     auto param = std::make_unique<MockParam>();
+                    resolveChildrenFromDevice(*param, fqoid, *device);
                     setupMockParam(*param, fqoid, *it->second.descriptor);
                     status = catena::exception_with_status("", catena::StatusCode::OK);
                     return param;
@@ -742,9 +757,9 @@ TEST_F(SubscriptionManagerTest, Array_WildcardSubscriptionWithNestedElements) {
     // Verify array and its elements with complete parameter paths are subscribed
     auto oids = manager->getAllSubscribedOids(*device);
     EXPECT_EQ(oids.size(), 3); // Array + 2 elements with sub-parameters
-    EXPECT_TRUE(oids.find("/test/array") != oids.end());
-    EXPECT_TRUE(oids.find("/test/array/0/subparam") != oids.end());
-    EXPECT_TRUE(oids.find("/test/array/1/subparam") != oids.end());
+    EXPECT_TRUE(oids.contains("/test/array"));
+    EXPECT_TRUE(oids.contains("/test/array/0/subparam"));
+    EXPECT_TRUE(oids.contains("/test/array/1/subparam"));
     
     // Remove array wildcard subscription
     EXPECT_TRUE(manager->removeSubscription("/test/array/*", *device, rc));
@@ -766,6 +781,7 @@ TEST_F(SubscriptionManagerTest, Array_IsSubscribedCheck) {
                 auto it = wildcardDescriptors.find(fqoid);
                 if (it != wildcardDescriptors.end()) {
                     auto param = std::make_unique<MockParam>();
+                    resolveChildrenFromDevice(*param, fqoid, *device);
                     setupMockParam(*param, fqoid, *it->second.descriptor);
                     status = catena::exception_with_status("", catena::StatusCode::OK);
                     return param;
@@ -804,6 +820,7 @@ TEST_F(SubscriptionManagerTest, Array_DuplicateSubscription) {
                 auto it = wildcardDescriptors.find(fqoid);
                 if (it != wildcardDescriptors.end()) {
                     auto param = std::make_unique<MockParam>();
+                    resolveChildrenFromDevice(*param, fqoid, *device);
                     setupMockParam(*param, fqoid, *it->second.descriptor);
                     status = catena::exception_with_status("", catena::StatusCode::OK);
                     return param;
@@ -824,7 +841,7 @@ TEST_F(SubscriptionManagerTest, Array_DuplicateSubscription) {
     // Verify only one subscription exists
     auto oids = manager->getAllSubscribedOids(*device);
     EXPECT_EQ(oids.size(), 1);
-    EXPECT_TRUE(oids.find("/test/array/0/subparam") != oids.end());
+    EXPECT_TRUE(oids.contains("/test/array/0/subparam"));
 }
 
 // Test 4.6: Error case - Remove non-existent array subscription
@@ -839,3 +856,184 @@ TEST_F(SubscriptionManagerTest, Array_RemoveNonExistentSubscription) {
     auto oids = manager->getAllSubscribedOids(*device);
     EXPECT_EQ(oids.size(), 0);
 }
+
+// ======= 5. TRIE TESTS =======
+
+// Test 5.1: Success case - Wildcards are stored without expanding them
+TEST_F(SubscriptionManagerTest, Trie_WildcardNotExpandedOnAdd) {
+    catena::exception_with_status rc("", catena::StatusCode::OK);
+    EXPECT_CALL(*device, getTopLevelParams(::testing::_, ::testing::_)).Times(0);
+    EXPECT_TRUE(manager->addSubscription("/*", *device, rc, authz_));
+
+    // Everything is covered, including params the device does not have yet.
+    EXPECT_TRUE(manager->isSubscribed("/test/param", *device));
+    EXPECT_TRUE(manager->isSubscribed("/new/param/0/child", *device));
+    EXPECT_TRUE(manager->getAllSubscribedOids(*device).contains("/test"));
+}
+
+// Test 5.2: Success case - isSubscribed matches whole segments only
+TEST_F(SubscriptionManagerTest, Trie_IsSubscribedWildcardPrefix) {
+    catena::exception_with_status rc("", catena::StatusCode::OK);
+    EXPECT_TRUE(manager->addSubscription("/test/*", *device, rc, authz_));
+    EXPECT_TRUE(manager->addSubscription("/nonwildcard/param", *device, rc, authz_));
+
+    EXPECT_TRUE(manager->isSubscribed("/test", *device));
+    EXPECT_TRUE(manager->isSubscribed("/test/basic/deeper/param3", *device));
+    EXPECT_FALSE(manager->isSubscribed("/testing", *device));
+    EXPECT_FALSE(manager->isSubscribed("/nonwildcard", *device));
+    EXPECT_TRUE(manager->isSubscribed("/nonwildcard/param", *device));
+    EXPECT_FALSE(manager->isSubscribed("/nonwildcard/param/child", *device));
+}
+
+// Test 5.3: Success case - Wildcards absorb the subscriptions below them
+TEST_F(SubscriptionManagerTest, Trie_WildcardAbsorbsChildren) {
+    catena::exception_with_status rc("", catena::StatusCode::OK);
+    EXPECT_TRUE(manager->addSubscription("/test/param", *device, rc, authz_));
+    EXPECT_TRUE(manager->addSubscription("/test/*", *device, rc, authz_));
+
+    // Already covered by the wildcard.
+    EXPECT_FALSE(manager->addSubscription("/test/param", *device, rc, authz_));
+    EXPECT_EQ(rc.status, catena::StatusCode::ALREADY_EXISTS);
+    EXPECT_TRUE(manager->addSubscription("/test/basic/*", *device, rc, authz_));
+
+    // Removing the wildcard removes everything below it.
+    EXPECT_TRUE(manager->removeSubscription("/test/*", *device, rc));
+    EXPECT_FALSE(manager->isSubscribed("/test/param", *device));
+    EXPECT_FALSE(manager->isSubscribed("/test/basic/param2", *device));
+    EXPECT_FALSE(manager->removeSubscription("/test/basic/*", *device, rc));
+    EXPECT_EQ(rc.status, catena::StatusCode::NOT_FOUND);
+}
+
+// Test 5.4: Success case - Views keep the subscriptions they were created with
+TEST_F(SubscriptionManagerTest, Trie_ViewIsSnapshot) {
+    catena::exception_with_status rc("", catena::StatusCode::OK);
+    EXPECT_TRUE(manager->addSubscription("/test/param1", *device, rc, authz_));
+    auto before = manager->getAllSubscribedOids(*device);
+
+    EXPECT_TRUE(manager->addSubscription("/test/param2", *device, rc, authz_));
+    EXPECT_TRUE(manager->removeSubscription("/test/param1", *device, rc));
+    auto after = manager->getAllSubscribedOids(*device);
+
+    EXPECT_TRUE(before.contains("/test/param1"));
+    EXPECT_FALSE(before.contains("/test/param2"));
+    EXPECT_EQ(before.size(), 1);
+    EXPECT_FALSE(after.contains("/test/param1"));
+    EXPECT_TRUE(after.contains("/test/param2"));
+    EXPECT_EQ(after.size(), 1);
+}
+
+// Test 5.5: Success case - Removing a parent keeps its subscribed children
+TEST_F(SubscriptionManagerTest, Trie_RemoveParentKeepsChildren) {
+    catena::exception_with_status rc("", catena::StatusCode::OK);
+    EXPECT_TRUE(manager->addSubscription("/test", *device, rc, authz_));
+    EXPECT_TRUE(manager->addSubscription("/test/basic/param2", *device, rc, authz_));
+
+    EXPECT_TRUE(manager->removeSubscription("/test", *device, rc));
+    EXPECT_FALSE(manager->removeSubscription("/test/basic", *device, rc));
+    EXPECT_FALSE(manager->isSubscribed("/test", *device));
+    EXPECT_TRUE(manager->isSubscribed("/test/basic/param2", *device));
+
+    EXPECT_TRUE(manager->removeSubscription("/test/basic/param2", *device, rc));
+    EXPECT_TRUE(manager->getAllSubscribedOids(*device).empty());
+}
+
+// Test 5.6: Success case - A wildcard upgrades an exact subscription to the same OID
+TEST_F(SubscriptionManagerTest, Trie_WildcardUpgradesExact) {
+    catena::exception_with_status rc("", catena::StatusCode::OK);
+    EXPECT_TRUE(manager->addSubscription("/test", *device, rc, authz_));
+    EXPECT_FALSE(manager->isSubscribed("/test/param", *device));
+
+    EXPECT_TRUE(manager->addSubscription("/test/*", *device, rc, authz_));
+    EXPECT_TRUE(manager->isSubscribed("/test", *device));
+    EXPECT_TRUE(manager->isSubscribed("/test/param", *device));
+    EXPECT_TRUE(manager->isSubscribed("/test/basic/param2", *device));
+
+    // Already covered by the wildcard itself, or by one above it.
+    EXPECT_TRUE(manager->addSubscription("/test/*", *device, rc, authz_));
+    EXPECT_TRUE(manager->addSubscription("/test/basic/*", *device, rc, authz_));
+    EXPECT_TRUE(manager->removeSubscription("/test/*", *device, rc));
+    EXPECT_FALSE(manager->isSubscribed("/test/param", *device));
+}
+
+// ======= 6. SCOPE TESTS =======
+
+// Test 6.1: Success case - Scopes do not see each other's subscriptions
+TEST_F(SubscriptionManagerTest, Scope_Isolated) {
+    catena::exception_with_status rc("", catena::StatusCode::OK);
+    manager->openScope("a");
+    manager->openScope("b");
+    EXPECT_TRUE(manager->addSubscription("/test/param1", *device, rc, authz_, "a"));
+    EXPECT_TRUE(manager->addSubscription("/test/param2", *device, rc, authz_, "b"));
+    EXPECT_TRUE(manager->addSubscription("/test/param3", *device, rc, authz_));
+
+    EXPECT_TRUE(manager->isSubscribed("/test/param1", *device, "a"));
+    EXPECT_FALSE(manager->isSubscribed("/test/param2", *device, "a"));
+    EXPECT_FALSE(manager->isSubscribed("/test/param3", *device, "a"));
+    EXPECT_FALSE(manager->isSubscribed("/test/param1", *device));
+    EXPECT_TRUE(manager->isSubscribed("/test/param3", *device));
+    EXPECT_EQ(manager->getAllSubscribedOids(*device, "b").size(), 1);
+
+    // The same OID can be subscribed to in each scope.
+    EXPECT_TRUE(manager->addSubscription("/test/param1", *device, rc, authz_, "b"));
+    EXPECT_TRUE(manager->removeSubscription("/test/param1", *device, rc, "a"));
+    EXPECT_TRUE(manager->isSubscribed("/test/param1", *device, "b"));
+    EXPECT_FALSE(manager->removeSubscription("/test/param2", *device, rc, "a"));
+    EXPECT_EQ(rc.status, catena::StatusCode::NOT_FOUND);
+    manager->closeScope("a");
+    manager->closeScope("b");
+}
+
+// Test 6.2: Success case - Scopes are dropped when their last connection closes
+TEST_F(SubscriptionManagerTest, Scope_OpenClose) {
+    catena::exception_with_status rc("", catena::StatusCode::OK);
+    manager->openScope("a");
+    manager->openScope("a");
+    EXPECT_TRUE(manager->addSubscription("/test/param1", *device, rc, authz_, "a"));
+    EXPECT_TRUE(manager->isSubscribed("/test/param1", *device, "a"));
+
+    manager->closeScope("a");
+    EXPECT_TRUE(manager->isSubscribed("/test/param1", *device, "a"));
+    manager->closeScope("a");
+    EXPECT_FALSE(manager->isSubscribed("/test/param1", *device, "a"));
+    EXPECT_TRUE(manager->getAllSubscribedOids(*device, "a").empty());
+
+    // Closing an unknown scope is harmless and the shared scope is never dropped.
+    manager->closeScope("unknown");
+    EXPECT_TRUE(manager->addSubscription("/test/param1", *device, rc, authz_));
+    manager->openScope(ISubscriptionManager::kSharedScope);
+    manager->closeScope(ISubscriptionManager::kSharedScope);
+    EXPECT_TRUE(manager->isSubscribed("/test/param1", *device));
+}
+
+// Test 6.3: Error case - Scopes no connection has open can not be changed
+TEST_F(SubscriptionManagerTest, Scope_NotOpen) {
+    catena::exception_with_status rc("", catena::StatusCode::OK);
+    // Nothing is created for a scope no connection owns.
+    EXPECT_FALSE(manager->addSubscription("/test/param1", *device, rc, authz_, "a"));
+    EXPECT_EQ(rc.status, catena::StatusCode::FAILED_PRECONDITION);
+    EXPECT_FALSE(manager->removeSubscription("/test/param1", *device, rc, "a"));
+    EXPECT_EQ(rc.status, catena::StatusCode::FAILED_PRECONDITION);
+    EXPECT_FALSE(manager->isSubscribed("/test/param1", *device, "a"));
+    manager->openScope("a");
+    EXPECT_TRUE(manager->getAllSubscribedOids(*device, "a").empty());
+
+    // Nor once its last connection has closed it.
+    manager->closeScope("a");
+    EXPECT_FALSE(manager->addSubscription("/test/param1", *device, rc, authz_, "a"));
+    EXPECT_EQ(rc.status, catena::StatusCode::FAILED_PRECONDITION);
+
+    // The shared scope is always open.
+    EXPECT_TRUE(manager->addSubscription("/test/param1", *device, rc, authz_));
+}
+
+// Test 6.4: Success case - Scope keys keep every subject and connection apart
+TEST_F(SubscriptionManagerTest, Scope_Key) {
+    EXPECT_EQ(ISubscriptionManager::scopeKey("", ""), ISubscriptionManager::kSharedScope);
+    EXPECT_NE(ISubscriptionManager::scopeKey("", "id"), ISubscriptionManager::kSharedScope);
+    EXPECT_NE(ISubscriptionManager::scopeKey("a", ""), ISubscriptionManager::kSharedScope);
+    EXPECT_NE(ISubscriptionManager::scopeKey("a", "id"), ISubscriptionManager::scopeKey("b", "id"));
+    EXPECT_NE(ISubscriptionManager::scopeKey("a", "id"), ISubscriptionManager::scopeKey("a", "other"));
+    // Subjects can not reach into other subjects' connections.
+    EXPECT_NE(ISubscriptionManager::scopeKey("a", "bc"), ISubscriptionManager::scopeKey("ab", "c"));
+    EXPECT_NE(ISubscriptionManager::scopeKey("a", "1:bc"), ISubscriptionManager::scopeKey("1:a", "bc"));
+}
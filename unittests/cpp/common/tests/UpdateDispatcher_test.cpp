@@ -0,0 +1,156 @@
+/*
+ * Copyright 2026 Ross Video Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @brief This file is for testing the UpdateDispatcher.cpp file.
+ * @date 2026-10-16
+ * @copyright Copyright © 2026 Ross Video Ltd
+ */
+
+#include <gtest/gtest.h>
+#include "CommonTestHelpers.h"
+#include <rpc/UpdateDispatcher.h>
+
+#include <mutex>
+#include <thread>
+
+using namespace catena::common;
+
+class UpdateDispatcherTest : public ::testing::Test {
+  protected:
+    // Set up and tear down Google Logging
+    static void SetUpTestSuite() {
+        set_up_test_logs(UNITTEST_LOG_DIR, "UpdateDispatcherTest");
+    }
+};
+
+/*
+ * TEST 1 - With no workers jobs run inline.
+ */
+TEST_F(UpdateDispatcherTest, UpdateDispatcher_Inline) {
+    UpdateDispatcher dispatcher(0);
+    EXPECT_FALSE(dispatcher.async());
+    std::thread::id ranOn;
+    dispatcher.post(0, [&ranOn]() { ranOn = std::this_thread::get_id(); });
+    EXPECT_EQ(ranOn, std::this_thread::get_id());
+    EXPECT_TRUE(dispatcher.metrics().depth.empty());
+}
+
+/*
+ * TEST 2 - Jobs with the same key run in order, on a worker thread.
+ */
+TEST_F(UpdateDispatcherTest, UpdateDispatcher_OrderPerKey) {
+    constexpr size_t kKeys = 8;
+    constexpr size_t kJobs = 2000;
+    std::mutex mtx;
+    std::vector<std::vector<size_t>> ran(kKeys);
+    std::vector<std::thread::id> ranOn;
+    {
+        UpdateDispatcher dispatcher(3);
+        EXPECT_TRUE(dispatcher.async());
+        // Posting from several threads, each with their own keys.
+        std::vector<std::thread> producers;
+        for (size_t t = 0; t < 2; ++t) {
+            producers.emplace_back([&, t]() {
+                for (size_t i = 0; i < kJobs; ++i) {
+                    for (size_t key = t; key < kKeys; key += 2) {
+                        dispatcher.post(key, [&, key, i]() {
+                            std::lock_guard<std::mutex> lock(mtx);
+                            ran[key].push_back(i);
+                            ranOn.push_back(std::this_thread::get_id());
+                        });
+                    }
+                }
+            });
+        }
+        for (auto& producer : producers) {
+            producer.join();
+        }
+    } // Destructor runs the remaining jobs.
+    for (size_t key = 0; key < kKeys; ++key) {
+        ASSERT_EQ(ran[key].size(), kJobs);
+        for (size_t i = 0; i < kJobs; ++i) {
+            EXPECT_EQ(ran[key][i], i);
+        }
+    }
+    for (auto& id : ranOn) {
+        EXPECT_NE(id, std::this_thread::get_id());
+    }
+}
+
+/*
+ * TEST 3 - Metrics count dispatched jobs and their latencies.
+ */
+TEST_F(UpdateDispatcherTest, UpdateDispatcher_Metrics) {
+    UpdateDispatcher dispatcher(2);
+    std::atomic<uint32_t> count{0};
+    for (uint32_t i = 0; i < 10; ++i) {
+        dispatcher.post(i, [&count]() {
+            count.fetch_add(1);
+            count.notify_one();
+        });
+    }
+    for (uint32_t seen = count.load(); seen < 10; seen = count.load()) {
+        count.wait(seen);
+    }
+    dispatcher.recordWrite(UpdateDispatcher::Clock::now() - std::chrono::milliseconds(3));
+    UpdateDispatcher::Metrics metrics = dispatcher.metrics();
+    EXPECT_EQ(metrics.depth.size(), 2);
+    EXPECT_GE(metrics.maxDepth, 1);
+    // The counter is bumped just after each job returns.
+    while (dispatcher.metrics().dispatched < 10) {
+        std::this_thread::yield();
+    }
+    metrics = dispatcher.metrics();
+    uint64_t dispatchCount = 0;
+    for (uint64_t c : metrics.dispatchLatency) {
+        dispatchCount += c;
+    }
+    EXPECT_EQ(dispatchCount, 10);
+    // 3ms lands in the [2048us, 4096us) bucket.
+    EXPECT_EQ(metrics.writeLatency[12], 1);
+}
+
+/*
+ * TEST 4 - LatencyHistogram bucket boundaries.
+ */
+TEST_F(UpdateDispatcherTest, LatencyHistogram_Buckets) {
+    LatencyHistogram histogram;
+    histogram.record(std::chrono::nanoseconds(500));
+    histogram.record(std::chrono::microseconds(1));
+    histogram.record(std::chrono::microseconds(3));
+    histogram.record(std::chrono::hours(1));
+    LatencyHistogram::Counts counts = histogram.counts();
+    EXPECT_EQ(counts[0], 1);
+    EXPECT_EQ(counts[1], 1);
+    EXPECT_EQ(counts[2], 1);
+    EXPECT_EQ(counts[LatencyHistogram::kBuckets - 1], 1);
+    EXPECT_EQ(LatencyHistogram::upperBound(2), std::chrono::microseconds(4));
+}
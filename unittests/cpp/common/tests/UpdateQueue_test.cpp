@@ -0,0 +1,151 @@
+/*
+ * Copyright 2026 Ross Video Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @brief This file is for testing the UpdateQueue.cpp file.
+ * @date 2026-10-16
+ * @copyright Copyright © 2026 Ross Video Ltd
+ */
+
+#include <gtest/gtest.h>
+#include "CommonTestHelpers.h"
+#include <rpc/UpdateQueue.h>
+#include "Config.h"
+
+using namespace catena::common;
+
+class UpdateQueueTest : public ::testing::Test {
+  protected:
+    // Set up and tear down Google Logging
+    static void SetUpTestSuite() {
+        set_up_test_logs(UNITTEST_LOG_DIR, "UpdateQueueTest");
+    }
+
+    // Returns a value update for oid with an int32 value.
+    static SharedUpdatePtr valueUpdate(uint32_t slot, const std::string& oid, int32_t value) {
+        st2138::PushUpdates update;
+        update.set_slot(slot);
+        update.mutable_value()->set_oid(oid);
+        update.mutable_value()->mutable_value()->set_int32_value(value);
+        return std::make_shared<SharedUpdate>(std::move(update));
+    }
+};
+
+/*
+ * TEST 1 - Updates to the same oid keep the first position and latest value.
+ */
+TEST_F(UpdateQueueTest, UpdateQueue_Coalesce) {
+    UpdateQueue queue(8, UpdateQueue::Overflow::kDropOldest);
+    EXPECT_TRUE(queue.push(0, "/a", valueUpdate(0, "/a", 1)));
+    EXPECT_TRUE(queue.push(0, "/b", valueUpdate(0, "/b", 2)));
+    EXPECT_TRUE(queue.push(0, "/a", valueUpdate(0, "/a", 3)));
+    EXPECT_EQ(queue.size(), 2);
+    std::vector<SharedUpdatePtr> batch;
+    EXPECT_EQ(queue.drain(batch, 8), 2);
+    EXPECT_EQ(batch[0]->message().value().oid(), "/a");
+    EXPECT_EQ(batch[0]->message().value().value().int32_value(), 3);
+    EXPECT_EQ(batch[1]->message().value().oid(), "/b");
+    EXPECT_TRUE(queue.empty());
+    // Once drained, the oid is queued again rather than coalesced.
+    EXPECT_TRUE(queue.push(0, "/a", valueUpdate(0, "/a", 4)));
+    EXPECT_EQ(queue.metrics().coalesced, 1);
+    EXPECT_EQ(queue.metrics().enqueued, 3);
+}
+
+/*
+ * TEST 2 - Updates without an oid are never coalesced.
+ */
+TEST_F(UpdateQueueTest, UpdateQueue_NoCoalesce) {
+    UpdateQueue queue(8, UpdateQueue::Overflow::kDropOldest);
+    queue.push(std::make_shared<SharedUpdate>(st2138::PushUpdates()));
+    queue.push(std::make_shared<SharedUpdate>(st2138::PushUpdates()));
+    EXPECT_EQ(queue.size(), 2);
+}
+
+/*
+ * TEST 3 - drain respects the batch size.
+ */
+TEST_F(UpdateQueueTest, UpdateQueue_DrainBatch) {
+    UpdateQueue queue(8, UpdateQueue::Overflow::kDropOldest);
+    for (int32_t i = 0; i < 5; ++i) {
+        queue.push(0, "/" + std::to_string(i), valueUpdate(0, "/" + std::to_string(i), i));
+    }
+    std::vector<SharedUpdatePtr> batch;
+    EXPECT_EQ(queue.drain(batch, 3), 3);
+    EXPECT_EQ(queue.size(), 2);
+    EXPECT_EQ(queue.drain(batch, 3), 2);
+    ASSERT_EQ(batch.size(), 5);
+    for (int32_t i = 0; i < 5; ++i) {
+        EXPECT_EQ(batch[i]->message().value().value().int32_value(), i);
+    }
+    EXPECT_EQ(queue.metrics().delivered, 5);
+}
+
+/*
+ * TEST 4 - kDropOldest discards the oldest update when full.
+ */
+TEST_F(UpdateQueueTest, UpdateQueue_DropOldest) {
+    UpdateQueue queue(2, UpdateQueue::Overflow::kDropOldest);
+    queue.push(0, "/a", valueUpdate(0, "/a", 1));
+    queue.push(0, "/b", valueUpdate(0, "/b", 2));
+    EXPECT_TRUE(queue.push(0, "/c", valueUpdate(0, "/c", 3)));
+    EXPECT_FALSE(queue.overflowed());
+    // "/a" was dropped so it is queued again instead of coalesced.
+    EXPECT_TRUE(queue.push(0, "/a", valueUpdate(0, "/a", 4)));
+    std::vector<SharedUpdatePtr> batch;
+    queue.drain(batch, 8);
+    ASSERT_EQ(batch.size(), 2);
+    EXPECT_EQ(batch[0]->message().value().oid(), "/c");
+    EXPECT_EQ(batch[1]->message().value().oid(), "/a");
+    EXPECT_EQ(queue.metrics().dropped, 2);
+}
+
+/*
+ * TEST 5 - kDisconnect rejects new oids when full but still coalesces.
+ */
+TEST_F(UpdateQueueTest, UpdateQueue_Disconnect) {
+    UpdateQueue queue(1, UpdateQueue::Overflow::kDisconnect);
+    EXPECT_TRUE(queue.push(0, "/a", valueUpdate(0, "/a", 1)));
+    EXPECT_TRUE(queue.push(0, "/a", valueUpdate(0, "/a", 2)));
+    EXPECT_FALSE(queue.overflowed());
+    EXPECT_FALSE(queue.push(0, "/b", valueUpdate(0, "/b", 3)));
+    EXPECT_TRUE(queue.overflowed());
+    EXPECT_EQ(queue.size(), 1);
+}
+
+/*
+ * TEST 6 - A depth of 0 is treated as 1.
+ */
+TEST_F(UpdateQueueTest, UpdateQueue_MinDepth) {
+    UpdateQueue queue(0, UpdateQueue::Overflow::kDropOldest);
+    EXPECT_EQ(queue.metrics().maxDepth, 1);
+    EXPECT_TRUE(queue.push(0, "/a", valueUpdate(0, "/a", 1)));
+    EXPECT_EQ(queue.size(), 1);
+}
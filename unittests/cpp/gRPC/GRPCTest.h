@@ -126,8 +126,10 @@ class GRPCTest : public ::testing::Test {
             testCall_.reset(nullptr);
         }));
         EXPECT_CALL(dm0_, mutex()).WillRepeatedly(::testing::ReturnRef(mtx0_));
+        EXPECT_CALL(dm0_, paramMutex(::testing::_)).WillRepeatedly(::testing::ReturnRef(paramMtx0_));
         EXPECT_CALL(dm0_, slot()).WillRepeatedly(::testing::Return(0));
         EXPECT_CALL(dm1_, mutex()).WillRepeatedly(::testing::ReturnRef(mtx1_));
+        EXPECT_CALL(dm1_, paramMutex(::testing::_)).WillRepeatedly(::testing::ReturnRef(paramMtx1_));
         EXPECT_CALL(dm1_, slot()).WillRepeatedly(::testing::Return(1));
         EXPECT_CALL(service_, authorizationEnabled()).WillRepeatedly(::testing::Invoke([this](){ return authzEnabled_; }));
 
@@ -168,8 +170,10 @@ class GRPCTest : public ::testing::Test {
     grpc::ServerBuilder builder_;
     std::unique_ptr<grpc::Server> server_ = nullptr;
     MockServiceImpl service_;
-    std::mutex mtx0_;
-    std::mutex mtx1_;
+    std::shared_mutex mtx0_;
+    std::shared_mutex mtx1_;
+    std::shared_mutex paramMtx0_;
+    std::shared_mutex paramMtx1_;
     MockDevice dm0_;
     MockDevice dm1_;
     SlotMap dms_ = {{0, &dm0_}, {1, &dm1_}};
@@ -99,15 +99,18 @@ class gRPCConnectTests : public GRPCTest {
             if (!testCall_) {
                 testCall_.swap(asyncCall_);
             }
+            // The wake alarm has its own tag, everything else goes to the calls.
+            bool wake = testCall_ && ignored_tag != asyncCall_.get() && ignored_tag != testCall_.get();
             // asyncCall_ emits the shutdown signal.
-            if (asyncCall_ && !ok) {
+            if (asyncCall_ && !ok && !wake) {
                 EXPECT_CALL(service_, deregisterItem(asyncCall_.get()))
                     .WillOnce(::testing::Invoke([this] { asyncCall_.reset(nullptr); }));
                 asyncCall_->proceed(ok);
             // testCall_ proceed assigned to thread to avoid blocking asyncCall_.
             } else if (testCall_) {
                 if (testThread) { testThread->join(); }
-                testThread = std::make_unique<std::thread>([&]{ testCall_->proceed(ok); });
+                ICallData* call = wake ? static_cast<ICallData*>(ignored_tag) : testCall_.get();
+                testThread = std::make_unique<std::thread>([call, ok]{ call->proceed(ok); });
             }
         }
         // Make sure the testCall is completely finished before continuing.
@@ -506,3 +509,39 @@ TEST_F(gRPCConnectTests, Connect_InvalidRequestStart) {
     // Test with too large of a value
     testRPCTimestamps(std::string(20, '1'), DEFAULT_REQUEST_START);
 }
+
+/*
+ * TEST 11 - Testing Connect writing a burst of updates queued while parked.
+ */
+TEST_F(gRPCConnectTests, Connect_UpdateBurst) {
+    constexpr uint32_t kUpdates = 8;
+    std::vector<std::unique_ptr<MockParam>> params;
+    initPayload("en", st2138::Device_DetailLevel::Device_DetailLevel_FULL, "");
+    // Setting expectations
+    for (uint32_t i = 0; i < kUpdates; i++) {
+        std::string value = "value" + std::to_string(i);
+        expPushValue(0, "oid" + std::to_string(i), value);
+        params.push_back(std::make_unique<MockParam>());
+        EXPECT_CALL(*params.back(), getScope()).WillRepeatedly(
+            testing::ReturnRefOfCopy(Scopes().getForwardMap().at(Scopes_e::kUndefined)));
+        EXPECT_CALL(*params.back(), toProto(testing::An<st2138::Value&>(), testing::_)).Times(1)
+            .WillOnce(testing::Invoke([value](st2138::Value& dst, const IAuthorizer& authz) {
+                dst.set_string_value(value);
+                return catena::exception_with_status("", catena::StatusCode::OK);
+            }));
+    }
+    // Making call
+    streamReader_ = std::make_unique<StreamReader>(&outVals_, &outRc_, true);
+    streamReader_->MakeCall(&clientContext_, &inVal_, [this](auto ctx, auto payload, auto reactor) {
+        client_->async()->Connect(ctx, payload, reactor);
+    });
+    streamReader_->Await();
+    // Emitting without waiting so updates queue up behind the first write.
+    for (uint32_t i = 0; i < kUpdates; i++) {
+        dm0_.getValueSetByClient().emit("oid" + std::to_string(i), params[i].get());
+    }
+    while (outVals_.size() < kUpdates + 1) {
+        streamReader_->Await();
+    }
+    testRPC();
+}
@@ -184,19 +184,19 @@ TEST_F(gRPCDeviceRequestTests, DeviceRequest_Normal) {
     initExpVal(6);
     // Setting expectations
     EXPECT_CALL(dm0_, getComponentSerializer(::testing::_, ::testing::_, inVal_.detail_level(), true)).Times(1)
-        .WillOnce(::testing::Invoke([this](const IAuthorizer &authz, const std::set<std::string> &subscribedOids, st2138::Device_DetailLevel dl, bool shallow){
+        .WillOnce(::testing::Invoke([this](const IAuthorizer &authz, const SubscribedOids &subscribedOids, st2138::Device_DetailLevel dl, bool shallow){
             // Making sure the correct values were passed in
             EXPECT_EQ(!authzEnabled_, &authz == &Authorizer::kAuthzDisabled);
             EXPECT_TRUE(subscribedOids.empty());
             return std::move(mockSerializer_);
         }));
     EXPECT_CALL(*mockSerializer_, getNext()).Times(6)
-        .WillOnce(::testing::Return(expVals_[0]))
-        .WillOnce(::testing::Return(expVals_[1]))
-        .WillOnce(::testing::Return(expVals_[2]))
-        .WillOnce(::testing::Return(expVals_[3]))
-        .WillOnce(::testing::Return(expVals_[4]))
-        .WillOnce(::testing::Return(expVals_[5]));
+        .WillOnce(::testing::ReturnRef(expVals_[0]))
+        .WillOnce(::testing::ReturnRef(expVals_[1]))
+        .WillOnce(::testing::ReturnRef(expVals_[2]))
+        .WillOnce(::testing::ReturnRef(expVals_[3]))
+        .WillOnce(::testing::ReturnRef(expVals_[4]))
+        .WillOnce(::testing::ReturnRef(expVals_[5]));
     EXPECT_CALL(*mockSerializer_, hasMore()).Times(6)
         .WillOnce(::testing::Return(true))
         .WillOnce(::testing::Return(true))
@@ -219,24 +219,24 @@ TEST_F(gRPCDeviceRequestTests, DeviceRequest_Subscriptions) {
     // Setting expectations
     EXPECT_CALL(service_, getSubscriptionManager()).WillRepeatedly(::testing::ReturnRef(mockSubManager));
     for (auto oid : subscribedTestOids) {
-        EXPECT_CALL(mockSubManager, addSubscription(oid, ::testing::_, ::testing::_, ::testing::_)).Times(1).WillOnce(::testing::Invoke(
-        [this](const std::string &oid, catena::common::IDevice &dm, catena::exception_with_status &rc, const IAuthorizer &authz){
+        EXPECT_CALL(mockSubManager, addSubscription(oid, ::testing::_, ::testing::_, ::testing::_, ::testing::_)).Times(1).WillOnce(::testing::Invoke(
+        [this](const std::string &oid, catena::common::IDevice &dm, catena::exception_with_status &rc, const IAuthorizer &authz, const std::string& scope){
             // Making sure the correct values were passed in
             EXPECT_EQ(!authzEnabled_, &authz == &Authorizer::kAuthzDisabled);
             EXPECT_EQ(&dm, &dm0_);
             return true;
         }));
     }
-    EXPECT_CALL(mockSubManager, getAllSubscribedOids(::testing::_)).Times(1).WillOnce(::testing::Return(subscribedTestOids));
+    EXPECT_CALL(mockSubManager, getAllSubscribedOids(::testing::_, ::testing::_)).Times(1).WillOnce(::testing::Return(subscribedTestOids));
     EXPECT_CALL(dm0_, getComponentSerializer(::testing::_, ::testing::_, inVal_.detail_level(), true)).Times(1)
-        .WillOnce(::testing::Invoke([this, &subscribedTestOids](const IAuthorizer &authz, const std::set<std::string> &subscribedOids, st2138::Device_DetailLevel dl, bool shallow){
+        .WillOnce(::testing::Invoke([this, &subscribedTestOids](const IAuthorizer &authz, const SubscribedOids &subscribedOids, st2138::Device_DetailLevel dl, bool shallow){
             // Making sure the correct values were passed in
             EXPECT_EQ(!authzEnabled_, &authz == &Authorizer::kAuthzDisabled);
-            EXPECT_EQ(subscribedOids, subscribedTestOids);
+            EXPECT_EQ(std::set<std::string>(subscribedOids.begin(), subscribedOids.end()), subscribedTestOids);
             return std::move(mockSerializer_);
         }));
     EXPECT_CALL(dm1_, getComponentSerializer(::testing::_, ::testing::_, ::testing::_, ::testing::_)).Times(0);
-    EXPECT_CALL(*mockSerializer_, getNext()).Times(1).WillOnce(::testing::Return(expVals_[0]));
+    EXPECT_CALL(*mockSerializer_, getNext()).Times(1).WillOnce(::testing::ReturnRef(expVals_[0]));
     EXPECT_CALL(*mockSerializer_, hasMore()).Times(1).WillOnce(::testing::Return(false));
     // Sending the RPC
     testRPC();
@@ -251,19 +251,19 @@ TEST_F(gRPCDeviceRequestTests, DeviceRequest_NullSlotCase) {
     initExpVal(6);
     // Setting expectations
     EXPECT_CALL(dm0_, getComponentSerializer(::testing::_, ::testing::_, inVal_.detail_level(), true)).Times(1)
-        .WillOnce(::testing::Invoke([this](const IAuthorizer &authz, const std::set<std::string> &subscribedOids, st2138::Device_DetailLevel dl, bool shallow){
+        .WillOnce(::testing::Invoke([this](const IAuthorizer &authz, const SubscribedOids &subscribedOids, st2138::Device_DetailLevel dl, bool shallow){
             // Making sure the correct values were passed in
             EXPECT_EQ(!authzEnabled_, &authz == &Authorizer::kAuthzDisabled);
             EXPECT_TRUE(subscribedOids.empty());
             return std::move(mockSerializer_);
         }));
     EXPECT_CALL(*mockSerializer_, getNext()).Times(6)
-        .WillOnce(::testing::Return(expVals_[0]))
-        .WillOnce(::testing::Return(expVals_[1]))
-        .WillOnce(::testing::Return(expVals_[2]))
-        .WillOnce(::testing::Return(expVals_[3]))
-        .WillOnce(::testing::Return(expVals_[4]))
-        .WillOnce(::testing::Return(expVals_[5]));
+        .WillOnce(::testing::ReturnRef(expVals_[0]))
+        .WillOnce(::testing::ReturnRef(expVals_[1]))
+        .WillOnce(::testing::ReturnRef(expVals_[2]))
+        .WillOnce(::testing::ReturnRef(expVals_[3]))
+        .WillOnce(::testing::ReturnRef(expVals_[4]))
+        .WillOnce(::testing::ReturnRef(expVals_[5]));
     EXPECT_CALL(*mockSerializer_, hasMore()).Times(6)
         .WillOnce(::testing::Return(true))
         .WillOnce(::testing::Return(true))
@@ -287,14 +287,14 @@ TEST_F(gRPCDeviceRequestTests, DeviceRequest_AuthzValid) {
     clientContext_.AddMetadata("authorization", "Bearer " + mockToken);
     // Setting expectations
     EXPECT_CALL(dm0_, getComponentSerializer(::testing::_, ::testing::_, inVal_.detail_level(), true)).Times(1)
-        .WillOnce(::testing::Invoke([this](const IAuthorizer &authz, const std::set<std::string> &subscribedOids, st2138::Device_DetailLevel dl, bool shallow){
+        .WillOnce(::testing::Invoke([this](const IAuthorizer &authz, const SubscribedOids &subscribedOids, st2138::Device_DetailLevel dl, bool shallow){
             // Making sure the correct values were passed in.
             EXPECT_EQ(!authzEnabled_, &authz == &Authorizer::kAuthzDisabled);
             EXPECT_TRUE(subscribedOids.empty());
             return std::move(mockSerializer_);
         }));
     EXPECT_CALL(dm1_, getComponentSerializer(::testing::_, ::testing::_, ::testing::_, ::testing::_)).Times(0);
-    EXPECT_CALL(*mockSerializer_, getNext()).Times(1).WillOnce(::testing::Return(expVals_[0]));
+    EXPECT_CALL(*mockSerializer_, getNext()).Times(1).WillOnce(::testing::ReturnRef(expVals_[0]));
     EXPECT_CALL(*mockSerializer_, hasMore()).Times(1).WillOnce(::testing::Return(false));
     // Sending the RPC
     testRPC();
@@ -361,7 +361,7 @@ TEST_F(gRPCDeviceRequestTests, DeviceRequest_ErrGetSerializerThrowCatena) {
     expRc_ = catena::exception_with_status("Component not found", catena::StatusCode::INVALID_ARGUMENT);
     // Setting expectations
     EXPECT_CALL(dm0_, getComponentSerializer(::testing::_, ::testing::_, ::testing::_, ::testing::_)).Times(1)
-        .WillOnce(::testing::Invoke([this](const IAuthorizer &authz, const std::set<std::string> &subscribedOids, st2138::Device_DetailLevel dl, bool shallow){
+        .WillOnce(::testing::Invoke([this](const IAuthorizer &authz, const SubscribedOids &subscribedOids, st2138::Device_DetailLevel dl, bool shallow){
             throw catena::exception_with_status(expRc_.what(), expRc_.status);
             return nullptr;
         }));
@@ -395,9 +395,9 @@ TEST_F(gRPCDeviceRequestTests, DeviceRequest_ErrGetNextThrowCatena) {
     EXPECT_CALL(dm1_, getComponentSerializer(::testing::_, ::testing::_, ::testing::_, ::testing::_)).Times(0);
     // Reading 2 components successfully before throwing an exception.
     EXPECT_CALL(*mockSerializer_, getNext()).Times(3)
-        .WillOnce(::testing::Return(expVals_[0]))
-        .WillOnce(::testing::Return(expVals_[1]))
-        .WillOnce(::testing::Invoke([this](){
+        .WillOnce(::testing::ReturnRef(expVals_[0]))
+        .WillOnce(::testing::ReturnRef(expVals_[1]))
+        .WillOnce(::testing::Invoke([this]() -> const st2138::DeviceComponent& {
             throw catena::exception_with_status(expRc_.what(), expRc_.status);
             return expVals_[1]; // Should not recieve
         }));
@@ -418,8 +418,8 @@ TEST_F(gRPCDeviceRequestTests, DeviceRequest_ErrGetNextThrowUnknown) {
     EXPECT_CALL(dm1_, getComponentSerializer(::testing::_, ::testing::_, ::testing::_, ::testing::_)).Times(0);
     // Reading 2 components successfully before throwing an exception.
     EXPECT_CALL(*mockSerializer_, getNext()).Times(3)
-        .WillOnce(::testing::Return(expVals_[0]))
-        .WillOnce(::testing::Return(expVals_[1]))
+        .WillOnce(::testing::ReturnRef(expVals_[0]))
+        .WillOnce(::testing::ReturnRef(expVals_[1]))
         .WillOnce(::testing::Throw(std::runtime_error(expRc_.what())));
     EXPECT_CALL(*mockSerializer_, hasMore()).Times(2).WillRepeatedly(::testing::Return(true));
     // Sending the RPC
@@ -46,6 +46,10 @@
 
 // gRPC
 #include "controllers/ExecuteCommand.h"
+#include <grpcpp/alarm.h>
+
+// std
+#include <future>
 
 using namespace catena::common;
 using namespace catena::gRPC;
@@ -66,6 +70,38 @@ class gRPCExecuteCommandTests : public GRPCTest {
      */
     void makeOne() override { new ExecuteCommand(&service_, dms_, true); }
 
+    /*
+     * Overriding processEvents to send alarms to their own tags.
+     */
+    void processEvents() override {
+        void* tag;
+        bool ok;
+        while (cq_->Next(&tag, &ok)) {
+            if (!testCall_) {
+                testCall_.swap(asyncCall_);
+            }
+            // The response alarm has its own tag, everything else goes to the calls.
+            if (testCall_ && tag != asyncCall_.get() && tag != testCall_.get()) {
+                static_cast<ICallData*>(tag)->proceed(ok);
+            } else if (testCall_) {
+                testCall_->proceed(ok);
+            }
+        }
+    }
+
+    /*
+     * Completion queue tag which signals once the poller reaches it.
+     */
+    class ProbeTag : public ICallData {
+      public:
+        void proceed(bool ok) override { reached.set_value(); }
+        std::promise<void> reached;
+
+      protected:
+        std::string jwsToken_() const override { return ""; }
+        void processTimestamps_() override {}
+    };
+
     /*
      * This is a test class which makes an async RPC to the MockServer on
      * construction and compares the streamed-back response.
@@ -655,3 +691,34 @@ TEST_F(gRPCExecuteCommandTests, ExecuteCommand_InvalidRequestStart) {
     // Test with too large of a value
     testRPCTimestamps(std::string(20, '1'), DEFAULT_REQUEST_START);
 }
+
+/*
+ * TEST 23 - The command runs off the completion queue thread, which keeps
+ *           processing events while the command blocks.
+ */
+TEST_F(gRPCExecuteCommandTests, ExecuteCommand_BlockingCommand) {
+    initPayload(0, "test_command", "test_value", true);
+    expResponse("test_response_1");
+    // Setting expectations
+    EXPECT_CALL(dm0_, getCommand(inVal_.oid(), ::testing::_, ::testing::_)).Times(1)
+        .WillOnce(::testing::Invoke([this](const std::string& oid, catena::exception_with_status& status, const IAuthorizer& authz) {
+            return std::move(mockCommand_);
+        }));
+    EXPECT_CALL(*mockCommand_, executeCommand(::testing::_, ::testing::_, ::testing::_, ::testing::_)).Times(1)
+        .WillOnce(::testing::Invoke([this](const st2138::Value& value, const bool respond, catena::exception_with_status& status, const IAuthorizer& authz) {
+            EXPECT_NE(std::this_thread::get_id(), cqthread_->get_id());
+            return std::move(mockResponder_);
+        }));
+    EXPECT_CALL(*mockResponder_, getNext()).Times(1).WillOnce(::testing::Invoke([this]() {
+        EXPECT_NE(std::this_thread::get_id(), cqthread_->get_id());
+        // Another event is processed while the command is still running.
+        ProbeTag probe;
+        grpc::Alarm alarm;
+        alarm.Set(cq_.get(), gpr_now(GPR_CLOCK_MONOTONIC), static_cast<ICallData*>(&probe));
+        EXPECT_EQ(probe.reached.get_future().wait_for(std::chrono::seconds(5)), std::future_status::ready);
+        return expVals_[0];
+    }));
+    EXPECT_CALL(*mockResponder_, hasMore()).Times(1).WillOnce(::testing::Return(false));
+    // Sending the RPC
+    testRPC();
+}
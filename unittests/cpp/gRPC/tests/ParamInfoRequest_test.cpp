@@ -178,7 +178,7 @@ TEST_F(gRPCParamInfoRequestTests, ParamInfoRequest_AuthzValid) {
     EXPECT_CALL(dm0_, getParam(testing::An<const std::string&>(), testing::_, testing::_))
        .WillRepeatedly(testing::Invoke([&param](const std::string&, catena::exception_with_status &status, const IAuthorizer &) {
             status = catena::exception_with_status("", catena::StatusCode::OK);
-            return std::move(param);
+            return borrowParam(*param);
         }));
     
     testRPC();
@@ -238,11 +238,7 @@ TEST_F(gRPCParamInfoRequestTests, ParamInfoRequest_getTopLevelParams) {
     expVals_.back().mutable_info()->set_type(st2138::ParamType::STRING);
 
     // Setup mock expectations
-    EXPECT_CALL(dm0_, getTopLevelParams(testing::_, testing::_))
-        .WillOnce(testing::Invoke([&top_level_params](catena::exception_with_status& status, const IAuthorizer&) -> std::vector<std::unique_ptr<IParam>> {
-            status = catena::exception_with_status("", catena::StatusCode::OK);
-            return std::move(top_level_params);
-        }));
+    serveTopLevelParams(dm0_, top_level_params);
 
     // Verify the call completed successfully
     testRPC();
@@ -266,11 +262,7 @@ TEST_F(gRPCParamInfoRequestTests, ParamInfoRequest_getTopLevelParamsWithArray) {
     expVals_.back().set_array_length(5);
 
     // Setup mock expectations
-    EXPECT_CALL(dm0_, getTopLevelParams(testing::_, testing::_))
-        .WillOnce(testing::Invoke([&top_level_params](catena::exception_with_status& status, const IAuthorizer&) {
-            status = catena::exception_with_status("", catena::StatusCode::OK);
-            return std::move(top_level_params);
-        }));
+    serveTopLevelParams(dm0_, top_level_params);
 
     testRPC();
 }
@@ -305,15 +297,11 @@ TEST_F(gRPCParamInfoRequestTests, ParamInfoRequest_NormalCaseNull) {
     expVals_.back().mutable_info()->set_oid("param2");
     expVals_.back().mutable_info()->set_type(st2138::ParamType::STRING);
 
-    // Setup mock expectations
-    EXPECT_CALL(dm0_, getTopLevelParams(testing::_, testing::_))
-        .WillOnce(testing::Invoke([&top_level_params](catena::exception_with_status& status, const IAuthorizer&) -> std::vector<std::unique_ptr<IParam>> {
-            status = catena::exception_with_status("", catena::StatusCode::OK);
-            return std::move(top_level_params);
-        }));
-
     inVal_.clear_slot();
 
+    // Setup mock expectations
+    serveTopLevelParams(dm0_, top_level_params);
+
     // Verify the call completed successfully
     testRPC();
 }
@@ -383,11 +371,7 @@ TEST_F(gRPCParamInfoRequestTests, ParamInfoRequest_getTopLevelParamsThrow) {
     top_level_params.push_back(std::move(param2));
 
     // Setup mock expectations
-    EXPECT_CALL(dm0_, getTopLevelParams(testing::_, testing::_))
-        .WillOnce(testing::Invoke([&top_level_params](catena::exception_with_status& status, const IAuthorizer&) {
-            status = catena::exception_with_status("", catena::StatusCode::OK);
-            return std::move(top_level_params);
-        }));
+    serveTopLevelParams(dm0_, top_level_params);
 
     testRPC();
 }
@@ -425,9 +409,11 @@ TEST_F(gRPCParamInfoRequestTests, ParamInfoRequest_getTopLevelParamsWithDeepNest
 
     auto level1 = std::make_unique<MockParam>();
     setupMockParamInfo(*level1, level1_info_struct, *level1Desc.descriptor);
+    resolveChildrenFromDevice(*level1, level1Oid, dm0_);
 
     auto level2 = std::make_unique<MockParam>();
     setupMockParamInfo(*level2, level2_info_struct, *level2Desc.descriptor);
+    resolveChildrenFromDevice(*level2, level2Oid, dm0_);
 
     auto level3 = std::make_unique<MockParam>();
     setupMockParamInfo(*level3, level3_info_struct, *level3Desc.descriptor);
@@ -451,13 +437,6 @@ TEST_F(gRPCParamInfoRequestTests, ParamInfoRequest_getTopLevelParamsWithDeepNest
     expVals_.back().mutable_info()->set_oid("level3");
     expVals_.back().mutable_info()->set_type(st2138::ParamType::STRING);
 
-    // Setup mock expectations
-    EXPECT_CALL(dm0_, getTopLevelParams(testing::_, testing::_))
-        .WillOnce(testing::Invoke([&top_level_params](catena::exception_with_status& status, const IAuthorizer&) {
-            status = catena::exception_with_status("", catena::StatusCode::OK);
-            return std::move(top_level_params);
-        }));
-
     // Setup mock expectations for getParam to handle child traversal
     EXPECT_CALL(dm0_, getParam(testing::An<const std::string&>(), testing::An<catena::exception_with_status&>(), testing::An<const IAuthorizer&>()))
         .WillRepeatedly(testing::Invoke(
@@ -467,16 +446,19 @@ TEST_F(gRPCParamInfoRequestTests, ParamInfoRequest_getTopLevelParamsWithDeepNest
                 std::string level3Oid = level3Desc.descriptor->getOid();
                 if (fqoid == level2Oid) {
                     status = catena::exception_with_status("", catena::StatusCode::OK);
-                    return std::move(level2);
+                    return borrowParam(*level2);
                 } else if (fqoid == level3Oid) {
                     status = catena::exception_with_status("", catena::StatusCode::OK);
-                    return std::move(level3);
+                    return borrowParam(*level3);
                 }
                 status = catena::exception_with_status("Parameter not found", catena::StatusCode::NOT_FOUND);
                 return nullptr;
             }
         ));
 
+    // Serve the top-level params after any broader getParam expectation
+    serveTopLevelParams(dm0_, top_level_params);
+
     testRPC();
 }
 
@@ -508,6 +490,7 @@ TEST_F(gRPCParamInfoRequestTests, ParamInfoRequest_getTopLevelParamsWithRecursio
     // Create mock params using helpers
     auto parentParam = std::make_unique<MockParam>();
     setupMockParamInfo(*parentParam, parent_info, *parentDesc.descriptor);
+    resolveChildrenFromDevice(*parentParam, parentOid, dm0_);
 
     auto arrayChild = std::make_unique<MockParam>();
     setupMockParamInfo(*arrayChild, arrayChild_info, *childDesc.descriptor);
@@ -530,25 +513,21 @@ TEST_F(gRPCParamInfoRequestTests, ParamInfoRequest_getTopLevelParamsWithRecursio
     expVals_.back().mutable_info()->set_type(st2138::ParamType::STRING_ARRAY);
     expVals_.back().set_array_length(3);
 
-    // Setup mock expectations for getTopLevelParams
-    EXPECT_CALL(dm0_, getTopLevelParams(testing::_, testing::_))
-        .WillOnce(testing::Invoke([&top_level_params](catena::exception_with_status& status, const IAuthorizer&) {
-            status = catena::exception_with_status("", catena::StatusCode::OK);
-            return std::move(top_level_params);
-        }));
-
     // Setup mock expectations for getParam to handle child traversal
     EXPECT_CALL(dm0_, getParam(testing::An<const std::string&>(), testing::An<catena::exception_with_status&>(), testing::An<const IAuthorizer&>()))
         .WillRepeatedly(testing::Invoke([this, &arrayChild, childOid, arrayChild_info, childDesc]
             (const std::string& fqoid, catena::exception_with_status& status, const IAuthorizer&) -> std::unique_ptr<IParam> {
                 if (fqoid == childOid) {
                     status = catena::exception_with_status("", catena::StatusCode::OK);
-                    return std::move(arrayChild);
+                    return borrowParam(*arrayChild);
                 }
                 status = catena::exception_with_status("Parameter not found", catena::StatusCode::NOT_FOUND);
                 return nullptr;
             }));
 
+    // Serve the top-level params after any broader getParam expectation
+    serveTopLevelParams(dm0_, top_level_params);
+
     testRPC();
 }
 
@@ -584,6 +563,7 @@ TEST_F(gRPCParamInfoRequestTests, ParamInfoRequest_getTopLevelParamsWithRecursio
 
     auto parentParam = std::make_unique<MockParam>();
     setupMockParamInfo(*parentParam, parent_info_struct, *parentDesc.descriptor);
+    resolveChildrenFromDevice(*parentParam, parentOid, dm0_);
 
     // For the error child, set up a param that throws in toProto
     auto errorChild = std::make_unique<MockParam>();
@@ -600,25 +580,21 @@ TEST_F(gRPCParamInfoRequestTests, ParamInfoRequest_getTopLevelParamsWithRecursio
     // Enable recursion by setting it in the request payload
     initPayload(0, "", true);
 
-    // Setup mock expectations for getTopLevelParams
-    EXPECT_CALL(dm0_, getTopLevelParams(testing::_, testing::_))
-        .WillOnce(testing::Invoke([&top_level_params](catena::exception_with_status& status, const IAuthorizer&) {
-            status = catena::exception_with_status("", catena::StatusCode::OK);
-            return std::move(top_level_params);
-        }));
-
     // Setup mock expectations for getParam to handle child traversal
     EXPECT_CALL(dm0_, getParam(testing::An<const std::string&>(), testing::An<catena::exception_with_status&>(), testing::An<const IAuthorizer&>()))
         .WillRepeatedly(testing::Invoke([&errorChild, childOid]
             (const std::string& fqoid, catena::exception_with_status& status, const IAuthorizer&) -> std::unique_ptr<IParam> {
                 if (fqoid == childOid) {
                     status = catena::exception_with_status("", catena::StatusCode::OK);
-                    return std::move(errorChild);
+                    return borrowParam(*errorChild);
                 }
                 status = catena::exception_with_status("Parameter not found", catena::StatusCode::NOT_FOUND);
                 return nullptr;
             }));
 
+    // Serve the top-level params after any broader getParam expectation
+    serveTopLevelParams(dm0_, top_level_params);
+
     testRPC();
 }
 
@@ -662,10 +638,10 @@ TEST_F(gRPCParamInfoRequestTests, ParamInfoRequest_proceedSpecificParam) {
 
     // Setup mock expectations for mode 2 (specific parameter)
     EXPECT_CALL(dm0_, getParam(fqoid, testing::_, testing::_))
-        .WillOnce(testing::Invoke(
+        .WillRepeatedly(testing::Invoke(
             [&mockParam](const std::string&, catena::exception_with_status& status, const IAuthorizer&) {
                 status = catena::exception_with_status("", catena::StatusCode::OK);
-                return std::move(mockParam);
+                return borrowParam(*mockParam);
             }
         ));
     
@@ -711,10 +687,10 @@ TEST_F(gRPCParamInfoRequestTests, ParamInfoRequest_getSpecificParamWithRecursion
 
     // Setup mock expectations
     EXPECT_CALL(dm0_, getParam(fqoid, testing::_, testing::_))
-        .WillOnce(testing::Invoke(
+        .WillRepeatedly(testing::Invoke(
             [&mockParam](const std::string&, catena::exception_with_status& status, const IAuthorizer&) {
                 status = catena::exception_with_status("", catena::StatusCode::OK);
-                return std::move(mockParam);
+                return borrowParam(*mockParam);
             }
         ));
 
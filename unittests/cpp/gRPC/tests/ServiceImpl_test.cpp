@@ -205,3 +205,34 @@ TEST(gRPCServiceImplTests_NoFixture, ServiceImpl_CreateDuplicateSlot) {
     // Creating a service with a duplicate slot.
     EXPECT_THROW(ServiceImpl service = ServiceImpl{config}, std::runtime_error) << "Creating a service with two devices sharing a slot should throw an error.";
 }
+
+/*
+ * TEST 5 - Creating a ServiceImpl with a set number of threads, and with the
+ * default of one per hardware thread.
+ */
+TEST(gRPCServiceImplTests_NoFixture, ServiceImpl_Threads) {
+    grpc::ServerBuilder builder;
+    builder.AddListeningPort("0.0.0.0:0", grpc::InsecureServerCredentials());
+    auto cq = builder.AddCompletionQueue();
+    ServiceConfig config = ServiceConfig().set_cq(cq.get()).set_threads(3);
+    EXPECT_EQ(config.threads, 3);
+    EXPECT_EQ(ServiceImpl(config).threads(), 3);
+    config.set_threads(0);
+    EXPECT_GE(ServiceImpl(config).threads(), 1);
+}
+
+/*
+ * TEST 6 - Events are processed by the pool and processEvents returns once
+ * the completion queue shuts down.
+ */
+TEST_F(gRPCServiceImplTests, ServiceImpl_ProcessEventsPool) {
+    EXPECT_GE(service_->threads(), 1);
+    // A unary call is handled by one of the pool threads.
+    grpc::ClientContext context;
+    st2138::Empty req;
+    st2138::SlotList res;
+    grpc::Status status = client_->GetPopulatedSlots(&context, req, &res);
+    EXPECT_TRUE(status.ok());
+    ASSERT_EQ(res.slots_size(), 1);
+    EXPECT_EQ(res.slots(0), 0);
+}
@@ -91,18 +91,18 @@ class gRPCUpdateSubscriptionsTests : public GRPCTest {
             
             // Set up default behavior for subscription manager
             EXPECT_CALL(service_, getSubscriptionManager()).WillRepeatedly(testing::ReturnRef(subManager_));
-            EXPECT_CALL(subManager_, getAllSubscribedOids(testing::Ref(dm0_))).WillRepeatedly(testing::Return(std::set<std::string>(testOids_.begin(), testOids_.end())));
+            EXPECT_CALL(subManager_, getAllSubscribedOids(testing::Ref(dm0_), testing::_)).WillRepeatedly(testing::Return(std::set<std::string>(testOids_.begin(), testOids_.end())));
             
             // Set up default expectations for subscription operations
             for (const auto& oid : testOids_) {
-                EXPECT_CALL(subManager_, addSubscription(oid, testing::Ref(dm0_), testing::_, testing::_)).WillRepeatedly(testing::Invoke(
-                    [this](const std::string& oid, catena::common::IDevice& dm, catena::exception_with_status& rc, const IAuthorizer& authz) -> bool {
+                EXPECT_CALL(subManager_, addSubscription(oid, testing::Ref(dm0_), testing::_, testing::_, testing::_)).WillRepeatedly(testing::Invoke(
+                    [this](const std::string& oid, catena::common::IDevice& dm, catena::exception_with_status& rc, const IAuthorizer& authz, const std::string& scope) -> bool {
                         addedOids_++;
                         rc = catena::exception_with_status("", catena::StatusCode::OK);
                         return true;
                     }));
-                EXPECT_CALL(subManager_, removeSubscription(oid, testing::Ref(dm0_), testing::_)).WillRepeatedly(testing::Invoke(
-                    [this](const std::string& oid, const catena::common::IDevice& dm, catena::exception_with_status& rc) -> bool {
+                EXPECT_CALL(subManager_, removeSubscription(oid, testing::Ref(dm0_), testing::_, testing::_)).WillRepeatedly(testing::Invoke(
+                    [this](const std::string& oid, const catena::common::IDevice& dm, catena::exception_with_status& rc, const std::string& scope) -> bool {
                         removedOids_++;
                         rc = catena::exception_with_status("", catena::StatusCode::OK);
                         return true;
@@ -238,8 +238,8 @@ TEST_F(gRPCUpdateSubscriptionsTests, UpdateSubscriptions_InvalidSlot) {
     expRc_ = catena::exception_with_status("device not found in slot " + std::to_string(dms_.size()), catena::StatusCode::NOT_FOUND);
     
     // Setting expectations - no subscription operations should happen for invalid slot
-    EXPECT_CALL(subManager_, addSubscription(testing::_, testing::_, testing::_, testing::_)).Times(0);
-    EXPECT_CALL(subManager_, removeSubscription(testing::_, testing::_, testing::_)).Times(0);
+    EXPECT_CALL(subManager_, addSubscription(testing::_, testing::_, testing::_, testing::_, testing::_)).Times(0);
+    EXPECT_CALL(subManager_, removeSubscription(testing::_, testing::_, testing::_, testing::_)).Times(0);
     
     // Calling proceed and testing the output
     testRPC();
@@ -261,14 +261,14 @@ TEST_F(gRPCUpdateSubscriptionsTests, UpdateSubscriptions_AddOnly) {
     initPayload(0, {"param1", "param2"}, {});
     
     // Setting expectations for add subscription operations
-    EXPECT_CALL(subManager_, addSubscription("param1", testing::Ref(dm0_), testing::_, testing::_)).WillOnce(testing::Invoke(
-        [this](const std::string& oid, catena::common::IDevice& dm, catena::exception_with_status& rc, const IAuthorizer& authz) -> bool {
+    EXPECT_CALL(subManager_, addSubscription("param1", testing::Ref(dm0_), testing::_, testing::_, testing::_)).WillOnce(testing::Invoke(
+        [this](const std::string& oid, catena::common::IDevice& dm, catena::exception_with_status& rc, const IAuthorizer& authz, const std::string& scope) -> bool {
             addedOids_++;
             rc = catena::exception_with_status("", catena::StatusCode::OK);
             return true;
         }));
-    EXPECT_CALL(subManager_, addSubscription("param2", testing::Ref(dm0_), testing::_, testing::_)).WillOnce(testing::Invoke(
-        [this](const std::string& oid, catena::common::IDevice& dm, catena::exception_with_status& rc, const IAuthorizer& authz) -> bool {
+    EXPECT_CALL(subManager_, addSubscription("param2", testing::Ref(dm0_), testing::_, testing::_, testing::_)).WillOnce(testing::Invoke(
+        [this](const std::string& oid, catena::common::IDevice& dm, catena::exception_with_status& rc, const IAuthorizer& authz, const std::string& scope) -> bool {
             addedOids_++;
             rc = catena::exception_with_status("", catena::StatusCode::OK);
             return true;
@@ -287,14 +287,14 @@ TEST_F(gRPCUpdateSubscriptionsTests, UpdateSubscriptions_RemoveOnly) {
     initPayload(0, {}, {"param1", "param2"});
     
     // Setting expectations for remove subscription operations
-    EXPECT_CALL(subManager_, removeSubscription("param1", testing::Ref(dm0_), testing::_)).WillOnce(testing::Invoke(
-        [this](const std::string& oid, const catena::common::IDevice& dm, catena::exception_with_status& rc) -> bool {
+    EXPECT_CALL(subManager_, removeSubscription("param1", testing::Ref(dm0_), testing::_, testing::_)).WillOnce(testing::Invoke(
+        [this](const std::string& oid, const catena::common::IDevice& dm, catena::exception_with_status& rc, const std::string& scope) -> bool {
             removedOids_++;
             rc = catena::exception_with_status("", catena::StatusCode::OK);
             return true;
         }));
-    EXPECT_CALL(subManager_, removeSubscription("param2", testing::Ref(dm0_), testing::_)).WillOnce(testing::Invoke(
-        [this](const std::string& oid, const catena::common::IDevice& dm, catena::exception_with_status& rc) -> bool {
+    EXPECT_CALL(subManager_, removeSubscription("param2", testing::Ref(dm0_), testing::_, testing::_)).WillOnce(testing::Invoke(
+        [this](const std::string& oid, const catena::common::IDevice& dm, catena::exception_with_status& rc, const std::string& scope) -> bool {
             removedOids_++;
             rc = catena::exception_with_status("", catena::StatusCode::OK);
             return true;
@@ -339,14 +339,14 @@ TEST_F(gRPCUpdateSubscriptionsTests, UpdateSubscriptions_NullSlotCase) {
     inVal_.clear_slot();
     
     // Setting expectations for add subscription operations
-    EXPECT_CALL(subManager_, addSubscription("param1", testing::Ref(dm0_), testing::_, testing::_)).WillOnce(testing::Invoke(
-        [this](const std::string& oid, catena::common::IDevice& dm, catena::exception_with_status& rc, const IAuthorizer& authz) -> bool {
+    EXPECT_CALL(subManager_, addSubscription("param1", testing::Ref(dm0_), testing::_, testing::_, testing::_)).WillOnce(testing::Invoke(
+        [this](const std::string& oid, catena::common::IDevice& dm, catena::exception_with_status& rc, const IAuthorizer& authz, const std::string& scope) -> bool {
             addedOids_++;
             rc = catena::exception_with_status("", catena::StatusCode::OK);
             return true;
         }));
-    EXPECT_CALL(subManager_, addSubscription("param2", testing::Ref(dm0_), testing::_, testing::_)).WillOnce(testing::Invoke(
-        [this](const std::string& oid, catena::common::IDevice& dm, catena::exception_with_status& rc, const IAuthorizer& authz) -> bool {
+    EXPECT_CALL(subManager_, addSubscription("param2", testing::Ref(dm0_), testing::_, testing::_, testing::_)).WillOnce(testing::Invoke(
+        [this](const std::string& oid, catena::common::IDevice& dm, catena::exception_with_status& rc, const IAuthorizer& authz, const std::string& scope) -> bool {
             addedOids_++;
             rc = catena::exception_with_status("", catena::StatusCode::OK);
             return true;
@@ -367,14 +367,28 @@ TEST_F(gRPCUpdateSubscriptionsTests, UpdateSubscriptions_NullSlotCase) {
  * 
  */
 
+// 1.6: Success Case - UpdateSubscriptions changes the scope of the Connect the client names.
+TEST_F(gRPCUpdateSubscriptionsTests, UpdateSubscriptions_ConnectionId) {
+    initPayload(0, {"param1"}, {"param2"});
+    clientContext_.AddMetadata(catena::gRPC::kConnectionIdKey, "0123456789abcdef0123456789abcdef");
+    const std::string scope = ISubscriptionManager::scopeKey("", "0123456789abcdef0123456789abcdef");
+
+    EXPECT_CALL(subManager_, addSubscription("param1", testing::Ref(dm0_), testing::_, testing::_, scope)).WillOnce(testing::Return(true));
+    EXPECT_CALL(subManager_, removeSubscription("param2", testing::Ref(dm0_), testing::_, scope)).WillOnce(testing::Return(true));
+    EXPECT_CALL(subManager_, getAllSubscribedOids(testing::Ref(dm0_), scope)).WillOnce(testing::Return(std::set<std::string>{}));
+
+    // Calling proceed and testing the output
+    testRPC();
+}
+
 // 2.1: Error Case - UpdateSubscriptions add subscription returns error.
 TEST_F(gRPCUpdateSubscriptionsTests, UpdateSubscriptions_AddReturnErr) {
     initPayload(0, {"errParam", "param1"}, {});
     expRc_ = catena::exception_with_status("Failed to add subscription", catena::StatusCode::INVALID_ARGUMENT);
     
     // Override the default expectation for errParam to throw an error.
-    EXPECT_CALL(subManager_, addSubscription("errParam", testing::_, testing::_, testing::_)).WillOnce(testing::Invoke(
-        [this](const std::string& oid, const catena::common::IDevice& dm, catena::exception_with_status& rc, const IAuthorizer& authz) {
+    EXPECT_CALL(subManager_, addSubscription("errParam", testing::_, testing::_, testing::_, testing::_)).WillOnce(testing::Invoke(
+        [this](const std::string& oid, const catena::common::IDevice& dm, catena::exception_with_status& rc, const IAuthorizer& authz, const std::string& scope) {
             // Simulating an error in adding subscription.
             throw catena::exception_with_status("Failed to add subscription", catena::StatusCode::INVALID_ARGUMENT);
             return false;
@@ -390,8 +404,8 @@ TEST_F(gRPCUpdateSubscriptionsTests, UpdateSubscriptions_RemoveReturnErr) {
     expRc_ = catena::exception_with_status("Failed to remove subscription", catena::StatusCode::INVALID_ARGUMENT);
     
     // Override the default expectation for errParam to throw an error.
-    EXPECT_CALL(subManager_, removeSubscription("errParam", testing::_, testing::_)).WillOnce(testing::Invoke(
-        [this](const std::string& oid, const catena::common::IDevice& dm, catena::exception_with_status& rc) {
+    EXPECT_CALL(subManager_, removeSubscription("errParam", testing::_, testing::_, testing::_)).WillOnce(testing::Invoke(
+        [this](const std::string& oid, const catena::common::IDevice& dm, catena::exception_with_status& rc, const std::string& scope) {
             // Simulating an error in removing subscription.
             throw catena::exception_with_status("Failed to remove subscription", catena::StatusCode::INVALID_ARGUMENT);
             return false;
@@ -407,8 +421,8 @@ TEST_F(gRPCUpdateSubscriptionsTests, UpdateSubscriptions_AddThrowCatena) {
     expRc_ = catena::exception_with_status("Failed to add subscription", catena::StatusCode::INVALID_ARGUMENT);
     
     // Setting expectations for errParam specifically.
-    EXPECT_CALL(subManager_, addSubscription("errParam", testing::_, testing::_, testing::_)).WillRepeatedly(testing::Invoke(
-        [this](const std::string& oid, const catena::common::IDevice& dm, catena::exception_with_status& rc, const IAuthorizer& authz) -> bool {
+    EXPECT_CALL(subManager_, addSubscription("errParam", testing::_, testing::_, testing::_, testing::_)).WillRepeatedly(testing::Invoke(
+        [this](const std::string& oid, const catena::common::IDevice& dm, catena::exception_with_status& rc, const IAuthorizer& authz, const std::string& scope) -> bool {
             // Simulating an error in adding subscription.
             throw catena::exception_with_status("Failed to add subscription", catena::StatusCode::INVALID_ARGUMENT);
             return false;
@@ -424,8 +438,8 @@ TEST_F(gRPCUpdateSubscriptionsTests, UpdateSubscriptions_RemoveThrowCatena) {
     expRc_ = catena::exception_with_status("Failed to remove subscription", catena::StatusCode::INVALID_ARGUMENT);
     
     // Setting expectations for errParam specifically.
-    EXPECT_CALL(subManager_, removeSubscription("errParam", testing::_, testing::_)).WillRepeatedly(testing::Invoke(
-        [this](const std::string& oid, const catena::common::IDevice& dm, catena::exception_with_status& rc) -> bool {
+    EXPECT_CALL(subManager_, removeSubscription("errParam", testing::_, testing::_, testing::_)).WillRepeatedly(testing::Invoke(
+        [this](const std::string& oid, const catena::common::IDevice& dm, catena::exception_with_status& rc, const std::string& scope) -> bool {
             // Simulating an error in removing subscription.
             throw catena::exception_with_status("Failed to remove subscription", catena::StatusCode::INVALID_ARGUMENT);
             return false;
@@ -441,7 +455,7 @@ TEST_F(gRPCUpdateSubscriptionsTests, UpdateSubscriptions_AddThrowUnknown) {
     expRc_ = catena::exception_with_status("Unknown error", catena::StatusCode::UNKNOWN);
     
     // Setting expectations for errParam specifically.
-    EXPECT_CALL(subManager_, addSubscription("errParam", testing::_, testing::_, testing::_))
+    EXPECT_CALL(subManager_, addSubscription("errParam", testing::_, testing::_, testing::_, testing::_))
         .WillRepeatedly(testing::Throw(std::runtime_error("Unknown error")));
     
     // Calling proceed and testing the output
@@ -454,13 +468,29 @@ TEST_F(gRPCUpdateSubscriptionsTests, UpdateSubscriptions_RemoveThrowUnknown) {
     expRc_ = catena::exception_with_status("Unknown error", catena::StatusCode::UNKNOWN);
     
     // Setting expectations for errParam specifically.
-    EXPECT_CALL(subManager_, removeSubscription("errParam", testing::_, testing::_))
+    EXPECT_CALL(subManager_, removeSubscription("errParam", testing::_, testing::_, testing::_))
         .WillRepeatedly(testing::Throw(std::runtime_error("Unknown error")));
     
     // Calling proceed and testing the output
     testRPC();
 }
 
+// 2.7: Error Case - UpdateSubscriptions for a Connect which is not open returns the error.
+TEST_F(gRPCUpdateSubscriptionsTests, UpdateSubscriptions_ScopeNotOpen) {
+    initPayload(0, {"param1", "param2"}, {});
+    expRc_ = catena::exception_with_status("No open connection for subscription scope", catena::StatusCode::FAILED_PRECONDITION);
+
+    EXPECT_CALL(subManager_, addSubscription("param1", testing::_, testing::_, testing::_, testing::_)).WillOnce(testing::Invoke(
+        [](const std::string& oid, catena::common::IDevice& dm, catena::exception_with_status& rc, const IAuthorizer& authz, const std::string& scope) {
+            rc = catena::exception_with_status("No open connection for subscription scope", catena::StatusCode::FAILED_PRECONDITION);
+            return false;
+        }));
+    EXPECT_CALL(subManager_, addSubscription("param2", testing::_, testing::_, testing::_, testing::_)).Times(0);
+
+    // Calling proceed and testing the output
+    testRPC();
+}
+
 /*
  * ============================================================================
  *                      3. Additional Authorization Tests
@@ -491,8 +521,8 @@ TEST_F(gRPCUpdateSubscriptionsTests, UpdateSubscriptions_AuthzInvalid) {
     // Setting expectations - should not call any device methods
     EXPECT_CALL(dm0_, getParam(testing::An<const std::string&>(), testing::_, testing::_)).Times(0);
     EXPECT_CALL(dm1_, getParam(testing::An<const std::string&>(), testing::_, testing::_)).Times(0);
-    EXPECT_CALL(subManager_, addSubscription(testing::An<const std::string&>(), testing::_, testing::_, testing::_)).Times(0);
-    EXPECT_CALL(subManager_, removeSubscription(testing::An<const std::string&>(), testing::_, testing::_)).Times(0);
+    EXPECT_CALL(subManager_, addSubscription(testing::An<const std::string&>(), testing::_, testing::_, testing::_, testing::_)).Times(0);
+    EXPECT_CALL(subManager_, removeSubscription(testing::An<const std::string&>(), testing::_, testing::_, testing::_)).Times(0);
     
     // Calling proceed and testing the output
     testRPC();
@@ -506,8 +536,8 @@ TEST_F(gRPCUpdateSubscriptionsTests, UpdateSubscriptions_SlotOutOfRange) {
     initPayload(65536, {"param1", "param2"}, {});
     expRc_ = catena::exception_with_status("slot number out of range", catena::StatusCode::INVALID_ARGUMENT);
     // Setting expectations - no subscription operations should happen for invalid slot
-    EXPECT_CALL(subManager_, addSubscription(testing::_, testing::_, testing::_, testing::_)).Times(0);
-    EXPECT_CALL(subManager_, removeSubscription(testing::_, testing::_, testing::_)).Times(0);
+    EXPECT_CALL(subManager_, addSubscription(testing::_, testing::_, testing::_, testing::_, testing::_)).Times(0);
+    EXPECT_CALL(subManager_, removeSubscription(testing::_, testing::_, testing::_, testing::_)).Times(0);
     
     // Calling proceed and testing the output
     testRPC();